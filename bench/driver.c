@@ -0,0 +1,27 @@
+// ベンチマークのドライバ
+//  カーネル(bench_run)をccでビルドしたこのドライバから呼び出し、
+//  rdtscで計測したサイクル数の最小値を出力する。
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+
+long bench_run(long n);
+
+int main(int argc, char** argv){
+    long n = argc > 1 ? atol(argv[1]) : 1;
+    int reps = argc > 2 ? atoi(argv[2]) : 5;
+
+    unsigned long long best = ~0ULL;
+    long result = 0;
+    for(int i = 0; i < reps; i++){
+        unsigned long long start = __rdtsc();
+        result = bench_run(n);
+        unsigned long long end = __rdtsc();
+        if(end - start < best){
+            best = end - start;
+        }
+    }
+
+    printf("%llu %ld\n", best, result);
+    return 0;
+}
@@ -0,0 +1,60 @@
+// 小さなアクセサ関数を多く呼び出す処理 (インライン展開できる呼び出し)
+#define N 2048
+
+struct Particle {
+    long x;
+    long y;
+    long vx;
+    long vy;
+};
+
+static long get_x(struct Particle* p){
+    return p->x;
+}
+
+static long get_y(struct Particle* p){
+    return p->y;
+}
+
+static void set_pos(struct Particle* p, long x, long y){
+    p->x = x;
+    p->y = y;
+}
+
+static inline long clamp(long v, long lo, long hi){
+    if(v < lo) return lo;
+    if(v > hi) return hi;
+    return v;
+}
+
+long abs_diff(long a, long b){
+    return a < b ? b - a : a - b;
+}
+
+static void step(struct Particle* p){
+    long x = clamp(get_x(p) + p->vx, 0, 65535);
+    long y = clamp(get_y(p) + p->vy, 0, 65535);
+    if(x == 0 || x == 65535) p->vx = -p->vx;
+    if(y == 0 || y == 65535) p->vy = -p->vy;
+    set_pos(p, x, y);
+}
+
+long bench_run(long n){
+    struct Particle ps[N];
+    long seed = 1;
+    for(int i = 0; i < N; i++){
+        seed = (seed * 1103515245 + 12345) & 2147483647;
+        set_pos(&ps[i], (seed >> 4) & 65535, (seed >> 8) & 65535);
+        ps[i].vx = (seed & 63) - 32;
+        ps[i].vy = ((seed >> 6) & 63) - 32;
+    }
+
+    long acc = 0;
+    for(long r = 0; r < n; r++){
+        for(int i = 0; i < N; i++){
+            step(&ps[i]);
+            acc = (acc + abs_diff(get_x(&ps[i]), get_y(&ps[i]))) & 1073741823;
+        }
+    }
+    return acc;
+}
@@ -0,0 +1,29 @@
+// 配列のチェックサム (Fletcher風)
+#define N 4099
+
+int checksum(int* data, int len){
+    int s1 = 0;
+    int s2 = 0;
+    for(int i = 0; i < len; i++){
+        s1 = (s1 + data[i]) & 65535;
+        s2 = (s2 + s1) & 65535;
+    }
+    return s2 * 65536 + s1;
+}
+
+long bench_run(long n){
+    int data[N];
+    long x = 1;
+    for(int i = 0; i < N; i++){
+        x = (x * 1103515245 + 12345) & 2147483647;
+        data[i] = (x >> 16) & 255;
+    }
+
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        for(int len = N - 3; len <= N; len++){
+            sum = (sum + checksum(data, len)) & 1073741823;
+        }
+    }
+    return sum;
+}
@@ -0,0 +1,108 @@
+// バイトコードインタプリタのループ
+#define OP_HALT     0
+#define OP_PUSH     1
+#define OP_ADD      2
+#define OP_SUB      3
+#define OP_MUL      4
+#define OP_DUP      5
+#define OP_SWAP     6
+#define OP_JNZ      7
+#define OP_POP      8
+#define OP_DEC      9
+#define OP_AND      10
+#define OP_OVER     11
+
+long run_vm(long* code, long* stack){
+    long pc = 0;
+    long sp = 0;
+    while(1){
+        long op = code[pc];
+        pc++;
+        switch(op){
+            case OP_HALT:
+                return stack[sp - 1];
+            case OP_PUSH:
+                stack[sp] = code[pc];
+                sp++;
+                pc++;
+                break;
+            case OP_ADD:
+                stack[sp - 2] = stack[sp - 2] + stack[sp - 1];
+                sp--;
+                break;
+            case OP_SUB:
+                stack[sp - 2] = stack[sp - 2] - stack[sp - 1];
+                sp--;
+                break;
+            case OP_MUL:
+                stack[sp - 2] = stack[sp - 2] * stack[sp - 1];
+                sp--;
+                break;
+            case OP_DUP:
+                stack[sp] = stack[sp - 1];
+                sp++;
+                break;
+            case OP_SWAP:
+            {
+                long t = stack[sp - 1];
+                stack[sp - 1] = stack[sp - 2];
+                stack[sp - 2] = t;
+                break;
+            }
+            case OP_JNZ:
+                sp--;
+                if(stack[sp]){
+                    pc = code[pc];
+                } else {
+                    pc++;
+                }
+                break;
+            case OP_POP:
+                sp--;
+                break;
+            case OP_DEC:
+                stack[sp - 1] = stack[sp - 1] - 1;
+                break;
+            case OP_AND:
+                stack[sp - 2] = stack[sp - 2] & stack[sp - 1];
+                sp--;
+                break;
+            case OP_OVER:
+                stack[sp] = stack[sp - 2];
+                sp++;
+                break;
+        }
+    }
+    return 0;
+}
+
+long bench_run(long n){
+    // acc = 0; cnt = 10000;
+    // do { acc = (acc * 3 + cnt) & 0xffff; cnt--; } while(cnt);
+    long code[64];
+    long stack[64];
+    long i = 0;
+    code[i++] = OP_PUSH; code[i++] = 0;
+    code[i++] = OP_PUSH; code[i++] = 10000;
+    // loop: [acc cnt]
+    long loop = i;
+    code[i++] = OP_SWAP;                            // [cnt acc]
+    code[i++] = OP_PUSH; code[i++] = 3;
+    code[i++] = OP_MUL;                             // [cnt acc*3]
+    code[i++] = OP_OVER;                            // [cnt acc*3 cnt]
+    code[i++] = OP_ADD;                             // [cnt acc']
+    code[i++] = OP_PUSH; code[i++] = 65535;
+    code[i++] = OP_AND;                             // [cnt acc']
+    code[i++] = OP_SWAP;                            // [acc' cnt]
+    code[i++] = OP_DEC;                             // [acc' cnt-1]
+    code[i++] = OP_DUP;
+    code[i++] = OP_JNZ; code[i++] = loop;
+    code[i++] = OP_POP;
+    code[i++] = OP_HALT;
+
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        sum += run_vm(code, stack);
+    }
+    return sum;
+}
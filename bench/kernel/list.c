@@ -0,0 +1,48 @@
+// 構造体の連結リスト走査
+#define N 8192
+
+struct ListNode {
+    long key;
+    long weight;
+    struct ListNode* next;
+    long pad;
+};
+
+long bench_run(long n){
+    struct ListNode list_pool[N];
+    long list_order[N];
+
+    // 疑似乱数順にノードをつなぐ
+    for(long i = 0; i < N; i++){
+        list_order[i] = i;
+    }
+    long x = 7;
+    for(long i = N - 1; i > 0; i--){
+        x = (x * 1103515245 + 12345) & 2147483647;
+        long j = x % (i + 1);
+        long t = list_order[i];
+        list_order[i] = list_order[j];
+        list_order[j] = t;
+    }
+    for(long i = 0; i < N; i++){
+        struct ListNode* node = &list_pool[list_order[i]];
+        node->key = i;
+        node->weight = (i * 7) % 13;
+        if(i + 1 < N){
+            node->next = &list_pool[list_order[i + 1]];
+        } else {
+            node->next = 0;
+        }
+    }
+
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        struct ListNode* p = &list_pool[list_order[0]];
+        while(p){
+            sum += p->key * p->weight;
+            p = p->next;
+        }
+        sum = sum & 1073741823;
+    }
+    return sum;
+}
@@ -0,0 +1,42 @@
+// 行列積 (N x N, 1次元配列で表現)
+#define N 48
+#define NN 2304
+
+long dot(long* a, long* b, long i, long j){
+    long acc = 0;
+    for(long k = 0; k < N; k++){
+        long x = a[i * N + k];
+        long y = b[k * N + j];
+        acc += x * y;
+    }
+    return acc;
+}
+
+void matmul(long* a, long* b, long* c){
+    for(long i = 0; i < N; i++){
+        for(long j = 0; j < N; j++){
+            long v = dot(a, b, i, j);
+            long idx = i * N + j;
+            c[idx] = v;
+        }
+    }
+}
+
+long bench_run(long n){
+    long mat_a[NN];
+    long mat_b[NN];
+    long mat_c[NN];
+    for(long t = 0; t < NN; t++){
+        long i = t / N;
+        long j = t % N;
+        mat_a[t] = i + j;
+        mat_b[t] = i - j;
+    }
+
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        matmul(mat_a, mat_b, mat_c);
+        sum += mat_c[r % NN];
+    }
+    return sum;
+}
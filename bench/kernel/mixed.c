@@ -0,0 +1,34 @@
+// 大きさの違うメンバーが混ざった構造体の配列を走査する処理 (メンバーのアラインメント)
+#define N 4096
+
+struct Record {
+    char tag;
+    long value;
+    short weight;
+    int count;
+};
+
+long bench_run(long n){
+    struct Record recs[N];
+    long seed = 3;
+    for(int i = 0; i < N; i++){
+        seed = (seed * 1103515245 + 12345) & 2147483647;
+        recs[i].tag = seed & 7;
+        recs[i].value = seed >> 3;
+        recs[i].weight = (seed >> 5) & 255;
+        recs[i].count = 0;
+    }
+
+    long acc = 0;
+    for(long r = 0; r < n; r++){
+        for(int i = 0; i < N; i++){
+            struct Record* p = &recs[i];
+            if(p->tag < 4){
+                p->value = p->value + p->weight;
+                p->count++;
+            }
+            acc = (acc + p->value + p->count) & 1073741823;
+        }
+    }
+    return acc;
+}
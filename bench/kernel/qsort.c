@@ -0,0 +1,39 @@
+// 再帰クイックソート
+#define N 20000
+
+void quick_sort(long* a, long lo, long hi){
+    if(lo >= hi){
+        return;
+    }
+    long pivot = a[(lo + hi) / 2];
+    long i = lo;
+    long j = hi;
+    while(i <= j){
+        while(a[i] < pivot) i++;
+        while(a[j] > pivot) j--;
+        if(i <= j){
+            long t = a[i];
+            a[i] = a[j];
+            a[j] = t;
+            i++;
+            j--;
+        }
+    }
+    quick_sort(a, lo, j);
+    quick_sort(a, i, hi);
+}
+
+long bench_run(long n){
+    long qs_data[N];
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        long x = r + 1;
+        for(long i = 0; i < N; i++){
+            x = (x * 1103515245 + 12345) & 2147483647;
+            qs_data[i] = x % 100000;
+        }
+        quick_sort(qs_data, 0, N - 1);
+        sum += qs_data[r % N] + qs_data[N / 2];
+    }
+    return sum;
+}
@@ -0,0 +1,46 @@
+// 末尾位置の再帰呼び出し (ループにできる再帰、相互再帰)
+#define N 4096
+
+long gcd(long a, long b){
+    if(b == 0) return a;
+    return gcd(b, a % b);
+}
+
+// 昇順の配列を二分探索する
+long search(long* data, long lo, long hi, long key){
+    if(lo >= hi) return -1;
+    long mid = (lo + hi) / 2;
+    if(data[mid] == key) return mid;
+    if(data[mid] < key) return search(data, mid + 1, hi, key);
+    return search(data, lo, mid, key);
+}
+
+long skip_odd(long* data, long i, long n, long acc);
+
+long skip_even(long* data, long i, long n, long acc){
+    if(i >= n) return acc;
+    return skip_odd(data, i + 1, n, acc + data[i]);
+}
+
+long skip_odd(long* data, long i, long n, long acc){
+    if(i >= n) return acc;
+    return skip_even(data, i + 1, n, acc ^ data[i]);
+}
+
+long bench_run(long n){
+    long data[N];
+    for(int i = 0; i < N; i++){
+        data[i] = i * 3 + 1;
+    }
+
+    long acc = 0;
+    for(long r = 0; r < n; r++){
+        for(int i = 0; i < N; i++){
+            acc += gcd(i * 7919 + r, 1234567);
+            acc += search(data, 0, N, i * 3 + (i & 1));
+        }
+        acc += skip_even(data, 0, N, r);
+        acc = acc & 1073741823;
+    }
+    return acc;
+}
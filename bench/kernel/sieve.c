@@ -0,0 +1,22 @@
+// エラトステネスのふるい
+#define N 65536
+
+long bench_run(long n){
+    char sieve_flag[N];
+    long count = 0;
+    for(long r = 0; r < n; r++){
+        for(long i = 0; i < N; i++){
+            sieve_flag[i] = 1;
+        }
+        count = 0;
+        for(long i = 2; i < N; i++){
+            if(sieve_flag[i]){
+                count++;
+                for(long j = i + i; j < N; j += i){
+                    sieve_flag[j] = 0;
+                }
+            }
+        }
+    }
+    return count;
+}
@@ -0,0 +1,29 @@
+// 文字列ハッシュ (FNV風)
+#define N 32768
+#define LEN 16
+
+long hash_str(char* s, long len){
+    long h = 216613626;
+    for(long i = 0; i < len; i++){
+        h = h ^ s[i];
+        h = (h * 16777619) & 1073741823;
+    }
+    return h;
+}
+
+long bench_run(long n){
+    char str_buf[N];
+    long x = 1;
+    for(long i = 0; i < N; i++){
+        x = (x * 1103515245 + 12345) & 2147483647;
+        str_buf[i] = 97 + (x >> 16) % 26;
+    }
+
+    long sum = 0;
+    for(long r = 0; r < n; r++){
+        for(long i = 0; i + LEN <= N; i += LEN){
+            sum = (sum + hash_str(str_buf + i, LEN)) & 1073741823;
+        }
+    }
+    return sum;
+}
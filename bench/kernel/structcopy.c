@@ -0,0 +1,64 @@
+// 構造体の代入 (24byte、64byte、512byteのコピー)
+#define N 1024
+
+struct Small {
+    long key;
+    long value;
+    long next;
+};
+
+struct Record {
+    long a;
+    long b;
+    long c;
+    long d;
+    long e;
+    long f;
+    long g;
+    long h;
+};
+
+struct Block {
+    struct Record r0;
+    struct Record r1;
+    struct Record r2;
+    struct Record r3;
+    struct Record r4;
+    struct Record r5;
+    struct Record r6;
+    struct Record r7;
+};
+
+long bench_run(long n){
+    struct Small smalls[N];
+    struct Record records[N];
+    struct Block blocks[2];
+    for(int i = 0; i < N; i++){
+        smalls[i].key = i;
+        smalls[i].value = i * 3;
+        smalls[i].next = (i * 7) % N;
+        records[i].a = i;
+        records[i].h = N - i;
+    }
+    blocks[0].r3.d = 1;
+    blocks[1].r3.d = 2;
+
+    long acc = 0;
+    for(long r = 0; r < n; r++){
+        for(int i = 0; i < N; i++){
+            struct Small s = smalls[i];
+            s.value = s.value + r;
+            smalls[s.next] = s;
+
+            struct Record t = records[i];
+            t.a = t.a + t.h;
+            records[(i + 1) % N] = t;
+            acc = (acc + s.value + t.a) & 1073741823;
+        }
+        struct Block b = blocks[r & 1];
+        b.r3.d = b.r3.d + 1;
+        blocks[(r + 1) & 1] = b;
+        acc = acc + b.r3.d;
+    }
+    return acc;
+}
@@ -0,0 +1,55 @@
+// 配列の要素ごとの計算と集計 (ベクトル化できるループ)
+#define N 4099
+
+void scale(int* dst, int* src, int len, int k){
+    for(int i = 0; i < len; i++){
+        dst[i] = (src[i] << 1) + k;
+    }
+}
+
+int sum(int* data, int len){
+    int s = 0;
+    for(int i = 0; i < len; i++){
+        s += data[i];
+    }
+    return s;
+}
+
+long byte_sum(unsigned char* data, int len){
+    long s = 0;
+    for(int i = 0; i < len; i++){
+        s += data[i];
+    }
+    return s;
+}
+
+int min(int* data, int len){
+    int m = 2147483647;
+    for(int i = 0; i < len; i++){
+        if(data[i] < m){
+            m = data[i];
+        }
+    }
+    return m;
+}
+
+long bench_run(long n){
+    int src[N];
+    int dst[N];
+    unsigned char bytes[N];
+    long x = 1;
+    for(int i = 0; i < N; i++){
+        x = (x * 1103515245 + 12345) & 2147483647;
+        src[i] = (x >> 8) & 65535;
+        bytes[i] = x >> 16;
+    }
+
+    long acc = 0;
+    for(long r = 0; r < n; r++){
+        for(int len = N - 3; len <= N; len++){
+            scale(dst, src, len, r);
+            acc = (acc + sum(dst, len) + byte_sum(bytes, len) + min(dst, len)) & 1073741823;
+        }
+    }
+    return acc;
+}
@@ -0,0 +1,120 @@
+#!/bin/bash
+# mcc2が生成するコードの実行速度を計測する
+#
+#   ./bench/run.sh [kernel...]
+#
+# bench/kernel/*.c をmcc2, cc -O0, cc -O2でそれぞれビルドし、
+# bench/driver.cから呼び出してrdtscで計測したサイクル数(最小値)を比較する。
+# 結果はカーネルごとに1行のJSONで標準出力に出す。
+#
+# 環境変数
+#   MCC2        : 計測するコンパイラ (default: ./mcc2)
+#   MCC2_FLAGS  : mcc2に追加で渡すオプション
+#                 --statsを含めると、mcc2の統計情報を"stats"に出力する
+#   BENCH_REPS  : 計測の繰り返し回数 (default: 5)
+#   BENCH_SCALE : 各カーネルの反復回数に掛ける倍率 (default: 1)
+
+cd "$(dirname "$0")/.."
+
+MCC2=${MCC2:-./mcc2}
+REPS=${BENCH_REPS:-5}
+SCALE=${BENCH_SCALE:-1}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# カーネルごとのbench_run(n)に渡す反復回数
+iterations() {
+  case "$1" in
+    sieve)   echo 20 ;;
+    matmul)  echo 5 ;;
+    qsort)   echo 5 ;;
+    strhash) echo 50 ;;
+    interp)  echo 20 ;;
+    list)    echo 100 ;;
+    checksum) echo 50 ;;
+    vecops)  echo 50 ;;
+    accessor) echo 50 ;;
+    recurse) echo 20 ;;
+    structcopy) echo 50 ;;
+    mixed) echo 50 ;;
+    *)       echo 1 ;;
+  esac
+}
+
+# .sファイル中の命令数を数える(ラベル、ディレクティブ、コメントを除く)
+count_insns() {
+  grep -E '^[[:space:]]+[a-z]' "$1" | grep -vE '^[[:space:]]+\.' | wc -l
+}
+
+# 実行して "cycles result" を得る。失敗した場合は空文字
+run_kernel() {
+  "$1" "$2" "$REPS" 2>/dev/null || true
+}
+
+cc -O2 -c -o "$WORK/driver.o" bench/driver.c || exit 1
+
+if [ $# -gt 0 ]; then
+  KERNELS="$@"
+else
+  KERNELS=$(ls bench/kernel/*.c | xargs -n1 basename | sed 's/\.c$//')
+fi
+
+for name in $KERNELS; do
+  src=bench/kernel/$name.c
+  n=$(( $(iterations "$name") * SCALE ))
+  status=ok
+
+  # mcc2
+  if ! $MCC2 -c "$src" -o "$WORK/$name.mcc2.s" $MCC2_FLAGS 2>"$WORK/$name.err" \
+    || ! cc -no-pie -o "$WORK/$name.mcc2" "$WORK/driver.o" "$WORK/$name.mcc2.s" 2>>"$WORK/$name.err"; then
+    status=compile_error
+  fi
+
+  # cc -O0 / -O2
+  for opt in O0 O2; do
+    cc -$opt -S -masm=intel -o "$WORK/$name.$opt.s" "$src"
+    cc -no-pie -o "$WORK/$name.$opt" "$WORK/driver.o" "$WORK/$name.$opt.s"
+  done
+
+  read o0_cycles o0_result <<< "$(run_kernel "$WORK/$name.O0" "$n")"
+  read o2_cycles o2_result <<< "$(run_kernel "$WORK/$name.O2" "$n")"
+  mcc2_cycles=0
+  mcc2_result=
+  mcc2_insns=0
+  if [ "$status" = ok ]; then
+    read mcc2_cycles mcc2_result <<< "$(run_kernel "$WORK/$name.mcc2" "$n")"
+    mcc2_insns=$(count_insns "$WORK/$name.mcc2.s")
+    if [ -z "$mcc2_cycles" ]; then
+      status=runtime_error
+      mcc2_cycles=0
+    elif [ "$mcc2_result" != "$o0_result" ]; then
+      status=wrong_result
+    fi
+  fi
+
+  o0_insns=$(count_insns "$WORK/$name.O0.s")
+  o2_insns=$(count_insns "$WORK/$name.O2.s")
+
+  ratio() {
+    if [ "$2" -gt 0 ] && [ "$1" -gt 0 ]; then
+      awk -v a="$1" -v b="$2" 'BEGIN { printf "%.3f", a / b }'
+    else
+      echo null
+    fi
+  }
+
+  printf '{"kernel":"%s","n":%d,"status":"%s","result":"%s",' \
+    "$name" "$n" "$status" "$o0_result"
+  printf '"cycles":{"mcc2":%d,"O0":%d,"O2":%d},' \
+    "$mcc2_cycles" "$o0_cycles" "$o2_cycles"
+  printf '"ratio":{"mcc2_O0":%s,"mcc2_O2":%s},' \
+    "$(ratio "$mcc2_cycles" "$o0_cycles")" "$(ratio "$mcc2_cycles" "$o2_cycles")"
+  printf '"insns":{"mcc2":%d,"O0":%d,"O2":%d}' \
+    "$mcc2_insns" "$o0_insns" "$o2_insns"
+  stats=$(grep '^stats: ' "$WORK/$name.err" 2>/dev/null \
+    | awk '{ printf "%s\"%s\":%s", (NR > 1 ? "," : ""), $2, $3 }')
+  if [ -n "$stats" ]; then
+    printf ',"stats":{%s}' "$stats"
+  fi
+  printf '}\n'
+done
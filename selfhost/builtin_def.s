@@ -0,0 +1,9 @@
+.intel_syntax noprefix
+.global builtin_def
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string ""
+  .data
+  .align 8
+builtin_def:
+  .quad .LSTR0
@@ -0,0 +1,1508 @@
+.intel_syntax noprefix
+.global unreachable
+.global error
+.global warn_at_src
+.global error_at_src
+.global remark_tok
+.global warn_tok
+.global error_tok
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "Reached unreachable code."
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "%s\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "%s:%d: remark: "
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "^ "
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string " "
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "%*s"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "%.*s\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "%s:%d: "
+# unreachable
+#	 stack size: 0
+  .text
+unreachable:
+  push rbp
+  mov rbp, rsp
+#./src/error.c:192:     fprintf(stderr, "%s\n", "Reached unreachable code.");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR7 ]
+  lea rcx, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov eax, 0
+  call fprintf
+  mov r8, rax
+#./src/error.c:193:     exit(1);
+  mov rdi, 1
+  call exit
+  mov r8, rax
+ret_unreachable:
+  pop rbp
+  ret
+# error
+#	 stack size: 168
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 144, size: 136) : level0
+#	 fmt( ofs: 8, size: 8) : level0
+  .text
+error:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov DWORD PTR [rbp - 144], 8
+  mov DWORD PTR [rbp - 144 + 4], 48
+  lea rax, [rbp - 144 + 16]
+  mov QWORD PTR [rbp - 144 + 8], rax
+  lea rax, [rbp - 144 + 24]
+  mov QWORD PTR [rbp - 144 + 16], rax
+  mov QWORD PTR [rbp - 144 + 24], rdi
+  mov QWORD PTR [rbp - 144 + 32], rsi
+  mov QWORD PTR [rbp - 144 + 40], rdx
+  mov QWORD PTR [rbp - 144 + 48], rcx
+  mov QWORD PTR [rbp - 144 + 56], r8
+  mov QWORD PTR [rbp - 144 + 64], r9
+  movsd QWORD PTR [rbp - 144 + 72], xmm0
+  movsd QWORD PTR [rbp - 144 + 80], xmm1
+  movsd QWORD PTR [rbp - 144 + 88], xmm2
+  movsd QWORD PTR [rbp - 144 + 96], xmm3
+  movsd QWORD PTR [rbp - 144 + 104], xmm4
+  movsd QWORD PTR [rbp - 144 + 112], xmm5
+  movsd QWORD PTR [rbp - 144 + 120], xmm6
+  movsd QWORD PTR [rbp - 144 + 128], xmm7
+  mov [rbp - 8], rdi
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 144]
+  lea rcx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#./src/error.c:185:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 168]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  call vfprintf
+  mov r8, rax
+#./src/error.c:186:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  call fprintf
+  mov r8, rax
+#./src/error.c:187:     exit(1);
+  mov rdi, 1
+  call exit
+  mov r8, rax
+ret_error:
+  mov rsp, rbp
+  pop rbp
+  ret
+# warn_at_src
+#	 stack size: 272
+#	 ap( ofs: 272, size: 24) : level0
+#	 pos_( ofs: 244, size: 4) : level0
+#	 indent( ofs: 240, size: 4) : level0
+#	 p( ofs: 224, size: 8) : level0
+#	 line_num( ofs: 212, size: 4) : level0
+#	 end( ofs: 200, size: 8) : level0
+#	 line( ofs: 184, size: 8) : level0
+#	 filename( ofs: 176, size: 8) : level0
+#	 user_input( ofs: 168, size: 8) : level0
+#	 __va_area__( ofs: 160, size: 136) : level0
+#	 fmt( ofs: 24, size: 8) : level0
+#	 src( ofs: 16, size: 8) : level0
+#	 pos( ofs: 8, size: 8) : level0
+  .text
+warn_at_src:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  push rbx
+  mov DWORD PTR [rbp - 160], 24
+  mov DWORD PTR [rbp - 160 + 4], 48
+  lea rax, [rbp - 160 + 16]
+  mov QWORD PTR [rbp - 160 + 8], rax
+  lea rax, [rbp - 160 + 24]
+  mov QWORD PTR [rbp - 160 + 16], rax
+  mov QWORD PTR [rbp - 160 + 24], rdi
+  mov QWORD PTR [rbp - 160 + 32], rsi
+  mov QWORD PTR [rbp - 160 + 40], rdx
+  mov QWORD PTR [rbp - 160 + 48], rcx
+  mov QWORD PTR [rbp - 160 + 56], r8
+  mov QWORD PTR [rbp - 160 + 64], r9
+  movsd QWORD PTR [rbp - 160 + 72], xmm0
+  movsd QWORD PTR [rbp - 160 + 80], xmm1
+  movsd QWORD PTR [rbp - 160 + 88], xmm2
+  movsd QWORD PTR [rbp - 160 + 96], xmm3
+  movsd QWORD PTR [rbp - 160 + 104], xmm4
+  movsd QWORD PTR [rbp - 160 + 112], xmm5
+  movsd QWORD PTR [rbp - 160 + 120], xmm6
+  movsd QWORD PTR [rbp - 160 + 128], xmm7
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  mov [rbp - 24], rdx
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 168]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 176]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:148:     while (user_input < line && line[-1] != '\n')
+.L0:
+  lea r8, [rbp - 168]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L1
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L1
+#./src/error.c:149:         line--;
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  sub r8, r9
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  jmp .L0
+.L1:
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:153:     while (*end != '\n')
+.L2:
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L3
+#./src/error.c:154:         end++;
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  jmp .L2
+.L3:
+  lea r8, [rbp - 212]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./src/error.c:158:     for (char *p = user_input; p < line; p++){
+  lea r8, [rbp - 168]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L4:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L6
+#./src/error.c:159:         if (*p == '\n'){
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L7
+#./src/error.c:160:             line_num++;
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 236]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 212]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 236]
+  movsxd r8, DWORD PTR [r8]
+.L7:
+.L5:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 232]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  jmp .L4
+.L6:
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR0 ]
+  lea rcx, [rbp - 176]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 212]
+  movsxd rbx, DWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 240]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:166:     fprintf(stderr, "%.*s\n", (int)(end - line), line);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR1 ]
+  lea rcx, [rbp - 200]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 184]
+  mov rdx, QWORD PTR [rdx]
+  sub rcx, rdx
+# cast st
+  movsxd rcx, ecx
+  lea rdx, [rbp - 184]
+  mov rbx, QWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  sub r8, r9
+  lea r9, [rbp - 240]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 244]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:170:     fprintf(stderr, "%*s", pos_, " ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR2 ]
+  lea rcx, [rbp - 244]
+  movsxd rcx, DWORD PTR [rcx]
+  lea rbx, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:173:     fprintf(stderr, "^ ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 160]
+  lea rcx, [rbp - 272]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#./src/error.c:177:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 272]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  sub rsp, 8
+  call vfprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:178:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+ret_warn_at_src:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# error_at_src
+#	 stack size: 272
+#	 ap( ofs: 272, size: 24) : level0
+#	 pos_( ofs: 244, size: 4) : level0
+#	 indent( ofs: 240, size: 4) : level0
+#	 p( ofs: 224, size: 8) : level0
+#	 line_num( ofs: 212, size: 4) : level0
+#	 end( ofs: 200, size: 8) : level0
+#	 line( ofs: 184, size: 8) : level0
+#	 filename( ofs: 176, size: 8) : level0
+#	 user_input( ofs: 168, size: 8) : level0
+#	 __va_area__( ofs: 160, size: 136) : level0
+#	 fmt( ofs: 24, size: 8) : level0
+#	 src( ofs: 16, size: 8) : level0
+#	 pos( ofs: 8, size: 8) : level0
+  .text
+error_at_src:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  push rbx
+  mov DWORD PTR [rbp - 160], 24
+  mov DWORD PTR [rbp - 160 + 4], 48
+  lea rax, [rbp - 160 + 16]
+  mov QWORD PTR [rbp - 160 + 8], rax
+  lea rax, [rbp - 160 + 24]
+  mov QWORD PTR [rbp - 160 + 16], rax
+  mov QWORD PTR [rbp - 160 + 24], rdi
+  mov QWORD PTR [rbp - 160 + 32], rsi
+  mov QWORD PTR [rbp - 160 + 40], rdx
+  mov QWORD PTR [rbp - 160 + 48], rcx
+  mov QWORD PTR [rbp - 160 + 56], r8
+  mov QWORD PTR [rbp - 160 + 64], r9
+  movsd QWORD PTR [rbp - 160 + 72], xmm0
+  movsd QWORD PTR [rbp - 160 + 80], xmm1
+  movsd QWORD PTR [rbp - 160 + 88], xmm2
+  movsd QWORD PTR [rbp - 160 + 96], xmm3
+  movsd QWORD PTR [rbp - 160 + 104], xmm4
+  movsd QWORD PTR [rbp - 160 + 112], xmm5
+  movsd QWORD PTR [rbp - 160 + 120], xmm6
+  movsd QWORD PTR [rbp - 160 + 128], xmm7
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  mov [rbp - 24], rdx
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 168]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 176]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:108:     while (user_input < line && line[-1] != '\n')
+.L8:
+  lea r8, [rbp - 168]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L9
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L9
+#./src/error.c:109:         line--;
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  sub r8, r9
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  jmp .L8
+.L9:
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:113:     while (*end != '\n')
+.L10:
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L11
+#./src/error.c:114:         end++;
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  jmp .L10
+.L11:
+  lea r8, [rbp - 212]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./src/error.c:118:     for (char *p = user_input; p < line; p++){
+  lea r8, [rbp - 168]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L12:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L14
+#./src/error.c:119:         if (*p == '\n'){
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L15
+#./src/error.c:120:             line_num++;
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 236]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 212]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 236]
+  movsxd r8, DWORD PTR [r8]
+.L15:
+.L13:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 232]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  jmp .L12
+.L14:
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR0 ]
+  lea rcx, [rbp - 176]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 212]
+  movsxd rbx, DWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 240]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:126:     fprintf(stderr, "%.*s\n", (int)(end - line), line);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR1 ]
+  lea rcx, [rbp - 200]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 184]
+  mov rdx, QWORD PTR [rdx]
+  sub rcx, rdx
+# cast st
+  movsxd rcx, ecx
+  lea rdx, [rbp - 184]
+  mov rbx, QWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  sub r8, r9
+  lea r9, [rbp - 240]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 244]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:130:     fprintf(stderr, "%*s", pos_, " ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR2 ]
+  lea rcx, [rbp - 244]
+  movsxd rcx, DWORD PTR [rcx]
+  lea rbx, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:133:     fprintf(stderr, "^ ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 160]
+  lea rcx, [rbp - 272]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#./src/error.c:137:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 272]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  sub rsp, 8
+  call vfprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:138:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:139:     exit(1);
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+ret_error_at_src:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# remark_tok
+#	 stack size: 204
+#	 p( ofs: 192, size: 8) : level0
+#	 line_num( ofs: 180, size: 4) : level0
+#	 ap( ofs: 176, size: 24) : level0
+#	 __va_area__( ofs: 152, size: 136) : level0
+#	 fmt( ofs: 16, size: 8) : level0
+#	 tok( ofs: 8, size: 8) : level0
+  .text
+remark_tok:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  push rbx
+  mov DWORD PTR [rbp - 152], 16
+  mov DWORD PTR [rbp - 152 + 4], 48
+  lea rax, [rbp - 152 + 16]
+  mov QWORD PTR [rbp - 152 + 8], rax
+  lea rax, [rbp - 152 + 24]
+  mov QWORD PTR [rbp - 152 + 16], rax
+  mov QWORD PTR [rbp - 152 + 24], rdi
+  mov QWORD PTR [rbp - 152 + 32], rsi
+  mov QWORD PTR [rbp - 152 + 40], rdx
+  mov QWORD PTR [rbp - 152 + 48], rcx
+  mov QWORD PTR [rbp - 152 + 56], r8
+  mov QWORD PTR [rbp - 152 + 64], r9
+  movsd QWORD PTR [rbp - 152 + 72], xmm0
+  movsd QWORD PTR [rbp - 152 + 80], xmm1
+  movsd QWORD PTR [rbp - 152 + 88], xmm2
+  movsd QWORD PTR [rbp - 152 + 96], xmm3
+  movsd QWORD PTR [rbp - 152 + 104], xmm4
+  movsd QWORD PTR [rbp - 152 + 112], xmm5
+  movsd QWORD PTR [rbp - 152 + 120], xmm6
+  movsd QWORD PTR [rbp - 152 + 128], xmm7
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 152]
+  lea rcx, [rbp - 176]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+  lea r8, [rbp - 180]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./src/error.c:50:     for (char *p = tok->file->body; p < tok->pos; p++){
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L16:
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 8
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L18
+#./src/error.c:51:         if (*p == '\n'){
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L19
+#./src/error.c:52:             line_num++;
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 204]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 180]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 204]
+  movsxd r8, DWORD PTR [r8]
+.L19:
+.L17:
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  jmp .L16
+.L18:
+#./src/error.c:56:     fprintf(stderr, "%s:%d: remark: ", tok->file->name, line_num);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR6 ]
+  lea rcx, [rbp - 8]
+  mov rcx, QWORD PTR [rcx]
+  add rcx, 16
+  mov rcx, QWORD PTR [rcx]
+  add rcx, 0
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 180]
+  movsxd rbx, DWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:57:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 176]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  sub rsp, 8
+  call vfprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:58:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+ret_remark_tok:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# warn_tok
+#	 stack size: 268
+#	 pos( ofs: 268, size: 4) : level0
+#	 indent( ofs: 264, size: 4) : level0
+#	 p( ofs: 248, size: 8) : level0
+#	 line_num( ofs: 236, size: 4) : level0
+#	 end( ofs: 224, size: 8) : level0
+#	 line( ofs: 208, size: 8) : level0
+#	 loc( ofs: 200, size: 8) : level0
+#	 filename( ofs: 192, size: 8) : level0
+#	 user_input( ofs: 184, size: 8) : level0
+#	 ap( ofs: 176, size: 24) : level0
+#	 __va_area__( ofs: 152, size: 136) : level0
+#	 fmt( ofs: 16, size: 8) : level0
+#	 tok( ofs: 8, size: 8) : level0
+  .text
+warn_tok:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  push rbx
+  mov DWORD PTR [rbp - 152], 16
+  mov DWORD PTR [rbp - 152 + 4], 48
+  lea rax, [rbp - 152 + 16]
+  mov QWORD PTR [rbp - 152 + 8], rax
+  lea rax, [rbp - 152 + 24]
+  mov QWORD PTR [rbp - 152 + 16], rax
+  mov QWORD PTR [rbp - 152 + 24], rdi
+  mov QWORD PTR [rbp - 152 + 32], rsi
+  mov QWORD PTR [rbp - 152 + 40], rdx
+  mov QWORD PTR [rbp - 152 + 48], rcx
+  mov QWORD PTR [rbp - 152 + 56], r8
+  mov QWORD PTR [rbp - 152 + 64], r9
+  movsd QWORD PTR [rbp - 152 + 72], xmm0
+  movsd QWORD PTR [rbp - 152 + 80], xmm1
+  movsd QWORD PTR [rbp - 152 + 88], xmm2
+  movsd QWORD PTR [rbp - 152 + 96], xmm3
+  movsd QWORD PTR [rbp - 152 + 104], xmm4
+  movsd QWORD PTR [rbp - 152 + 112], xmm5
+  movsd QWORD PTR [rbp - 152 + 120], xmm6
+  movsd QWORD PTR [rbp - 152 + 128], xmm7
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 152]
+  lea rcx, [rbp - 176]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:13:     while (user_input < line && line[-1] != '\n')
+.L20:
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L21
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L21
+#./src/error.c:14:         line--;
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 216]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  sub r8, r9
+  lea r9, [rbp - 208]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 216]
+  mov r8, QWORD PTR [r8]
+  jmp .L20
+.L21:
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:18:     while (*end != '\n')
+.L22:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L23
+#./src/error.c:19:         end++;
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 232]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  jmp .L22
+.L23:
+  lea r8, [rbp - 236]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./src/error.c:23:     for (char *p = user_input; p < line; p++){
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 248]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L24:
+  lea r8, [rbp - 248]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L26
+#./src/error.c:24:         if (*p == '\n'){
+  lea r8, [rbp - 248]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L27
+#./src/error.c:25:             line_num++;
+  lea r8, [rbp - 236]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 260]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 236]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 236]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+.L27:
+.L25:
+  lea r8, [rbp - 248]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 256]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 248]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 248]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 256]
+  mov r8, QWORD PTR [r8]
+  jmp .L24
+.L26:
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR0 ]
+  lea rcx, [rbp - 192]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 236]
+  movsxd rbx, DWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 264]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:31:     fprintf(stderr, "%.*s\n", (int)(end - line), line);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR1 ]
+  lea rcx, [rbp - 224]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 208]
+  mov rdx, QWORD PTR [rdx]
+  sub rcx, rdx
+# cast st
+  movsxd rcx, ecx
+  lea rdx, [rbp - 208]
+  mov rbx, QWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov r9, QWORD PTR [r9]
+  sub r8, r9
+  lea r9, [rbp - 264]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 268]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:35:     fprintf(stderr, "%*s", pos, " ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR2 ]
+  lea rcx, [rbp - 268]
+  movsxd rcx, DWORD PTR [rcx]
+  lea rbx, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:38:     fprintf(stderr, "^ ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:39:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 176]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  sub rsp, 8
+  call vfprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:40:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+ret_warn_tok:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# error_tok
+#	 stack size: 272
+#	 ap( ofs: 272, size: 24) : level0
+#	 pos( ofs: 244, size: 4) : level0
+#	 indent( ofs: 240, size: 4) : level0
+#	 p( ofs: 224, size: 8) : level0
+#	 line_num( ofs: 212, size: 4) : level0
+#	 end( ofs: 200, size: 8) : level0
+#	 line( ofs: 184, size: 8) : level0
+#	 loc( ofs: 176, size: 8) : level0
+#	 filename( ofs: 168, size: 8) : level0
+#	 user_input( ofs: 160, size: 8) : level0
+#	 __va_area__( ofs: 152, size: 136) : level0
+#	 fmt( ofs: 16, size: 8) : level0
+#	 tok( ofs: 8, size: 8) : level0
+  .text
+error_tok:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  push rbx
+  mov DWORD PTR [rbp - 152], 16
+  mov DWORD PTR [rbp - 152 + 4], 48
+  lea rax, [rbp - 152 + 16]
+  mov QWORD PTR [rbp - 152 + 8], rax
+  lea rax, [rbp - 152 + 24]
+  mov QWORD PTR [rbp - 152 + 16], rax
+  mov QWORD PTR [rbp - 152 + 24], rdi
+  mov QWORD PTR [rbp - 152 + 32], rsi
+  mov QWORD PTR [rbp - 152 + 40], rdx
+  mov QWORD PTR [rbp - 152 + 48], rcx
+  mov QWORD PTR [rbp - 152 + 56], r8
+  mov QWORD PTR [rbp - 152 + 64], r9
+  movsd QWORD PTR [rbp - 152 + 72], xmm0
+  movsd QWORD PTR [rbp - 152 + 80], xmm1
+  movsd QWORD PTR [rbp - 152 + 88], xmm2
+  movsd QWORD PTR [rbp - 152 + 96], xmm3
+  movsd QWORD PTR [rbp - 152 + 104], xmm4
+  movsd QWORD PTR [rbp - 152 + 112], xmm5
+  movsd QWORD PTR [rbp - 152 + 120], xmm6
+  movsd QWORD PTR [rbp - 152 + 128], xmm7
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 160]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 168]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 176]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 176]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:68:     while (user_input < line && line[-1] != '\n')
+.L28:
+  lea r8, [rbp - 160]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L29
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L29
+#./src/error.c:69:         line--;
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 192]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 184]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  sub r8, r9
+  lea r9, [rbp - 184]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  jmp .L28
+.L29:
+  lea r8, [rbp - 176]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/error.c:73:     while (*end != '\n')
+.L30:
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L31
+#./src/error.c:74:         end++;
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 200]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 200]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 208]
+  mov r8, QWORD PTR [r8]
+  jmp .L30
+.L31:
+  lea r8, [rbp - 212]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./src/error.c:78:     for (char *p = user_input; p < line; p++){
+  lea r8, [rbp - 160]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L32:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jae .L34
+#./src/error.c:79:         if (*p == '\n'){
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L35
+#./src/error.c:80:             line_num++;
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 236]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 212]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 212]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 236]
+  movsxd r8, DWORD PTR [r8]
+.L35:
+.L33:
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 232]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 224]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  jmp .L32
+.L34:
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR0 ]
+  lea rcx, [rbp - 168]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 212]
+  movsxd rbx, DWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 240]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:86:     fprintf(stderr, "%.*s\n", (int)(end - line), line);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR1 ]
+  lea rcx, [rbp - 200]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 184]
+  mov rdx, QWORD PTR [rdx]
+  sub rcx, rdx
+# cast st
+  movsxd rcx, ecx
+  lea rdx, [rbp - 184]
+  mov rbx, QWORD PTR [rdx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 176]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov r9, QWORD PTR [r9]
+  sub r8, r9
+  lea r9, [rbp - 240]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 244]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./src/error.c:90:     fprintf(stderr, "%*s", pos, " ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR2 ]
+  lea rcx, [rbp - 244]
+  movsxd rcx, DWORD PTR [rcx]
+  lea rbx, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:93:     fprintf(stderr, "^ ");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 152]
+  lea rcx, [rbp - 272]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#./src/error.c:97:     vfprintf(stderr, fmt, ap);
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 272]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  sub rsp, 8
+  call vfprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:98:     fprintf(stderr, "\n");
+  lea r8, [ rip + stderr ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  sub rsp, 8
+  call fprintf
+  add rsp, 8
+  mov r8, rax
+#./src/error.c:99:     exit(1);
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+ret_error_tok:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,624 @@
+.intel_syntax noprefix
+.global fp
+.global close_output_file
+.global open_output_file
+.global print
+.global file_init
+.global get_dirname
+.global read_file
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "cannot open file: %s"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "w"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "%s: fseek: %s"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "invalid file path."
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "r"
+  .data
+  .align 8
+fp:
+  .zero 8
+# close_output_file
+#	 stack size: 0
+  .text
+close_output_file:
+  push rbp
+  mov rbp, rsp
+#./src/file.c:76:     fclose(fp);
+  lea r8, [ rip + fp ]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  call fclose
+  mov r8, rax
+ret_close_output_file:
+  pop rbp
+  ret
+# open_output_file
+#	 stack size: 8
+#	 filename( ofs: 8, size: 8) : level0
+  .text
+open_output_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 8], rdi
+#./src/file.c:69:     fp = fopen(filename, "w");
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov rsi, r9
+  call fopen
+  mov r8, rax
+  lea r9, [ rip + fp ]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:70:     if(fp == NULL){
+  lea r8, [ rip + fp ]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  jne .L0
+#./src/file.c:71:         error("cannot open file: %s", filename);
+  lea r8, [ rip + .LSTR4 ]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  mov rdi, r8
+  mov rsi, r9
+  mov eax, 0
+  call error
+  mov r8, rax
+.L0:
+ret_open_output_file:
+  mov rsp, rbp
+  pop rbp
+  ret
+# print
+#	 stack size: 168
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 144, size: 136) : level0
+#	 fmt( ofs: 8, size: 8) : level0
+  .text
+print:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov DWORD PTR [rbp - 144], 8
+  mov DWORD PTR [rbp - 144 + 4], 48
+  lea rax, [rbp - 144 + 16]
+  mov QWORD PTR [rbp - 144 + 8], rax
+  lea rax, [rbp - 144 + 24]
+  mov QWORD PTR [rbp - 144 + 16], rax
+  mov QWORD PTR [rbp - 144 + 24], rdi
+  mov QWORD PTR [rbp - 144 + 32], rsi
+  mov QWORD PTR [rbp - 144 + 40], rdx
+  mov QWORD PTR [rbp - 144 + 48], rcx
+  mov QWORD PTR [rbp - 144 + 56], r8
+  mov QWORD PTR [rbp - 144 + 64], r9
+  movsd QWORD PTR [rbp - 144 + 72], xmm0
+  movsd QWORD PTR [rbp - 144 + 80], xmm1
+  movsd QWORD PTR [rbp - 144 + 88], xmm2
+  movsd QWORD PTR [rbp - 144 + 96], xmm3
+  movsd QWORD PTR [rbp - 144 + 104], xmm4
+  movsd QWORD PTR [rbp - 144 + 112], xmm5
+  movsd QWORD PTR [rbp - 144 + 120], xmm6
+  movsd QWORD PTR [rbp - 144 + 128], xmm7
+  mov [rbp - 8], rdi
+#./src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 144]
+  lea rcx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#./src/file.c:82:     vfprintf(fp, fmt, ap);
+  lea r8, [ rip + fp ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 168]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  call vfprintf
+  mov r8, rax
+#./src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+ret_print:
+  mov rsp, rbp
+  pop rbp
+  ret
+# file_init
+#	 stack size: 0
+  .text
+file_init:
+  push rbp
+  mov rbp, rsp
+#./src/file.c:65:     fp = stdout;
+  lea r8, [ rip + stdout ]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + fp ]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+ret_file_init:
+  pop rbp
+  ret
+# get_dirname
+#	 stack size: 24
+#	 buf( ofs: 24, size: 8) : level0
+#	 yen_pos( ofs: 16, size: 8) : level0
+#	 path( ofs: 8, size: 8) : level0
+  .text
+get_dirname:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  mov rsi, 47
+  call strrchr
+  mov r8, rax
+  lea r9, [rbp - 16]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  call strlen
+  mov r8, rax
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 8]
+  mov rcx, QWORD PTR [rcx]
+  sub r9, rcx
+  add r8, r9
+  sub r8, 1
+  mov rdi, 1
+  mov rsi, r8
+  call calloc
+  mov r8, rax
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:59:     strncpy(buf, path, yen_pos - path);
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 16]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 8]
+  mov rdx, QWORD PTR [rdx]
+  sub rcx, rdx
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  call strncpy
+  mov r8, rax
+#./src/file.c:60:     return buf;
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_get_dirname
+ret_get_dirname:
+  mov rsp, rbp
+  pop rbp
+  ret
+# read_file
+#	 stack size: 120
+#	 file( ofs: 120, size: 8) : level0
+#	 p2( ofs: 64, size: 8) : level0
+#	 p( ofs: 56, size: 8) : level0
+#	 buf2( ofs: 48, size: 8) : level0
+#	 buf( ofs: 32, size: 8) : level0
+#	 size( ofs: 24, size: 8) : level0
+#	 fp( ofs: 16, size: 8) : level0
+#	 path( ofs: 8, size: 8) : level0
+  .text
+read_file:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  push rbx
+  push r12
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov rsi, r9
+  call fopen
+  mov r8, rax
+  lea r9, [rbp - 16]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:8:     if(!fp){
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  jne .L1
+#./src/file.c:9:         error("invalid file path.");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call error
+  mov r8, rax
+.L1:
+#./src/file.c:12:     if (fseek(fp, 0, SEEK_END) == -1)
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  mov rsi, 0
+  mov rdx, 2
+  call fseek
+  mov r8, rax
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L2
+#./src/file.c:13:         error("%s: fseek: %s", path, strerror(errno));
+  lea rbx, [ rip + .LSTR2 ]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  lea r8, [ rip + errno ]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  call strerror
+  mov r8, rax
+  mov rdi, rbx
+  mov rsi, r12
+  mov rdx, r8
+  mov eax, 0
+  call error
+  mov r8, rax
+.L2:
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  call ftell
+  mov r8, rax
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:15:     if (fseek(fp, 0, SEEK_SET) == -1)
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  mov rsi, 0
+  mov rdx, 0
+  call fseek
+  mov r8, rax
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L3
+#./src/file.c:16:         error("%s: fseek: %s", path, strerror(errno));
+  lea rbx, [ rip + .LSTR2 ]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  lea r8, [ rip + errno ]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  call strerror
+  mov r8, rax
+  mov rdi, rbx
+  mov rsi, r12
+  mov rdx, r8
+  mov eax, 0
+  call error
+  mov r8, rax
+.L3:
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  add r8, 2
+  mov rdi, 1
+  mov rsi, r8
+  call calloc
+  mov r8, rax
+  lea r9, [rbp - 32]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:19:     fread(buf, size, 1, fp);
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 16]
+  mov rcx, QWORD PTR [rcx]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 1
+  mov rcx, rcx
+  call fread
+  mov r8, rax
+#./src/file.c:21:     if (size == 0 || buf[size - 1] != '\n')
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L5
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  sub r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L4
+.L5:
+#./src/file.c:22:         buf[size++] = '\n';
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 40]
+  mov QWORD PTR [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  add r9, 1
+  lea rcx, [rbp - 24]
+  mov QWORD PTR [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 40]
+  mov r9, QWORD PTR [r9]
+  imul r9, 1
+  add r8, r9
+  mov r9, 92
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+.L4:
+#./src/file.c:23:     buf[size] = '\0';
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  imul r9, 1
+  add r8, r9
+  mov r9, 92
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./src/file.c:24:     fclose(fp);
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  call fclose
+  mov r8, rax
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  add r8, 2
+  mov rdi, 1
+  mov rsi, r8
+  call calloc
+  mov r8, rax
+  lea r9, [rbp - 48]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 56]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 48]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 64]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:30:     while(*p){
+.L6:
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  je .L7
+#./src/file.c:31:         if(*p == '\\' && isspace(*(p + 1))){
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L8
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  add r8, 1
+  movsx r8, BYTE PTR [r8]
+  mov rdi, r8
+  call isspace
+  mov r8, rax
+  cmp r8, 0
+  je .L8
+#./src/file.c:33:             p++;
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 72]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 56]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 72]
+  mov r8, QWORD PTR [r8]
+#./src/file.c:34:             while(*p && *p != '\n' && isspace(*buf))
+.L9:
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  je .L10
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L10
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  mov rdi, r8
+  call isspace
+  mov r8, rax
+  cmp r8, 0
+  je .L10
+#./src/file.c:35:                 buf++;
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 80]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 32]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 80]
+  mov r8, QWORD PTR [r8]
+  jmp .L9
+.L10:
+#./src/file.c:37:             if(*p == '\n'){
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  jne .L11
+#./src/file.c:38:                 p++;
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 88]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 56]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 88]
+  mov r8, QWORD PTR [r8]
+#./src/file.c:40:                 while(*p && *p != '\n' && isspace(*p))
+.L12:
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  je .L13
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 92
+  je .L13
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  mov rdi, r8
+  call isspace
+  mov r8, rax
+  cmp r8, 0
+  je .L13
+#./src/file.c:41:                     p++;
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 96]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 56]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 96]
+  mov r8, QWORD PTR [r8]
+  jmp .L12
+.L13:
+#./src/file.c:42:                 continue;
+  jmp .L6
+.L11:
+.L8:
+#./src/file.c:45:         *p2++ = *p++;
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 112]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 56]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 112]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 64]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 104]
+  mov QWORD PTR [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 64]
+  mov r9, QWORD PTR [r9]
+  mov rcx, 1
+  imul rcx, 1
+  add r9, rcx
+  lea rcx, [rbp - 64]
+  mov QWORD PTR [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 104]
+  mov r9, QWORD PTR [r9]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+  jmp .L6
+.L7:
+  mov rdi, 1
+  mov rsi, 16
+  call calloc
+  mov r8, rax
+  lea r9, [rbp - 120]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:49:     file->name = (char*)path;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 120]
+  mov r9, QWORD PTR [r9]
+  add r9, 0
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:50:     file->body = buf2;
+  lea r8, [rbp - 48]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 120]
+  mov r9, QWORD PTR [r9]
+  add r9, 8
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./src/file.c:52:     return file;
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_read_file
+ret_read_file:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
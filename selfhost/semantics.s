@@ -0,0 +1,11 @@
+.intel_syntax noprefix
+.global semantics
+# semantics
+#	 stack size: 0
+  .text
+semantics:
+  push rbp
+  mov rbp, rsp
+ret_semantics:
+  pop rbp
+  ret
@@ -0,0 +1,275 @@
+.intel_syntax noprefix
+.global test_assignment
+.global test_static
+  .data
+.LSTR0:
+  .string "test of assignment..\n"
+  .bss
+.Ltest_static:
+  .zero 4
+# test_assignment
+#	 stack size: 244
+#	 a( ofs: 244, size: 4) : level0
+#	 __spill_area__( ofs: 240, size: 1) : level0
+  .text
+test_assignment:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/assignment.c:4:     printf("test of assignment..\n");
+  lea r10, [ rip + .LSTR0 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+  lea r10, [rbp - 244]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  add r11, 3
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L0
+  mov r11, 0
+  jmp .L1
+.L0:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L1:
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+  lea r10, [rbp - 244]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  sub r11, 3
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r10, 0
+  sub r10, 3
+  cmp r11, r10
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L2
+  mov r10, 0
+  jmp .L3
+.L2:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L3:
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+  lea r10, [rbp - 244]
+  mov r11, 2
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  imul r11, 3
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 6
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L4
+  mov r11, 0
+  jmp .L5
+.L4:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L5:
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+  lea r10, [rbp - 244]
+  mov r11, 8
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r10, 4
+  mov rax, r11
+  cqo
+  idiv r10
+  mov r11, rax
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 2
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L6
+  mov r11, 0
+  jmp .L7
+.L6:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L7:
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+  lea r10, [rbp - 244]
+  mov r11, 13
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r10, 5
+  mov rax, r11
+  cqo
+  idiv r10
+  mov r11, rdx
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L8
+  mov r11, 0
+  jmp .L9
+.L8:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L9:
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+  lea r10, [rbp - 244]
+  mov r11, 56
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  sar r11, 3
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 7
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L10
+  mov r11, 0
+  jmp .L11
+.L10:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L11:
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+  lea r10, [rbp - 244]
+  mov r11, 7
+  mov [r10], r11d
+  mov r12, r11
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  sal r11, 3
+  lea r10, [rbp - 244]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 56
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L12
+  mov r11, 0
+  jmp .L13
+.L12:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L13:
+#test/c/assignment.c:13:     return 0;
+  mov r10, 0
+  mov rax, r10
+  jmp ret_test_assignment
+ret_test_assignment:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,1481 @@
+.intel_syntax noprefix
+.global test_cast
+.global test_static
+  .data
+.LSTR1:
+  .string "test of pointer cast..\n"
+  .data
+.LSTR0:
+  .string "test of cast..\n"
+  .bss
+.Ltest_static:
+  .zero 4
+# test_cast
+#	 stack size: 298
+#	 pcs2( ofs: 298, size: 4) : level0
+#	 a( ofs: 294, size: 8) : level0
+#	 pcs( ofs: 286, size: 8) : level0
+#	 pi( ofs: 278, size: 8) : level0
+#	 ul( ofs: 270, size: 8) : level0
+#	 ui( ofs: 262, size: 4) : level0
+#	 us( ofs: 258, size: 2) : level0
+#	 uc( ofs: 256, size: 1) : level0
+#	 l( ofs: 255, size: 8) : level0
+#	 i( ofs: 247, size: 4) : level0
+#	 s( ofs: 243, size: 2) : level0
+#	 c( ofs: 241, size: 1) : level0
+#	 __spill_area__( ofs: 240, size: 1) : level0
+  .text
+test_cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 304
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/cast.c:4:     printf("test of cast..\n");
+  lea r10, [ rip + .LSTR0 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+  lea r10, [rbp - 241]
+  mov r11, 0
+  mov [r10], r11b
+  mov r12, r11
+  lea r10, [rbp - 243]
+  mov r11, 0
+  mov [r10], r11w
+  mov r12, r11
+  lea r10, [rbp - 247]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+  lea r10, [rbp - 255]
+  mov r11, 0
+  mov [r10], r11
+  mov r12, r11
+  lea r10, [rbp - 256]
+  mov r11, 0
+  mov [r10], r11b
+  mov r12, r11
+  lea r10, [rbp - 258]
+  mov r11, 0
+  mov [r10], r11w
+  mov r12, r11
+  lea r10, [rbp - 262]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+  lea r10, [rbp - 270]
+  mov r11, 0
+  mov [r10], r11
+  mov r12, r11
+#test/c/cast.c:16:     c = -1;
+  mov r10, 0
+  sub r10, 1
+  lea r11, [rbp - 241]
+  mov [r11], r10b
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L0
+  mov r10, 0
+  jmp .L1
+.L0:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L2
+  mov r10, 0
+  jmp .L3
+.L2:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L3:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L4
+  mov r10, 0
+  jmp .L5
+.L4:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L5:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L6
+  mov r10, 0
+  jmp .L7
+.L6:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L7:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L8
+  mov r10, 0
+  jmp .L9
+.L8:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L9:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  mov r10d, r11d
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L10
+  mov r10, 0
+  jmp .L11
+.L10:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 241]
+  movsx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 18446744073709551615
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L12
+  mov r10, 0
+  jmp .L13
+.L12:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L13:
+#test/c/cast.c:26:     s = -1;
+  mov r10, 0
+  sub r10, 1
+  lea r11, [rbp - 243]
+  mov [r11], r10w
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L14
+  mov r10, 0
+  jmp .L15
+.L14:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L16
+  mov r10, 0
+  jmp .L17
+.L16:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L18
+  mov r10, 0
+  jmp .L19
+.L18:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L19:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L20
+  mov r10, 0
+  jmp .L21
+.L20:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L22
+  mov r10, 0
+  jmp .L23
+.L22:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L23:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  mov r10d, r11d
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L24
+  mov r10, 0
+  jmp .L25
+.L24:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 243]
+  movsx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 18446744073709551615
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L26
+  mov r10, 0
+  jmp .L27
+.L26:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L27:
+#test/c/cast.c:36:     i = -1;
+  mov r10, 0
+  sub r10, 1
+  lea r11, [rbp - 247]
+  mov [r11], r10d
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L28
+  mov r10, 0
+  jmp .L29
+.L28:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  movsx r10, r11w
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L30
+  mov r10, 0
+  jmp .L31
+.L30:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L32
+  mov r10, 0
+  jmp .L33
+.L32:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L34
+  mov r10, 0
+  jmp .L35
+.L34:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L36
+  mov r10, 0
+  jmp .L37
+.L36:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L37:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  mov r10d, r11d
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L38
+  mov r10, 0
+  jmp .L39
+.L38:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 247]
+  movsxd r11, DWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 18446744073709551615
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L40
+  mov r10, 0
+  jmp .L41
+.L40:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L41:
+#test/c/cast.c:46:     l = -1;
+  mov r10, 0
+  sub r10, 1
+  lea r11, [rbp - 255]
+  mov [r11], r10
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L42
+  mov r10, 0
+  jmp .L43
+.L42:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L43:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsx r10, r11w
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L44
+  mov r10, 0
+  jmp .L45
+.L44:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsxd r10, r11d
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L46
+  mov r10, 0
+  jmp .L47
+.L46:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L47:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L48
+  mov r10, 0
+  jmp .L49
+.L48:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L50
+  mov r10, 0
+  jmp .L51
+.L50:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  mov r10d, r11d
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L52
+  mov r10, 0
+  jmp .L53
+.L52:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 255]
+  mov r11, QWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 18446744073709551615
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L54
+  mov r10, 0
+  jmp .L55
+.L54:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L55:
+#test/c/cast.c:56:     uc = 255;
+  lea r10, [rbp - 256]
+  mov r11, 255
+  mov [r10], r11b
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L56
+  mov r10, 0
+  jmp .L57
+.L56:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L58
+  mov r10, 0
+  jmp .L59
+.L58:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L60
+  mov r10, 0
+  jmp .L61
+.L60:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L62
+  mov r10, 0
+  jmp .L63
+.L62:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L64
+  mov r10, 0
+  jmp .L65
+.L64:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L66
+  mov r10, 0
+  jmp .L67
+.L66:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movzx r11, BYTE PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L68
+  mov r10, 0
+  jmp .L69
+.L68:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L69:
+#test/c/cast.c:66:     us = 65535;
+  lea r10, [rbp - 258]
+  mov r11, 65535
+  mov [r10], r11w
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L70
+  mov r10, 0
+  jmp .L71
+.L70:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  movsx r10, r11w
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L72
+  mov r10, 0
+  jmp .L73
+.L72:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L74
+  mov r10, 0
+  jmp .L75
+.L74:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L76
+  mov r10, 0
+  jmp .L77
+.L76:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L78
+  mov r10, 0
+  jmp .L79
+.L78:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L80
+  mov r10, 0
+  jmp .L81
+.L80:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L81:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 258]
+  movzx r11, WORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L82
+  mov r10, 0
+  jmp .L83
+.L82:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L83:
+#test/c/cast.c:76:     ui = 4294967295;
+  lea r10, [rbp - 262]
+  mov r11, 4294967295
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L84
+  mov r10, 0
+  jmp .L85
+.L84:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L85:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  movsx r10, r11w
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L86
+  mov r10, 0
+  jmp .L87
+.L86:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  movsxd r10, r11d
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L88
+  mov r10, 0
+  jmp .L89
+.L88:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L89:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L90
+  mov r10, 0
+  jmp .L91
+.L90:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L92
+  mov r10, 0
+  jmp .L93
+.L92:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L93:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L94
+  mov r10, 0
+  jmp .L95
+.L94:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L95:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 262]
+  mov r11d, DWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L96
+  mov r10, 0
+  jmp .L97
+.L96:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L97:
+#test/c/cast.c:86:     ul = 18446744073709551615ul;
+  lea r10, [rbp - 270]
+  mov r11, 18446744073709551615
+  mov [r10], r11
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsx r10, r11b
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L98
+  mov r10, 0
+  jmp .L99
+.L98:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsx r10, r11w
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L100
+  mov r10, 0
+  jmp .L101
+.L100:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L101:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movsxd r10, r11d
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L102
+  mov r10, 0
+  jmp .L103
+.L102:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  mov r10, r11
+  mov r11, 0
+  sub r11, 1
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L104
+  mov r10, 0
+  jmp .L105
+.L104:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L105:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movzx r10, r11b
+  mov r12, 255
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L106
+  mov r10, 0
+  jmp .L107
+.L106:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L107:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  movzx r10, r11w
+  mov r12, 65535
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L108
+  mov r10, 0
+  jmp .L109
+.L108:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L109:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 270]
+  mov r11, QWORD PTR [r10]
+# cast st
+  mov r10d, r11d
+  mov r12, 4294967295
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L110
+  mov r10, 0
+  jmp .L111
+.L110:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L111:
+#test/c/cast.c:96:     printf("test of pointer cast..\n");
+  lea r10, [ rip + .LSTR1 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/cast.c:97:     i = 5555;
+  lea r10, [rbp - 247]
+  mov r11, 5555
+  mov [r10], r11d
+  mov r12, r11
+  lea r10, [rbp - 247]
+  lea r11, [rbp - 278]
+  mov [r11], r10
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 278]
+  mov r11, QWORD PTR [r10]
+  movsx r10, BYTE PTR [r11]
+  mov r11, 0
+  sub r11, 77
+  cmp r10, r11
+  sete al
+  movzb r12, al
+  cmp r12, 0
+  je .L112
+  mov r10, 0
+  jmp .L113
+.L112:
+  mov r11, 1
+  mov rdi, r11
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r11, rax
+  mov r10, r11
+.L113:
+  lea r10, [rbp - 294]
+  mov r11, 123456
+  mov [r10], r11
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 294]
+  add r10, 0
+  movsx r11, BYTE PTR [r10]
+  mov r12, 64
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L114
+  mov r11, 0
+  jmp .L115
+.L114:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L115:
+#test/c/cast.c:112:     pcs2.a = 1;
+  lea r10, [rbp - 298]
+  add r10, 0
+  mov r11, 1
+  mov [r10], r11b
+  mov r12, r11
+#test/c/cast.c:113:     pcs2.b = 12;
+  lea r10, [rbp - 298]
+  add r10, 1
+  mov r11, 12
+  mov [r10], r11b
+  mov r12, r11
+#test/c/cast.c:118:     (PointerCastStruct2*)&pcs2;
+  lea r10, [rbp - 298]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 298]
+  add r10, 1
+  movsx r11, BYTE PTR [r10]
+  mov r12, 12
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L116
+  mov r11, 0
+  jmp .L117
+.L116:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L117:
+ret_test_cast:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,3362 @@
+.intel_syntax noprefix
+.global strength_mismatch
+.global uop_by
+.global op_by
+.global logic_call
+.global logic_calls
+.global test_expression
+.global test_static
+  .data
+.LSTR11:
+  .string "test of signed and unsigned arithmetic ...\n"
+  .data
+.LSTR10:
+  .string "test of full of register ...\n"
+  .data
+.LSTR9:
+  .string "test of sizeof ...\n"
+  .data
+.LSTR8:
+  .string "test of not operator...\n"
+  .data
+.LSTR7:
+  .string "test of unary...\n"
+  .data
+.LSTR6:
+  .string "test of condition operator...\n"
+  .data
+.LSTR5:
+  .string "test of comma operator...\n"
+  .data
+.LSTR4:
+  .string "test of multiply and divide by constants...\n"
+  .data
+.LSTR3:
+  .string "test of short-circuit evaluation...\n"
+  .data
+.LSTR2:
+  .string "test of logical expression...\n"
+  .data
+.LSTR1:
+  .string "test of expression relational..\n"
+  .data
+.LSTR0:
+  .string "test of expression..\n"
+  .bss
+  .align 4
+logic_calls:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# strength_mismatch
+#	 stack size: 24
+#	 u( ofs: 24, size: 8) : level0
+#	 bad( ofs: 12, size: 4) : level0
+#	 n( ofs: 8, size: 8) : level0
+  .text
+strength_mismatch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8
+  mov r8, r8
+#test/c/expression.c:224:     bad += n * 0 != op_by(0, n, 0);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 0
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 0
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:225:     bad += n * 1 != op_by(0, n, 1);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 1
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 1
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:226:     bad += n * 3 != op_by(0, n, 3);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  lea r12, [r12 + r12 * 2]
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 3
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:227:     bad += n * 8 != op_by(0, n, 8);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 8
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:228:     bad += n * 10 != op_by(0, n, 10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 10
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 10
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:229:     bad += n * 17 != op_by(0, n, 17);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 17
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 17
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:230:     bad += n * 31 != op_by(0, n, 31);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 31
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 31
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:231:     bad += n * 72 != op_by(0, n, 72);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  imul r12, 72
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 0
+  mov rsi, r8
+  mov rdx, 72
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:232:     bad += n / 1 != op_by(1, n, 1);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 1
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 1
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:233:     bad += n / 2 != op_by(1, n, 2);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 2
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 2
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:234:     bad += n / 16 != op_by(1, n, 16);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 16
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 16
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:235:     bad += n / 3 != op_by(1, n, 3);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 3
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 3
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:236:     bad += n / 7 != op_by(1, n, 7);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 7
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 7
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:237:     bad += n / 10 != op_by(1, n, 10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 10
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 10
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:238:     bad += n / 1000 != op_by(1, n, 1000);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 1000
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 1000
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:239:     bad += n / -3 != op_by(1, n, -3);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 0
+  sub r8, 3
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 3
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, r9
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:240:     bad += n / -10 != op_by(1, n, -10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 0
+  sub r8, 10
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 10
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, r9
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:241:     bad += n % 2 != op_by(2, n, 2);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 2
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rdx
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 2
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:242:     bad += n % 64 != op_by(2, n, 64);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 64
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rdx
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 64
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:243:     bad += n % 3 != op_by(2, n, 3);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 3
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rdx
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 3
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:244:     bad += n % 7 != op_by(2, n, 7);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 7
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rdx
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 7
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:245:     bad += n % -10 != op_by(2, n, -10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 8]
+  mov r12, QWORD PTR [r8]
+  mov r8, 0
+  sub r8, 10
+  mov rax, r12
+  cqo
+  idiv r8
+  mov r12, rdx
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 10
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, r9
+  call op_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:246:     bad += u / 4 != uop_by(1, u, 4);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 4
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rax
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 4
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:247:     bad += u / 3 != uop_by(1, u, 3);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 3
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rax
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 3
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:248:     bad += u / 7 != uop_by(1, u, 7);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 7
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rax
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 7
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:249:     bad += u / 10 != uop_by(1, u, 10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 10
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rax
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 10
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:250:     bad += u % 8 != uop_by(2, u, 8);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 8
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rdx
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 8
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:251:     bad += u % 7 != uop_by(2, u, 7);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 7
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rdx
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 7
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:252:     bad += u % 10 != uop_by(2, u, 10);
+  lea r8, [rbp - 12]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r12, QWORD PTR [r8]
+  mov r8, 10
+  mov rax, r12
+  xor edx, edx
+  div r8
+  mov r12, rdx
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, 2
+  mov rsi, r8
+  mov rdx, 10
+  call uop_by
+  mov r8, rax
+  cmp r12, r8
+  setne al
+  movzb r8, al
+  add rbx, r8
+  lea r8, [rbp - 12]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:253:     return bad;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_strength_mismatch
+ret_strength_mismatch:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# uop_by
+#	 stack size: 24
+#	 d( ofs: 24, size: 8) : level0
+#	 n( ofs: 16, size: 8) : level0
+#	 op( ofs: 4, size: 4) : level0
+  .text
+uop_by:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  mov [rbp - 16], rsi
+  mov [rbp - 24], rdx
+#test/c/expression.c:217:     if(op == 1) return n / d;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L0
+#test/c/expression.c:217:     if(op == 1) return n / d;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rax
+  mov rax, r8
+  jmp ret_uop_by
+.L0:
+#test/c/expression.c:218:     return n % d;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rdx
+  mov rax, r8
+  jmp ret_uop_by
+ret_uop_by:
+  pop rbp
+  ret
+# op_by
+#	 stack size: 24
+#	 d( ofs: 24, size: 8) : level0
+#	 n( ofs: 16, size: 8) : level0
+#	 op( ofs: 4, size: 4) : level0
+  .text
+op_by:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  mov [rbp - 16], rsi
+  mov [rbp - 24], rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L1
+#test/c/expression.c:211:     if(op == 0) return n * d;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  imul r8, r9
+  mov rax, r8
+  jmp ret_op_by
+.L1:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L2
+#test/c/expression.c:212:     if(op == 1) return n / d;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov rax, r8
+  jmp ret_op_by
+.L2:
+#test/c/expression.c:213:     return n % d;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  mov rax, r8
+  jmp ret_op_by
+ret_op_by:
+  pop rbp
+  ret
+# logic_call
+#	 stack size: 8
+#	 v( ofs: 4, size: 4) : level0
+  .text
+logic_call:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+#test/c/expression.c:205:     logic_calls++;
+  lea r8, [ rip + logic_calls ]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [ rip + logic_calls ]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [ rip + logic_calls ]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+#test/c/expression.c:206:     return v;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_logic_call
+ret_logic_call:
+  pop rbp
+  ret
+# test_expression
+#	 stack size: 248
+#	 folded( ofs: 248, size: 4) : level0
+#	 ui( ofs: 244, size: 4) : level0
+#	 ul( ofs: 240, size: 8) : level0
+#	 sl( ofs: 232, size: 8) : level0
+#	 i( ofs: 204, size: 4) : level0
+#	 preg2( ofs: 200, size: 8) : level0
+#	 preg1( ofs: 192, size: 8) : level0
+#	 i( ofs: 180, size: 4) : level0
+#	 reg2( ofs: 176, size: 12) : level0
+#	 reg1( ofs: 164, size: 12) : level0
+#	 sintp( ofs: 152, size: 8) : level0
+#	 sint( ofs: 140, size: 4) : level0
+#	 incp( ofs: 120, size: 8) : level0
+#	 i( ofs: 108, size: 4) : level0
+#	 idlist( ofs: 104, size: 40) : level0
+#	 pd( ofs: 60, size: 4) : level0
+#	 pi( ofs: 52, size: 4) : level0
+#	 u( ofs: 44, size: 4) : level0
+#	 sr_uint( ofs: 40, size: 4) : level0
+#	 sr_int( ofs: 36, size: 4) : level0
+#	 sr_i( ofs: 24, size: 8) : level0
+#	 sr_bad( ofs: 16, size: 4) : level0
+#	 logic_v( ofs: 12, size: 4) : level0
+#	 logic_p( ofs: 8, size: 8) : level0
+  .text
+test_expression:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  push rbx
+#test/c/expression.c:10:     printf("test of expression..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  add r8, 5
+  cmp r8, 8
+  jne .L3
+  mov rbx, 0
+  jmp .L4
+.L3:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L4:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  sub r8, 5
+  cmp r8, 3
+  jne .L5
+  mov rbx, 0
+  jmp .L6
+.L5:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L6:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  imul r8, 4
+  mov r9, 1
+  add r9, r8
+  cmp r9, 13
+  jne .L7
+  mov rbx, 0
+  jmp .L8
+.L7:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L8:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  mov r9, 2
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov r9, 3
+  add r9, r8
+  cmp r9, 5
+  jne .L9
+  mov rbx, 0
+  jmp .L10
+.L9:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L10:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 9
+  add r8, 6
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  cmp r8, 5
+  jne .L11
+  mov rbx, 0
+  jmp .L12
+.L11:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L12:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 2
+  jne .L13
+  mov rbx, 0
+  jmp .L14
+.L13:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L14:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 56
+  sar r8, 3
+  cmp r8, 7
+  jne .L15
+  mov rbx, 0
+  jmp .L16
+.L15:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L16:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 7
+  sal r8, 3
+  cmp r8, 56
+  jne .L17
+  mov rbx, 0
+  jmp .L18
+.L17:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L18:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  and r8, 3
+  cmp r8, 1
+  jne .L19
+  mov rbx, 0
+  jmp .L20
+.L19:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L20:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  xor r8, 3
+  cmp r8, 6
+  jne .L21
+  mov rbx, 0
+  jmp .L22
+.L21:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L22:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  or r8, 4
+  cmp r8, 7
+  jne .L23
+  mov rbx, 0
+  jmp .L24
+.L23:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L24:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  and r8, 4
+  mov r9, 3
+  xor r9, r8
+  mov r8, 8
+  or r8, r9
+  cmp r8, 15
+  jne .L25
+  mov rbx, 0
+  jmp .L26
+.L25:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L26:
+#test/c/expression.c:24:     printf("test of expression relational..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 4
+  setl al
+  movzb r8, al
+  cmp r8, 1
+  jne .L27
+  mov rbx, 0
+  jmp .L28
+.L27:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L28:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 2
+  setl al
+  movzb r8, al
+  cmp r8, 0
+  jne .L29
+  mov rbx, 0
+  jmp .L30
+.L29:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L30:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  setle al
+  movzb r8, al
+  cmp r8, 1
+  jne .L31
+  mov rbx, 0
+  jmp .L32
+.L31:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L32:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 4
+  setle al
+  movzb r8, al
+  cmp r8, 1
+  jne .L33
+  mov rbx, 0
+  jmp .L34
+.L33:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L34:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 2
+  setle al
+  movzb r8, al
+  cmp r8, 0
+  jne .L35
+  mov rbx, 0
+  jmp .L36
+.L35:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L36:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 4
+  setl al
+  movzb r8, al
+  cmp r8, 1
+  jne .L37
+  mov rbx, 0
+  jmp .L38
+.L37:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L38:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  cmp r8, 4
+  setl al
+  movzb r8, al
+  cmp r8, 0
+  jne .L39
+  mov rbx, 0
+  jmp .L40
+.L39:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L40:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  setle al
+  movzb r8, al
+  cmp r8, 1
+  jne .L41
+  mov rbx, 0
+  jmp .L42
+.L41:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L42:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 4
+  setle al
+  movzb r8, al
+  cmp r8, 1
+  jne .L43
+  mov rbx, 0
+  jmp .L44
+.L43:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L44:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  cmp r8, 4
+  setle al
+  movzb r8, al
+  cmp r8, 0
+  jne .L45
+  mov rbx, 0
+  jmp .L46
+.L45:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L46:
+#test/c/expression.c:36:     printf("test of logical expression...\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  mov r9, 2
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 1
+  jne .L47
+  mov rbx, 0
+  jmp .L48
+.L47:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L48:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  mov r9, 3
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 0
+  jne .L49
+  mov rbx, 0
+  jmp .L50
+.L49:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L50:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  add r8, 4
+  cmp r8, 8
+  setne al
+  movzb r8, al
+  cmp r8, 1
+  jne .L51
+  mov rbx, 0
+  jmp .L52
+.L51:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L52:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  add r8, 4
+  cmp r8, 7
+  setne al
+  movzb r8, al
+  cmp r8, 0
+  jne .L53
+  mov rbx, 0
+  jmp .L54
+.L53:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L54:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 0
+  je .L59
+  mov r8, 5
+  cmp r8, 0
+  jne .L57
+.L59:
+  mov r8, 0
+  jmp .L58
+.L57:
+  mov r8, 1
+.L58:
+  cmp r8, 1
+  jne .L55
+  mov rbx, 0
+  jmp .L56
+.L55:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L56:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 0
+  je .L64
+  mov r8, 0
+  cmp r8, 0
+  jne .L62
+.L64:
+  mov r8, 0
+  jmp .L63
+.L62:
+  mov r8, 1
+.L63:
+  cmp r8, 0
+  jne .L60
+  mov rbx, 0
+  jmp .L61
+.L60:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  je .L69
+  mov r8, 5
+  cmp r8, 0
+  jne .L67
+.L69:
+  mov r8, 0
+  jmp .L68
+.L67:
+  mov r8, 1
+.L68:
+  cmp r8, 0
+  jne .L65
+  mov rbx, 0
+  jmp .L66
+.L65:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L66:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  je .L74
+  mov r8, 0
+  cmp r8, 0
+  jne .L72
+.L74:
+  mov r8, 0
+  jmp .L73
+.L72:
+  mov r8, 1
+.L73:
+  cmp r8, 0
+  jne .L70
+  mov rbx, 0
+  jmp .L71
+.L70:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 0
+  jne .L77
+  mov r8, 5
+  cmp r8, 0
+  jne .L77
+  mov r8, 0
+  jmp .L78
+.L77:
+  mov r8, 1
+.L78:
+  cmp r8, 1
+  jne .L75
+  mov rbx, 0
+  jmp .L76
+.L75:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L76:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 0
+  jne .L81
+  mov r8, 0
+  cmp r8, 0
+  jne .L81
+  mov r8, 0
+  jmp .L82
+.L81:
+  mov r8, 1
+.L82:
+  cmp r8, 1
+  jne .L79
+  mov rbx, 0
+  jmp .L80
+.L79:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L80:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  jne .L85
+  mov r8, 5
+  cmp r8, 0
+  jne .L85
+  mov r8, 0
+  jmp .L86
+.L85:
+  mov r8, 1
+.L86:
+  cmp r8, 1
+  jne .L83
+  mov rbx, 0
+  jmp .L84
+.L83:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L84:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  jne .L89
+  mov r8, 0
+  cmp r8, 0
+  jne .L89
+  mov r8, 0
+  jmp .L90
+.L89:
+  mov r8, 1
+.L90:
+  cmp r8, 0
+  jne .L87
+  mov rbx, 0
+  jmp .L88
+.L87:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L88:
+#test/c/expression.c:50:     printf("test of short-circuit evaluation...\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/expression.c:51:     logic_calls = 0;
+  lea r8, [ rip + logic_calls ]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  je .L95
+  mov rdi, 1
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L93
+.L95:
+  mov r8, 0
+  jmp .L94
+.L93:
+  mov r8, 1
+.L94:
+  cmp r8, 0
+  jne .L91
+  mov rbx, 0
+  jmp .L92
+.L91:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L92:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + logic_calls ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L96
+  mov rbx, 0
+  jmp .L97
+.L96:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L97:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L100
+  mov rdi, 3
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L100
+  mov r8, 0
+  jmp .L101
+.L100:
+  mov r8, 1
+.L101:
+  cmp r8, 1
+  jne .L98
+  mov rbx, 0
+  jmp .L99
+.L98:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + logic_calls ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L102
+  mov rbx, 0
+  jmp .L103
+.L102:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 4
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  je .L108
+  mov rdi, 0
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L106
+.L108:
+  mov rdi, 5
+  sub rsp, 8
+  call logic_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L106
+  mov r8, 0
+  jmp .L107
+.L106:
+  mov r8, 1
+.L107:
+  cmp r8, 1
+  jne .L104
+  mov rbx, 0
+  jmp .L105
+.L104:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L105:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + logic_calls ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L109
+  mov rbx, 0
+  jmp .L110
+.L109:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L110:
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L115
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L113
+.L115:
+  mov r8, 0
+  jmp .L114
+.L113:
+  mov r8, 1
+.L114:
+  cmp r8, 0
+  jne .L111
+  mov rbx, 0
+  jmp .L112
+.L111:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L112:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L118
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L118
+  mov r8, 0
+  jmp .L119
+.L118:
+  mov r8, 1
+.L119:
+  cmp r8, 1
+  jne .L116
+  mov rbx, 0
+  jmp .L117
+.L116:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L117:
+  lea r8, [rbp - 12]
+  mov r9, 7
+  mov [r8], r9d
+  mov r8, r9
+#test/c/expression.c:62:     logic_p = &logic_v;
+  lea r8, [rbp - 12]
+  lea r9, [rbp - 8]
+  mov [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L124
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  je .L122
+.L124:
+  mov r8, 0
+  jmp .L123
+.L122:
+  mov r8, 1
+.L123:
+  cmp r8, 1
+  jne .L120
+  mov rbx, 0
+  jmp .L121
+.L120:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L121:
+#test/c/expression.c:65:     printf("test of multiply and divide by constants...\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/expression.c:67:     for(long sr_i = -6; sr_i <= 6; sr_i++){
+  mov r8, 0
+  sub r8, 6
+  lea r9, [rbp - 24]
+  mov [r9], r8
+  mov r8, r8
+.L125:
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 6
+  jg .L127
+#test/c/expression.c:68:         sr_bad += strength_mismatch(sr_i);
+  lea r8, [rbp - 16]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call strength_mismatch
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  lea r8, [rbp - 16]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:69:         sr_bad += strength_mismatch(sr_i * 987654321987);
+  lea r8, [rbp - 16]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov r9, 987654321987
+  imul r8, r9
+  mov rdi, r8
+  sub rsp, 8
+  call strength_mismatch
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  lea r8, [rbp - 16]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/expression.c:70:         sr_bad += strength_mismatch(sr_i * 1234567 + 89);
+  lea r8, [rbp - 16]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  imul r8, 1234567
+  add r8, 89
+  mov rdi, r8
+  sub rsp, 8
+  call strength_mismatch
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  lea r8, [rbp - 16]
+  mov [r8], ebx
+  mov r8, rbx
+.L126:
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 32]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 24]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  jmp .L125
+.L127:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L128
+  mov rbx, 0
+  jmp .L129
+.L128:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L129:
+  mov r8, 0
+  sub r8, 100
+  lea r9, [rbp - 36]
+  mov [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 8
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov r9, 0
+  sub r9, 12
+  cmp r8, r9
+  jne .L130
+  mov rbx, 0
+  jmp .L131
+.L130:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L131:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 8
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  mov r9, 0
+  sub r9, 4
+  cmp r8, r9
+  jne .L132
+  mov rbx, 0
+  jmp .L133
+.L132:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L133:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 7
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov r9, 0
+  sub r9, 14
+  cmp r8, r9
+  jne .L134
+  mov rbx, 0
+  jmp .L135
+.L134:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L135:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 7
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  mov r9, 0
+  sub r9, 2
+  cmp r8, r9
+  jne .L136
+  mov rbx, 0
+  jmp .L137
+.L136:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L137:
+  lea r8, [rbp - 40]
+  mov r9, 4000000000
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8d, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rax
+  mov r9, 1333333333
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 1
+  jne .L138
+  mov rbx, 0
+  jmp .L139
+.L138:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L139:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8d, DWORD PTR [r8]
+  mov r9, 7
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rdx
+  cmp r8, 3
+  jne .L140
+  mov rbx, 0
+  jmp .L141
+.L140:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L141:
+#test/c/expression.c:82:     printf("test of comma operator...\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  jne .L142
+  mov rbx, 0
+  jmp .L143
+.L142:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L143:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L144
+  mov rbx, 0
+  jmp .L145
+.L144:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L145:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 5
+  cmp r8, 5
+  jne .L146
+  mov rbx, 0
+  jmp .L147
+.L146:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L147:
+#test/c/expression.c:87:     printf("test of condition operator...\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 0
+  je .L150
+  mov r8, 6
+  jmp .L151
+.L150:
+  mov r8, 3
+.L151:
+  cmp r8, 6
+  jne .L148
+  mov rbx, 0
+  jmp .L149
+.L148:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L149:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  je .L154
+  mov r8, 6
+  jmp .L155
+.L154:
+  mov r8, 3
+.L155:
+  cmp r8, 3
+  jne .L152
+  mov rbx, 0
+  jmp .L153
+.L152:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L153:
+#test/c/expression.c:91:     printf("test of unary...\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 10
+  mov r9, 0
+  sub r9, r8
+  cmp r9, 10
+  jne .L156
+  mov rbx, 0
+  jmp .L157
+.L156:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L157:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 10
+  mov r9, 0
+  sub r9, r8
+  cmp r9, 10
+  jne .L158
+  mov rbx, 0
+  jmp .L159
+.L158:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L159:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 10
+  add r8, 20
+  cmp r8, 10
+  jne .L160
+  mov rbx, 0
+  jmp .L161
+.L160:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L161:
+  lea r8, [rbp - 44]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/expression.c:96:     ++u;    // u -> 1
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L162
+  mov rbx, 0
+  jmp .L163
+.L162:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L163:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 48]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L164
+  mov rbx, 0
+  jmp .L165
+.L164:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L165:
+#test/c/expression.c:99:     --u;    // u -> 1
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L166
+  mov rbx, 0
+  jmp .L167
+.L166:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L167:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+  cmp r8, 0
+  jne .L168
+  mov rbx, 0
+  jmp .L169
+.L168:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L169:
+  lea r8, [rbp - 52]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 56]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 52]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L170
+  mov rbx, 0
+  jmp .L171
+.L170:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L171:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L172
+  mov rbx, 0
+  jmp .L173
+.L172:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L173:
+  lea r8, [rbp - 60]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 64]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 60]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 64]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L174
+  mov rbx, 0
+  jmp .L175
+.L174:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L175:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L176
+  mov rbx, 0
+  jmp .L177
+.L176:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L177:
+#test/c/expression.c:112:     for(int i = 0; i < 10; ++i){
+  lea r8, [rbp - 108]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L178:
+  lea r8, [rbp - 108]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jge .L180
+#test/c/expression.c:113:         idlist[i] = i;
+  lea r8, [rbp - 108]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 104]
+  lea rcx, [rbp - 108]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L179:
+  lea r8, [rbp - 108]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 108]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L178
+.L180:
+  lea r8, [rbp - 104]
+  lea r9, [rbp - 120]
+  mov [r9], r8
+  mov r8, r8
+#test/c/expression.c:117:     incp++;
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 128]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  lea r9, [rbp - 120]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 128]
+  mov r8, QWORD PTR [r8]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L181
+  mov rbx, 0
+  jmp .L182
+.L181:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L182:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  lea r9, [rbp - 120]
+  mov [r9], r8
+  mov r8, r8
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L183
+  mov rbx, 0
+  jmp .L184
+.L183:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L184:
+#test/c/expression.c:121:     incp--;
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 136]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 4
+  sub r8, r9
+  lea r9, [rbp - 120]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 136]
+  mov r8, QWORD PTR [r8]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L185
+  mov rbx, 0
+  jmp .L186
+.L185:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L186:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 120]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 4
+  sub r8, r9
+  lea r9, [rbp - 120]
+  mov [r9], r8
+  mov r8, r8
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L187
+  mov rbx, 0
+  jmp .L188
+.L187:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L188:
+#test/c/expression.c:125:     printf("test of not operator...\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 6
+  mov r9, 0
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 0
+  jne .L189
+  mov rbx, 0
+  jmp .L190
+.L189:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L190:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  mov r9, 0
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 1
+  jne .L191
+  mov rbx, 0
+  jmp .L192
+.L191:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L192:
+#test/c/expression.c:129:     printf("test of sizeof ...\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L193
+  mov rbx, 0
+  jmp .L194
+.L193:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L194:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L195
+  mov rbx, 0
+  jmp .L196
+.L195:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L196:
+  lea r8, [rbp - 140]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L197
+  mov rbx, 0
+  jmp .L198
+.L197:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L198:
+  lea r8, [rbp - 140]
+  lea r9, [rbp - 152]
+  mov [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L199
+  mov rbx, 0
+  jmp .L200
+.L199:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L200:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L201
+  mov rbx, 0
+  jmp .L202
+.L201:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L202:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L203
+  mov rbx, 0
+  jmp .L204
+.L203:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L204:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L205
+  mov rbx, 0
+  jmp .L206
+.L205:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L206:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L207
+  mov rbx, 0
+  jmp .L208
+.L207:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L208:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L209
+  mov rbx, 0
+  jmp .L210
+.L209:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L210:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L211
+  mov rbx, 0
+  jmp .L212
+.L211:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L212:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L213
+  mov rbx, 0
+  jmp .L214
+.L213:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L214:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  cmp r8, 2
+  jne .L215
+  mov rbx, 0
+  jmp .L216
+.L215:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L216:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L217
+  mov rbx, 0
+  jmp .L218
+.L217:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L218:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L219
+  mov rbx, 0
+  jmp .L220
+.L219:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L220:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L221
+  mov rbx, 0
+  jmp .L222
+.L221:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L222:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L223
+  mov rbx, 0
+  jmp .L224
+.L223:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L224:
+#test/c/expression.c:158:     printf("test of full of register ...\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/expression.c:161:     for(int i = 0; i < 3; i++){
+  lea r8, [rbp - 180]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L225:
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jge .L227
+#test/c/expression.c:162:         reg1[i] = 3 - i;
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  sub r9, r8
+  lea r8, [rbp - 164]
+  lea rcx, [rbp - 180]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r8, rcx
+  mov [r8], r9d
+  mov r8, r9
+.L226:
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 184]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 180]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 184]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L225
+.L227:
+  lea r8, [rbp - 164]
+  lea r9, [rbp - 192]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 176]
+  lea r9, [rbp - 200]
+  mov [r9], r8
+  mov r8, r8
+#test/c/expression.c:166:     for(int i = 0; i < 3; i++){
+  lea r8, [rbp - 204]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L228:
+  lea r8, [rbp - 204]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jge .L230
+#test/c/expression.c:167:         *preg2++ = *preg1++;
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 224]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 192]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  lea r9, [rbp - 192]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 224]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 200]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 216]
+  mov [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 200]
+  mov r9, QWORD PTR [r9]
+  mov rcx, 1
+  imul rcx, 4
+  add r9, rcx
+  lea rcx, [rbp - 200]
+  mov [rcx], r9
+  mov r9, r9
+  lea r9, [rbp - 216]
+  mov r9, QWORD PTR [r9]
+  mov [r9], r8d
+  mov r8, r8
+.L229:
+  lea r8, [rbp - 204]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 208]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 204]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 204]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 208]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L228
+.L230:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 176]
+  mov r9, 0
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L231
+  mov rbx, 0
+  jmp .L232
+.L231:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L232:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 176]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L233
+  mov rbx, 0
+  jmp .L234
+.L233:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L234:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 176]
+  mov r9, 2
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L235
+  mov rbx, 0
+  jmp .L236
+.L235:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L236:
+#test/c/expression.c:173:     printf("test of signed and unsigned arithmetic ...\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  mov r8, 0
+  sub r8, 7
+  lea r9, [rbp - 232]
+  mov [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  mov r9, 2
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov r9, 0
+  sub r9, 3
+  cmp r8, r9
+  jne .L237
+  mov rbx, 0
+  jmp .L238
+.L237:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L238:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  mov r9, 2
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L239
+  mov rbx, 0
+  jmp .L240
+.L239:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L240:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  sar r8, 1
+  mov r9, 0
+  sub r9, 4
+  cmp r8, r9
+  jne .L241
+  mov rbx, 0
+  jmp .L242
+.L241:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L242:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 232]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 1
+  setl al
+  movzb r8, al
+  cmp r8, 1
+  jne .L243
+  mov rbx, 0
+  jmp .L244
+.L243:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L244:
+  lea r8, [rbp - 240]
+  mov r9, 0
+  mov [r8], r9
+  mov r8, r9
+#test/c/expression.c:180:     ul = ul - 1;
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 240]
+  mov [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  mov r9, 5
+  cmp r9, r8
+  setb al
+  movzb r8, al
+  cmp r8, 1
+  jne .L245
+  mov rbx, 0
+  jmp .L246
+.L245:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L246:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 5
+  setbe al
+  movzb r8, al
+  cmp r8, 0
+  jne .L247
+  mov rbx, 0
+  jmp .L248
+.L247:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L248:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  shr r8, 60
+  cmp r8, 15
+  jne .L249
+  mov rbx, 0
+  jmp .L250
+.L249:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L250:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1152921504606846976
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rax
+  cmp r8, 15
+  jne .L251
+  mov rbx, 0
+  jmp .L252
+.L251:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L252:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 240]
+  mov r8, QWORD PTR [r8]
+  mov r9, 16
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rdx
+  cmp r8, 15
+  jne .L253
+  mov rbx, 0
+  jmp .L254
+.L253:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L254:
+  lea r8, [rbp - 244]
+  mov r9, 7
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 244]
+  mov r8d, DWORD PTR [r8]
+  mov r9, 2
+  mov rax, r8
+  xor edx, edx
+  div r9
+  mov r8, rax
+  cmp r8, 3
+  jne .L255
+  mov rbx, 0
+  jmp .L256
+.L255:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L256:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 7
+  mov r9, 2
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov r9, 0
+  sub r9, 3
+  cmp r8, r9
+  jne .L257
+  mov rbx, 0
+  jmp .L258
+.L257:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L258:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  sal r8, 40
+  sar r8, 38
+  cmp r8, 4
+  jne .L259
+  mov rbx, 0
+  jmp .L260
+.L259:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L260:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 300
+# cast st
+  movsx r8, r8b
+  cmp r8, 44
+  jne .L261
+  mov rbx, 0
+  jmp .L262
+.L261:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L262:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L263
+  mov rbx, 0
+  jmp .L264
+.L263:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L264:
+  mov r8, 4
+  imul r8, 8
+  lea r9, [rbp - 248]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/expression.c:193:     if(0){
+  mov r8, 0
+  cmp r8, 0
+  je .L265
+#test/c/expression.c:194:         folded = 0;
+  lea r8, [rbp - 248]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L265:
+#test/c/expression.c:196:     while(0){
+.L266:
+  mov r8, 0
+  cmp r8, 0
+  je .L267
+#test/c/expression.c:197:         folded = 1;
+  lea r8, [rbp - 248]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+  jmp .L266
+.L267:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 248]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 32
+  jne .L268
+  mov rbx, 0
+  jmp .L269
+.L268:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L269:
+#test/c/expression.c:201:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_expression
+ret_test_expression:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,1341 @@
+.intel_syntax noprefix
+.global fr_keep
+.global fr_leaf
+.global tc_addr
+.global tc_odd
+.global tc_even
+.global tc_gcd
+.global tc_sum
+.global inl_swap_sum
+.global inl_twice
+.global inl_add1
+.global inl_fact
+.global combine
+.global times_ten
+.global void_func
+.global get_pointer
+.global g_func_a
+.global test_function
+.global test_static
+  .data
+.LSTR6:
+  .string "test of tail call..\n"
+  .data
+.LSTR5:
+  .string "test of frame layout..\n"
+  .data
+.LSTR4:
+  .string "test of inline expansion..\n"
+  .data
+.LSTR3:
+  .string "test of value live across function call..\n"
+  .data
+.LSTR2:
+  .string "test of nested function call..\n"
+  .data
+.LSTR1:
+  .string "test of void function call..\n"
+  .data
+.LSTR0:
+  .string "test of function call..\n"
+  .bss
+g_func_a:
+  .zero 4
+  .bss
+.Ltest_static:
+  .zero 4
+# fr_keep
+#	 stack size: 32
+#	 z( ofs: 32, size: 8) : level0
+#	 y( ofs: 24, size: 8) : level0
+#	 x( ofs: 16, size: 8) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+fr_keep:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  imul r8, 2
+  lea r9, [rbp - 16]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 24]
+  mov [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov rbx, rax
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  lea r8, [rbp - 32]
+  mov [r8], rbx
+  mov r8, rbx
+#test/c/function.c:114:     return x + y + z + times_ten(y);
+  lea r8, [rbp - 16]
+  mov rbx, QWORD PTR [r8]
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  add rbx, r8
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  add rbx, r8
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  mov rax, rbx
+  jmp ret_fr_keep
+ret_fr_keep:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# fr_leaf
+#	 stack size: 56
+#	 i( ofs: 52, size: 4) : level0
+#	 s( ofs: 48, size: 4) : level0
+#	 i( ofs: 40, size: 4) : level0
+#	 a( ofs: 36, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+fr_leaf:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+#test/c/function.c:99:     for(int i = 0; i < 8; i++){
+  lea r8, [rbp - 40]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L0:
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 8
+  jge .L2
+#test/c/function.c:100:         a[i] = i * n;
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  imul r8, r9
+  lea r9, [rbp - 36]
+  lea rcx, [rbp - 40]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L1:
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 40]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L0
+.L2:
+  lea r8, [rbp - 48]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/function.c:103:     for(int i = 0; i < 8; i++){
+  lea r8, [rbp - 52]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L3:
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 8
+  jge .L5
+#test/c/function.c:104:         s = s + a[i];
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 36]
+  lea rcx, [rbp - 52]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 48]
+  mov [r9], r8d
+  mov r8, r8
+.L4:
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 56]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 52]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L3
+.L5:
+#test/c/function.c:106:     return s;
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_fr_leaf
+ret_fr_leaf:
+  pop rbp
+  ret
+# tc_addr
+#	 stack size: 16
+#	 x( ofs: 16, size: 4) : level0
+#	 p( ofs: 12, size: 8) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_addr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+  mov [rbp - 12], rsi
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:92:     if(n == 0) return *p;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L6
+#test/c/function.c:92:     if(n == 0) return *p;
+  lea r8, [rbp - 12]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_tc_addr
+.L6:
+#test/c/function.c:93:     return tc_addr(n - 1, &x);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 16]
+  mov rdi, r8
+  mov rsi, r9
+  call tc_addr
+  mov r8, rax
+  mov rax, r8
+  jmp ret_tc_addr
+ret_tc_addr:
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_odd
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_odd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+#test/c/function.c:81:     if(n == 0) return 0;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L7
+#test/c/function.c:81:     if(n == 0) return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_tc_odd
+.L7:
+#test/c/function.c:82:     return tc_even(n - 1);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  mov rdi, r8
+  call tc_even
+  mov r8, rax
+  mov rax, r8
+  jmp ret_tc_odd
+ret_tc_odd:
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_even
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_even:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+#test/c/function.c:86:     if(n == 0) return 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L8
+#test/c/function.c:86:     if(n == 0) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_tc_even
+.L8:
+#test/c/function.c:87:     return tc_odd(n - 1);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  mov rdi, r8
+  call tc_odd
+  mov r8, rax
+  mov rax, r8
+  jmp ret_tc_even
+ret_tc_even:
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_gcd
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+tc_gcd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+#test/c/function.c:72:     if(b == 0){
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L9
+#test/c/function.c:73:         return a;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_tc_gcd
+.L9:
+#test/c/function.c:75:     return tc_gcd(b, a % b);
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  lea rcx, [rbp - 8]
+  movsxd rcx, DWORD PTR [rcx]
+  mov rax, r9
+  cqo
+  idiv rcx
+  mov r9, rdx
+  mov rdi, r8
+  mov rsi, r9
+  call tc_gcd
+  mov r8, rax
+  mov rax, r8
+  jmp ret_tc_gcd
+ret_tc_gcd:
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_sum
+#	 stack size: 16
+#	 acc( ofs: 16, size: 8) : level0
+#	 n( ofs: 8, size: 8) : level0
+  .text
+tc_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+#test/c/function.c:67:     if(n == 0) return acc;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  jne .L10
+#test/c/function.c:67:     if(n == 0) return acc;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_tc_sum
+.L10:
+#test/c/function.c:68:     return tc_sum(n - 1, acc + n);
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 8]
+  mov rcx, QWORD PTR [rcx]
+  add r9, rcx
+  mov rdi, r8
+  mov rsi, r9
+  call tc_sum
+  mov r8, rax
+  mov rax, r8
+  jmp ret_tc_sum
+ret_tc_sum:
+  mov rsp, rbp
+  pop rbp
+  ret
+# inl_swap_sum
+#	 stack size: 12
+#	 t( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+inl_swap_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:60:     a = b;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:61:     b = t;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:62:     inl_store(&t, a * 10 + b);
+  lea r8, [rbp - 12]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 10
+  lea rcx, [rbp - 8]
+  movsxd rcx, DWORD PTR [rcx]
+  add r9, rcx
+  mov rdi, r8
+  mov rsi, r9
+  call inl_store
+  mov r8, rax
+#test/c/function.c:63:     return t;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inl_swap_sum
+ret_inl_swap_sum:
+  mov rsp, rbp
+  pop rbp
+  ret
+# inl_store
+#	 stack size: 16
+#	 tmp( ofs: 16, size: 4) : level0
+#	 v( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+inl_store:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:55:     *p = tmp;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  mov [r9], r8d
+  mov r8, r8
+ret_inl_store:
+  pop rbp
+  ret
+# inl_twice
+#	 stack size: 12
+#	 b( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 4) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+inl_twice:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp - 4], edi
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  call inl_add1
+  mov r8, rax
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  call inl_add1
+  mov r8, rax
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:50:     return a + b;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_inl_twice
+ret_inl_twice:
+  mov rsp, rbp
+  pop rbp
+  ret
+# inl_add1
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+inl_add1:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+#test/c/function.c:44:     return x + 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  mov rax, r8
+  jmp ret_inl_add1
+ret_inl_add1:
+  pop rbp
+  ret
+# inl_fact
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inl_fact:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  mov [rbp - 4], edi
+#test/c/function.c:39:     if(n <= 1) return 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jg .L11
+#test/c/function.c:39:     if(n <= 1) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_inl_fact
+.L11:
+#test/c/function.c:40:     return n * inl_fact(n - 1);
+  lea r8, [rbp - 4]
+  movsxd rbx, DWORD PTR [r8]
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call inl_fact
+  add rsp, 8
+  mov r8, rax
+  imul rbx, r8
+  mov rax, rbx
+  jmp ret_inl_fact
+ret_inl_fact:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inl_once
+#	 stack size: 16
+#	 i( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inl_once:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/function.c:31:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L12:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L14
+#test/c/function.c:32:         if(i == 5) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L15
+#test/c/function.c:32:         if(i == 5) break;
+  jmp .L14
+.L15:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L13:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L12
+.L14:
+#test/c/function.c:35:     return s;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inl_once
+ret_inl_once:
+  pop rbp
+  ret
+# inl_clamp
+#	 stack size: 12
+#	 hi( ofs: 12, size: 4) : level0
+#	 lo( ofs: 8, size: 4) : level0
+#	 v( ofs: 4, size: 4) : level0
+  .text
+inl_clamp:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+  mov [rbp - 12], edx
+#test/c/function.c:24:     if(v < lo) return lo;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L16
+#test/c/function.c:24:     if(v < lo) return lo;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inl_clamp
+.L16:
+#test/c/function.c:25:     if(v > hi) return hi;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L17
+#test/c/function.c:25:     if(v > hi) return hi;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inl_clamp
+.L17:
+#test/c/function.c:26:     return v;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inl_clamp
+ret_inl_clamp:
+  pop rbp
+  ret
+# combine
+#	 stack size: 12
+#	 c( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+combine:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+  mov [rbp - 12], edx
+#test/c/function.c:20:     return a * 100 + b * 10 + c;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 100
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 10
+  add r8, r9
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_combine
+ret_combine:
+  pop rbp
+  ret
+# times_ten
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+times_ten:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+#test/c/function.c:16:     return x * 10;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  mov rax, r8
+  jmp ret_times_ten
+ret_times_ten:
+  pop rbp
+  ret
+# void_func
+#	 stack size: 0
+  .text
+void_func:
+  push rbp
+  mov rbp, rsp
+#test/c/function.c:12:     return;
+  jmp ret_void_func
+ret_void_func:
+  pop rbp
+  ret
+# get_pointer
+#	 stack size: 8
+#	 a( ofs: 8, size: 8) : level0
+  .text
+get_pointer:
+  push rbp
+  mov rbp, rsp
+  lea r8, [ rip + g_func_a ]
+  lea r9, [rbp - 8]
+  mov [r9], r8
+  mov r8, r8
+#test/c/function.c:7:     *a = 30;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 30
+  mov [r8], r9d
+  mov r8, r9
+#test/c/function.c:8:     return a;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_get_pointer
+ret_get_pointer:
+  pop rbp
+  ret
+# test_function
+#	 stack size: 28
+#	 w( ofs: 28, size: 4) : level0
+#	 z( ofs: 24, size: 4) : level0
+#	 y( ofs: 20, size: 4) : level0
+#	 x( ofs: 16, size: 4) : level0
+#	 c( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+test_function:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+#test/c/function.c:119:     printf("test of function call..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  sub rsp, 8
+  call get_pointer
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 8]
+  mov [r9], r8
+  mov r8, r8
+#test/c/function.c:122:     c = *p;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/function.c:125:     ((*p) == (30) ? 0 : exit(1));
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 30
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#test/c/function.c:127:     printf("test of void function call..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/function.c:128:     void_func();
+  sub rsp, 8
+  call void_func
+  add rsp, 8
+  mov r8, rax
+#test/c/function.c:130:     printf("test of nested function call..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov r8, rax
+  mov r9, 10
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov rdi, 1
+  mov rsi, r8
+  mov rdx, 3
+  sub rsp, 8
+  call combine
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 123
+  jne .L20
+  mov rbx, 0
+  jmp .L21
+.L20:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov rbx, rax
+  mov r8, 10
+  mov rax, rbx
+  cqo
+  idiv r8
+  mov rbx, rax
+  mov rdi, 3
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov r8, rax
+  mov r9, 10
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  mov rdi, rbx
+  mov rsi, 2
+  mov rdx, r8
+  sub rsp, 8
+  call combine
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 123
+  jne .L22
+  mov rbx, 0
+  jmp .L23
+.L22:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L23:
+#test/c/function.c:134:     printf("test of value live across function call..\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 16]
+  mov r9, 4
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 20]
+  mov r9, 5
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call times_ten
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  cmp r8, 54
+  jne .L24
+  mov rbx, 0
+  jmp .L25
+.L24:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L25:
+#test/c/function.c:140:     printf("test of inline expansion..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 3
+  mov rdi, r8
+  mov rsi, 0
+  mov rdx, 10
+  sub rsp, 8
+  call inl_clamp
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L26
+  mov rbx, 0
+  jmp .L27
+.L26:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L27:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 0
+  mov rdx, 10
+  sub rsp, 8
+  call inl_clamp
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 3
+  jne .L28
+  mov rbx, 0
+  jmp .L29
+.L28:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 30
+  mov rsi, 0
+  mov rdx, 10
+  sub rsp, 8
+  call inl_clamp
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 10
+  jne .L30
+  mov rbx, 0
+  jmp .L31
+.L30:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  sub rsp, 8
+  call inl_once
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 10
+  jne .L32
+  mov rbx, 0
+  jmp .L33
+.L32:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5
+  sub rsp, 8
+  call inl_fact
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 120
+  jne .L34
+  mov rbx, 0
+  jmp .L35
+.L34:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call inl_twice
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 9
+  jne .L36
+  mov rbx, 0
+  jmp .L37
+.L36:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L37:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call inl_twice
+  add rsp, 8
+  mov r8, rax
+  mov rdi, r8
+  sub rsp, 8
+  call inl_twice
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 13
+  jne .L38
+  mov rbx, 0
+  jmp .L39
+.L38:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  mov rsi, 2
+  sub rsp, 8
+  call inl_swap_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 21
+  jne .L40
+  mov rbx, 0
+  jmp .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L41:
+  lea r8, [rbp - 28]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/function.c:150:     inl_store(&w, 7);
+  lea r8, [rbp - 28]
+  mov rdi, r8
+  mov rsi, 7
+  sub rsp, 8
+  call inl_store
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L42
+  mov rbx, 0
+  jmp .L43
+.L42:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L43:
+#test/c/function.c:153:     printf("test of frame layout..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 84
+  jne .L44
+  mov rbx, 0
+  jmp .L45
+.L44:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call fr_keep
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 160
+  jne .L46
+  mov rbx, 0
+  jmp .L47
+.L46:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L47:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  mov rdi, r8
+  sub rsp, 8
+  call fr_keep
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 4480
+  jne .L48
+  mov rbx, 0
+  jmp .L49
+.L48:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L49:
+#test/c/function.c:158:     printf("test of tail call..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1000
+  mov rsi, 0
+  sub rsp, 8
+  call tc_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 500500
+  jne .L50
+  mov rbx, 0
+  jmp .L51
+.L50:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1071
+  mov rsi, 462
+  sub rsp, 8
+  call tc_gcd
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 21
+  jne .L52
+  mov rbx, 0
+  jmp .L53
+.L52:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1001
+  sub rsp, 8
+  call tc_even
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L54
+  mov rbx, 0
+  jmp .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1001
+  sub rsp, 8
+  call tc_odd
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L56
+  mov rbx, 0
+  jmp .L57
+.L56:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 28]
+  mov rdi, 5
+  mov rsi, r8
+  sub rsp, 8
+  call tc_addr
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L58
+  mov rbx, 0
+  jmp .L59
+.L58:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L59:
+#test/c/function.c:170:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_function
+ret_test_function:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,1023 @@
+.intel_syntax noprefix
+.global am_global
+.global am_len
+.global am_max
+.global am_sum_tag
+.global am_sum_side
+.global am_table
+.global set_through
+.global test_pointer
+.global test_static
+  .data
+.LSTR1:
+  .string "address"
+  .data
+.LSTR0:
+  .string "test of addressing mode..\n"
+  .bss
+  .align 8
+am_table:
+  .zero 64
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# am_global
+#	 stack size: 4
+#	 i( ofs: 4, size: 4) : level0
+  .text
+am_global:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+#test/c/pointer.c:123:     am_table[i] = i * 3;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [ rip + am_table ]
+  lea rcx, [rbp - 4]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r9, rcx
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#test/c/pointer.c:124:     return am_table[i] + am_table[0];
+  lea r8, [ rip + am_table ]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + am_table ]
+  mov rcx, 0
+  imul rcx, 8
+  add r9, rcx
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_am_global
+ret_am_global:
+  pop rbp
+  ret
+# am_len
+#	 stack size: 24
+#	 n( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 8) : level0
+  .text
+am_len:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/pointer.c:115:     while(*s){
+.L0:
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  je .L1
+#test/c/pointer.c:116:         n++;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+#test/c/pointer.c:117:         s++;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  jmp .L0
+.L1:
+#test/c/pointer.c:119:     return n;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_am_len
+ret_am_len:
+  pop rbp
+  ret
+# am_max
+#	 stack size: 32
+#	 i( ofs: 28, size: 4) : level0
+#	 m( ofs: 24, size: 8) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+am_max:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#test/c/pointer.c:105:     for(int i = 1; i < n; i++){
+  lea r8, [rbp - 28]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L2:
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L4
+#test/c/pointer.c:106:         if(m < a[i]){
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 28]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r9, rcx
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  jge .L5
+#test/c/pointer.c:107:             m = a[i];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 28]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L5:
+.L3:
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 32]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 28]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L2
+.L4:
+#test/c/pointer.c:110:     return m;
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_am_max
+ret_am_max:
+  pop rbp
+  ret
+# am_sum_tag
+#	 stack size: 24
+#	 sum( ofs: 24, size: 8) : level0
+#	 tag( ofs: 9, size: 1) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+am_sum_tag:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  mov [rbp - 9], sil
+  lea r8, [rbp - 24]
+  mov r9, 0
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/pointer.c:94:     while(p){
+.L6:
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L7
+#test/c/pointer.c:95:         if(p->tag == tag){
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 9]
+  movsx r9, BYTE PTR [r9]
+  cmp r8, r9
+  jne .L8
+#test/c/pointer.c:96:             sum += p->val;
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 8
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L8:
+#test/c/pointer.c:98:         p = p->next;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 16
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  jmp .L6
+.L7:
+#test/c/pointer.c:100:     return sum;
+  lea r8, [rbp - 24]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_am_sum_tag
+ret_am_sum_tag:
+  pop rbp
+  ret
+# am_sum_side
+#	 stack size: 12
+#	 i( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+am_sum_side:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+#test/c/pointer.c:89:     return a[i + 1] + a[i - 1];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r9, 1
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 12]
+  movsxd rcx, DWORD PTR [rcx]
+  sub rcx, 1
+  imul rcx, 8
+  add r9, rcx
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_am_sum_side
+ret_am_sum_side:
+  pop rbp
+  ret
+# set_through
+#	 stack size: 12
+#	 v( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+set_through:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+#test/c/pointer.c:85:     *p = v;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+ret_set_through:
+  pop rbp
+  ret
+# test_pointer
+#	 stack size: 224
+#	 n1( ofs: 224, size: 24) : level0
+#	 n2( ofs: 200, size: 24) : level0
+#	 n3( ofs: 176, size: 24) : level0
+#	 i( ofs: 148, size: 4) : level0
+#	 la( ofs: 144, size: 40) : level0
+#	 twice( ofs: 100, size: 4) : level0
+#	 ap( ofs: 96, size: 8) : level0
+#	 ai( ofs: 84, size: 4) : level0
+#	 arr( ofs: 80, size: 16) : level0
+#	 lp( ofs: 64, size: 8) : level0
+#	 ld( ofs: 56, size: 8) : level0
+#	 sp( ofs: 48, size: 8) : level0
+#	 sd( ofs: 34, size: 2) : level0
+#	 cp( ofs: 32, size: 8) : level0
+#	 cd( ofs: 17, size: 1) : level0
+#	 a( ofs: 16, size: 8) : level0
+#	 data( ofs: 4, size: 4) : level0
+  .text
+test_pointer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  push rbx
+#test/c/pointer.c:18:     int data; data = 10;
+  lea r8, [rbp - 4]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/pointer.c:19:     int* a; a = &data;
+  lea r8, [rbp - 4]
+  lea r9, [rbp - 16]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L9
+  mov rbx, 0
+  jmp .L10
+.L9:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L10:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 4]
+  cmp r8, r9
+  jne .L11
+  mov rbx, 0
+  jmp .L12
+.L11:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L12:
+#test/c/pointer.c:22:     *a = 15;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  mov r9, 15
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 15
+  jne .L13
+  mov rbx, 0
+  jmp .L14
+.L13:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L14:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L15
+  mov rbx, 0
+  jmp .L16
+.L15:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L16:
+  lea r8, [rbp - 17]
+  mov r9, 10
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+  lea r8, [rbp - 17]
+  lea r9, [rbp - 32]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 10
+  jne .L17
+  mov rbx, 0
+  jmp .L18
+.L17:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L18:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 17]
+  cmp r8, r9
+  jne .L19
+  mov rbx, 0
+  jmp .L20
+.L19:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L20:
+#test/c/pointer.c:30:     *cp = 15;
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+  mov r9, 15
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 15
+  jne .L21
+  mov rbx, 0
+  jmp .L22
+.L21:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L22:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L23
+  mov rbx, 0
+  jmp .L24
+.L23:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L24:
+  lea r8, [rbp - 34]
+  mov r9, 10
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+  lea r8, [rbp - 34]
+  lea r9, [rbp - 48]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 48]
+  mov r8, QWORD PTR [r8]
+  movsx r8, WORD PTR [r8]
+  cmp r8, 10
+  jne .L25
+  mov rbx, 0
+  jmp .L26
+.L25:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L26:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 48]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 34]
+  cmp r8, r9
+  jne .L27
+  mov rbx, 0
+  jmp .L28
+.L27:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L28:
+#test/c/pointer.c:38:     *sp = 15;
+  lea r8, [rbp - 48]
+  mov r8, QWORD PTR [r8]
+  mov r9, 15
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 34]
+  movsx r8, WORD PTR [r8]
+  cmp r8, 15
+  jne .L29
+  mov rbx, 0
+  jmp .L30
+.L29:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L30:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L31
+  mov rbx, 0
+  jmp .L32
+.L31:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L32:
+  lea r8, [rbp - 56]
+  mov r9, 10
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+  lea r8, [rbp - 56]
+  lea r9, [rbp - 64]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 64]
+  mov r8, QWORD PTR [r8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 10
+  jne .L33
+  mov rbx, 0
+  jmp .L34
+.L33:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L34:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 64]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 56]
+  cmp r8, r9
+  jne .L35
+  mov rbx, 0
+  jmp .L36
+.L35:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L36:
+#test/c/pointer.c:46:     *lp = 15;
+  lea r8, [rbp - 64]
+  mov r8, QWORD PTR [r8]
+  mov r9, 15
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 56]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 15
+  jne .L37
+  mov rbx, 0
+  jmp .L38
+.L37:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L38:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L39
+  mov rbx, 0
+  jmp .L40
+.L39:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L40:
+#test/c/pointer.c:51:     arr[1] = 3;
+  lea r8, [rbp - 80]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  mov r9, 3
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 84]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 80]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  lea r9, [rbp - 96]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [rbp - 80]
+  lea r9, [rbp - 84]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 80]
+  lea rcx, [rbp - 84]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 100]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#test/c/pointer.c:55:     *ap = 10;
+  lea r8, [rbp - 96]
+  mov r8, QWORD PTR [r8]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 100]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 6
+  jne .L41
+  mov rbx, 0
+  jmp .L42
+.L41:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L42:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 80]
+  lea r9, [rbp - 84]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 80]
+  lea rcx, [rbp - 84]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  cmp r8, 20
+  jne .L43
+  mov rbx, 0
+  jmp .L44
+.L43:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L44:
+#test/c/pointer.c:58:     set_through(ap, 7);
+  lea r8, [rbp - 96]
+  mov r8, QWORD PTR [r8]
+  mov rdi, r8
+  mov rsi, 7
+  sub rsp, 8
+  call set_through
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 80]
+  lea r9, [rbp - 84]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 80]
+  lea rcx, [rbp - 84]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  imul r8, r9
+  cmp r8, 49
+  jne .L45
+  mov rbx, 0
+  jmp .L46
+.L45:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L46:
+#test/c/pointer.c:61:     printf("test of addressing mode..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/pointer.c:63:     for(int i = 0; i < 5; i++){
+  lea r8, [rbp - 148]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L47:
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L49
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 148]
+  movsxd r9, DWORD PTR [r9]
+  imul r8, r9
+  add r8, 1
+  lea r9, [rbp - 144]
+  lea rcx, [rbp - 148]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r9, rcx
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+.L48:
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 152]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 148]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 152]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L47
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 144]
+  mov rdi, r8
+  mov rsi, 2
+  sub rsp, 8
+  call am_sum_side
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 12
+  jne .L50
+  mov rbx, 0
+  jmp .L51
+.L50:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 144]
+  mov rdi, r8
+  mov rsi, 5
+  sub rsp, 8
+  call am_max
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 17
+  jne .L52
+  mov rbx, 0
+  jmp .L53
+.L52:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L53:
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  lea r8, [rbp - 224]
+  add r8, 0
+  mov r9, 2
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  lea r8, [rbp - 224]
+  add r8, 8
+  mov r9, 10
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  lea r8, [rbp - 200]
+  lea r9, [rbp - 224]
+  add r9, 16
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  lea r8, [rbp - 200]
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  lea r8, [rbp - 200]
+  add r8, 8
+  mov r9, 20
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  lea r8, [rbp - 176]
+  lea r9, [rbp - 200]
+  add r9, 16
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  lea r8, [rbp - 176]
+  add r8, 0
+  mov r9, 2
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  lea r8, [rbp - 176]
+  add r8, 8
+  mov r9, 30
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  lea r8, [rbp - 176]
+  add r8, 16
+  mov r9, 0
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 224]
+  mov rdi, r8
+  mov rsi, 2
+  sub rsp, 8
+  call am_sum_tag
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 40
+  jne .L54
+  mov rbx, 0
+  jmp .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 224]
+  mov rdi, r8
+  mov rsi, 1
+  sub rsp, 8
+  call am_sum_tag
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 20
+  jne .L56
+  mov rbx, 0
+  jmp .L57
+.L56:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  sub rsp, 8
+  call am_len
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 7
+  jne .L58
+  mov rbx, 0
+  jmp .L59
+.L58:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5
+  sub rsp, 8
+  call am_global
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 15
+  jne .L60
+  mov rbx, 0
+  jmp .L61
+.L60:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call am_global
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L62
+  mov rbx, 0
+  jmp .L63
+.L62:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + am_table ]
+  mov r9, 5
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  cmp r8, 15
+  jne .L64
+  mov rbx, 0
+  jmp .L65
+.L64:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L65:
+#test/c/pointer.c:81:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_pointer
+ret_test_pointer:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
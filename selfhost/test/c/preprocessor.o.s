@@ -0,0 +1,325 @@
+.intel_syntax noprefix
+.global test_preprocess
+.global test_static
+  .data
+.LSTR2:
+  .string "test of preprocess if directive..\n"
+  .data
+.LSTR1:
+  .string "test of preprocess if-group..\n"
+  .data
+.LSTR0:
+  .string "test of preprocess..\n"
+  .bss
+.Ltest_static:
+  .zero 4
+# test_preprocess
+#	 stack size: 256
+#	 func_arg_owner( ofs: 256, size: 4) : level0
+#	 TEST_CIRC_A( ofs: 252, size: 4) : level0
+#	 pp_ans( ofs: 248, size: 4) : level0
+#	 a( ofs: 244, size: 4) : level0
+#	 __spill_area__( ofs: 240, size: 1) : level0
+  .text
+test_preprocess:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/preprocessor.c:8:     printf("test of preprocess..\n");
+  lea r10, [ rip + .LSTR0 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+  lea r10, [rbp - 244]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+#test/c/preprocessor.c:10:     a = TEST_MACRO;
+  lea r10, [rbp - 244]
+  mov r11, 123
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 123
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L0
+  mov r11, 0
+  jmp .L1
+.L0:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r10, 1
+  add r10, 2
+  mov r12, 3
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L2
+  mov r10, 0
+  jmp .L3
+.L2:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L3:
+#test/c/preprocessor.c:14:     printf("test of preprocess if-group..\n");
+  lea r10, [ rip + .LSTR1 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/preprocessor.c:26:     a = 20;
+  lea r10, [rbp - 244]
+  mov r11, 20
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 244]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 20
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L4
+  mov r11, 0
+  jmp .L5
+.L4:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L5:
+  lea r10, [rbp - 248]
+  mov r11, 10
+  mov [r10], r11d
+  mov r12, r11
+#test/c/preprocessor.c:32:     printf("test of preprocess if directive..\n");
+  lea r10, [ rip + .LSTR2 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/preprocessor.c:41:     pp_ans = 10;
+  lea r10, [rbp - 248]
+  mov r11, 10
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 248]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 10
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L6
+  mov r11, 0
+  jmp .L7
+.L6:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L7:
+#test/c/preprocessor.c:52:     pp_ans = 20;
+  lea r10, [rbp - 248]
+  mov r11, 20
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 248]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 20
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L8
+  mov r11, 0
+  jmp .L9
+.L8:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L9:
+  lea r10, [rbp - 252]
+  mov r11, 30
+  mov [r10], r11d
+  mov r12, r11
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  lea r10, [rbp - 252]
+  mov r11, 50
+  mov [r10], r11d
+  mov r12, r11
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  lea r10, [rbp - 252]
+  movsxd r11, DWORD PTR [r10]
+  add r11, 1
+  lea r10, [rbp - 252]
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 252]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 51
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L10
+  mov r11, 0
+  jmp .L11
+.L10:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L11:
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  mov r10, 3
+  imul r10, 4
+  lea r11, [rbp - 252]
+  mov [r11], r10d
+  mov r12, r10
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 252]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 12
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L12
+  mov r11, 0
+  jmp .L13
+.L12:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L13:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r10, 3
+  add r10, 1
+  add r10, 2
+  mov r12, 6
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L14
+  mov r10, 0
+  jmp .L15
+.L14:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r11, 3
+  mov r12, 3
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L16
+  mov r11, 0
+  jmp .L17
+.L16:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L17:
+  lea r10, [rbp - 256]
+  mov r11, 10
+  mov [r10], r11d
+  mov r12, r11
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [rbp - 256]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 10
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L18
+  mov r11, 0
+  jmp .L19
+.L18:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L19:
+#test/c/preprocessor.c:163:     OBJLIKE_VACANCY_MACRO;
+#test/c/preprocessor.c:164:     FUNC_ARG_OWNER(OBJLIKE_VACANCY_MACRO);
+#test/c/preprocessor.c:167:     FUNC_MACRO_VACANCY(3);
+#test/c/preprocessor.c:168:     FUNC_MACRO_VACANCY(XXXXXXX_NODEFINED);
+#test/c/preprocessor.c:170:     return 0;
+  mov r10, 0
+  mov rax, r10
+  jmp ret_test_preprocess
+ret_test_preprocess:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,533 @@
+.intel_syntax noprefix
+.global add
+.global test_primary
+.global test_static
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of initialize..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of character riteral..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of function call..\n"
+  .section .rodata
+.LSTR5:
+  .string "a\0b"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "pool"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "pooled"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "abd"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "abc"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of string literal..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# add
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+add:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+#test/c/primary.c:55:     return a + b;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_add
+ret_add:
+  pop rbp
+  ret
+# test_primary
+#	 stack size: 56
+#	 st2( ofs: 56, size: 8) : level0
+#	 st1( ofs: 48, size: 8) : level0
+#	 val( ofs: 40, size: 8) : level0
+#	 defini( ofs: 28, size: 4) : level0
+#	 s2( ofs: 24, size: 8) : level0
+#	 s1( ofs: 16, size: 8) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_primary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  push rbx
+#test/c/primary.c:6:     printf("test of string literal..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/primary.c:8:     c = "abc"[0]; ASSERT(c, 'a');
+  lea r8, [ rip + .LSTR1 ]
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 97
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#test/c/primary.c:9:     c = "abc"[1]; ASSERT(c, 'b');
+  lea r8, [ rip + .LSTR1 ]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 98
+  jne .L2
+  mov rbx, 0
+  jmp .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L3:
+#test/c/primary.c:10:     c = "abc"[2]; ASSERT(c, 'c');
+  lea r8, [ rip + .LSTR1 ]
+  mov r9, 2
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 99
+  jne .L4
+  mov rbx, 0
+  jmp .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L5:
+#test/c/primary.c:11:     c = "abc"[3]; ASSERT(c, 0);
+  lea r8, [ rip + .LSTR1 ]
+  mov r9, 3
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  jne .L6
+  mov rbx, 0
+  jmp .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L7:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+  lea r8, [ rip + .LSTR3 ]
+  lea r9, [rbp - 16]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+  lea r8, [ rip + .LSTR3 ]
+  lea r9, [rbp - 24]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov r9, QWORD PTR [r9]
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 1
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [ rip + .LSTR4 ]
+  cmp r8, r9
+  sete al
+  movzb r8, al
+  cmp r8, 0
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#test/c/primary.c:17:     c = "a\0b"[2]; ASSERT(c, 'b');
+  lea r8, [ rip + .LSTR5 ]
+  mov r9, 2
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 98
+  jne .L14
+  mov rbx, 0
+  jmp .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L15:
+#test/c/primary.c:19:     printf("test of function call..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 4
+  sub rsp, 8
+  call add
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 7
+  jne .L16
+  mov rbx, 0
+  jmp .L17
+.L16:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5
+  mov rsi, 6
+  sub rsp, 8
+  call add
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 11
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#test/c/primary.c:23:     printf("test of character riteral..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 97
+  cmp r8, 97
+  jne .L20
+  mov rbx, 0
+  jmp .L21
+.L20:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L21:
+#test/c/primary.c:26:     printf("test of initialize..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 28]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L22
+  mov rbx, 0
+  jmp .L23
+.L22:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L23:
+  lea r8, [rbp - 40]
+  mov r9, 123
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L24
+  mov rbx, 0
+  jmp .L25
+.L24:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L26
+  mov rbx, 0
+  jmp .L27
+.L26:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L27:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L28
+  mov rbx, 0
+  jmp .L29
+.L28:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L30
+  mov rbx, 0
+  jmp .L31
+.L30:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L32
+  mov rbx, 0
+  jmp .L33
+.L32:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L34
+  mov rbx, 0
+  jmp .L35
+.L34:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 123
+  jne .L36
+  mov rbx, 0
+  jmp .L37
+.L36:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L37:
+#test/c/primary.c:39:     printf("test of struct..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/primary.c:45:     st1.a = 1;
+  lea r8, [rbp - 48]
+  add r8, 0
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/primary.c:46:     st1.b = 2;
+  lea r8, [rbp - 48]
+  add r8, 4
+  mov r9, 2
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/primary.c:47:     st2 = st1;
+  lea r9, [rbp - 48]
+  lea rcx, [rbp - 56]
+  mov r8, QWORD PTR [r9 + 0]
+  mov QWORD PTR [rcx + 0], r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 56]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L38
+  mov rbx, 0
+  jmp .L39
+.L38:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 56]
+  add r8, 4
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L40
+  mov rbx, 0
+  jmp .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L41:
+#test/c/primary.c:51:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_primary
+ret_test_primary:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,6694 @@
+.intel_syntax noprefix
+.global inv_set_limit
+.global inv_scale
+.global up_count
+.global vec_overlap
+.global vec_ucmax
+.global vec_cmin
+.global vec_max
+.global vec_min
+.global vec_ucsum
+.global vec_csum
+.global vec_sum
+.global vec_map
+.global unroll_heuristic
+.global unroll_full
+.global unroll_down
+.global unroll_jump
+.global unroll_known
+.global unroll_sum
+.global iv_weighted
+.global iv_after
+.global iv_reverse
+.global iv_stride
+.global iv_sum
+.global inv_guard
+.global inv_call
+.global inv_through_ptr
+.global inv_shrink
+.global inv_sum
+.global inv_limit
+.global switch_unsigned
+.global switch_mixed
+.global switch_sparse
+.global switch_dense
+.global in_range
+.global unsigned_less
+.global branch_code
+.global count_up
+.global test_return
+.global test_statement
+.global test_static
+  .bss
+inv_scale:
+  .zero 4
+  .bss
+up_count:
+  .zero 4
+  .data
+.LSTR17:
+  .string "test of expression statement..\n"
+  .data
+.LSTR16:
+  .string "test of label and goto..\n"
+  .data
+.LSTR15:
+  .string "test of loop vectorization..\n"
+  .data
+.LSTR14:
+  .string "test of loop unrolling..\n"
+  .data
+.LSTR13:
+  .string "abcde"
+  .data
+.LSTR12:
+  .string "test of induction variable..\n"
+  .data
+.LSTR11:
+  .string "test of loop invariant..\n"
+  .data
+.LSTR10:
+  .string "test of switch statement..\n"
+  .data
+.LSTR9:
+  .string "test of continue statement..\n"
+  .data
+.LSTR8:
+  .string "test of break statement..\n"
+  .data
+.LSTR7:
+  .string "test of void statement..\n"
+  .data
+.LSTR6:
+  .string "test of compound-statement..\n"
+  .data
+.LSTR5:
+  .string "test of return-statement...\n"
+  .data
+.LSTR4:
+  .string "test of condition branch..\n"
+  .data
+.LSTR3:
+  .string "test of if-statement...\n"
+  .data
+.LSTR2:
+  .string "test of for-statement...\n"
+  .data
+.LSTR1:
+  .string "test of do-while-statement...\n"
+  .data
+.LSTR0:
+  .string "test of while-statement...\n"
+  .bss
+inv_limit:
+  .zero 4
+  .bss
+.Ltest_static:
+  .zero 4
+# inv_set_limit
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inv_set_limit:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+#test/c/statement.c:502:     inv_limit = n;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [ rip + inv_limit ]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:503:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_inv_set_limit
+ret_inv_set_limit:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_overlap
+#	 stack size: 28
+#	 i( ofs: 24, size: 4) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 8) : level0
+#	 d( ofs: 8, size: 8) : level0
+  .text
+vec_overlap:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  mov [rbp - 20], edx
+#test/c/statement.c:691:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 24]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L0:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L2
+#test/c/statement.c:692:         d[i] = s[i] + 1;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 24]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 24]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L1:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 28]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L0
+.L2:
+#test/c/statement.c:694:     return d[n - 1];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  sub r9, 1
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_overlap
+ret_vec_overlap:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_ucmax
+#	 stack size: 21
+#	 i( ofs: 17, size: 4) : level0
+#	 m( ofs: 13, size: 1) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_ucmax:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 13]
+  mov r9, 0
+  mov [r8], r9b
+  mov r8, r9
+#test/c/statement.c:684:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 17]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L3:
+  lea r8, [rbp - 17]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L5
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+  lea r8, [rbp - 13]
+  movzx r8, BYTE PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 17]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  movzx r9, BYTE PTR [r9]
+  cmp r8, r9
+  jge .L6
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 17]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 1
+  add r8, r9
+  movzx r8, BYTE PTR [r8]
+  lea r9, [rbp - 13]
+  mov [r9], r8b
+  mov r8, r8
+.L6:
+.L4:
+  lea r8, [rbp - 17]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 21]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 17]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 17]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 21]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L3
+.L5:
+#test/c/statement.c:687:     return m;
+  lea r8, [rbp - 13]
+  movzx r8, BYTE PTR [r8]
+  mov rax, r8
+  jmp ret_vec_ucmax
+ret_vec_ucmax:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_cmin
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_cmin:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 1000
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:676:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L7:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L9
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 16]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L10
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L10:
+.L8:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L7
+.L9:
+#test/c/statement.c:679:     return m;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_cmin
+ret_vec_cmin:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_max
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_max:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  mov r8, 0
+  sub r8, 10000
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:668:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L11:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L13
+#test/c/statement.c:669:         m = m < a[i] ? a[i] : m;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L14
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  mov r8, r8
+  jmp .L15
+.L14:
+  lea r9, [rbp - 16]
+  movsxd r9, DWORD PTR [r9]
+  mov r8, r9
+.L15:
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L12:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L11
+.L13:
+#test/c/statement.c:671:     return m;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_max
+ret_vec_max:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_min
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_min:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 10000
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:658:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L16:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L18
+#test/c/statement.c:659:         if(a[i] < m){
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L19
+#test/c/statement.c:660:             m = a[i];
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L19:
+.L17:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L16
+.L18:
+#test/c/statement.c:663:     return m;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_min
+ret_vec_min:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_ucsum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_ucsum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:650:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L20:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L22
+#test/c/statement.c:651:         s = s + a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  movzx r9, BYTE PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L21:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L20
+.L22:
+#test/c/statement.c:653:     return s;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_ucsum
+ret_vec_ucsum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_csum
+#	 stack size: 28
+#	 i( ofs: 24, size: 4) : level0
+#	 s( ofs: 20, size: 8) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_csum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9
+  mov r8, r9
+#test/c/statement.c:642:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 24]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L23:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L25
+#test/c/statement.c:643:         s += a[i];
+  lea r8, [rbp - 20]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 24]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  movsx r9, BYTE PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 20]
+  mov [r9], r8
+  mov r8, r8
+.L24:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 28]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L23
+.L25:
+#test/c/statement.c:645:     return s;
+  lea r8, [rbp - 20]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_csum
+ret_vec_csum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:634:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L26:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L28
+#test/c/statement.c:635:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L27:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L26
+.L28:
+#test/c/statement.c:637:     return s;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_sum
+ret_vec_sum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_map
+#	 stack size: 44
+#	 i( ofs: 40, size: 4) : level0
+#	 h( ofs: 36, size: 4) : level0
+#	 i( ofs: 28, size: 4) : level0
+#	 k( ofs: 24, size: 4) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 8) : level0
+#	 d( ofs: 8, size: 8) : level0
+  .text
+vec_map:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  mov [rbp - 20], edx
+  mov [rbp - 24], ecx
+#test/c/statement.c:622:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 28]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L29:
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L31
+#test/c/statement.c:623:         d[i] = (s[i] << 2) - s[i] + k;
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 28]
+  movsxd r9, DWORD PTR [r9]
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  sal r8, 2
+  lea r9, [rbp - 16]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 28]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  sub r8, r9
+  lea r9, [rbp - 24]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 28]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L30:
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 32]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 28]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L29
+.L31:
+  lea r8, [rbp - 36]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:626:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 40]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L32:
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L34
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 40]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 36]
+  mov [r9], r8d
+  mov r8, r8
+.L33:
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 40]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L32
+.L34:
+#test/c/statement.c:629:     return h;
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vec_map
+ret_vec_map:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_heuristic
+#	 stack size: 28
+#	 i( ofs: 24, size: 4) : level0
+#	 s( ofs: 20, size: 4) : level0
+#	 k( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+unroll_heuristic:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  mov [rbp - 16], edx
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:615:     for(int i = 1; i < n - k; i++){
+  lea r8, [rbp - 24]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+.L35:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  lea rcx, [rbp - 16]
+  movsxd rcx, DWORD PTR [rcx]
+  sub r9, rcx
+  cmp r8, r9
+  jge .L37
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 24]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  lea rcx, [rbp - 8]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 24]
+  movsxd rdx, DWORD PTR [rdx]
+  sub rdx, 1
+  imul rdx, 4
+  add rcx, rdx
+  movsxd rcx, DWORD PTR [rcx]
+  sub r9, rcx
+  add r8, r9
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+.L36:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 28]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L35
+.L37:
+#test/c/statement.c:618:     return s;
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_unroll_heuristic
+ret_unroll_heuristic:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_full
+#	 stack size: 12
+#	 i( ofs: 12, size: 8) : level0
+#	 s( ofs: 4, size: 4) : level0
+  .text
+unroll_full:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:607:     for(long i = 1; i <= 3; ++i){
+  lea r8, [rbp - 12]
+  mov r9, 1
+  mov [r8], r9
+  mov r8, r9
+#test/c/statement.c:608:         s = s * 10 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  lea r9, [rbp - 12]
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L39:
+  lea r8, [rbp - 12]
+  mov r8, QWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8
+  mov r8, r8
+#test/c/statement.c:608:         s = s * 10 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  lea r9, [rbp - 12]
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L40:
+  lea r8, [rbp - 12]
+  mov r8, QWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8
+  mov r8, r8
+#test/c/statement.c:608:         s = s * 10 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  lea r9, [rbp - 12]
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L41:
+  lea r8, [rbp - 12]
+  mov r8, QWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8
+  mov r8, r8
+.L38:
+#test/c/statement.c:610:     return s;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_unroll_full
+ret_unroll_full:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_down
+#	 stack size: 12
+#	 i( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+unroll_down:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:598:     for(i = n; i >= 0; i -= 3){
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L43:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r8, r8
+  add r8, 18446744073709551613
+  mov r9, 0
+  cmp r9, r8
+  jg .L44
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L45:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 3
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L46:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 3
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L43
+.L44:
+.L47:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  cmp r9, r8
+  jg .L42
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L48:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 3
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L47
+.L42:
+#test/c/statement.c:601:     return s + i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_unroll_down
+ret_unroll_down:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_jump
+#	 stack size: 16
+#	 i( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+unroll_jump:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:586:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L50:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r8, r8
+  add r8, 3
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L51
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L53
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  jmp .L52
+.L53:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 11
+  jne .L54
+#test/c/statement.c:588:         if(i == 11) break;
+  jmp .L49
+.L54:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L52:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L56
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  jmp .L55
+.L56:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 11
+  jne .L57
+#test/c/statement.c:588:         if(i == 11) break;
+  jmp .L49
+.L57:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L55:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L59
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  jmp .L58
+.L59:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 11
+  jne .L60
+#test/c/statement.c:588:         if(i == 11) break;
+  jmp .L49
+.L60:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L58:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L62
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  jmp .L61
+.L62:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 11
+  jne .L63
+#test/c/statement.c:588:         if(i == 11) break;
+  jmp .L49
+.L63:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L61:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L50
+.L51:
+.L64:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L49
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 3
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L66
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  jmp .L65
+.L66:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 11
+  jne .L67
+#test/c/statement.c:588:         if(i == 11) break;
+  jmp .L49
+.L67:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+.L65:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L64
+.L49:
+#test/c/statement.c:591:     return s;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_unroll_jump
+ret_unroll_jump:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_known
+#	 stack size: 12
+#	 i( ofs: 8, size: 4) : level0
+#	 s( ofs: 4, size: 4) : level0
+  .text
+unroll_known:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:577:     for(int i = 0; i < 10; i++){
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L69:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov r8, r8
+  add r8, 2
+  cmp r8, 10
+  jge .L70
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 2
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L71:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 2
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L72:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 2
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L73:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L69
+.L70:
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 2
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+.L74:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+.L68:
+#test/c/statement.c:580:     return s;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_unroll_known
+ret_unroll_known:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+unroll_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:568:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L76:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  mov r8, r8
+  add r8, 3
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L77
+#test/c/statement.c:569:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L78:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:569:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L79:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:569:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L80:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:569:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L81:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L76
+.L77:
+.L82:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L75
+#test/c/statement.c:569:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L83:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L82
+.L75:
+#test/c/statement.c:571:     return s;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_unroll_sum
+ret_unroll_sum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_weighted
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_weighted:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:559:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L84:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L86
+#test/c/statement.c:560:         s += a[i] * i;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul r9, rcx
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L85:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L84
+.L86:
+#test/c/statement.c:562:     return s + n;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_iv_weighted
+ret_iv_weighted:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_after
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 str( ofs: 8, size: 8) : level0
+  .text
+iv_after:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:551:     for(i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L87:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L89
+#test/c/statement.c:552:         s += str[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  movsx r9, BYTE PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L88:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L87
+.L89:
+#test/c/statement.c:554:     return s + i;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  mov rax, r8
+  jmp ret_iv_after
+ret_iv_after:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_reverse
+#	 stack size: 60
+#	 i( ofs: 56, size: 4) : level0
+#	 t( ofs: 52, size: 4) : level0
+#	 i( ofs: 44, size: 4) : level0
+#	 arr( ofs: 40, size: 4) : level0
+  .text
+iv_reverse:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  lea r8, [rbp - 44]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L90:
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jge .L92
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 44]
+  movsxd r9, DWORD PTR [r9]
+  imul r8, r9
+  lea r9, [rbp - 40]
+  lea rcx, [rbp - 44]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L91:
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 48]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L90
+.L92:
+  lea r8, [rbp - 52]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea r8, [rbp - 56]
+  mov r9, 9
+  mov [r8], r9d
+  mov r8, r9
+.L93:
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  cmp r9, r8
+  jg .L95
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 40]
+  lea rcx, [rbp - 56]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 52]
+  mov [r9], r8d
+  mov r8, r8
+.L94:
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 60]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 56]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L93
+.L95:
+#test/c/statement.c:545:     return t;
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_iv_reverse
+ret_iv_reverse:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_stride
+#	 stack size: 32
+#	 i( ofs: 32, size: 4) : level0
+#	 s( ofs: 28, size: 8) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 b( ofs: 16, size: 8) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_stride:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 16], rsi
+  mov [rbp - 20], edx
+  lea r8, [rbp - 28]
+  mov r9, 0
+  mov [r8], r9
+  mov r8, r9
+#test/c/statement.c:534:     for(int i = 2; i < n; i += 2){
+  lea r8, [rbp - 32]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+.L96:
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L98
+#test/c/statement.c:535:         s += a[i] * b[i];
+  lea r8, [rbp - 28]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 32]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r9, rcx
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 16]
+  mov rcx, QWORD PTR [rcx]
+  lea rdx, [rbp - 32]
+  movsxd rdx, DWORD PTR [rdx]
+  imul rdx, 8
+  add rcx, rdx
+  mov rcx, QWORD PTR [rcx]
+  imul r9, rcx
+  add r8, r9
+  lea r9, [rbp - 28]
+  mov [r9], r8
+  mov r8, r8
+.L97:
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 2
+  lea r9, [rbp - 32]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L96
+.L98:
+#test/c/statement.c:537:     return s;
+  lea r8, [rbp - 28]
+  mov r8, QWORD PTR [r8]
+  mov rax, r8
+  jmp ret_iv_stride
+ret_iv_stride:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:526:     for(int i = 0; i < n; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L99:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L101
+#test/c/statement.c:527:         s += a[i];
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L100:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L99
+.L101:
+#test/c/statement.c:529:     return s;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_iv_sum
+ret_iv_sum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_guard
+#	 stack size: 20
+#	 i( ofs: 16, size: 4) : level0
+#	 s( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_guard:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:518:     for(int i = 0; v && i < v->len; i++){
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L102:
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 0
+  je .L104
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 0
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L104
+#test/c/statement.c:519:         s += v->data[i];
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 4
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 16]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L103:
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L102
+.L104:
+#test/c/statement.c:521:     return s;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inv_guard
+ret_inv_guard:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_call
+#	 stack size: 16
+#	 i( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inv_call:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:508:     inv_limit = 3;
+  lea r8, [ rip + inv_limit ]
+  mov r9, 3
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:509:     for(int i = 0; i < inv_limit; i++){
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L105:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [ rip + inv_limit ]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L107
+#test/c/statement.c:510:         if(i == 0) inv_set_limit(6);
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L108
+#test/c/statement.c:510:         if(i == 0) inv_set_limit(6);
+  mov rdi, 6
+  sub rsp, 8
+  call inv_set_limit
+  add rsp, 8
+  mov r8, rax
+.L108:
+#test/c/statement.c:511:         n++;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+.L106:
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L105
+.L107:
+#test/c/statement.c:513:     return n;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inv_call
+ret_inv_call:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_through_ptr
+#	 stack size: 24
+#	 i( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+inv_through_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:493:     inv_limit = 10;
+  lea r8, [ rip + inv_limit ]
+  mov r9, 10
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:494:     for(int i = 0; i < inv_limit; i++){
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L109:
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [ rip + inv_limit ]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L111
+#test/c/statement.c:495:         *p = 4;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  mov r9, 4
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:496:         n++;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+.L110:
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L109
+.L111:
+#test/c/statement.c:498:     return n;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inv_through_ptr
+ret_inv_through_ptr:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_shrink
+#	 stack size: 24
+#	 i( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_shrink:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:484:     for(int i = 0; i < v->len; i++){
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L112:
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 0
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L114
+#test/c/statement.c:485:         if(i == 2) v->len = 3;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L115
+#test/c/statement.c:485:         if(i == 2) v->len = 3;
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r9, 3
+  mov [r8], r9d
+  mov r8, r9
+.L115:
+#test/c/statement.c:486:         n++;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+.L113:
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L112
+.L114:
+#test/c/statement.c:488:     return n;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inv_shrink
+ret_inv_shrink:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 k( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_sum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 8], rdi
+  mov [rbp - 12], esi
+#test/c/statement.c:474:     inv_scale = 2;
+  lea r8, [ rip + inv_scale ]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:476:     for(int i = 0; i < v->len; i++){
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L116:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 0
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L118
+#test/c/statement.c:477:         s = s + v->data[i] * (k * 3 + 1) + inv_scale;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9, QWORD PTR [r9]
+  add r9, 4
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 20]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  lea rcx, [rbp - 12]
+  movsxd rcx, DWORD PTR [rcx]
+  lea rcx, [rcx + rcx * 2]
+  add rcx, 1
+  imul r9, rcx
+  add r8, r9
+  lea r9, [ rip + inv_scale ]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L117:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L116
+.L118:
+#test/c/statement.c:479:     return s;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_inv_sum
+ret_inv_sum:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# switch_unsigned
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_unsigned:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+#test/c/statement.c:461:     switch(x){
+  lea r8, [rbp - 4]
+  mov r8d, DWORD PTR [r8]
+  cmp r8, 3
+  ja .L125
+  lea rax, [rip + .L126]
+  movsxd r11, DWORD PTR [rax + r8 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L126:
+  .long .L124 - .L126
+  .long .L123 - .L126
+  .long .L122 - .L126
+  .long .L121 - .L126
+  .text
+.L125:
+  mov r9, 4294967295
+  cmp r8, r9
+  je .L120
+  jmp .L119
+.L124:
+#test/c/statement.c:462:         case 0: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L123:
+#test/c/statement.c:463:         case 1: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L122:
+#test/c/statement.c:464:         case 2: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L121:
+#test/c/statement.c:465:         case 3: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L120:
+#test/c/statement.c:466:         case 4294967295: return 9;
+  mov r8, 9
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L119:
+#test/c/statement.c:468:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_switch_unsigned
+ret_switch_unsigned:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# switch_mixed
+#	 stack size: 8
+#	 r( ofs: 8, size: 4) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_mixed:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:446:     switch(x){
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1000
+  jge .L137
+  cmp r8, 3
+  je .L136
+  mov r9, r8
+  sub r9, 10
+  cmp r9, 5
+  ja .L138
+  lea rax, [rip + .L139]
+  movsxd r11, DWORD PTR [rax + r9 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L139:
+  .long .L135 - .L139
+  .long .L134 - .L139
+  .long .L133 - .L139
+  .long .L132 - .L139
+  .long .L131 - .L139
+  .long .L130 - .L139
+  .text
+.L138:
+  jmp .L127
+.L137:
+  cmp r8, 1000
+  je .L129
+  cmp r8, 2000
+  je .L128
+  jmp .L127
+.L136:
+#test/c/statement.c:447:         case 3: r = 100; break;
+  lea r8, [rbp - 8]
+  mov r9, 100
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:447:         case 3: r = 100; break;
+  jmp .L127
+.L135:
+#test/c/statement.c:448:         case 10: r = 10; break;
+  lea r8, [rbp - 8]
+  mov r9, 10
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:448:         case 10: r = 10; break;
+  jmp .L127
+.L134:
+#test/c/statement.c:449:         case 11: r = 11; break;
+  lea r8, [rbp - 8]
+  mov r9, 11
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:449:         case 11: r = 11; break;
+  jmp .L127
+.L133:
+#test/c/statement.c:450:         case 12: r = 12; break;
+  lea r8, [rbp - 8]
+  mov r9, 12
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:450:         case 12: r = 12; break;
+  jmp .L127
+.L132:
+#test/c/statement.c:451:         case 13: r = 13; break;
+  lea r8, [rbp - 8]
+  mov r9, 13
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:451:         case 13: r = 13; break;
+  jmp .L127
+.L131:
+#test/c/statement.c:452:         case 14: r = 14; break;
+  lea r8, [rbp - 8]
+  mov r9, 14
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:452:         case 14: r = 14; break;
+  jmp .L127
+.L130:
+#test/c/statement.c:453:         case 15: r = 15; break;
+  lea r8, [rbp - 8]
+  mov r9, 15
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:453:         case 15: r = 15; break;
+  jmp .L127
+.L129:
+#test/c/statement.c:454:         case 1000: r = 200; break;
+  lea r8, [rbp - 8]
+  mov r9, 200
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:454:         case 1000: r = 200; break;
+  jmp .L127
+.L128:
+#test/c/statement.c:455:         case 2000: r = 300; break;
+  lea r8, [rbp - 8]
+  mov r9, 300
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:455:         case 2000: r = 300; break;
+.L127:
+#test/c/statement.c:457:     return r;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_switch_mixed
+ret_switch_mixed:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# switch_sparse
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_sparse:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+#test/c/statement.c:433:     switch(x){
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 100
+  jge .L147
+  cmp r8, 1
+  je .L145
+  cmp r8, 3
+  je .L144
+  cmp r8, 77
+  je .L142
+  jmp .L140
+.L147:
+  cmp r8, 100
+  je .L141
+  cmp r8, 1000
+  je .L146
+  cmp r8, 5000
+  je .L143
+  jmp .L140
+.L146:
+#test/c/statement.c:434:         case 1000: return 5;
+  mov r8, 5
+  mov rax, r8
+  jmp ret_switch_sparse
+.L145:
+#test/c/statement.c:435:         case 1: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_sparse
+.L144:
+#test/c/statement.c:436:         case 3: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_sparse
+.L143:
+#test/c/statement.c:437:         case 5000: return 6;
+  mov r8, 6
+  mov rax, r8
+  jmp ret_switch_sparse
+.L142:
+#test/c/statement.c:438:         case 77: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_sparse
+.L141:
+#test/c/statement.c:439:         case 100: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_sparse
+.L140:
+#test/c/statement.c:441:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_switch_sparse
+ret_switch_sparse:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# switch_dense
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_dense:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+#test/c/statement.c:418:     switch(x){
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 9
+  ja .L159
+  lea rax, [rip + .L160]
+  movsxd r11, DWORD PTR [rax + r8 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L160:
+  .long .L157 - .L160
+  .long .L156 - .L160
+  .long .L155 - .L160
+  .long .L154 - .L160
+  .long .L153 - .L160
+  .long .L158 - .L160
+  .long .L152 - .L160
+  .long .L151 - .L160
+  .long .L150 - .L160
+  .long .L149 - .L160
+  .text
+.L159:
+  jmp .L158
+.L157:
+#test/c/statement.c:419:         case 0: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_dense
+.L156:
+#test/c/statement.c:420:         case 1: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_dense
+.L155:
+#test/c/statement.c:421:         case 2: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_dense
+.L154:
+#test/c/statement.c:422:         case 3: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_dense
+.L153:
+#test/c/statement.c:423:         case 4: return 5;
+  mov r8, 5
+  mov rax, r8
+  jmp ret_switch_dense
+.L152:
+#test/c/statement.c:424:         case 6: return 9;
+  mov r8, 9
+  mov rax, r8
+  jmp ret_switch_dense
+.L151:
+#test/c/statement.c:425:         case 7: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_dense
+.L150:
+#test/c/statement.c:427:         case 9: return 6;
+.L149:
+#test/c/statement.c:427:         case 9: return 6;
+  mov r8, 6
+  mov rax, r8
+  jmp ret_switch_dense
+.L158:
+#test/c/statement.c:428:         default: return 7;
+  mov r8, 7
+  mov rax, r8
+  jmp ret_switch_dense
+ret_switch_dense:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# in_range
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+in_range:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  cmp r9, r8
+  jg .L163
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jl .L162
+.L163:
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 100
+  jne .L161
+.L162:
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_in_range
+.L161:
+#test/c/statement.c:414:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_in_range
+ret_in_range:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unsigned_less
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+unsigned_less:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+#test/c/statement.c:408:     if(a < b) return 1;
+  lea r8, [rbp - 4]
+  mov r8d, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov r9d, DWORD PTR [r9]
+  cmp r8, r9
+  jae .L164
+#test/c/statement.c:408:     if(a < b) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_unsigned_less
+.L164:
+#test/c/statement.c:409:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_unsigned_less
+ret_unsigned_less:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# branch_code
+#	 stack size: 12
+#	 code( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+branch_code:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  mov [rbp - 4], edi
+  mov [rbp - 8], esi
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:397:     if(a < b) code += 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L165
+#test/c/statement.c:397:     if(a < b) code += 1;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L165:
+#test/c/statement.c:398:     if(a <= b) code += 2;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jg .L166
+#test/c/statement.c:398:     if(a <= b) code += 2;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 2
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L166:
+#test/c/statement.c:399:     if(a > b) code += 4;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L167
+#test/c/statement.c:399:     if(a > b) code += 4;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 4
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L167:
+#test/c/statement.c:400:     if(a >= b) code += 8;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jg .L168
+#test/c/statement.c:400:     if(a >= b) code += 8;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 8
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L168:
+#test/c/statement.c:401:     if(a == b) code += 16;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jne .L169
+#test/c/statement.c:401:     if(a == b) code += 16;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 16
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L169:
+#test/c/statement.c:402:     if(a != b) code += 32;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  je .L170
+#test/c/statement.c:402:     if(a != b) code += 32;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 32
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L170:
+#test/c/statement.c:403:     if(!(a < b)) code += 64;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jl .L171
+#test/c/statement.c:403:     if(!(a < b)) code += 64;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 64
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+.L171:
+#test/c/statement.c:404:     return code;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_branch_code
+ret_branch_code:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# count_up
+#	 stack size: 4
+  .text
+count_up:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/statement.c:386:     up_count++;
+  lea r8, [ rip + up_count ]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [ rip + up_count ]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [ rip + up_count ]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+#test/c/statement.c:387:     return up_count;
+  lea r8, [ rip + up_count ]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_count_up
+ret_count_up:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# test_return
+#	 stack size: 0
+  .text
+test_return:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/statement.c:391:     return 5;
+  mov r8, 5
+  mov rax, r8
+  jmp ret_test_return
+ret_test_return:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# test_statement
+#	 stack size: 1380
+#	 esp( ofs: 1380, size: 8) : level0
+#	 es( ofs: 1368, size: 4) : level0
+#	 li( ofs: 1364, size: 4) : level0
+#	 vec_i( ofs: 1356, size: 4) : level0
+#	 vec_u( ofs: 1352, size: 1) : level0
+#	 vec_c( ofs: 1252, size: 1) : level0
+#	 vec_d( ofs: 1152, size: 4) : level0
+#	 vec_a( ofs: 752, size: 4) : level0
+#	 ur_i( ofs: 348, size: 4) : level0
+#	 ur_a( ofs: 344, size: 4) : level0
+#	 iv_i( ofs: 260, size: 4) : level0
+#	 iv_b( ofs: 256, size: 8) : level0
+#	 iv_a( ofs: 208, size: 8) : level0
+#	 inv_other( ofs: 160, size: 4) : level0
+#	 inv_v( ofs: 156, size: 12) : level0
+#	 inv_i( ofs: 140, size: 4) : level0
+#	 inv_data( ofs: 136, size: 4) : level0
+#	 sw_i( ofs: 112, size: 4) : level0
+#	 sw_sum( ofs: 108, size: 4) : level0
+#	 s5( ofs: 104, size: 4) : level0
+#	 s4( ofs: 100, size: 4) : level0
+#	 s3( ofs: 96, size: 4) : level0
+#	 s2( ofs: 92, size: 4) : level0
+#	 s1( ofs: 88, size: 4) : level0
+#	 cont_2_1( ofs: 84, size: 4) : level0
+#	 cont_2( ofs: 80, size: 4) : level0
+#	 cont_1_1( ofs: 76, size: 4) : level0
+#	 cont_1( ofs: 72, size: 4) : level0
+#	 break_3_2( ofs: 68, size: 4) : level0
+#	 break_3_1( ofs: 64, size: 4) : level0
+#	 break_2( ofs: 60, size: 4) : level0
+#	 break_1( ofs: 56, size: 4) : level0
+#	 i( ofs: 52, size: 4) : level0
+#	 cp2( ofs: 48, size: 4) : level0
+#	 cp( ofs: 44, size: 4) : level0
+#	 cond_n( ofs: 40, size: 4) : level0
+#	 cond_sc( ofs: 36, size: 4) : level0
+#	 if_a( ofs: 32, size: 4) : level0
+#	 for_null( ofs: 28, size: 4) : level0
+#	 for_d( ofs: 24, size: 4) : level0
+#	 for_c( ofs: 20, size: 4) : level0
+#	 for_b( ofs: 16, size: 4) : level0
+#	 for_a( ofs: 12, size: 4) : level0
+#	 do_while_a( ofs: 8, size: 4) : level0
+#	 while_a( ofs: 4, size: 4) : level0
+  .text
+test_statement:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 1392
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/statement.c:41:     printf("test of while-statement...\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:42:     int while_a; while_a = 0;
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:43:     while(while_a < 3) while_a = while_a + 1;
+.L174:
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jge .L175
+#test/c/statement.c:43:     while(while_a < 3) while_a = while_a + 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 4]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L174
+.L175:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L176
+  mov rbx, 0
+  jmp .L177
+.L176:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L177:
+#test/c/statement.c:46:     printf("test of do-while-statement...\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:47:     int do_while_a; do_while_a = 0;
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:48:     do {
+.L178:
+#test/c/statement.c:49:         do_while_a = do_while_a + 1;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jl .L178
+.L179:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L180
+  mov rbx, 0
+  jmp .L181
+.L180:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L181:
+#test/c/statement.c:53:     do_while_a = 0;
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:54:     do {
+.L182:
+#test/c/statement.c:55:         do_while_a = do_while_a + 1;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 8]
+  mov [r9], r8d
+  mov r8, r8
+  mov r8, 0
+  cmp r8, 0
+  jne .L182
+.L183:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L184
+  mov rbx, 0
+  jmp .L185
+.L184:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L185:
+#test/c/statement.c:59:     printf("test of for-statement...\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:60:     int for_a; for_a = 0;
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:61:     int for_b; for_b = 0;
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+  lea r8, [rbp - 12]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L186:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L188
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 2
+  lea r9, [rbp - 16]
+  mov [r9], r8d
+  mov r8, r8
+.L187:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L186
+.L188:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L189
+  mov rbx, 0
+  jmp .L190
+.L189:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L190:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L191
+  mov rbx, 0
+  jmp .L192
+.L191:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L192:
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:67:     for(; for_c < 5;){ for_c += 1; }
+.L193:
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L195
+#test/c/statement.c:67:     for(; for_c < 5;){ for_c += 1; }
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 20]
+  mov [r9], r8d
+  mov r8, r8
+.L194:
+  jmp .L193
+.L195:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L196
+  mov rbx, 0
+  jmp .L197
+.L196:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L197:
+#test/c/statement.c:70:     for(int for_d = 0; for_d < 5; ){ for_d += 1; }
+  lea r8, [rbp - 24]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L198:
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L200
+#test/c/statement.c:70:     for(int for_d = 0; for_d < 5; ){ for_d += 1; }
+  lea r8, [rbp - 24]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 24]
+  mov [r9], r8d
+  mov r8, r8
+.L199:
+  jmp .L198
+.L200:
+  lea r8, [rbp - 28]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:73:     for(;;){
+.L201:
+  mov r8, 1
+  cmp r8, 0
+  je .L203
+#test/c/statement.c:74:         for_null += 1;
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 28]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:75:         if(for_null == 5) break;
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L204
+#test/c/statement.c:75:         if(for_null == 5) break;
+  jmp .L203
+.L204:
+#test/c/statement.c:75:         if(for_null == 5) break;
+.L202:
+  jmp .L201
+.L203:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 28]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L205
+  mov rbx, 0
+  jmp .L206
+.L205:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L206:
+#test/c/statement.c:79:     printf("test of if-statement...\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:81:     if_a = 0;
+  lea r8, [rbp - 32]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:82:     if(1){
+  mov r8, 1
+  cmp r8, 0
+  je .L207
+#test/c/statement.c:83:         if_a = 1;
+  lea r8, [rbp - 32]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+.L207:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L208
+  mov rbx, 0
+  jmp .L209
+.L208:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L209:
+#test/c/statement.c:87:     if(0){
+  mov r8, 0
+  cmp r8, 0
+  je .L210
+#test/c/statement.c:88:         if_a = 2;
+  lea r8, [rbp - 32]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+.L210:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L211
+  mov rbx, 0
+  jmp .L212
+.L211:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L212:
+#test/c/statement.c:92:     if(1){
+  mov r8, 1
+  cmp r8, 0
+  je .L213
+#test/c/statement.c:93:         if_a = 2;
+  lea r8, [rbp - 32]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+  jmp .L214
+.L213:
+#test/c/statement.c:95:         if_a = 20;
+  lea r8, [rbp - 32]
+  mov r9, 20
+  mov [r8], r9d
+  mov r8, r9
+.L214:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L215
+  mov rbx, 0
+  jmp .L216
+.L215:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L216:
+#test/c/statement.c:99:     if(0){
+  mov r8, 0
+  cmp r8, 0
+  je .L217
+#test/c/statement.c:100:         if_a = 2;
+  lea r8, [rbp - 32]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+  jmp .L218
+.L217:
+#test/c/statement.c:102:         if_a = 20;
+  lea r8, [rbp - 32]
+  mov r9, 20
+  mov [r8], r9d
+  mov r8, r9
+.L218:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 20
+  jne .L219
+  mov rbx, 0
+  jmp .L220
+.L219:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L220:
+#test/c/statement.c:106:     if(0){
+  mov r8, 0
+  cmp r8, 0
+  je .L221
+#test/c/statement.c:107:         if_a = 1;
+  lea r8, [rbp - 32]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+  jmp .L222
+.L221:
+#test/c/statement.c:108:     } else if(1){
+  mov r8, 1
+  cmp r8, 0
+  je .L223
+#test/c/statement.c:109:         if_a = 12;
+  lea r8, [rbp - 32]
+  mov r9, 12
+  mov [r8], r9d
+  mov r8, r9
+  jmp .L224
+.L223:
+#test/c/statement.c:111:         if_a = 123;
+  lea r8, [rbp - 32]
+  mov r9, 123
+  mov [r8], r9d
+  mov r8, r9
+.L224:
+.L222:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 12
+  jne .L225
+  mov rbx, 0
+  jmp .L226
+.L225:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L226:
+#test/c/statement.c:115:     printf("test of condition branch..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  mov rsi, 2
+  sub rsp, 8
+  call branch_code
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 35
+  jne .L227
+  mov rbx, 0
+  jmp .L228
+.L227:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L228:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  mov rsi, 2
+  sub rsp, 8
+  call branch_code
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 90
+  jne .L229
+  mov rbx, 0
+  jmp .L230
+.L229:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L230:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 2
+  sub rsp, 8
+  call branch_code
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 108
+  jne .L231
+  mov rbx, 0
+  jmp .L232
+.L231:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L232:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  mov rsi, 1
+  sub rsp, 8
+  call branch_code
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 35
+  jne .L233
+  mov rbx, 0
+  jmp .L234
+.L233:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L234:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  mov rsi, 1
+  sub rsp, 8
+  call unsigned_less
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L235
+  mov rbx, 0
+  jmp .L236
+.L235:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L236:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, 1
+  mov rsi, r8
+  sub rsp, 8
+  call unsigned_less
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L237
+  mov rbx, 0
+  jmp .L238
+.L237:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L238:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call in_range
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L239
+  mov rbx, 0
+  jmp .L240
+.L239:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L240:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call in_range
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L241
+  mov rbx, 0
+  jmp .L242
+.L241:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L242:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 9
+  sub rsp, 8
+  call in_range
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L243
+  mov rbx, 0
+  jmp .L244
+.L243:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L244:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  sub rsp, 8
+  call in_range
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L245
+  mov rbx, 0
+  jmp .L246
+.L245:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L246:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 100
+  sub rsp, 8
+  call in_range
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L247
+  mov rbx, 0
+  jmp .L248
+.L247:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L248:
+  lea r8, [rbp - 36]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:128:     if(0 && (cond_sc = 1)) cond_sc = 2;
+  mov r8, 0
+  cmp r8, 0
+  je .L249
+  lea r8, [rbp - 36]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+  cmp r8, 0
+  je .L249
+#test/c/statement.c:128:     if(0 && (cond_sc = 1)) cond_sc = 2;
+  lea r8, [rbp - 36]
+  mov r9, 2
+  mov [r8], r9d
+  mov r8, r9
+.L249:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L250
+  mov rbx, 0
+  jmp .L251
+.L250:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L251:
+#test/c/statement.c:130:     if(1 || (cond_sc = 1)) cond_sc += 3;
+  mov r8, 1
+  cmp r8, 0
+  jne .L253
+  lea r8, [rbp - 36]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+  cmp r8, 0
+  je .L252
+.L253:
+#test/c/statement.c:130:     if(1 || (cond_sc = 1)) cond_sc += 3;
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 3
+  lea r9, [rbp - 36]
+  mov [r9], r8d
+  mov r8, r8
+.L252:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L254
+  mov rbx, 0
+  jmp .L255
+.L254:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L255:
+  lea r8, [rbp - 40]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:133:     while(!(cond_n >= 4)) cond_n += 1;
+.L256:
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 4
+  cmp r9, r8
+  jle .L257
+#test/c/statement.c:133:     while(!(cond_n >= 4)) cond_n += 1;
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 40]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L256
+.L257:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L258
+  mov rbx, 0
+  jmp .L259
+.L258:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L259:
+#test/c/statement.c:136:     printf("test of return-statement...\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call test_return
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 5
+  jne .L260
+  mov rbx, 0
+  jmp .L261
+.L260:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L261:
+#test/c/statement.c:139:     printf("test of compound-statement..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:140:     int cp; cp = 0;
+  lea r8, [rbp - 44]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:141:     int cp2; cp2 = 0;
+  lea r8, [rbp - 48]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:142:     int i; i = 0;
+  lea r8, [rbp - 52]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:143:     for(i = 0; i < 5; i += 1){
+  lea r8, [rbp - 52]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L262:
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L264
+#test/c/statement.c:144:         cp = cp + 1;
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 44]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 2
+  lea r9, [rbp - 48]
+  mov [r9], r8d
+  mov r8, r8
+.L263:
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 52]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L262
+.L264:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 44]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L265
+  mov rbx, 0
+  jmp .L266
+.L265:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L266:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 48]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L267
+  mov rbx, 0
+  jmp .L268
+.L267:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L268:
+#test/c/statement.c:150:     printf("test of void statement..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:153:         ;
+#test/c/statement.c:155:     if(1) ;
+  mov r8, 1
+  cmp r8, 0
+  je .L269
+#test/c/statement.c:155:     if(1) ;
+.L269:
+#test/c/statement.c:156:     if(0) ; else ;
+  mov r8, 0
+  cmp r8, 0
+  je .L270
+#test/c/statement.c:156:     if(0) ; else ;
+  jmp .L271
+.L270:
+#test/c/statement.c:156:     if(0) ; else ;
+.L271:
+#test/c/statement.c:158:     printf("test of break statement..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 56]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:160:     for(; break_1 < 5; break_1 += 1){
+.L272:
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L274
+#test/c/statement.c:161:         if(break_1 == 3){
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L275
+#test/c/statement.c:162:             break;
+  jmp .L274
+.L275:
+.L273:
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 56]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L272
+.L274:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 56]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L276
+  mov rbx, 0
+  jmp .L277
+.L276:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L277:
+  lea r8, [rbp - 60]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:168:     while(1){
+.L278:
+  mov r8, 1
+  cmp r8, 0
+  je .L279
+#test/c/statement.c:169:         if(break_2 == 4) break;
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L280
+#test/c/statement.c:169:         if(break_2 == 4) break;
+  jmp .L279
+.L280:
+#test/c/statement.c:169:         if(break_2 == 4) break;
+#test/c/statement.c:170:         break_2 += 1;
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 60]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L278
+.L279:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 60]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L281
+  mov rbx, 0
+  jmp .L282
+.L281:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L282:
+  lea r8, [rbp - 64]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 68]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:176:     for(; break_3_1 < 5; break_3_1 += 1){
+.L283:
+  lea r8, [rbp - 64]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L285
+#test/c/statement.c:177:         for(break_3_2 = 0; break_3_2 < 5; break_3_2 += 1){
+  lea r8, [rbp - 68]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L286:
+  lea r8, [rbp - 68]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L288
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+  lea r8, [rbp - 68]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L289
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+  jmp .L288
+.L289:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L287:
+  lea r8, [rbp - 68]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 68]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L286
+.L288:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 68]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L290
+  mov rbx, 0
+  jmp .L291
+.L290:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L291:
+.L284:
+  lea r8, [rbp - 64]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 64]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L283
+.L285:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 64]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L292
+  mov rbx, 0
+  jmp .L293
+.L292:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L293:
+#test/c/statement.c:184:     printf("test of continue statement..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 72]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 76]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:187:     for(;cont_1 < 5; cont_1 += 1){
+.L294:
+  lea r8, [rbp - 72]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L296
+#test/c/statement.c:188:         continue;
+.L295:
+  lea r8, [rbp - 72]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 72]
+  mov [r9], r8d
+  mov r8, r8
+  jmp .L294
+.L296:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 72]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L297
+  mov rbx, 0
+  jmp .L298
+.L297:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L298:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 76]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L299
+  mov rbx, 0
+  jmp .L300
+.L299:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L300:
+  lea r8, [rbp - 80]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 84]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:196:     while(cont_2 < 5){
+.L301:
+  lea r8, [rbp - 80]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L302
+#test/c/statement.c:197:         cont_2 += 1;
+  lea r8, [rbp - 80]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 80]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:198:         continue;
+  jmp .L301
+.L302:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 72]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L303
+  mov rbx, 0
+  jmp .L304
+.L303:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L304:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 76]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L305
+  mov rbx, 0
+  jmp .L306
+.L305:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L306:
+#test/c/statement.c:204:     printf("test of switch statement..\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 88]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 92]
+  mov r9, 3
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:208:     switch(s1){
+  lea r8, [rbp - 88]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  je .L309
+  cmp r8, 3
+  je .L308
+  jmp .L307
+.L309:
+#test/c/statement.c:210:             s2 = 5;
+  lea r8, [rbp - 92]
+  mov r9, 5
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:211:             break;
+  jmp .L307
+.L308:
+#test/c/statement.c:213:             s2 = 4;
+  lea r8, [rbp - 92]
+  mov r9, 4
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:214:             break;
+.L307:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 92]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L310
+  mov rbx, 0
+  jmp .L311
+.L310:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L311:
+  lea r8, [rbp - 96]
+  mov r9, 5
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:219:     switch(s2){
+  lea r8, [rbp - 92]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  je .L314
+  cmp r8, 1
+  je .L313
+  jmp .L315
+.L314:
+#test/c/statement.c:221:             s3 = 51;
+  lea r8, [rbp - 96]
+  mov r9, 51
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:222:             break;
+  jmp .L312
+.L313:
+#test/c/statement.c:224:             s3 = 10;
+  lea r8, [rbp - 96]
+  mov r9, 10
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:225:             break;
+  jmp .L312
+.L315:
+#test/c/statement.c:227:             s3 = 123;
+  lea r8, [rbp - 96]
+  mov r9, 123
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:228:             break;
+.L312:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 96]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 123
+  jne .L316
+  mov rbx, 0
+  jmp .L317
+.L316:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L317:
+  lea r8, [rbp - 100]
+  mov r9, 4
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:233:     switch(s2){
+  lea r8, [rbp - 92]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  je .L320
+  cmp r8, 10
+  je .L319
+  jmp .L318
+.L320:
+#test/c/statement.c:235:             s3 = 10;
+  lea r8, [rbp - 96]
+  mov r9, 10
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:236:         case 10:
+.L319:
+#test/c/statement.c:237:             s4 = 12;
+  lea r8, [rbp - 100]
+  mov r9, 12
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:238:             break;
+.L318:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 96]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L321
+  mov rbx, 0
+  jmp .L322
+.L321:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L322:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 100]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 12
+  jne .L323
+  mov rbx, 0
+  jmp .L324
+.L323:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L324:
+  lea r8, [rbp - 104]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:244:     switch(s2){
+  lea r8, [rbp - 92]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  je .L326
+  jmp .L325
+.L326:
+#test/c/statement.c:246:             s5 = 1;
+  lea r8, [rbp - 104]
+  mov r9, 1
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:247:             break;
+.L325:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 104]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L327
+  mov rbx, 0
+  jmp .L328
+.L327:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L328:
+  lea r8, [rbp - 108]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:252:     for(int sw_i = -3; sw_i < 12; sw_i++){
+  mov r8, 0
+  sub r8, 3
+  lea r9, [rbp - 112]
+  mov [r9], r8d
+  mov r8, r8
+.L329:
+  lea r8, [rbp - 112]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 12
+  jge .L331
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea r8, [rbp - 108]
+  movsxd rbx, DWORD PTR [r8]
+  lea rbx, [rbx + rbx * 2]
+  lea r8, [rbp - 112]
+  movsxd r8, DWORD PTR [r8]
+  mov rdi, r8
+  sub rsp, 8
+  call switch_dense
+  add rsp, 8
+  mov r8, rax
+  add rbx, r8
+  lea r8, [rbp - 108]
+  mov [r8], ebx
+  mov r8, rbx
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  lea r8, [rbp - 108]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 1000003
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  lea r9, [rbp - 108]
+  mov [r9], r8d
+  mov r8, r8
+.L330:
+  lea r8, [rbp - 112]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 116]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 112]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 112]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 116]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L329
+.L331:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 108]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 55398
+  jne .L332
+  mov rbx, 0
+  jmp .L333
+.L332:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L333:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L334
+  mov rbx, 0
+  jmp .L335
+.L334:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L335:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 2
+  jne .L336
+  mov rbx, 0
+  jmp .L337
+.L336:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L337:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 77
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 3
+  jne .L338
+  mov rbx, 0
+  jmp .L339
+.L338:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L339:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 100
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 4
+  jne .L340
+  mov rbx, 0
+  jmp .L341
+.L340:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L341:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1000
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 5
+  jne .L342
+  mov rbx, 0
+  jmp .L343
+.L342:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L343:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5000
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 6
+  jne .L344
+  mov rbx, 0
+  jmp .L345
+.L344:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L345:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L346
+  mov rbx, 0
+  jmp .L347
+.L346:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L347:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 4999
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L348
+  mov rbx, 0
+  jmp .L349
+.L348:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L349:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 3
+  mov rdi, r8
+  sub rsp, 8
+  call switch_sparse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L350
+  mov rbx, 0
+  jmp .L351
+.L350:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L351:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 100
+  jne .L352
+  mov rbx, 0
+  jmp .L353
+.L352:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L353:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 9
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L354
+  mov rbx, 0
+  jmp .L355
+.L354:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L355:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 10
+  jne .L356
+  mov rbx, 0
+  jmp .L357
+.L356:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L357:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 13
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 13
+  jne .L358
+  mov rbx, 0
+  jmp .L359
+.L358:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L359:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 15
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 15
+  jne .L360
+  mov rbx, 0
+  jmp .L361
+.L360:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L361:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 16
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L362
+  mov rbx, 0
+  jmp .L363
+.L362:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L363:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1000
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 200
+  jne .L364
+  mov rbx, 0
+  jmp .L365
+.L364:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L365:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2000
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 300
+  jne .L366
+  mov rbx, 0
+  jmp .L367
+.L366:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L367:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1999
+  sub rsp, 8
+  call switch_mixed
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L368
+  mov rbx, 0
+  jmp .L369
+.L368:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L369:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call switch_unsigned
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1
+  jne .L370
+  mov rbx, 0
+  jmp .L371
+.L370:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L371:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call switch_unsigned
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 4
+  jne .L372
+  mov rbx, 0
+  jmp .L373
+.L372:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L373:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call switch_unsigned
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 9
+  jne .L374
+  mov rbx, 0
+  jmp .L375
+.L374:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L375:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 2
+  mov rdi, r8
+  sub rsp, 8
+  call switch_unsigned
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L376
+  mov rbx, 0
+  jmp .L377
+.L376:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L377:
+#test/c/statement.c:280:     printf("test of loop invariant..\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  lea r8, [rbp - 140]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L378:
+  lea r8, [rbp - 140]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jge .L380
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  lea r8, [rbp - 140]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 136]
+  lea rcx, [rbp - 140]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L379:
+  lea r8, [rbp - 140]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 144]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 140]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 140]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 144]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L378
+.L380:
+#test/c/statement.c:284:     inv_v.len = 5;
+  lea r8, [rbp - 156]
+  add r8, 0
+  mov r9, 5
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:285:     inv_v.data = inv_data;
+  lea r8, [rbp - 136]
+  lea r9, [rbp - 156]
+  add r9, 4
+  mov [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 156]
+  mov rdi, r8
+  mov rsi, 2
+  sub rsp, 8
+  call inv_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 115
+  jne .L381
+  mov rbx, 0
+  jmp .L382
+.L381:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L382:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 156]
+  mov rdi, r8
+  mov rsi, 0
+  sub rsp, 8
+  call inv_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 25
+  jne .L383
+  mov rbx, 0
+  jmp .L384
+.L383:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L384:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 156]
+  mov rdi, r8
+  sub rsp, 8
+  call inv_guard
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 15
+  jne .L385
+  mov rbx, 0
+  jmp .L386
+.L385:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L386:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call inv_guard
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L387
+  mov rbx, 0
+  jmp .L388
+.L387:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L388:
+#test/c/statement.c:290:     inv_v.len = 10;
+  lea r8, [rbp - 156]
+  add r8, 0
+  mov r9, 10
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 156]
+  mov rdi, r8
+  sub rsp, 8
+  call inv_shrink
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 3
+  jne .L389
+  mov rbx, 0
+  jmp .L390
+.L389:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L390:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 156]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L391
+  mov rbx, 0
+  jmp .L392
+.L391:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L392:
+  lea r8, [rbp - 160]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 160]
+  mov rdi, r8
+  sub rsp, 8
+  call inv_through_ptr
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 10
+  jne .L393
+  mov rbx, 0
+  jmp .L394
+.L393:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L394:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + inv_limit ]
+  mov rdi, r8
+  sub rsp, 8
+  call inv_through_ptr
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 4
+  jne .L395
+  mov rbx, 0
+  jmp .L396
+.L395:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L396:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call inv_call
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 6
+  jne .L397
+  mov rbx, 0
+  jmp .L398
+.L397:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L398:
+#test/c/statement.c:298:     printf("test of induction variable..\n");
+  lea r8, [ rip + .LSTR12 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 136]
+  mov rdi, r8
+  mov rsi, 5
+  sub rsp, 8
+  call iv_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 15
+  jne .L399
+  mov rbx, 0
+  jmp .L400
+.L399:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L400:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 136]
+  mov rdi, r8
+  mov rsi, 0
+  sub rsp, 8
+  call iv_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L401
+  mov rbx, 0
+  jmp .L402
+.L401:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L402:
+#test/c/statement.c:303:     for(int iv_i = 0; iv_i < 6; iv_i++){
+  lea r8, [rbp - 260]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L403:
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 6
+  jge .L405
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 208]
+  lea rcx, [rbp - 260]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r9, rcx
+  mov [r9], r8
+  mov r8, r8
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 10
+  sub r9, r8
+  lea r8, [rbp - 256]
+  lea rcx, [rbp - 260]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 8
+  add r8, rcx
+  mov [r8], r9
+  mov r8, r9
+.L404:
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 264]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 260]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 260]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 264]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L403
+.L405:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 208]
+  lea r9, [rbp - 256]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 6
+  sub rsp, 8
+  call iv_stride
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 40
+  jne .L406
+  mov rbx, 0
+  jmp .L407
+.L406:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L407:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 208]
+  lea r9, [rbp - 256]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 1
+  sub rsp, 8
+  call iv_stride
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L408
+  mov rbx, 0
+  jmp .L409
+.L408:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L409:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call iv_reverse
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 2155287
+  jne .L410
+  mov rbx, 0
+  jmp .L411
+.L410:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L411:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .LSTR13 ]
+  mov rdi, r8
+  mov rsi, 5
+  sub rsp, 8
+  call iv_after
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 500
+  jne .L412
+  mov rbx, 0
+  jmp .L413
+.L412:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L413:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 136]
+  mov rdi, r8
+  mov rsi, 5
+  sub rsp, 8
+  call iv_weighted
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 45
+  jne .L414
+  mov rbx, 0
+  jmp .L415
+.L414:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L415:
+#test/c/statement.c:313:     printf("test of loop unrolling..\n");
+  lea r8, [ rip + .LSTR14 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:315:     for(int ur_i = 0; ur_i < 20; ur_i++){
+  lea r8, [rbp - 348]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L416:
+  lea r8, [rbp - 348]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 20
+  jge .L418
+#test/c/statement.c:316:         ur_a[ur_i] = ur_i * ur_i + 1;
+  lea r8, [rbp - 348]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 348]
+  movsxd r9, DWORD PTR [r9]
+  imul r8, r9
+  add r8, 1
+  lea r9, [rbp - 344]
+  lea rcx, [rbp - 348]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+.L417:
+  lea r8, [rbp - 348]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 352]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 348]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 348]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 352]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L416
+.L418:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 7
+  sub rsp, 8
+  call unroll_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 98
+  jne .L419
+  mov rbx, 0
+  jmp .L420
+.L419:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L420:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 0
+  sub rsp, 8
+  call unroll_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L421
+  mov rbx, 0
+  jmp .L422
+.L421:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L422:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 20
+  sub rsp, 8
+  call unroll_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 2490
+  jne .L423
+  mov rbx, 0
+  jmp .L424
+.L423:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L424:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 3
+  sub rsp, 8
+  call unroll_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 8
+  jne .L425
+  mov rbx, 0
+  jmp .L426
+.L425:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L426:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call unroll_known
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1013
+  jne .L427
+  mov rbx, 0
+  jmp .L428
+.L427:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L428:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 20
+  sub rsp, 8
+  call unroll_jump
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 37
+  jne .L429
+  mov rbx, 0
+  jmp .L430
+.L429:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L430:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5
+  sub rsp, 8
+  call unroll_jump
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 7
+  jne .L431
+  mov rbx, 0
+  jmp .L432
+.L431:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L432:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  sub rsp, 8
+  call unroll_jump
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L433
+  mov rbx, 0
+  jmp .L434
+.L433:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L434:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  sub rsp, 8
+  call unroll_down
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 344
+  jne .L435
+  mov rbx, 0
+  jmp .L436
+.L435:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L436:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 9
+  sub rsp, 8
+  call unroll_down
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 303
+  jne .L437
+  mov rbx, 0
+  jmp .L438
+.L437:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L438:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call unroll_down
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L439
+  mov rbx, 0
+  jmp .L440
+.L439:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L440:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call unroll_full
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 123
+  jne .L441
+  mov rbx, 0
+  jmp .L442
+.L441:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L442:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 20
+  mov rdx, 0
+  sub rsp, 8
+  call unroll_heuristic
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 361
+  jne .L443
+  mov rbx, 0
+  jmp .L444
+.L443:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L444:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 20
+  mov rdx, 5
+  sub rsp, 8
+  call unroll_heuristic
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 196
+  jne .L445
+  mov rbx, 0
+  jmp .L446
+.L445:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L446:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 344]
+  mov rdi, r8
+  mov rsi, 1
+  mov rdx, 0
+  sub rsp, 8
+  call unroll_heuristic
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L447
+  mov rbx, 0
+  jmp .L448
+.L447:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L448:
+#test/c/statement.c:334:     printf("test of loop vectorization..\n");
+  lea r8, [ rip + .LSTR15 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/statement.c:339:     for(int vec_i = 0; vec_i < 100; vec_i++){
+  lea r8, [rbp - 1356]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+.L449:
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 100
+  jge .L451
+#test/c/statement.c:340:         vec_a[vec_i] = vec_i * 7919 % 2001 - 1000;
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 7919
+  mov r9, 2001
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  sub r8, 1000
+  lea r9, [rbp - 752]
+  lea rcx, [rbp - 1356]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 4
+  add r9, rcx
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:341:         vec_c[vec_i] = vec_i * 53 % 256 - 128;
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 53
+  mov r9, 256
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  sub r8, 128
+  lea r9, [rbp - 1252]
+  lea rcx, [rbp - 1356]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  mov [r9], r8b
+  mov r8, r8
+#test/c/statement.c:342:         vec_u[vec_i] = vec_i * 71 % 256;
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 71
+  mov r9, 256
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  lea r9, [rbp - 1352]
+  lea rcx, [rbp - 1356]
+  movsxd rcx, DWORD PTR [rcx]
+  imul rcx, 1
+  add r9, rcx
+  mov [r9], r8b
+  mov r8, r8
+.L450:
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 1360]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 1356]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 1356]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 1360]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L449
+.L451:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1152]
+  lea r9, [rbp - 752]
+  mov rcx, 1
+  imul rcx, 4
+  add r9, rcx
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 37
+  mov rcx, 5
+  sub rsp, 8
+  call vec_map
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 217499273
+  cmp r8, r9
+  jne .L452
+  mov rbx, 0
+  jmp .L453
+.L452:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L453:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1152]
+  lea r9, [rbp - 752]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 0
+  mov rcx, 5
+  sub rsp, 8
+  call vec_map
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 0
+  jne .L454
+  mov rbx, 0
+  jmp .L455
+.L454:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L455:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov r9, 3
+  imul r9, 4
+  add r8, r9
+  mov rdi, r8
+  mov rsi, 50
+  sub rsp, 8
+  call vec_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1209
+  jne .L456
+  mov rbx, 0
+  jmp .L457
+.L456:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L457:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov rdi, r8
+  mov rsi, 3
+  sub rsp, 8
+  call vec_sum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 747
+  jne .L458
+  mov rbx, 0
+  jmp .L459
+.L458:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L459:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1252]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  mov rdi, r8
+  mov rsi, 70
+  sub rsp, 8
+  call vec_csum
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 391
+  cmp r8, r9
+  jne .L460
+  mov rbx, 0
+  jmp .L461
+.L460:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L461:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1352]
+  mov rdi, r8
+  mov rsi, 70
+  sub rsp, 8
+  call vec_ucsum
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 8905
+  jne .L462
+  mov rbx, 0
+  jmp .L463
+.L462:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L463:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov r9, 2
+  imul r9, 4
+  add r8, r9
+  mov rdi, r8
+  mov rsi, 60
+  sub rsp, 8
+  call vec_min
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 993
+  cmp r8, r9
+  jne .L464
+  mov rbx, 0
+  jmp .L465
+.L464:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L465:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov rdi, r8
+  mov rsi, 0
+  sub rsp, 8
+  call vec_min
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 10000
+  jne .L466
+  mov rbx, 0
+  jmp .L467
+.L466:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L467:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov rdi, r8
+  mov rsi, 60
+  sub rsp, 8
+  call vec_max
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 962
+  jne .L468
+  mov rbx, 0
+  jmp .L469
+.L468:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L469:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1252]
+  mov rdi, r8
+  mov rsi, 70
+  sub rsp, 8
+  call vec_cmin
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 128
+  cmp r8, r9
+  jne .L470
+  mov rbx, 0
+  jmp .L471
+.L470:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L471:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1352]
+  mov r9, 5
+  imul r9, 1
+  add r8, r9
+  mov rdi, r8
+  mov rsi, 64
+  sub rsp, 8
+  call vec_ucmax
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 254
+  jne .L472
+  mov rbx, 0
+  jmp .L473
+.L472:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L473:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov r9, 1
+  imul r9, 4
+  add r8, r9
+  lea r9, [rbp - 752]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, 40
+  sub rsp, 8
+  call vec_overlap
+  add rsp, 8
+  mov r8, rax
+  mov r9, 0
+  sub r9, 960
+  cmp r8, r9
+  jne .L474
+  mov rbx, 0
+  jmp .L475
+.L474:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L475:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov r9, 20
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  sub r9, 980
+  cmp r8, r9
+  jne .L476
+  mov rbx, 0
+  jmp .L477
+.L476:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L477:
+#test/c/statement.c:358:     printf("test of label and goto..\n");
+  lea r8, [ rip + .LSTR16 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 1364]
+  mov r9, 0
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:361:     LABEL_TEST_HEAD:
+.L173:
+#test/c/statement.c:362:     li += 1;
+  lea r8, [rbp - 1364]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 1364]
+  mov [r9], r8d
+  mov r8, r8
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+  lea r8, [rbp - 1364]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L478
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+  jmp .L172
+.L478:
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+#test/c/statement.c:364:     goto LABEL_TEST_HEAD;
+  jmp .L173
+.L172:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1364]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L479
+  mov rbx, 0
+  jmp .L480
+.L479:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L480:
+#test/c/statement.c:368:     printf("test of expression statement..\n");
+  lea r8, [ rip + .LSTR17 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 1368]
+  mov r9, 3
+  mov [r8], r9d
+  mov r8, r9
+#test/c/statement.c:370:     es * 2 + 1;
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 2
+  add r8, 1
+#test/c/statement.c:371:     es == 4;
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 4
+  cmp r8, r9
+  sete al
+  movzb r8, al
+#test/c/statement.c:372:     (long)es;
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  mov r8, r8
+#test/c/statement.c:373:     es++;
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 1372]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 1368]
+  mov [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 1372]
+  movsxd r8, DWORD PTR [r8]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1368]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L481
+  mov rbx, 0
+  jmp .L482
+.L481:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L482:
+  lea r8, [rbp - 1368]
+  lea r9, [rbp - 1380]
+  mov [r9], r8
+  mov r8, r8
+#test/c/statement.c:376:     *esp + 1;
+  lea r8, [rbp - 1380]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+#test/c/statement.c:377:     count_up() * 2;
+  sub rsp, 8
+  call count_up
+  add rsp, 8
+  mov r8, rax
+  imul r8, 2
+#test/c/statement.c:378:     count_up() + es;
+  sub rsp, 8
+  call count_up
+  add rsp, 8
+  mov r8, rax
+  lea r9, [rbp - 1368]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call count_up
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 3
+  jne .L483
+  mov rbx, 0
+  jmp .L484
+.L483:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L484:
+#test/c/statement.c:381:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_statement
+ret_test_statement:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
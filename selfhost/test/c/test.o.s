@@ -0,0 +1,141 @@
+.intel_syntax noprefix
+.global main
+.global test_extern_int
+.global test_static
+  .data
+.LSTR1:
+  .string "test is complete!!!\n"
+  .data
+.LSTR0:
+  .string "mcc2 test...\n\n"
+  .bss
+test_extern_int:
+  .zero 4
+  .bss
+.Ltest_static:
+  .zero 4
+# main
+#	 stack size: 240
+#	 __spill_area__( ofs: 240, size: 1) : level0
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/test.c:6:     printf("mcc2 test...\n\n");
+  lea r10, [ rip + .LSTR0 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:8:     test_extern_int = 10;
+  lea r10, [ rip + test_extern_int ]
+  mov r11, 10
+  mov [r10], r11d
+  mov r12, r11
+#test/c/test.c:9:     test_static = 20;
+  lea r10, [ rip + .Ltest_static ]
+  mov r11, 20
+  mov [r10], r11d
+  mov r12, r11
+#test/c/test.c:11:     test_expression();
+  sub rsp, 8
+  call test_expression
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:12:     test_statement();
+  sub rsp, 8
+  call test_statement
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:13:     test_variable();
+  sub rsp, 8
+  call test_variable
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:14:     test_type();
+  sub rsp, 8
+  call test_type
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:15:     test_primary();
+  sub rsp, 8
+  call test_primary
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:16:     test_pointer();
+  sub rsp, 8
+  call test_pointer
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:17:     test_assignment();
+  sub rsp, 8
+  call test_assignment
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:18:     test_preprocess();
+  sub rsp, 8
+  call test_preprocess
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:19:     test_cast();
+  sub rsp, 8
+  call test_cast
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:20:     test_function();
+  sub rsp, 8
+  call test_function
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:21:     test_varg();
+  sub rsp, 8
+  call test_varg
+  add rsp, 8
+  mov r10, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r10, [ rip + .Ltest_static ]
+  movsxd r11, DWORD PTR [r10]
+  mov r12, 20
+  cmp r11, r12
+  sete al
+  movzb r10, al
+  cmp r10, 0
+  je .L0
+  mov r11, 0
+  jmp .L1
+.L0:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r11, r12
+.L1:
+#test/c/test.c:25:     printf("test is complete!!!\n");
+  lea r10, [ rip + .LSTR1 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/test.c:26:     return 0;
+  mov r10, 0
+  mov rax, r10
+  jmp ret_main
+ret_main:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
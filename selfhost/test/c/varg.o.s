@@ -0,0 +1,405 @@
+.intel_syntax noprefix
+.global vafuncstr
+.global vafunc
+.global test_varg
+.global test_static
+  .data
+.LSTR7:
+  .string "d"
+  .data
+.LSTR6:
+  .string "c"
+  .data
+.LSTR5:
+  .string "b"
+  .data
+.LSTR4:
+  .string "a"
+  .data
+.LSTR3:
+  .string "%s %s %s %s\n"
+  .data
+.LSTR2:
+  .string "%d %d %d %d\n"
+  .data
+.LSTR1:
+  .string "test of varg with string..\n"
+  .data
+.LSTR0:
+  .string "test of varg..\n"
+  .bss
+.Ltest_static:
+  .zero 4
+# vafuncstr
+#	 stack size: 408
+#	 ap( ofs: 408, size: 24) : level0
+#	 __va_area__( ofs: 384, size: 1) : level0
+#	 __spill_area__( ofs: 248, size: 1) : level0
+#	 fmt( ofs: 8, size: 8) : level0
+  .text
+vafuncstr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 416
+  push r12
+  push r13
+  push r14
+  push r15
+  mov DWORD PTR [rbp - 384], 8
+  mov DWORD PTR [rbp - 384 + 4], 48
+  lea rax, [rbp - 384 + 16]
+  mov QWORD PTR [rbp - 384 + 8], rax
+  lea rax, [rbp - 384 + 24]
+  mov QWORD PTR [rbp - 384 + 16], rax
+  mov QWORD PTR [rbp - 384 + 24], rdi
+  mov QWORD PTR [rbp - 384 + 32], rsi
+  mov QWORD PTR [rbp - 384 + 40], rdx
+  mov QWORD PTR [rbp - 384 + 48], rcx
+  mov QWORD PTR [rbp - 384 + 56], r8
+  mov QWORD PTR [rbp - 384 + 64], r9
+  movsd QWORD PTR [rbp - 384 + 72], xmm0
+  movsd QWORD PTR [rbp - 384 + 80], xmm1
+  movsd QWORD PTR [rbp - 384 + 88], xmm2
+  movsd QWORD PTR [rbp - 384 + 96], xmm3
+  movsd QWORD PTR [rbp - 384 + 104], xmm4
+  movsd QWORD PTR [rbp - 384 + 112], xmm5
+  movsd QWORD PTR [rbp - 384 + 120], xmm6
+  movsd QWORD PTR [rbp - 384 + 128], xmm7
+  mov [rbp - 8], rdi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r10, [rbp - 384]
+  lea r11, [rbp - 408]
+  mov r8b, BYTE PTR [r10 + 0]
+  mov BYTE PTR [r11 + 0], r8b
+  mov r8b, BYTE PTR [r10 + 1]
+  mov BYTE PTR [r11 + 1], r8b
+  mov r8b, BYTE PTR [r10 + 2]
+  mov BYTE PTR [r11 + 2], r8b
+  mov r8b, BYTE PTR [r10 + 3]
+  mov BYTE PTR [r11 + 3], r8b
+  mov r8b, BYTE PTR [r10 + 4]
+  mov BYTE PTR [r11 + 4], r8b
+  mov r8b, BYTE PTR [r10 + 5]
+  mov BYTE PTR [r11 + 5], r8b
+  mov r8b, BYTE PTR [r10 + 6]
+  mov BYTE PTR [r11 + 6], r8b
+  mov r8b, BYTE PTR [r10 + 7]
+  mov BYTE PTR [r11 + 7], r8b
+  mov r8b, BYTE PTR [r10 + 8]
+  mov BYTE PTR [r11 + 8], r8b
+  mov r8b, BYTE PTR [r10 + 9]
+  mov BYTE PTR [r11 + 9], r8b
+  mov r8b, BYTE PTR [r10 + 10]
+  mov BYTE PTR [r11 + 10], r8b
+  mov r8b, BYTE PTR [r10 + 11]
+  mov BYTE PTR [r11 + 11], r8b
+  mov r8b, BYTE PTR [r10 + 12]
+  mov BYTE PTR [r11 + 12], r8b
+  mov r8b, BYTE PTR [r10 + 13]
+  mov BYTE PTR [r11 + 13], r8b
+  mov r8b, BYTE PTR [r10 + 14]
+  mov BYTE PTR [r11 + 14], r8b
+  mov r8b, BYTE PTR [r10 + 15]
+  mov BYTE PTR [r11 + 15], r8b
+  mov r8b, BYTE PTR [r10 + 16]
+  mov BYTE PTR [r11 + 16], r8b
+  mov r8b, BYTE PTR [r10 + 17]
+  mov BYTE PTR [r11 + 17], r8b
+  mov r8b, BYTE PTR [r10 + 18]
+  mov BYTE PTR [r11 + 18], r8b
+  mov r8b, BYTE PTR [r10 + 19]
+  mov BYTE PTR [r11 + 19], r8b
+  mov r8b, BYTE PTR [r10 + 20]
+  mov BYTE PTR [r11 + 20], r8b
+  mov r8b, BYTE PTR [r10 + 21]
+  mov BYTE PTR [r11 + 21], r8b
+  mov r8b, BYTE PTR [r10 + 22]
+  mov BYTE PTR [r11 + 22], r8b
+  mov r8b, BYTE PTR [r10 + 23]
+  mov BYTE PTR [r11 + 23], r8b
+#test/c/varg.c:18:     vprintf(fmt, ap);
+  lea r10, [rbp - 8]
+  mov r11, QWORD PTR [r10]
+  mov rdi, r11
+  lea r10, [rbp - 408]
+  mov rsi, r10
+  sub rsp, 8
+  call vprintf
+  add rsp, 8
+  mov r10, rax
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+ret_vafuncstr:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
+# vafunc
+#	 stack size: 416
+#	 i( ofs: 412, size: 4) : level0
+#	 sum( ofs: 408, size: 4) : level0
+#	 ap( ofs: 404, size: 24) : level0
+#	 __va_area__( ofs: 380, size: 1) : level0
+#	 __spill_area__( ofs: 244, size: 1) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+vafunc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 416
+  push r12
+  push r13
+  push r14
+  push r15
+  mov DWORD PTR [rbp - 380], 8
+  mov DWORD PTR [rbp - 380 + 4], 48
+  lea rax, [rbp - 380 + 16]
+  mov QWORD PTR [rbp - 380 + 8], rax
+  lea rax, [rbp - 380 + 24]
+  mov QWORD PTR [rbp - 380 + 16], rax
+  mov QWORD PTR [rbp - 380 + 24], rdi
+  mov QWORD PTR [rbp - 380 + 32], rsi
+  mov QWORD PTR [rbp - 380 + 40], rdx
+  mov QWORD PTR [rbp - 380 + 48], rcx
+  mov QWORD PTR [rbp - 380 + 56], r8
+  mov QWORD PTR [rbp - 380 + 64], r9
+  movsd QWORD PTR [rbp - 380 + 72], xmm0
+  movsd QWORD PTR [rbp - 380 + 80], xmm1
+  movsd QWORD PTR [rbp - 380 + 88], xmm2
+  movsd QWORD PTR [rbp - 380 + 96], xmm3
+  movsd QWORD PTR [rbp - 380 + 104], xmm4
+  movsd QWORD PTR [rbp - 380 + 112], xmm5
+  movsd QWORD PTR [rbp - 380 + 120], xmm6
+  movsd QWORD PTR [rbp - 380 + 128], xmm7
+  mov [rbp - 4], edi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r10, [rbp - 380]
+  lea r11, [rbp - 404]
+  mov r8b, BYTE PTR [r10 + 0]
+  mov BYTE PTR [r11 + 0], r8b
+  mov r8b, BYTE PTR [r10 + 1]
+  mov BYTE PTR [r11 + 1], r8b
+  mov r8b, BYTE PTR [r10 + 2]
+  mov BYTE PTR [r11 + 2], r8b
+  mov r8b, BYTE PTR [r10 + 3]
+  mov BYTE PTR [r11 + 3], r8b
+  mov r8b, BYTE PTR [r10 + 4]
+  mov BYTE PTR [r11 + 4], r8b
+  mov r8b, BYTE PTR [r10 + 5]
+  mov BYTE PTR [r11 + 5], r8b
+  mov r8b, BYTE PTR [r10 + 6]
+  mov BYTE PTR [r11 + 6], r8b
+  mov r8b, BYTE PTR [r10 + 7]
+  mov BYTE PTR [r11 + 7], r8b
+  mov r8b, BYTE PTR [r10 + 8]
+  mov BYTE PTR [r11 + 8], r8b
+  mov r8b, BYTE PTR [r10 + 9]
+  mov BYTE PTR [r11 + 9], r8b
+  mov r8b, BYTE PTR [r10 + 10]
+  mov BYTE PTR [r11 + 10], r8b
+  mov r8b, BYTE PTR [r10 + 11]
+  mov BYTE PTR [r11 + 11], r8b
+  mov r8b, BYTE PTR [r10 + 12]
+  mov BYTE PTR [r11 + 12], r8b
+  mov r8b, BYTE PTR [r10 + 13]
+  mov BYTE PTR [r11 + 13], r8b
+  mov r8b, BYTE PTR [r10 + 14]
+  mov BYTE PTR [r11 + 14], r8b
+  mov r8b, BYTE PTR [r10 + 15]
+  mov BYTE PTR [r11 + 15], r8b
+  mov r8b, BYTE PTR [r10 + 16]
+  mov BYTE PTR [r11 + 16], r8b
+  mov r8b, BYTE PTR [r10 + 17]
+  mov BYTE PTR [r11 + 17], r8b
+  mov r8b, BYTE PTR [r10 + 18]
+  mov BYTE PTR [r11 + 18], r8b
+  mov r8b, BYTE PTR [r10 + 19]
+  mov BYTE PTR [r11 + 19], r8b
+  mov r8b, BYTE PTR [r10 + 20]
+  mov BYTE PTR [r11 + 20], r8b
+  mov r8b, BYTE PTR [r10 + 21]
+  mov BYTE PTR [r11 + 21], r8b
+  mov r8b, BYTE PTR [r10 + 22]
+  mov BYTE PTR [r11 + 22], r8b
+  mov r8b, BYTE PTR [r10 + 23]
+  mov BYTE PTR [r11 + 23], r8b
+  lea r10, [rbp - 408]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+#test/c/varg.c:8:     for (int i = 0; i < a; i++){
+  lea r10, [rbp - 412]
+  mov r11, 0
+  mov [r10], r11d
+  mov r12, r11
+.L0:
+  lea r10, [rbp - 412]
+  movsxd r11, DWORD PTR [r10]
+  lea r10, [rbp - 4]
+  movsxd r13, DWORD PTR [r10]
+  cmp r11, r13
+  setl al
+  movzb r10, al
+  cmp r10, 0
+  je .L2
+#test/c/varg.c:9:         sum += va_arg(ap, int);
+  lea r11, [rbp - 408]
+  movsxd r13, DWORD PTR [r11]
+  lea r11, [rbp - 404]
+  add r11, 0
+  mov r14d, DWORD PTR [r11]
+  add r14, 8
+  lea r11, [rbp - 404]
+  add r11, 0
+  mov [r11], r14d
+  mov r15, r14
+  lea r11, [rbp - 404]
+  add r11, 16
+  mov r14, QWORD PTR [r11]
+  lea r11, [rbp - 404]
+  add r11, 0
+  mov QWORD PTR [rbp - 240 + 0], r10
+  mov r10d, DWORD PTR [r11]
+  sub r10, 8
+  imul r10, 1
+  add r14, r10
+  mov r10, QWORD PTR [r14]
+  add r13, r10
+  lea r10, [rbp - 408]
+  mov [r10], r13d
+  mov r11, r13
+.L1:
+  lea r10, [rbp - 412]
+  movsxd r11, DWORD PTR [r10]
+  lea r10, [rbp - 416]
+  mov [r10], r11d
+  mov r12, r11
+  lea r10, [rbp - 412]
+  movsxd r11, DWORD PTR [r10]
+  add r11, 1
+  lea r10, [rbp - 412]
+  mov [r10], r11d
+  mov r13, r11
+  lea r10, [rbp - 416]
+  movsxd r11, DWORD PTR [r10]
+  jmp .L0
+.L2:
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+#test/c/varg.c:12:     return sum;
+  lea r10, [rbp - 408]
+  movsxd r11, DWORD PTR [r10]
+  mov rax, r11
+  jmp ret_vafunc
+ret_vafunc:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
+# test_varg
+#	 stack size: 240
+#	 __spill_area__( ofs: 240, size: 1) : level0
+  .text
+test_varg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  push r12
+  push r13
+  push r14
+  push r15
+#test/c/varg.c:23:     printf("test of varg..\n");
+  lea r10, [ rip + .LSTR0 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r10, 3
+  mov rdi, r10
+  mov r10, 1
+  mov rsi, r10
+  mov r10, 2
+  mov rdx, r10
+  mov r10, 3
+  mov rcx, r10
+  mov eax, 0
+  sub rsp, 8
+  call vafunc
+  add rsp, 8
+  mov r10, rax
+  mov r12, 6
+  cmp r10, r12
+  sete al
+  movzb r11, al
+  cmp r11, 0
+  je .L3
+  mov r10, 0
+  jmp .L4
+.L3:
+  mov r12, 1
+  mov rdi, r12
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r12, rax
+  mov r10, r12
+.L4:
+#test/c/varg.c:26:     printf("test of varg with string..\n");
+  lea r10, [ rip + .LSTR1 ]
+  mov rdi, r10
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r10, rax
+#test/c/varg.c:27:     vafuncstr("%d %d %d %d\n", 1, 2, 3, 4);
+  lea r10, [ rip + .LSTR2 ]
+  mov rdi, r10
+  mov r10, 1
+  mov rsi, r10
+  mov r10, 2
+  mov rdx, r10
+  mov r10, 3
+  mov rcx, r10
+  mov r10, 4
+  mov r8, r10
+  mov eax, 0
+  sub rsp, 8
+  call vafuncstr
+  add rsp, 8
+  mov r10, rax
+#test/c/varg.c:28:     vafuncstr("%s %s %s %s\n", "a", "b", "c", "d");
+  lea r10, [ rip + .LSTR3 ]
+  mov rdi, r10
+  lea r10, [ rip + .LSTR4 ]
+  mov rsi, r10
+  lea r10, [ rip + .LSTR5 ]
+  mov rdx, r10
+  lea r10, [ rip + .LSTR6 ]
+  mov rcx, r10
+  lea r10, [ rip + .LSTR7 ]
+  mov r8, r10
+  mov eax, 0
+  sub rsp, 8
+  call vafuncstr
+  add rsp, 8
+  mov r10, rax
+#test/c/varg.c:29:     return 0;
+  mov r10, 0
+  mov rax, r10
+  jmp ret_test_varg
+ret_test_varg:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,125 @@
+#include "mcc2.h"
+
+/*
+    アドレスの解析
+
+    SSA形式の上で、仮想レジスタに入っているアドレスがどの変数から計算したものかを調べる。
+    アドレスを外に出していないローカル変数は、ほかの変数やポインタ経由の
+    書き込み、関数呼び出しでは書き換わらないとみなす。
+    値番号付け(gvn.c)と不変式の移動(licm.c)が、読み込みを動かしてよいかの判断に使う。
+*/
+
+static Ident** base;        // [vn] アドレスの元になった変数
+static int nbase;
+static Ident** escaped;     // アドレスを外に出したローカル変数
+static int nescaped;
+
+Ident* addr_base(Reg* reg){
+    if(!is_vreg(reg) || reg->vn < 0 || reg->vn >= nbase){
+        return NULL;
+    }
+    return base[reg->vn];
+}
+
+bool addr_escaped(Ident* ident){
+    if(ident->kind != ID_LVAR){
+        return true;
+    }
+    for(int i = 0; i < nescaped; i++){
+        if(escaped[i] == ident) return true;
+    }
+    return false;
+}
+
+static void mark_escaped(Ident* ident){
+    if(!ident || addr_escaped(ident)){
+        return;
+    }
+    escaped = realloc(escaped, sizeof(Ident*) * (nescaped + 1));
+    escaped[nescaped++] = ident;
+}
+
+// アドレスとして読み書きにだけ使うオペランドか
+static bool is_address_use(IR* ir, Reg** slot){
+    switch(ir->cmd){
+        case IR_LOAD:
+            return slot == &ir->s2;
+        case IR_ASSIGN:
+        case IR_VLOAD:
+        case IR_VSTORE:
+            return slot == &ir->s1;
+        case IR_COPY:
+        case IR_RELEASE_REG:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 仮想レジスタごとに、どの変数のアドレスから計算したかを調べる
+// アドレスが読み書き以外に使われた変数は、外に出たものとする
+void analyze_addresses(CFG* cfg){
+    nbase = cfg->nregs;
+    base = calloc(nbase + 1, sizeof(Ident*));
+    nescaped = 0;
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                for(int j = 0; j < bb->npreds; j++){
+                    mark_escaped(addr_base(ir->phi_args[j]));
+                }
+                continue;
+            }
+
+            // アドレスに整数を足し引きしたもの、コピーしたものは同じ変数を指す
+            Reg* derived = NULL;
+            Ident* b = NULL;
+            if(ir->cmd == IR_REL){
+                b = ir->s1->ident;
+            } else if(ir->cmd == IR_MOV && is_vreg(ir->s1)){
+                derived = ir->s2;
+                b = addr_base(ir->s2);
+            } else if((ir->cmd == IR_ADD || ir->cmd == IR_SUB) && ir->t){
+                Ident* b1 = addr_base(ir->s1);
+                Ident* b2 = ir->cmd == IR_ADD ? addr_base(ir->s2) : NULL;
+                if(b1 && !b2){
+                    derived = ir->s1;
+                    b = b1;
+                } else if(b2 && !b1){
+                    derived = ir->s2;
+                    b = b2;
+                }
+            }
+            Reg** d = ir_def_slot(ir);
+            if(b && d && is_vreg(*d) && (*d)->vn < nbase){
+                base[(*d)->vn] = b;
+            }
+
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int j = 0; j < nuse; j++){
+                if(*slots[j] != derived && !is_address_use(ir, slots[j])){
+                    mark_escaped(addr_base(*slots[j]));
+                }
+            }
+        }
+    }
+}
+
+/*
+    書き込みでaddrからの読み込みの結果が使えなくなるか
+        store   : 書き込み先の変数(わからなければNULL)
+        is_call : 関数呼び出し
+*/
+bool may_clobber(Reg* addr, Ident* store, bool is_call){
+    Ident* b = addr_base(addr);
+    if(is_call){
+        return !b || addr_escaped(b);
+    }
+    if(store){
+        return b == store || (!b && addr_escaped(store));
+    }
+    return !b || addr_escaped(b);
+}
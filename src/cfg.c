@@ -0,0 +1,914 @@
+#include "mcc2.h"
+
+/*
+    関数の中間命令列を基本ブロックに分割して、制御フローグラフを作る。
+    最適化パスはCFGの上で中間命令を書き換え、最後にlinearize_cfg()で
+    命令列に戻す。
+*/
+
+static BasicBlock* new_block(CFG* cfg);
+static void add_edge(BasicBlock* from, BasicBlock* to);
+static void compute_rpo(CFG* cfg);
+static void compute_df(CFG* cfg);
+static void collect_regs(CFG* cfg);
+
+static char* ir_name[] = {
+    [IR_ADD] = "add",
+    [IR_SUB] = "sub",
+    [IR_MUL] = "mul",
+    [IR_DIV] = "div",
+    [IR_MOD] = "mod",
+    [IR_MULHI] = "mulhi",
+    [IR_EQUAL] = "eq",
+    [IR_NOT_EQUAL] = "ne",
+    [IR_LT] = "lt",
+    [IR_LE] = "le",
+    [IR_BIT_AND] = "and",
+    [IR_BIT_XOR] = "xor",
+    [IR_BIT_OR] = "or",
+    [IR_L_BIT_SHIFT] = "shl",
+    [IR_R_BIT_SHIFT] = "shr",
+    [IR_ASSIGN] = "assign",
+    [IR_FN_CALL] = "call",
+    [IR_TAIL_CALL] = "tailcall",
+    [IR_REL] = "rel",
+    [IR_CAST] = "cast",
+    [IR_MOV] = "mov",
+    [IR_RELEASE_REG] = "release",
+    [IR_RELEASE_REG_ALL] = "release_all",
+    [IR_LEA] = "lea",
+    [IR_ADDR] = "addr",
+    [IR_LOAD] = "load",
+    [IR_COPY] = "copy",
+    [IR_RET] = "ret",
+    [IR_JNZ] = "jnz",
+    [IR_JZ] = "jz",
+    [IR_JMP] = "jmp",
+    [IR_JE] = "je",
+    [IR_JNE] = "jne",
+    [IR_JLT] = "jlt",
+    [IR_JLE] = "jle",
+    [IR_JGT] = "jgt",
+    [IR_JGE] = "jge",
+    [IR_JTABLE] = "jtable",
+    [IR_LABEL] = "label",
+    [IR_FN_LABEL] = "fn_label",
+    [IR_FN_END_LABEL] = "fn_end_label",
+    [IR_GVAR_LABEL] = "gvar_label",
+    [IR_STATIC_GVAR_LABEL] = "static_gvar_label",
+    [IR_STORE_ARG_REG] = "store_arg_reg",
+    [IR_LOAD_ARG_REG] = "load_arg_reg",
+    [IR_SET_FLOAT_NUM] = "set_float_num",
+    [IR_EXTERN_LABEL] = "extern_label",
+    [IR_VA_START] = "va_start",
+    [IR_VLOAD] = "vload",
+    [IR_VSTORE] = "vstore",
+    [IR_VBCAST] = "vbcast",
+    [IR_VADD] = "vadd",
+    [IR_VSUB] = "vsub",
+    [IR_VMUL] = "vmul",
+    [IR_VAND] = "vand",
+    [IR_VOR] = "vor",
+    [IR_VXOR] = "vxor",
+    [IR_VSHL] = "vshl",
+    [IR_VSHR] = "vshr",
+    [IR_VMIN] = "vmin",
+    [IR_VMAX] = "vmax",
+    [IR_VSAD] = "vsad",
+    [IR_VREDUCE] = "vreduce",
+    [IR_VEND] = "vend",
+    [IR_COMMENT] = "comment",
+    [IR_PHI] = "phi",
+    [IR_SPILL] = "spill",
+    [IR_RELOAD] = "reload",
+};
+
+CFG* build_cfg(Ident* func){
+    CFG* cfg = calloc(1, sizeof(CFG));
+    cfg->func = func;
+
+    // ラベル番号の範囲を調べる
+    long min_label = -1;
+    long max_label = -1;
+    for(IR* ir = func->ir_cmd; ir; ir = ir->next){
+        if(ir->cmd == IR_LABEL){
+            long label = ir->s1->val;
+            if(min_label == -1 || label < min_label) min_label = label;
+            if(label > max_label) max_label = label;
+        }
+    }
+    BasicBlock** label2bb = calloc(max_label - min_label + 2, sizeof(BasicBlock*));
+
+    // 1. 基本ブロックに分割する
+    //    ラベルの前と、ジャンプ命令の後ろでブロックを区切る
+    BasicBlock* cur = new_block(cfg);
+    cfg->head = cur;
+    IR* tail = NULL;
+    bool only_label = true;
+    IR* next = NULL;
+    for(IR* ir = func->ir_cmd; ir; ir = next){
+        next = ir->next;
+        ir->next = NULL;
+
+        bool split = (ir->cmd == IR_LABEL && !only_label)
+                    || ir->cmd == IR_FN_END_LABEL;
+        if(split && cur->ir){
+            BasicBlock* bb = new_block(cfg);
+            cur->next = bb;
+            cur = bb;
+            tail = NULL;
+            only_label = true;
+        }
+
+        if(tail){
+            tail->next = ir;
+        } else {
+            cur->ir = ir;
+        }
+        tail = ir;
+
+        if(ir->cmd == IR_LABEL){
+            label2bb[ir->s1->val - min_label] = cur;
+        } else {
+            only_label = false;
+        }
+        if(ir->cmd == IR_FN_END_LABEL){
+            cfg->exit = cur;
+        }
+
+        if(is_terminator(ir->cmd) && next && next->cmd != IR_FN_END_LABEL){
+            BasicBlock* bb = new_block(cfg);
+            cur->next = bb;
+            cur = bb;
+            tail = NULL;
+            only_label = true;
+        }
+    }
+
+    // 2. ブロック間の辺を張る
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        IR* last = block_tail(bb);
+        switch(last ? last->cmd : IR_COMMENT){
+            case IR_JMP:
+                bb->succs[0] = label2bb[last->s1->val - min_label];
+                break;
+            case IR_RET:
+                bb->succs[0] = cfg->exit;
+                break;
+            case IR_JZ:
+            case IR_JNZ:
+                bb->succs[0] = bb->next;
+                bb->succs[1] = label2bb[last->s2->val - min_label];
+                break;
+            case IR_JE:
+            case IR_JNE:
+            case IR_JLT:
+            case IR_JLE:
+            case IR_JGT:
+            case IR_JGE:
+                bb->succs[0] = bb->next;
+                bb->succs[1] = label2bb[last->t->val - min_label];
+                break;
+            case IR_JTABLE:
+                bb->succs = calloc(last->ntargets + 2, sizeof(BasicBlock*));
+                bb->nsuccs = 0;
+                for(int i = 0; i < last->ntargets; i++){
+                    BasicBlock* to = label2bb[last->targets[i] - min_label];
+                    int j = 0;
+                    while(j < bb->nsuccs && bb->succs[j] != to) j++;
+                    if(j == bb->nsuccs){
+                        bb->succs[bb->nsuccs++] = to;
+                    }
+                }
+                continue;
+            default:
+                bb->succs[0] = bb->next;
+                break;
+        }
+        bb->nsuccs = bb->succs[0] ? 1 : 0;
+        if(bb->succs[1]){
+            if(bb->succs[1] == bb->succs[0]){
+                bb->succs[1] = NULL;
+            } else {
+                bb->nsuccs = 2;
+            }
+        }
+    }
+
+    compute_rpo(cfg);
+
+    // 先行ブロックは到達可能なものだけを持つ
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(int j = 0; j < bb->nsuccs; j++){
+            add_edge(bb, bb->succs[j]);
+        }
+    }
+
+    collect_regs(cfg);
+    return cfg;
+}
+
+// CFGを中間命令列に戻して、関数のir_cmdに書き戻す
+void linearize_cfg(CFG* cfg){
+    IR head = {};
+    IR* tail = &head;
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        // 次のブロックへのジャンプは不要
+        IR* last = block_tail(bb);
+        if(last && last->cmd == IR_JMP && bb->succs[0] == bb->next){
+            remove_ir(bb, last);
+            last = block_tail(bb);
+        }
+
+        // フォールスルー先が次のブロックでなくなっていたらジャンプを補う
+        bool falls = !last || !is_terminator(last->cmd)
+                    || last->cmd == IR_JZ || last->cmd == IR_JNZ || is_cmp_jump(last->cmd);
+        if(falls && bb->succs[0] && bb->succs[0] != bb->next){
+            BasicBlock* to = bb->succs[0];
+            IR* jmp = NULL;
+            if(to == cfg->exit){
+                jmp = make_IR(IR_RET, NULL, NULL, to->ir->s1);
+            } else {
+                jmp = make_IR(IR_JMP, NULL, new_RegImm(block_label(to)), NULL);
+            }
+            if(last){
+                last->next = jmp;
+            } else {
+                bb->ir = jmp;
+            }
+        }
+
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            tail->next = ir;
+            tail = ir;
+        }
+    }
+    tail->next = NULL;
+    cfg->func->ir_cmd = head.next;
+}
+
+static BasicBlock* new_block(CFG* cfg){
+    BasicBlock* bb = calloc(1, sizeof(BasicBlock));
+    bb->id = cfg->nblock_ids++;
+    bb->succs = calloc(2, sizeof(BasicBlock*));
+    bb->rpo = -1;
+    return bb;
+}
+
+static void add_edge(BasicBlock* from, BasicBlock* to){
+    to->preds = realloc(to->preds, sizeof(BasicBlock*) * (to->npreds + 1));
+    to->preds[to->npreds++] = from;
+}
+
+static void dfs(CFG* cfg, BasicBlock* bb, BasicBlock** order, int* n){
+    bb->reachable = true;
+    // 分岐先を先に辿ると、逆後順でフォールスルー先が前に来る
+    for(int i = bb->nsuccs - 1; i >= 0; i--){
+        if(!bb->succs[i]->reachable){
+            dfs(cfg, bb->succs[i], order, n);
+        }
+    }
+    order[(*n)++] = bb;
+}
+
+static void compute_rpo(CFG* cfg){
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        bb->reachable = false;
+        bb->rpo = -1;
+        bb->preds = NULL;
+        bb->npreds = 0;
+    }
+
+    BasicBlock** order = calloc(cfg->nblock_ids, sizeof(BasicBlock*));
+    int n = 0;
+    dfs(cfg, cfg->head, order, &n);
+
+    cfg->blocks = calloc(n, sizeof(BasicBlock*));
+    cfg->nblocks = n;
+    for(int i = 0; i < n; i++){
+        BasicBlock* bb = order[n - 1 - i];
+        bb->rpo = i;
+        cfg->blocks[i] = bb;
+    }
+}
+
+// 辺を張り替えた後で、到達可能性と先行ブロックを計算しなおす
+// phiの引数は新しい先行ブロックの順に並べなおす
+void cfg_refresh(CFG* cfg){
+    BasicBlock*** old_preds = calloc(cfg->nblock_ids, sizeof(BasicBlock**));
+    int* old_npreds = calloc(cfg->nblock_ids, sizeof(int));
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        old_preds[bb->id] = bb->preds;
+        old_npreds[bb->id] = bb->npreds;
+        IR* last = block_tail(bb);
+        if(last && last->cmd == IR_JTABLE){
+            continue;
+        }
+        bb->nsuccs = 0;
+        if(bb->succs[0]) bb->nsuccs++;
+        if(bb->succs[1]){
+            if(!bb->succs[0] || bb->succs[1] == bb->succs[0]){
+                error("invalid cfg edge.\n");
+            }
+            bb->nsuccs++;
+        }
+    }
+    compute_rpo(cfg);
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(int j = 0; j < bb->nsuccs; j++){
+            add_edge(bb, bb->succs[j]);
+        }
+    }
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd != IR_PHI) continue;
+            Reg** args = calloc(bb->npreds, sizeof(Reg*));
+            for(int j = 0; j < bb->npreds; j++){
+                for(int k = 0; k < old_npreds[bb->id]; k++){
+                    if(old_preds[bb->id][k] == bb->preds[j]){
+                        args[j] = ir->phi_args[k];
+                    }
+                }
+            }
+            ir->phi_args = args;
+        }
+    }
+}
+
+// from -> to の辺の間に空のブロックを挟んで、そのブロックを返す
+// 新しいブロックは配置順でtoの直前に置く。呼び出し側で cfg_refresh() すること
+BasicBlock* split_edge(CFG* cfg, BasicBlock* from, BasicBlock* to){
+    BasicBlock* bb = new_block(cfg);
+    bb->succs[0] = to;
+    bb->nsuccs = 1;
+
+    // 分岐先として辿る辺なら、分岐命令の飛び先を新しいブロックにする
+    IR* last = block_tail(from);
+    if(from->succs[1] == to || (last && last->cmd == IR_JMP)){
+        long label = block_label(bb);
+        if(last->cmd == IR_JMP){
+            last->s1 = new_RegImm(label);
+        } else if(last->cmd == IR_JZ || last->cmd == IR_JNZ){
+            last->s2 = new_RegImm(label);
+        } else {
+            last->t = new_RegImm(label);
+        }
+    }
+    for(int i = 0; i < from->nsuccs; i++){
+        if(from->succs[i] == to){
+            from->succs[i] = bb;
+        }
+    }
+
+    // phiの引数を引き継げるように、先行ブロックを置き換えておく
+    for(int i = 0; i < to->npreds; i++){
+        if(to->preds[i] == from){
+            to->preds[i] = bb;
+        }
+    }
+
+    BasicBlock* prev = cfg->head;
+    while(prev->next != to){
+        prev = prev->next;
+    }
+    prev->next = bb;
+    bb->next = to;
+    return bb;
+}
+
+// 配置順から到達できないブロックを取り除く。関数の出口は残す
+// 取り除いたブロックの数を返す
+int remove_unreachable_blocks(CFG* cfg){
+    int removed = 0;
+    BasicBlock* prev = cfg->head;
+    for(BasicBlock* bb = cfg->head->next; bb; bb = bb->next){
+        if(!bb->reachable && bb != cfg->exit){
+            prev->next = bb->next;
+            removed++;
+        } else {
+            prev = bb;
+        }
+    }
+    return removed;
+}
+
+static BasicBlock* intersect(BasicBlock* a, BasicBlock* b){
+    while(a != b){
+        while(a->rpo > b->rpo) a = a->idom;
+        while(b->rpo > a->rpo) b = b->idom;
+    }
+    return a;
+}
+
+// Cooper, Harvey, Kennedyの反復アルゴリズムで支配木を求める
+void compute_dominators(CFG* cfg){
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        bb->idom = NULL;
+        bb->dom_child = NULL;
+        bb->dom_sibling = NULL;
+    }
+
+    BasicBlock* entry = cfg->blocks[0];
+    entry->idom = entry;
+    bool changed = true;
+    while(changed){
+        changed = false;
+        for(int i = 1; i < cfg->nblocks; i++){
+            BasicBlock* bb = cfg->blocks[i];
+            BasicBlock* new_idom = NULL;
+            for(int j = 0; j < bb->npreds; j++){
+                BasicBlock* p = bb->preds[j];
+                if(!p->idom) continue;
+                new_idom = new_idom ? intersect(p, new_idom) : p;
+            }
+            if(bb->idom != new_idom){
+                bb->idom = new_idom;
+                changed = true;
+            }
+        }
+    }
+
+    // 支配木の子を逆順に繋いでおく(たどると逆後順になる)
+    for(int i = cfg->nblocks - 1; i > 0; i--){
+        BasicBlock* bb = cfg->blocks[i];
+        bb->dom_sibling = bb->idom->dom_child;
+        bb->idom->dom_child = bb;
+    }
+
+    compute_df(cfg);
+}
+
+static void compute_df(CFG* cfg){
+    for(int i = 0; i < cfg->nblocks; i++){
+        cfg->blocks[i]->df = NULL;
+        cfg->blocks[i]->ndf = 0;
+    }
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        if(bb->npreds < 2) continue;
+        for(int j = 0; j < bb->npreds; j++){
+            BasicBlock* runner = bb->preds[j];
+            while(runner != bb->idom){
+                bool found = false;
+                for(int k = 0; k < runner->ndf; k++){
+                    if(runner->df[k] == bb) found = true;
+                }
+                if(!found){
+                    runner->df = realloc(runner->df, sizeof(BasicBlock*) * (runner->ndf + 1));
+                    runner->df[runner->ndf++] = bb;
+                }
+                runner = runner->idom;
+            }
+        }
+    }
+}
+
+bool dominates(BasicBlock* a, BasicBlock* b){
+    while(true){
+        if(a == b) return true;
+        if(b->idom == b || !b->idom) return false;
+        b = b->idom;
+    }
+}
+
+// 仮想レジスタごとの生存区間を、ブロックの入口/出口で求める
+void compute_liveness(CFG* cfg){
+    collect_regs(cfg);
+
+    int n = cfg->nregs;
+    BitSet** use = calloc(cfg->nblock_ids, sizeof(BitSet*));
+    BitSet** def = calloc(cfg->nblock_ids, sizeof(BitSet*));
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        use[bb->id] = new_bitset(n);
+        def[bb->id] = new_bitset(n);
+        bb->live_in = new_bitset(n);
+        bb->live_out = new_bitset(n);
+
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd != IR_PHI){
+                Reg** slots[MAX_IR_OPERANDS];
+                int nuse = ir_use_slots(ir, slots);
+                for(int j = 0; j < nuse; j++){
+                    int vn = (*slots[j])->vn;
+                    if(!bitset_test(def[bb->id], vn)){
+                        bitset_set(use[bb->id], vn);
+                    }
+                }
+            }
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                bitset_set(def[bb->id], (*d)->vn);
+            }
+        }
+    }
+
+    bool changed = true;
+    while(changed){
+        changed = false;
+        for(int i = cfg->nblocks - 1; i >= 0; i--){
+            BasicBlock* bb = cfg->blocks[i];
+            for(int j = 0; j < bb->nsuccs; j++){
+                BasicBlock* succ = bb->succs[j];
+                bitset_union(bb->live_out, succ->live_in);
+
+                // phiの引数は先行ブロックの出口で使われる
+                int pidx = 0;
+                while(succ->preds[pidx] != bb) pidx++;
+                for(IR* ir = succ->ir; ir; ir = ir->next){
+                    if(ir->cmd != IR_PHI) continue;
+                    Reg* arg = ir->phi_args[pidx];
+                    if(is_vreg(arg)){
+                        bitset_set(bb->live_out, arg->vn);
+                    }
+                }
+            }
+
+            BitSet* in = copy_bitset(bb->live_out);
+            for(int k = 0; k < n; k++){
+                if(bitset_test(def[bb->id], k)){
+                    bitset_clear(in, k);
+                }
+            }
+            bitset_union(in, use[bb->id]);
+            if(!bitset_equal(in, bb->live_in)){
+                bb->live_in = in;
+                changed = true;
+            }
+        }
+    }
+}
+
+// 到達可能なブロックに現れる仮想レジスタに番号を振りなおす
+static void collect_regs(CFG* cfg){
+    cfg->nregs = 0;
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                cfg_add_reg(cfg, *d);
+            }
+            if(ir->cmd == IR_PHI){
+                for(int j = 0; j < cfg->blocks[i]->npreds; j++){
+                    if(is_vreg(ir->phi_args[j])){
+                        cfg_add_reg(cfg, ir->phi_args[j]);
+                    }
+                }
+                continue;
+            }
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int j = 0; j < nuse; j++){
+                cfg_add_reg(cfg, *slots[j]);
+            }
+        }
+    }
+}
+
+void cfg_add_reg(CFG* cfg, Reg* reg){
+    if(reg->vn >= 0 && reg->vn < cfg->nregs && cfg->regs[reg->vn] == reg){
+        return;
+    }
+    if(cfg->nregs == cfg->reg_cap){
+        cfg->reg_cap = cfg->reg_cap ? cfg->reg_cap * 2 : 64;
+        cfg->regs = realloc(cfg->regs, sizeof(Reg*) * cfg->reg_cap);
+    }
+    reg->vn = cfg->nregs;
+    cfg->regs[cfg->nregs++] = reg;
+}
+
+// baseと同じ型の仮想レジスタを新しく作る
+Reg* cfg_new_reg(CFG* cfg, Reg* base){
+    Reg* reg = new_Reg();
+    if(base){
+        reg->size = base->size;
+        reg->is_unsigned = base->is_unsigned;
+    }
+    cfg_add_reg(cfg, reg);
+    return reg;
+}
+
+IR* make_IR(IRCmd cmd, Reg* t, Reg* s1, Reg* s2){
+    IR* ir = calloc(1, sizeof(IR));
+    ir->cmd = cmd;
+    ir->t = t;
+    ir->s1 = s1;
+    ir->s2 = s2;
+    return ir;
+}
+
+bool is_vreg(Reg* reg){
+    return reg && reg->kind == REG_REG;
+}
+
+bool is_binop(IRCmd cmd){
+    switch(cmd){
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_DIV:
+        case IR_MOD:
+        case IR_MULHI:
+        case IR_BIT_AND:
+        case IR_BIT_XOR:
+        case IR_BIT_OR:
+        case IR_L_BIT_SHIFT:
+        case IR_R_BIT_SHIFT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool is_terminator(IRCmd cmd){
+    switch(cmd){
+        case IR_JMP:
+        case IR_JZ:
+        case IR_JNZ:
+        case IR_JTABLE:
+        case IR_RET:
+            return true;
+        default:
+            return is_cmp_jump(cmd);
+    }
+}
+
+// 2つの値を比較して分岐する命令か
+bool is_cmp_jump(IRCmd cmd){
+    switch(cmd){
+        case IR_JE:
+        case IR_JNE:
+        case IR_JLT:
+        case IR_JLE:
+        case IR_JGT:
+        case IR_JGE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 中間命令が値を書き込むオペランドを返す
+Reg** ir_def_slot(IR* ir){
+    if(is_binop(ir->cmd)){
+        return ir->t ? &ir->t : &ir->s1;
+    }
+    switch(ir->cmd){
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_CAST:
+        case IR_REL:
+        case IR_ADDR:
+        case IR_FN_CALL:
+        case IR_PHI:
+        case IR_VREDUCE:
+            return &ir->t;
+        case IR_ASSIGN:
+            return ir->t ? &ir->t : NULL;
+        case IR_MOV:
+        case IR_LOAD:
+            return &ir->s1;
+        case IR_STORE_ARG_REG:
+            return is_vreg(ir->s1) ? &ir->s1 : NULL;
+        default:
+            return NULL;
+    }
+}
+
+// 中間命令が値として読み出すオペランドをslotsに格納して、その数を返す
+// 直値も含む。phiの引数は含まない
+int ir_operand_slots(IR* ir, Reg*** slots){
+    Reg** cand[MAX_IR_OPERANDS] = { NULL, NULL, NULL };
+    if(is_binop(ir->cmd)){
+        cand[0] = &ir->s1;
+        cand[1] = &ir->s2;
+    } else {
+        switch(ir->cmd){
+            case IR_EQUAL:
+            case IR_NOT_EQUAL:
+            case IR_LT:
+            case IR_LE:
+            case IR_ASSIGN:
+            case IR_JE:
+            case IR_JNE:
+            case IR_JLT:
+            case IR_JLE:
+            case IR_JGT:
+            case IR_JGE:
+                cand[0] = &ir->s1;
+                cand[1] = &ir->s2;
+                break;
+            case IR_MOV:
+            case IR_LOAD:
+                cand[0] = &ir->s2;
+                break;
+            case IR_CAST:
+            case IR_ADDR:
+            case IR_LOAD_ARG_REG:
+            case IR_RET:
+            case IR_VLOAD:
+            case IR_VSTORE:
+            case IR_VBCAST:
+            case IR_JZ:
+            case IR_JNZ:
+            case IR_JTABLE:
+                cand[0] = &ir->s1;
+                break;
+            case IR_COPY:
+                cand[0] = &ir->t;
+                cand[1] = &ir->s1;
+                break;
+            case IR_RELEASE_REG:
+                cand[0] = &ir->t;
+                break;
+            default:
+                break;
+        }
+    }
+
+    // メモリオペランドの添字
+    if(ir->index){
+        cand[2] = &ir->index;
+    }
+
+    int n = 0;
+    for(int i = 0; i < MAX_IR_OPERANDS; i++){
+        if(cand[i] && *cand[i]){
+            slots[n++] = cand[i];
+        }
+    }
+    return n;
+}
+
+// 中間命令が読み出す仮想レジスタのオペランドをslotsに格納して、その数を返す
+// phiの引数は含まない
+int ir_use_slots(IR* ir, Reg*** slots){
+    Reg** cand[MAX_IR_OPERANDS];
+    int ncand = ir_operand_slots(ir, cand);
+    int n = 0;
+    for(int i = 0; i < ncand; i++){
+        if(is_vreg(*cand[i])){
+            slots[n++] = cand[i];
+        }
+    }
+    return n;
+}
+
+char* ir_cmd_name(IRCmd cmd){
+    return ir_name[cmd];
+}
+
+IR* block_tail(BasicBlock* bb){
+    IR* ir = bb->ir;
+    while(ir && ir->next){
+        ir = ir->next;
+    }
+    return ir;
+}
+
+// ブロックのラベル番号を返す。ラベルがなければ先頭に作る
+long block_label(BasicBlock* bb){
+    if(bb->ir && bb->ir->cmd == IR_LABEL){
+        return bb->ir->s1->val;
+    }
+    IR* label = make_IR(IR_LABEL, NULL, new_RegImm(get_label()), NULL);
+    label->next = bb->ir;
+    bb->ir = label;
+    return label->s1->val;
+}
+
+void remove_ir(BasicBlock* bb, IR* ir){
+    if(bb->ir == ir){
+        bb->ir = ir->next;
+        return;
+    }
+    for(IR* prev = bb->ir; prev; prev = prev->next){
+        if(prev->next == ir){
+            prev->next = ir->next;
+            return;
+        }
+    }
+}
+
+void insert_ir_before(BasicBlock* bb, IR* pos, IR* ir){
+    if(bb->ir == pos){
+        ir->next = pos;
+        bb->ir = ir;
+        return;
+    }
+    for(IR* prev = bb->ir; prev; prev = prev->next){
+        if(prev->next == pos){
+            ir->next = pos;
+            prev->next = ir;
+            return;
+        }
+    }
+}
+
+void insert_ir_after(IR* pos, IR* ir){
+    ir->next = pos->next;
+    pos->next = ir;
+}
+
+void insert_before_terminator(BasicBlock* bb, IR* ir){
+    IR head = {};
+    head.next = bb->ir;
+    IR* prev = &head;
+    while(prev->next && !is_terminator(prev->next->cmd)){
+        prev = prev->next;
+    }
+    ir->next = prev->next;
+    prev->next = ir;
+    bb->ir = head.next;
+}
+
+void insert_after_phis(BasicBlock* bb, IR* ir){
+    IR head = {};
+    head.next = bb->ir;
+    IR* prev = &head;
+    while(prev->next){
+        IRCmd cmd = prev->next->cmd;
+        if(cmd != IR_LABEL && cmd != IR_PHI && cmd != IR_FN_LABEL
+            && cmd != IR_FN_END_LABEL){
+            break;
+        }
+        prev = prev->next;
+    }
+    ir->next = prev->next;
+    prev->next = ir;
+    bb->ir = head.next;
+}
+
+static void dump_reg(Reg* reg){
+    if(!reg){
+        print(" _");
+        return;
+    }
+    switch(reg->kind){
+        case REG_REG:
+            print(" v%d", reg->vn);
+            break;
+        case REG_IMM:
+            print(" %ld", reg->val);
+            break;
+        case REG_VAR:
+            print(" %s", reg->ident->name);
+            break;
+        case REG_FNAME:
+            print(" %s", reg->ident->name);
+            break;
+        case REG_STR:
+            print(" %s", reg->str ? reg->str : "\"...\"");
+            break;
+        default:
+            print(" ?");
+            break;
+    }
+}
+
+// デバッグ用にCFGをアセンブリのコメントとして出力する
+void dump_cfg(CFG* cfg){
+    print("# cfg of %s\n", cfg->func->name);
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        print("# bb%d", bb->id);
+        if(!bb->reachable){
+            print(" (unreachable)\n");
+            continue;
+        }
+        print(" preds:");
+        for(int i = 0; i < bb->npreds; i++) print(" bb%d", bb->preds[i]->id);
+        print(" succs:");
+        for(int i = 0; i < bb->nsuccs; i++) print(" bb%d", bb->succs[i]->id);
+        if(bb->idom) print(" idom: bb%d", bb->idom->id);
+        print("\n");
+
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_COMMENT) continue;
+            print("#   %s", ir_name[ir->cmd]);
+            if(ir->cmd == IR_PHI){
+                dump_reg(ir->t);
+                for(int i = 0; i < bb->npreds; i++) dump_reg(ir->phi_args[i]);
+            } else {
+                dump_reg(ir->t);
+                dump_reg(ir->s1);
+                dump_reg(ir->s2);
+                if(ir->index || ir->disp || ir->sym){
+                    print(" [");
+                    if(ir->sym) print("%s", ir->sym->name);
+                    if(ir->index) print(" + v%d*%d", ir->index->vn, ir->scale);
+                    print(" + %ld]", ir->disp);
+                }
+            }
+            print("\n");
+        }
+    }
+}
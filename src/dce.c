@@ -0,0 +1,121 @@
+#include "mcc2.h"
+
+/*
+    不要命令の削除 (Dead Code Elimination)
+
+    SSA形式の上で、副作用のある命令から使用→定義をたどって
+    生きている仮想レジスタに印をつけ、印のない仮想レジスタを定義する
+    副作用のない命令を消す。
+    式文の結果のように、値を作ってもどこからも使われない命令がなくなる。
+    phiどうしで循環しているだけの値も消える。
+*/
+
+static IR** def;
+static bool* live;
+static int* work;
+static int nwork;
+
+// 値を作るだけで、消しても動作が変わらない命令か
+static bool is_pure(IR* ir){
+    if(is_binop(ir->cmd)){
+        return true;
+    }
+    switch(ir->cmd){
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_CAST:
+        case IR_REL:
+        case IR_ADDR:
+        case IR_MOV:
+        case IR_LOAD:
+        case IR_PHI:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 消せる命令なら、その命令が定義する仮想レジスタを返す
+static Reg* removable_def(IR* ir){
+    Reg* reg = NULL;
+    if(ir->cmd == IR_RELEASE_REG){
+        reg = ir->t;
+    } else if(is_pure(ir)){
+        reg = *ir_def_slot(ir);
+    }
+    return is_vreg(reg) ? reg : NULL;
+}
+
+static void mark(Reg* reg){
+    if(!is_vreg(reg) || live[reg->vn]){
+        return;
+    }
+    live[reg->vn] = true;
+    work[nwork++] = reg->vn;
+}
+
+static void mark_uses(BasicBlock* bb, IR* ir){
+    if(ir->cmd == IR_PHI){
+        for(int i = 0; i < bb->npreds; i++){
+            mark(ir->phi_args[i]);
+        }
+        return;
+    }
+    Reg** slots[MAX_IR_OPERANDS];
+    int nuse = ir_use_slots(ir, slots);
+    for(int i = 0; i < nuse; i++){
+        mark(*slots[i]);
+    }
+}
+
+// 取り除いた命令の数を返す
+int dce(CFG* cfg){
+    int n = cfg->nregs;
+    def = calloc(n, sizeof(IR*));
+    live = calloc(n, sizeof(bool));
+    work = calloc(n, sizeof(int));
+    BasicBlock** def_bb = calloc(n, sizeof(BasicBlock*));
+    nwork = 0;
+
+    // 副作用のある命令が使う値は生きている
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                def[(*d)->vn] = ir;
+                def_bb[(*d)->vn] = bb;
+            }
+            if(!removable_def(ir)){
+                mark_uses(bb, ir);
+            }
+        }
+    }
+
+    // 生きている値の定義が使う値も生きている
+    while(nwork){
+        int vn = work[--nwork];
+        if(def[vn]){
+            mark_uses(def_bb[vn], def[vn]);
+        }
+    }
+
+    int removed = 0;
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+            Reg* reg = removable_def(ir);
+            if(reg && !live[reg->vn]){
+                remove_ir(bb, ir);
+                if(ir->cmd != IR_RELEASE_REG){
+                    removed++;
+                }
+            }
+        }
+    }
+    return removed;
+}
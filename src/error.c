@@ -40,6 +40,24 @@ void warn_tok(Token* tok, char* fmt, ...){
     fprintf(stderr, "\n");
 }
 
+// 最適化の報告を "ファイル名:行番号: remark: メッセージ" の形式で表示する
+void remark_tok(Token* tok, char* fmt, ...){
+    va_list ap;
+    va_start(ap, fmt);
+
+    // 行数を数える
+    int line_num = 1;
+    for (char *p = tok->file->body; p < tok->pos; p++){
+        if (*p == '\n'){
+            line_num++;
+        }
+    }
+
+    fprintf(stderr, "%s:%d: remark: ", tok->file->name, line_num);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+}
+
 void error_tok(Token* tok, char* fmt, ...){
     char* user_input = tok->file->body;
     char* filename = tok->file->name;
@@ -5,27 +5,40 @@ static long g_break = -1;
 static long g_continue = -1;
 static Reg* func_name_str = NULL;
 static Type* func_type = NULL;
+static Node* func_body = NULL;     // 生成中の関数の本体
+static Ident* cur_func = NULL;     // 生成中の関数
+static long tail_label = -1;       // 末尾の自己再帰呼び出しで戻る先のラベル。なければ-1
 
 static void gen_extern(Scope* global_scope);
 static void gen_datas(Ident* ident);
 static void gen_function(Ident* func);
 static void gen_stmt(Node* stmt);
 static Reg* gen_lvar(Node* lvar);
-static long get_label();
 
 // レジスタマシン
 static IR* ir = NULL;
 static IR* new_IR(IRCmd cmd, Reg* t, Reg* s1, Reg* s2);
 static IR* new_IRLabel(long label);
 static IR* new_IRJmp(long label);
-static Reg* new_Reg();
-static Reg* new_RegImm(unsigned long val);
 static Reg* new_RegVar(Ident* ident);
 static Reg* new_RegStr(char* str);
 static Reg* new_RegAddr(Reg* reg, int size);
 static Reg* new_RegFname(Ident* ident);
 static Reg* new_RegToken(Token* tok);
 static Reg* gen_expr(Node* node);
+static void gen_cond_jump(Node* node, long label, bool jump_if);
+static void gen_switch(Node* node, Reg* reg, long l_default);
+static bool is_unsigned_op(Node* node);
+static bool gen_unrolled_for(Node* node);
+static bool gen_vectorized_for(Node* node);
+static bool should_inline(Node* node);
+static Reg* gen_inline_call(Node* node);
+static bool gen_inline_return(Node* node);
+static Ident* inline_var(Ident* ident);
+static void count_call_sites(Scope* scope);
+static void remove_unused_static(Scope* scope);
+static bool can_tail_loop(Ident* func);
+static bool gen_tail_loop(Node* node);
 
 void gen_ir(){
     // グローバル変数の出力
@@ -33,6 +46,9 @@ void gen_ir(){
     Ident* ident = scope->ident;
 
     gen_extern(scope);
+    if(opt_level){
+        count_call_sites(scope);
+    }
 
     for(Ident* cur = ident; cur; cur = cur->next){
         if(cur->kind == ID_FUNC && cur->funcbody){
@@ -41,6 +57,10 @@ void gen_ir(){
             gen_datas(cur);
         }
     }
+
+    if(opt_level){
+        remove_unused_static(scope);
+    }
 }
 
 static void gen_extern(Scope* global_scope){
@@ -49,9 +69,9 @@ static void gen_extern(Scope* global_scope){
 
     Ident* ident = global_scope->ident;
     while(ident){
-        if(ident->kind == ID_FUNC && ident->funcbody){
+        if(ident->kind == ID_FUNC && ident->funcbody && !ident->is_static){
             new_IR(IR_EXTERN_LABEL, NULL, new_RegStr(ident->name), NULL);
-        } else if(ident->kind == ID_GVAR && !ident->is_extern){
+        } else if(ident->kind == ID_GVAR && !ident->is_extern && !ident->is_static){
             if(!ident->is_string_literal){
                 new_IR(IR_EXTERN_LABEL, NULL, new_RegStr(ident->name), NULL);
             }
@@ -80,7 +100,8 @@ static void gen_function(Ident* func){
     ir = &head;
 
     func_name_str = new_RegStr(func->name);
-    new_IR(IR_FN_LABEL, NULL, func_name_str, new_RegImm(func->stack_size));
+    IR* fn_label = new_IR(IR_FN_LABEL, NULL, func_name_str, new_RegImm(func->stack_size));
+    cur_func = func;
 
     // 可変長引数の場合は、__va_area__に引数をコピーする
     if(func->va_area){
@@ -107,6 +128,13 @@ static void gen_function(Ident* func){
         }
     }
 
+    // 末尾の自己再帰呼び出しは、引数を代入してここへ戻るループにする
+    tail_label = -1;
+    if(opt_level && can_tail_loop(func)){
+        tail_label = get_label();
+        new_IRLabel(tail_label);
+    }
+
     Scope* scope = func->scope;
     for(Label* label = scope->label; label; label = label->next){
         if(label->labeld){
@@ -115,6 +143,7 @@ static void gen_function(Ident* func){
     }
 
     func_type = func->type;
+    func_body = func->funcbody;
     Node* cur = func->funcbody;
     while(cur){
         gen_stmt(cur);
@@ -123,6 +152,8 @@ static void gen_function(Ident* func){
 
     new_IR(IR_FN_END_LABEL, NULL, func_name_str, NULL);
 
+    // インライン展開した関数の局所変数の分だけフレームが大きくなる
+    fn_label->s2 = new_RegImm(func->stack_size);
     func->ir_cmd = head.next;
 }
 
@@ -132,6 +163,9 @@ static void gen_stmt(Node* node){
     }
     switch(node->kind){
         case ND_RETURN:
+            if(gen_inline_return(node) || gen_tail_loop(node)){
+                break;
+            }
             {
                 // return (val) がある場合は評価する
                 Reg* reg = NULL;
@@ -151,7 +185,7 @@ static void gen_stmt(Node* node){
         case ND_IF:
         {
             long l_end = get_label();
-            new_IR(IR_JZ, NULL, gen_expr(node->cond), new_RegImm(l_end));
+            gen_cond_jump(node->cond, l_end, false);
             gen_stmt(node->then);
             new_IRLabel(l_end);
             break;
@@ -161,7 +195,7 @@ static void gen_stmt(Node* node){
             long l_else = get_label();
             long l_end = get_label();
 
-            new_IR(IR_JZ, NULL, gen_expr(node->cond), new_RegImm(l_else));
+            gen_cond_jump(node->cond, l_else, false);
             gen_stmt(node->then);
             new_IRJmp(l_end);
 
@@ -178,7 +212,7 @@ static void gen_stmt(Node* node){
             long l_end = get_label();
 
             new_IRLabel(l_start);
-            new_IR(IR_JZ, NULL, gen_expr(node->cond), new_RegImm(l_end));
+            gen_cond_jump(node->cond, l_end, false);
 
             g_continue = l_start;
             g_break = l_end;
@@ -204,12 +238,15 @@ static void gen_stmt(Node* node){
             g_break = l_break_buf;
             g_continue = l_continue_buf;
 
-            new_IR(IR_JNZ, NULL, gen_expr(node->cond), new_RegImm(l_start));
+            gen_cond_jump(node->cond, l_start, true);
             new_IRLabel(l_end);
             break;
         }
         case ND_FOR:
         {
+            if(gen_vectorized_for(node) || gen_unrolled_for(node)){
+                break;
+            }
             long l_break_buf = g_break;
             long l_continue_buf = g_continue;
             long l_start = get_label();
@@ -220,7 +257,7 @@ static void gen_stmt(Node* node){
                 gen_expr(node->init);
             }
             new_IRLabel(l_start);
-            new_IR(IR_JZ, NULL, gen_expr(node->cond), new_RegImm(l_end));
+            gen_cond_jump(node->cond, l_end, false);
 
             g_continue = l_cont;
             g_break = l_end;
@@ -244,14 +281,13 @@ static void gen_stmt(Node* node){
             Reg* reg = gen_expr(node->cond);
             for( Node* nc = node->next_case; nc; nc = nc->next_case){
                 nc->val = get_label();
-                new_IR(IR_JE, new_RegImm(nc->val), reg, gen_expr(nc->lhs));
             }
-
-            // default
+            long l_default = l_end;
             if(node->default_label){
                 node->default_label->val = get_label();
-                new_IR(IR_JMP, NULL, new_RegImm(node->default_label->val), NULL);
+                l_default = node->default_label->val;
             }
+            gen_switch(node, reg, l_default);
 
             // body
             g_break = l_end;
@@ -351,10 +387,22 @@ static Reg* gen_expr(Node* node){
             return new_RegVar(node->ident);
         case ND_FUNCCALL:
         {
+            if(should_inline(node)){
+                return gen_inline_call(node);
+            }
+            // 引数の式の中の関数呼び出しで引数レジスタが壊れないように、
+            // すべての引数を計算してから引数レジスタに載せる
             int nargs = 0;
             for(Node* cur = node->params; cur; cur = cur->next){
-                Reg* reg = gen_expr(cur);
-                new_IR(IR_LOAD_ARG_REG, new_RegImm(nargs++), reg, NULL);
+                nargs++;
+            }
+            Reg** args = calloc(nargs, sizeof(Reg*));
+            int i = 0;
+            for(Node* cur = node->params; cur; cur = cur->next){
+                args[i++] = gen_expr(cur);
+            }
+            for(i = 0; i < nargs; i++){
+                new_IR(IR_LOAD_ARG_REG, new_RegImm(i), args[i], NULL);
             }
             if(node->ident->is_var_params){
                 new_IR(IR_SET_FLOAT_NUM, NULL, new_RegImm(0), NULL);
@@ -373,6 +421,7 @@ static Reg* gen_expr(Node* node){
             Reg* ret = new_Reg();
             Reg* pointer = gen_expr(node->lhs);
             pointer->size = node->lhs->type->ptr_to->size;
+            pointer->is_unsigned = node->lhs->type->ptr_to->is_unsigned;
             if((type->ptr_to->kind != TY_STRUCT)
                 && (type->ptr_to->kind != TY_UNION)){
                 new_IR(IR_LOAD, NULL, ret, pointer);
@@ -421,17 +470,14 @@ static Reg* gen_expr(Node* node){
             return reg;
         }
         case ND_LOGIC_OR:
+        case ND_LOGIC_AND:
         {
+            // 短絡評価の分岐にして、結果が決まったところで真か偽の側へ飛ぶ
             Reg* ret = new_Reg();
             long l_true = get_label();
             long l_end = get_label();
-            Reg* lreg = gen_expr(node->lhs);
-            Reg* rreg = gen_expr(node->rhs);
-            new_IR(IR_JNZ, NULL, lreg, new_RegImm(l_true));
-            new_IR(IR_JNZ, NULL, rreg, new_RegImm(l_true));
-            new_IR(IR_RELEASE_REG, lreg, NULL, NULL);
-            new_IR(IR_RELEASE_REG, rreg, NULL, NULL);
 
+            gen_cond_jump(node, l_true, true);
             new_IR(IR_MOV, NULL, ret, new_RegImm(0));
             new_IR(IR_JMP, NULL, new_RegImm(l_end), NULL);
 
@@ -440,34 +486,13 @@ static Reg* gen_expr(Node* node){
             new_IRLabel(l_end);
             return ret;
         }
-        case ND_LOGIC_AND:
-        {
-            Reg* ret = new_Reg();
-            long l_false = get_label();
-            long l_end = get_label();
-
-            Reg* lreg = gen_expr(node->lhs);
-            Reg* rreg = gen_expr(node->rhs);
-            new_IR(IR_JZ, NULL, lreg, new_RegImm(l_false));
-            new_IR(IR_JZ, NULL, rreg, new_RegImm(l_false));
-            new_IR(IR_RELEASE_REG, lreg, NULL, NULL);
-            new_IR(IR_RELEASE_REG, rreg, NULL, NULL);
-
-            new_IR(IR_MOV, NULL, ret, new_RegImm(1));
-            new_IR(IR_JMP, NULL, new_RegImm(l_end), NULL);
-
-            new_IRLabel(l_false);
-            new_IR(IR_MOV, NULL, ret, new_RegImm(0));
-            new_IRLabel(l_end);
-            return ret;
-        }
         case ND_COND_EXPR:
         {
             Reg* ret = new_Reg();
             long l_false = get_label();
             long l_end = get_label();
 
-            new_IR(IR_JZ, NULL, gen_expr(node->cond), new_RegImm(l_false));
+            gen_cond_jump(node->cond, l_false, false);
 
             new_IR(IR_MOV, NULL, ret, gen_expr(node->lhs));
             new_IR(IR_JMP, NULL, new_RegImm(l_end), NULL);
@@ -576,13 +601,1412 @@ static Reg* gen_expr(Node* node){
             new_IR(IR_R_BIT_SHIFT, NULL, r1, r2);
             break;
         default:
-            break;
+            return ret;
     }
+
+    // 除算、右シフト、大小比較は符号の有無で命令が変わる
+    ir->is_unsigned = is_unsigned_op(node);
     
     return ret;
 }
 
-static long get_label(){
+// 条件式nodeの真偽がjump_ifと一致したらlabelへ分岐する
+// 比較は0/1の値を作らずに比較と条件分岐にして、&&と||は短絡評価する
+static void gen_cond_jump(Node* node, long label, bool jump_if){
+    switch(node->kind){
+        case ND_LOGIC_AND:
+        case ND_LOGIC_OR:
+        {
+            // &&が真で飛ぶ / ||が偽で飛ぶには、両方を調べる必要がある
+            bool both = (node->kind == ND_LOGIC_AND) == jump_if;
+            if(both){
+                long l_skip = get_label();
+                gen_cond_jump(node->lhs, l_skip, !jump_if);
+                gen_cond_jump(node->rhs, label, jump_if);
+                new_IRLabel(l_skip);
+            } else {
+                gen_cond_jump(node->lhs, label, jump_if);
+                gen_cond_jump(node->rhs, label, jump_if);
+            }
+            return;
+        }
+        case ND_NOT:
+            gen_cond_jump(node->lhs, label, !jump_if);
+            return;
+        case ND_EQUAL:
+        case ND_NOT_EQUAL:
+        case ND_LT:
+        case ND_LE:
+        {
+            Reg* r1 = gen_expr(node->lhs);
+            Reg* r2 = gen_expr(node->rhs);
+            IRCmd cmd;
+            switch(node->kind){
+                case ND_EQUAL: cmd = jump_if ? IR_JE : IR_JNE; break;
+                case ND_NOT_EQUAL: cmd = jump_if ? IR_JNE : IR_JE; break;
+                case ND_LT: cmd = jump_if ? IR_JLT : IR_JGE; break;
+                default: cmd = jump_if ? IR_JLE : IR_JGT; break;
+            }
+            new_IR(cmd, new_RegImm(label), r1, r2);
+            ir->is_unsigned = is_unsigned_op(node);
+            return;
+        }
+        default:
+            break;
+    }
+    new_IR(jump_if ? IR_JNZ : IR_JZ, NULL, gen_expr(node), new_RegImm(label));
+}
+
+/*
+    ループの展開
+        for(i = a; i < n; i += c) body
+    の形で、ループの中でiとnが変わらないループを、bodyをN回並べたループと
+    残りの回数を回すループにする。
+            i = a
+        L_main:
+            if(i + (N - 1) * c >= n) goto L_rest    // N回回れないときは残りへ
+            body; i += c
+            ...                                     // N回並べる
+            goto L_main
+        L_rest:
+            for(; i < n; i += c) body               // 元のループ
+        L_end:
+    回数がコンパイル時に決まるときは、残りの回数だけbodyを並べる。
+    回数がN以下なら、ループにせずにすべて並べる。
+    #pragma unroll N で展開する回数を指定できる(1なら展開しない)。
+    指定がなければ、-Oのときに内側のループを本体の大きさに応じて展開する。
+*/
+#define UNROLL_DEFAULT      4
+#define UNROLL_MAX          64
+#define UNROLL_SMALL_BODY   24      // このノード数以下なら4回展開する
+#define UNROLL_MEDIUM_BODY  48      // このノード数以下なら2回展開する
+
+typedef struct UnrollLoop {
+    Node*   var;        // ループ変数のノード
+    Node*   limit;      // ループの中で変わらない上限(下限)
+    long    step;
+    long    trip;       // ループの回数。コンパイル時に決まらなければ-1
+} UnrollLoop;
+
+static int unroll_size;
+static bool unroll_nested;
+
+// nodeとその下のノードで、fnが真を返すものがあるか
+static bool any_node(Node* node, bool (*fn)(Node*, Ident*), Ident* var){
+    if(!node){
+        return false;
+    }
+    if(fn(node, var)){
+        return true;
+    }
+    if(node->kind == ND_BLOCK){
+        for(Node* cur = node->body; cur; cur = cur->next){
+            if(any_node(cur, fn, var)){
+                return true;
+            }
+        }
+        return false;
+    }
+    if(node->kind == ND_FUNCCALL){
+        for(Node* cur = node->params; cur; cur = cur->next){
+            if(any_node(cur, fn, var)){
+                return true;
+            }
+        }
+        return false;
+    }
+    return any_node(node->lhs, fn, var) || any_node(node->rhs, fn, var)
+        || any_node(node->cond, fn, var) || any_node(node->then, fn, var)
+        || any_node(node->elif, fn, var) || any_node(node->body, fn, var)
+        || any_node(node->init, fn, var) || any_node(node->incr, fn, var);
+}
+
+static bool is_var(Node* node, Ident* var){
+    return node->kind == ND_VAR && node->ident == var;
+}
+
+static bool assigns_var(Node* node, Ident* var){
+    return node->kind == ND_ASSIGN && is_var(node->lhs, var);
+}
+
+static bool takes_addr(Node* node, Ident* var){
+    return node->kind == ND_ADDR && is_var(node->lhs, var);
+}
+
+// 複製すると同じラベルがふたつできる文
+static bool is_unroll_barrier(Node* node, Ident* var){
+    return node->kind == ND_LABEL || node->kind == ND_SWITCH
+        || node->kind == ND_CASE || node->kind == ND_DEFAULT;
+}
+
+static bool count_node(Node* node, Ident* var){
+    unroll_size++;
+    if(node->kind == ND_FOR || node->kind == ND_WHILE || node->kind == ND_DO_WHILE){
+        unroll_nested = true;
+    }
+    return false;
+}
+
+// ループの中で値が変わったことを見落とさない局所変数か
+static bool is_tracked_var(Ident* ident, Node* body){
+    if(ident->kind != ID_LVAR || ident->type->kind != TY_INT){
+        return false;
+    }
+    if(any_node(body, assigns_var, ident)){
+        return false;
+    }
+    for(Node* cur = func_body; cur; cur = cur->next){
+        if(any_node(cur, takes_addr, ident)){
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_invariant(Node* node, Node* body, Ident* var){
+    switch(node->kind){
+        case ND_NUM:
+            return true;
+        case ND_VAR:
+            return node->ident != var && is_tracked_var(node->ident, body);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+            return !node->type->ptr_to && is_invariant(node->lhs, body, var)
+                && is_invariant(node->rhs, body, var);
+        case ND_CAST:
+            return !node->type->ptr_to && is_invariant(node->lhs, body, var);
+        default:
+            return false;
+    }
+}
+
+// i++, ++i, i += c, i--, --i, i -= c なら変数の増分を返す。それ以外は0を返す
+static long match_step(Node* incr, Ident** var){
+    // 後置の i++ は (tmp = i, (i = i + 1, tmp))
+    if(incr->kind == ND_COMMA && incr->lhs->kind == ND_ASSIGN
+        && incr->rhs->kind == ND_COMMA){
+        incr = incr->rhs->lhs;
+    }
+    if(incr->kind != ND_ASSIGN || incr->lhs->kind != ND_VAR){
+        return 0;
+    }
+    Node* rhs = incr->rhs;
+    *var = incr->lhs->ident;
+    if((rhs->kind != ND_ADD && rhs->kind != ND_SUB)
+        || !is_var(rhs->lhs, *var) || rhs->rhs->kind != ND_NUM){
+        return 0;
+    }
+    long step = rhs->rhs->val;
+    if(step < -65536 || step > 65536){
+        return 0;
+    }
+    return rhs->kind == ND_ADD ? step : -step;
+}
+
+static long unroll_trip(Node* node, UnrollLoop* loop){
+    Node* init = node->init;
+    if(!init || !assigns_var(init, loop->var->ident) || init->rhs->kind != ND_NUM
+        || loop->limit->kind != ND_NUM){
+        return -1;
+    }
+    long from = init->rhs->val;
+    long to = loop->limit->val;
+    long step = loop->step;
+    if(step < 0){
+        long buf = from;
+        from = to;
+        to = buf;
+        step = -step;
+    }
+    if(node->cond->kind == ND_LE){
+        return from <= to ? (to - from) / step + 1 : 0;
+    }
+    return from < to ? (to - from + step - 1) / step : 0;
+}
+
+static bool match_unroll_loop(Node* node, UnrollLoop* loop){
+    Node* cond = node->cond;
+    if(!node->incr || (cond->kind != ND_LT && cond->kind != ND_LE) || is_unsigned_op(cond)){
+        return false;
+    }
+    Ident* var = NULL;
+    loop->step = match_step(node->incr, &var);
+    if(!loop->step || var->type->is_unsigned){
+        return false;
+    }
+
+    // 増えていくなら i < n、減っていくなら n < i
+    loop->var = loop->step > 0 ? cond->lhs : cond->rhs;
+    loop->limit = loop->step > 0 ? cond->rhs : cond->lhs;
+    if(!is_var(loop->var, var) || !is_tracked_var(var, node->body)){
+        return false;
+    }
+    if(!is_invariant(loop->limit, node->body, var)
+        || any_node(node->body, is_unroll_barrier, NULL)){
+        return false;
+    }
+
+    // 8byteの変数は、上限に足しても桁あふれしない定数のときだけにする
+    if(var->type->size == 8){
+        long limit = loop->limit->val;
+        if(loop->limit->kind != ND_NUM || limit > (1L << 40) || limit < -(1L << 40)){
+            return false;
+        }
+    } else if(var->type->size != 4){
+        return false;
+    }
+
+    loop->trip = unroll_trip(node, loop);
+    return true;
+}
+
+static int unroll_factor(Node* node){
+    if(node->unroll){
+        if(node->unroll < 0){
+            return UNROLL_DEFAULT;
+        }
+        return node->unroll < UNROLL_MAX ? node->unroll : UNROLL_MAX;
+    }
+    if(!opt_level){
+        return 1;
+    }
+    unroll_size = 0;
+    unroll_nested = false;
+    any_node(node->body, count_node, NULL);
+    if(unroll_nested){
+        return 1;
+    }
+    if(unroll_size <= UNROLL_SMALL_BODY){
+        return 4;
+    }
+    return unroll_size <= UNROLL_MEDIUM_BODY ? 2 : 1;
+}
+
+// ループを1回分並べる。continueは次の増分の計算へ飛ぶ
+static void gen_iteration(Node* node){
+    long l_cont = get_label();
+    g_continue = l_cont;
+    gen_stmt(node->body);
+    new_IRLabel(l_cont);
+    gen_expr(node->incr);
+}
+
+// i + (N - 1) * c < n でなければlabelへ飛ぶ
+static void gen_unroll_guard(Node* node, UnrollLoop* loop, int factor, long label){
+    Reg* reg = new_Reg();
+    new_IR(IR_MOV, NULL, reg, gen_expr(loop->var));
+    new_IR(IR_ADD, NULL, reg, new_RegImm((factor - 1) * loop->step));
+    Reg* limit = gen_expr(loop->limit);
+    IRCmd cmd = node->cond->kind == ND_LT ? IR_JGE : IR_JGT;
+    if(loop->step > 0){
+        new_IR(cmd, new_RegImm(label), reg, limit);
+    } else {
+        new_IR(cmd, new_RegImm(label), limit, reg);
+    }
+}
+
+static bool gen_unrolled_for(Node* node){
+    UnrollLoop loop;
+    int factor = unroll_factor(node);
+    if(factor < 2 || !match_unroll_loop(node, &loop)){
+        return false;
+    }
+
+    long l_break_buf = g_break;
+    long l_continue_buf = g_continue;
+    long l_end = get_label();
+    g_break = l_end;
+
+    if(node->init){
+        gen_expr(node->init);
+    }
+
+    if(loop.trip >= 0 && loop.trip <= factor){
+        // すべて並べる
+        for(int i = 0; i < loop.trip; i++){
+            gen_iteration(node);
+        }
+    } else {
+        long l_main = get_label();
+        long l_rest = get_label();
+        new_IRLabel(l_main);
+        if(loop.trip >= 0 && loop.trip % factor == 0){
+            gen_cond_jump(node->cond, l_end, false);
+        } else {
+            gen_unroll_guard(node, &loop, factor, l_rest);
+        }
+        for(int i = 0; i < factor; i++){
+            gen_iteration(node);
+        }
+        new_IRJmp(l_main);
+
+        new_IRLabel(l_rest);
+        if(loop.trip >= 0){
+            for(int i = 0; i < loop.trip % factor; i++){
+                gen_iteration(node);
+            }
+        } else {
+            long l_start = get_label();
+            new_IRLabel(l_start);
+            gen_cond_jump(node->cond, l_end, false);
+            gen_iteration(node);
+            new_IRJmp(l_start);
+        }
+    }
+    new_IRLabel(l_end);
+
+    g_break = l_break_buf;
+    g_continue = l_continue_buf;
+
+    add_stat("unrolled_loops", 1);
+    if(print_remarks && loop.trip >= 0 && loop.trip <= factor){
+        remark_tok(node->pos, "loop fully unrolled: %ld iterations", loop.trip);
+    } else if(print_remarks){
+        remark_tok(node->pos, "loop unrolled by %d", factor);
+    }
+    return true;
+}
+
+/*
+    ループのベクトル化
+        for(i = a; i < n; i++) dst[i] = src[i] + k;         要素ごとの計算
+        for(i = a; i < n; i++) s += src[i];                  総和
+        for(i = a; i < n; i++) if(src[i] < m) m = src[i];    最小(最大)
+    の形で、intかcharの配列を1要素ずつ進むループを、SSE2(-mavx2のときはAVX2)の
+    ベクトル命令で16(32)byteずつ処理する。-Oのときだけ行う。
+            i = a
+            if(dstとsrcが重なる) goto L_scalar              // 実行時の重なりの確認
+            ループの中で変わらない値をベクトルに広げる
+        L_peel:                                             // 先頭の端数
+            if(!(i < n)) goto L_scalar
+            if(&dst[i]が16(32)byteに揃っている) goto L_first
+            body; i++; goto L_peel
+        L_first:                                            // 最小・最大だけ
+            if(!(i + (要素数 - 1) < n)) goto L_scalar
+            最初の16(32)byteを読み込んで初期値にする; i += 要素数
+        L_vec:
+            if(!(i + (要素数 - 1) < n)) goto L_reduce
+            16(32)byte分を計算する; i += 要素数; goto L_vec
+        L_reduce:
+            総和・最小・最大のベクトルの要素をまとめて変数に反映する
+        L_scalar:
+            for(; i < n; i++) body                          // 残りの端数
+    dstとsrcがどちらも配列(またはsrcがdstと同じ)なら、重なりの確認はしない。
+*/
+#define VEC_REGS    13      // 計算に使うベクトルレジスタの数。残りはバックエンドが使う
+
+typedef enum VecKind {
+    VEC_MAP,        // dst[i] = 式
+    VEC_SUM,        // s += 式
+    VEC_MIN,        // m = min(m, src[i])
+    VEC_MAX,        // m = max(m, src[i])
+} VecKind;
+
+typedef struct VecLoop {
+    UnrollLoop  loop;
+    VecKind     kind;
+    int         elem;           // 要素の大きさ(1か4)
+    Node*       store;          // VEC_MAP: 書き込む要素(ND_DREF)
+    Node*       value;          // 要素ごとに計算する式
+    Node*       acc;            // VEC_SUM/MIN/MAX: 集計する変数(ND_VAR)
+    Node*       first;          // 揃える要素
+    Node*       loads[VEC_REGS];
+    int         nloads;
+    Node*       bcasts[VEC_REGS];
+    int         bcast_regs[VEC_REGS];
+    int         nbcasts;
+    int         nregs;
+} VecLoop;
+
+static int vec_bytes(){
+    return use_avx2 ? 32 : 16;
+}
+
+// var[i] (i はループ変数) の形の読み書きなら、配列の先頭の式を返す
+static Node* unit_access(Node* node, Ident* var, Node* body){
+    if(node->kind != ND_DREF || node->type->kind != TY_INT){
+        return NULL;
+    }
+    Node* add = node->lhs;
+    if(add->kind != ND_ADD || add->rhs->kind != ND_MUL){
+        return NULL;
+    }
+    Node* base = add->lhs;
+    Node* mul = add->rhs;
+    if(!is_var(mul->lhs, var) || mul->rhs->kind != ND_NUM || mul->rhs->val != node->type->size){
+        return NULL;
+    }
+    if(base->kind != ND_VAR){
+        return NULL;
+    }
+    // 配列か、ループの中で変わらないポインタ
+    if(base->type->kind == TY_ARRAY){
+        return base;
+    }
+    if(base->type->kind != TY_POINTER || base->ident->kind != ID_LVAR
+        || any_node(body, assigns_var, base->ident)){
+        return NULL;
+    }
+    for(Node* cur = func_body; cur; cur = cur->next){
+        if(any_node(cur, takes_addr, base->ident)){
+            return NULL;
+        }
+    }
+    return base;
+}
+
+static bool same_access(Node* a, Node* b, Ident* var, Node* body){
+    Node* ba = unit_access(a, var, body);
+    Node* bb = unit_access(b, var, body);
+    return ba && bb && ba->ident == bb->ident && a->type->size == b->type->size;
+}
+
+// ベクトルで計算できる式か。使うベクトルレジスタの数をv->nregsに数える
+static bool vec_expr_ok(VecLoop* v, Node* node, Node* body){
+    Ident* var = v->loop.var->ident;
+    if(unit_access(node, var, body)){
+        if(node->type->size != v->elem || v->nloads >= VEC_REGS){
+            return false;
+        }
+        v->loads[v->nloads++] = node;
+        v->nregs++;
+        return true;
+    }
+    if(!node->type || node->type->kind != TY_INT){
+        return false;
+    }
+    if(is_invariant(node, body, var)){
+        // ループの前にすべての要素に広げておく
+        if(v->nbcasts >= VEC_REGS){
+            return false;
+        }
+        v->bcasts[v->nbcasts++] = node;
+        v->nregs++;
+        return true;
+    }
+    if(node->type->size > 4){
+        return false;
+    }
+    v->nregs++;
+    switch(node->kind){
+        case ND_ADD:
+        case ND_SUB:
+        case ND_BIT_AND:
+        case ND_BIT_OR:
+        case ND_BIT_XOR:
+            break;
+        case ND_MUL:
+            // 4byteの要素の乗算(vpmulld)はAVX2にしかない
+            if(v->elem != 4 || !use_avx2){
+                return false;
+            }
+            break;
+        case ND_L_BITSHIFT:
+        case ND_R_BITSHIFT:
+            // 1byteの要素のシフトはない。右シフトは読み込んだ値だけにする
+            if(v->elem != 4 || node->rhs->kind != ND_NUM || node->rhs->val >= 32){
+                return false;
+            }
+            if(node->kind == ND_R_BITSHIFT && !unit_access(node->lhs, var, body)){
+                return false;
+            }
+            return vec_expr_ok(v, node->lhs, body);
+        default:
+            return false;
+    }
+    return vec_expr_ok(v, node->lhs, body) && vec_expr_ok(v, node->rhs, body);
+}
+
+// 集計する変数。ループの中ではこの文でだけ書き換える局所変数
+static bool is_acc_var(Node* node, Ident* var){
+    if(node->kind != ND_VAR || node->ident == var || node->ident->kind != ID_LVAR
+        || node->type->kind != TY_INT){
+        return false;
+    }
+    for(Node* cur = func_body; cur; cur = cur->next){
+        if(any_node(cur, takes_addr, node->ident)){
+            return false;
+        }
+    }
+    return true;
+}
+
+// if(x < m) m = x; / m = x < m ? x : m; なら、条件と選ぶ値を返す
+static bool match_select(Node* stmt, Node** cond, Node** value, Node** acc){
+    if(stmt->kind == ND_IF){
+        Node* then = stmt->then;
+        if(then->kind == ND_BLOCK && then->body && !then->body->next){
+            then = then->body;
+        }
+        if(then->kind != ND_ASSIGN || then->lhs->kind != ND_VAR){
+            return false;
+        }
+        *cond = stmt->cond;
+        *value = then->rhs;
+        *acc = then->lhs;
+        return true;
+    }
+    if(stmt->kind == ND_ASSIGN && stmt->lhs->kind == ND_VAR && stmt->rhs->kind == ND_COND_EXPR
+        && is_var(stmt->rhs->rhs, stmt->lhs->ident)){
+        *cond = stmt->rhs->cond;
+        *value = stmt->rhs->lhs;
+        *acc = stmt->lhs;
+        return true;
+    }
+    return false;
+}
+
+static bool match_minmax(VecLoop* v, Node* stmt, Node* body){
+    Ident* var = v->loop.var->ident;
+    Node* cond;
+    Node* value;
+    Node* acc;
+    if(!match_select(stmt, &cond, &value, &acc) || !is_acc_var(acc, var)){
+        return false;
+    }
+    if((cond->kind != ND_LT && cond->kind != ND_LE) || is_unsigned_op(cond)){
+        return false;
+    }
+    // x < m なら最小、m < x なら最大
+    if(same_access(cond->lhs, value, var, body) && is_var(cond->rhs, acc->ident)){
+        v->kind = VEC_MIN;
+    } else if(same_access(cond->rhs, value, var, body) && is_var(cond->lhs, acc->ident)){
+        v->kind = VEC_MAX;
+    } else {
+        return false;
+    }
+
+    // 要素と変数の型。4byteの要素の符号なしの比較はSSE2にないので、符号付きだけにする
+    Type* ty = value->type;
+    Type* acc_ty = acc->type;
+    if(ty->size == 4 && ty->is_unsigned){
+        return false;
+    }
+    if(acc_ty->size < 4 && (acc_ty->size != ty->size || acc_ty->is_unsigned != ty->is_unsigned)){
+        return false;
+    }
+    if(acc_ty->size >= 4 && acc_ty->is_unsigned){
+        return false;
+    }
+    v->elem = ty->size;
+    v->acc = acc;
+    v->value = value;
+    return vec_expr_ok(v, value, body);
+}
+
+static bool match_vec_loop(Node* node, VecLoop* v){
+    if(!match_unroll_loop(node, &v->loop) || v->loop.step != 1){
+        return false;
+    }
+    Node* stmt = node->body;
+    if(stmt->kind == ND_BLOCK){
+        if(!stmt->body || stmt->body->next){
+            return false;
+        }
+        stmt = stmt->body;
+    }
+    Ident* var = v->loop.var->ident;
+
+    // dst[i] = 式
+    if(stmt->kind == ND_ASSIGN && unit_access(stmt->lhs, var, node->body)){
+        v->kind = VEC_MAP;
+        v->elem = stmt->lhs->type->size;
+        v->store = stmt->lhs;
+        v->value = stmt->rhs;
+        v->first = stmt->lhs;
+        return (v->elem == 1 || v->elem == 4) && vec_expr_ok(v, stmt->rhs, node->body)
+            && v->nregs <= VEC_REGS;
+    }
+
+    // s += 式
+    if(stmt->kind == ND_ASSIGN && is_acc_var(stmt->lhs, var) && stmt->rhs->kind == ND_ADD){
+        Node* acc = stmt->lhs;
+        Node* add = stmt->rhs;
+        Node* value = is_var(add->lhs, acc->ident) ? add->rhs
+            : is_var(add->rhs, acc->ident) ? add->lhs : NULL;
+        if(!value || !value->type || value->type->kind != TY_INT){
+            return false;
+        }
+        v->kind = VEC_SUM;
+        v->acc = acc;
+        v->value = value;
+        if(unit_access(value, var, node->body) && value->type->size == 1){
+            // charの総和は、8byteずつの和(psadbw)を8byteの要素で足していく
+            v->elem = 1;
+            v->nregs = 5;
+        } else {
+            // intの総和は4byteの要素で足していく。4byteを超える変数に足すと桁あふれが変わる
+            if(acc->type->size != 4){
+                return false;
+            }
+            v->elem = 4;
+            v->nregs = 1;
+        }
+        if(!vec_expr_ok(v, value, node->body) || !v->nloads || v->nregs > VEC_REGS){
+            return false;
+        }
+        v->first = v->loads[0];
+        return true;
+    }
+
+    // 最小・最大
+    if(match_minmax(v, stmt, node->body)){
+        v->nregs++;
+        v->first = v->loads[0];
+        return v->nregs <= VEC_REGS;
+    }
+    return false;
+}
+
+static int new_vreg(VecLoop* v){
+    return v->nregs++;
+}
+
+static void new_vop(IRCmd cmd, int t, int s1, int s2, int size){
+    new_IR(cmd, new_RegImm(t), new_RegImm(s1), new_RegImm(s2));
+    ir->size = size;
+}
+
+// 式をベクトルで計算し、結果のベクトルレジスタを返す
+static int gen_vexpr(VecLoop* v, Node* node){
+    for(int i = 0; i < v->nbcasts; i++){
+        if(v->bcasts[i] == node){
+            return v->bcast_regs[i];
+        }
+    }
+    int t = new_vreg(v);
+    if(node->kind == ND_DREF){
+        new_IR(IR_VLOAD, new_RegImm(t), gen_expr(node->lhs), NULL);
+        ir->size = v->elem;
+        return t;
+    }
+    if(node->kind == ND_L_BITSHIFT || node->kind == ND_R_BITSHIFT){
+        int s1 = gen_vexpr(v, node->lhs);
+        new_vop(node->kind == ND_L_BITSHIFT ? IR_VSHL : IR_VSHR, t, s1, node->rhs->val, v->elem);
+        ir->is_unsigned = node->lhs->type->is_unsigned;
+        return t;
+    }
+    int s1 = gen_vexpr(v, node->lhs);
+    int s2 = gen_vexpr(v, node->rhs);
+    IRCmd cmd;
+    switch(node->kind){
+        case ND_ADD: cmd = IR_VADD; break;
+        case ND_SUB: cmd = IR_VSUB; break;
+        case ND_MUL: cmd = IR_VMUL; break;
+        case ND_BIT_AND: cmd = IR_VAND; break;
+        case ND_BIT_OR: cmd = IR_VOR; break;
+        default: cmd = IR_VXOR; break;
+    }
+    new_vop(cmd, t, s1, s2, v->elem);
+    return t;
+}
+
+// 値をベクトルレジスタのすべての要素に入れる
+static int gen_vbcast(VecLoop* v, Reg* val, int size){
+    int t = new_vreg(v);
+    new_IR(IR_VBCAST, new_RegImm(t), val, NULL);
+    ir->size = size;
+    return t;
+}
+
+// 変数にnを足す
+static void gen_add_var(Node* var, long n){
+    Reg* val = gen_expr(var);
+    new_IR(IR_ADD, NULL, val, new_RegImm(n));
+    new_IR(IR_ASSIGN, new_Reg(), gen_lvar(var), val);
+}
+
+// 書き込む先と読み込む元が、ベクトル1個分の中で重なっていればlabelへ飛ぶ
+static void gen_alias_check(VecLoop* v, long label){
+    Node* dst = v->store->lhs->lhs;
+    for(int i = 0; i < v->nloads; i++){
+        Node* src = v->loads[i]->lhs->lhs;
+        if(src->ident == dst->ident
+            || (src->type->kind == TY_ARRAY && dst->type->kind == TY_ARRAY)){
+            continue;
+        }
+        // 0 < dst - src < 16(32) のとき、後の要素を読む前に書き換えてしまう
+        Reg* diff = new_Reg();
+        new_IR(IR_MOV, NULL, diff, gen_expr(dst));
+        new_IR(IR_SUB, NULL, diff, gen_expr(src));
+        new_IR(IR_SUB, NULL, diff, new_RegImm(1));
+        new_IR(IR_JLT, new_RegImm(label), diff, new_RegImm(vec_bytes() - 1));
+        ir->is_unsigned = true;
+    }
+}
+
+static bool gen_vectorized_for(Node* node){
+    VecLoop v = {};
+    if(!opt_level || node->unroll || !match_vec_loop(node, &v)){
+        return false;
+    }
+    int lanes = vec_bytes() / v.elem;
+
+    long l_break_buf = g_break;
+    long l_continue_buf = g_continue;
+    long l_peel = get_label();
+    long l_first = get_label();
+    long l_vec = get_label();
+    long l_reduce = get_label();
+    long l_scalar = get_label();
+    long l_end = get_label();
+    g_break = l_end;
+
+    if(node->init){
+        gen_expr(node->init);
+    }
+    if(v.kind == VEC_MAP){
+        gen_alias_check(&v, l_scalar);
+    }
+
+    // ループの中で変わらない値と、集計用のベクトル
+    v.nregs = 0;
+    for(int i = 0; i < v.nbcasts; i++){
+        v.bcast_regs[i] = gen_vbcast(&v, gen_expr(v.bcasts[i]), v.elem);
+    }
+    int acc = -1;
+    int zero = -1;
+    int bias = -1;
+    int bias_sum = -1;
+    bool signed_char_sum = false;
+    if(v.kind == VEC_SUM && v.elem == 1){
+        acc = gen_vbcast(&v, new_RegImm(0), 8);
+        zero = gen_vbcast(&v, new_RegImm(0), 8);
+        // 符号付きのcharは0x80を足して符号なしにし、足した分を8byteごとに引く
+        if(!v.value->type->is_unsigned){
+            signed_char_sum = true;
+            bias = gen_vbcast(&v, new_RegImm(0x80), 1);
+            bias_sum = gen_vbcast(&v, new_RegImm(0x80 * 8), 8);
+        }
+    } else if(v.kind == VEC_SUM){
+        acc = gen_vbcast(&v, new_RegImm(0), 4);
+    } else if(v.kind != VEC_MAP){
+        acc = new_vreg(&v);
+    }
+    int body_regs = v.nregs;
+
+    // 先頭の端数
+    new_IRLabel(l_peel);
+    gen_cond_jump(node->cond, l_scalar, false);
+    Reg* addr = new_Reg();
+    new_IR(IR_MOV, NULL, addr, gen_expr(v.first->lhs));
+    new_IR(IR_BIT_AND, NULL, addr, new_RegImm(vec_bytes() - 1));
+    new_IR(IR_JE, new_RegImm(l_first), addr, new_RegImm(0));
+    gen_iteration(node);
+    new_IRJmp(l_peel);
+
+    // 最小・最大は最初のベクトルを初期値にする
+    new_IRLabel(l_first);
+    if(v.kind == VEC_MIN || v.kind == VEC_MAX){
+        gen_unroll_guard(node, &v.loop, lanes, l_scalar);
+        new_IR(IR_VLOAD, new_RegImm(acc), gen_expr(v.value->lhs), NULL);
+        ir->size = v.elem;
+        gen_add_var(v.loop.var, lanes);
+    }
+
+    // ベクトルで計算する
+    new_IRLabel(l_vec);
+    gen_unroll_guard(node, &v.loop, lanes, l_reduce);
+    v.nregs = body_regs;
+    int val = gen_vexpr(&v, v.value);
+    switch(v.kind){
+        case VEC_MAP:
+            new_IR(IR_VSTORE, new_RegImm(val), gen_expr(v.store->lhs), NULL);
+            ir->size = v.elem;
+            break;
+        case VEC_SUM:
+            if(v.elem == 1){
+                int sad = new_vreg(&v);
+                if(signed_char_sum){
+                    new_vop(IR_VXOR, val, val, bias, 1);
+                }
+                new_vop(IR_VSAD, sad, val, zero, 1);
+                if(signed_char_sum){
+                    new_vop(IR_VSUB, sad, sad, bias_sum, 8);
+                }
+                new_vop(IR_VADD, acc, acc, sad, 8);
+            } else {
+                new_vop(IR_VADD, acc, acc, val, 4);
+            }
+            break;
+        default:
+            new_vop(v.kind == VEC_MIN ? IR_VMIN : IR_VMAX, acc, acc, val, v.elem);
+            ir->is_unsigned = v.value->type->is_unsigned;
+            break;
+    }
+    gen_add_var(v.loop.var, lanes);
+    new_IRJmp(l_vec);
+
+    // 集計したベクトルを変数に反映する
+    new_IRLabel(l_reduce);
+    if(v.kind == VEC_SUM){
+        Reg* sum = new_Reg();
+        new_IR(IR_VREDUCE, sum, new_RegImm(acc), new_RegImm(IR_VADD));
+        ir->size = v.elem == 1 ? 8 : 4;
+        Reg* val = gen_expr(v.acc);
+        new_IR(IR_ADD, NULL, val, sum);
+        new_IR(IR_ASSIGN, new_Reg(), gen_lvar(v.acc), val);
+    } else if(v.kind != VEC_MAP){
+        long l_skip = get_label();
+        Reg* m = new_Reg();
+        new_IR(IR_VREDUCE, m, new_RegImm(acc), new_RegImm(v.kind == VEC_MIN ? IR_VMIN : IR_VMAX));
+        ir->size = v.elem;
+        ir->is_unsigned = v.value->type->is_unsigned;
+        new_IR(v.kind == VEC_MIN ? IR_JGE : IR_JLE, new_RegImm(l_skip), m, gen_expr(v.acc));
+        new_IR(IR_ASSIGN, new_Reg(), gen_lvar(v.acc), m);
+        new_IRLabel(l_skip);
+    }
+
+    // 残りの端数
+    new_IRLabel(l_scalar);
+    new_IR(IR_VEND, NULL, NULL, NULL);
+    long l_start = get_label();
+    new_IRLabel(l_start);
+    gen_cond_jump(node->cond, l_end, false);
+    gen_iteration(node);
+    new_IRJmp(l_start);
+    new_IRLabel(l_end);
+
+    g_break = l_break_buf;
+    g_continue = l_continue_buf;
+
+    add_stat("vectorized_loops", 1);
+    if(print_remarks){
+        remark_tok(node->pos, "loop vectorized: %d x %d byte", lanes, v.elem);
+    }
+    return true;
+}
+
+/*
+    関数のインライン展開
+        -Oのとき、呼び出す関数の本体を呼び出した場所に展開する。
+            引数を計算する
+            仮引数の変数に引数を代入する
+            関数の本体                      // return x; は 戻り値の変数 = x; goto L_ret;
+        L_ret:
+            戻り値の変数を読む
+        呼び出す関数の局所変数は、呼び出した関数のフレームの後ろに置いた複製にする。
+        同じ関数の中で展開したものどうしは、同時に使わないので場所を使い回す。
+        本体のノード数が次の大きさ以下なら展開する。
+            inline指定がある        INLINE_HINT_SIZE
+            staticで呼び出しが1か所 INLINE_ONCE_SIZE
+            それ以外                INLINE_SMALL_SIZE
+        再帰呼び出しは展開しない。展開した本体の中の呼び出しはINLINE_DEPTHまで展開する。
+        すべての呼び出しを展開したstaticな関数は出力しない。
+*/
+#define INLINE_HINT_SIZE    200
+#define INLINE_ONCE_SIZE    120
+#define INLINE_SMALL_SIZE   30
+#define INLINE_DEPTH        4
+
+typedef struct InlineFrame InlineFrame;
+struct InlineFrame {
+    Ident*          func;       // 展開している関数
+    Ident**         from;       // 呼び出す関数の局所変数
+    Ident**         to;         // その複製
+    int             nvars;
+    int             base;       // 複製を置くフレームのオフセット
+    Ident*          ret_var;    // 戻り値の変数
+    long            l_ret;
+    InlineFrame*    prev;
+};
+
+static InlineFrame* inline_frame;
+static int inline_depth;
+static int inline_top;          // 展開した関数の局所変数が使っているフレームの大きさ
+
+static bool is_inline_barrier(Node* node, Ident* var){
+    return is_unroll_barrier(node, var) || node->kind == ND_GOTO;
+}
+
+// 展開できる関数か
+static bool can_inline(Ident* func){
+    if(!func->funcbody || func->is_var_params || func->va_area){
+        return false;
+    }
+    Type* ret = func->type;
+    if(ret->kind == TY_STRUCT || ret->kind == TY_UNION || ret->kind == TY_BOOL){
+        return false;
+    }
+    int nparams = 0;
+    for(Parameter* param = func->params; param; param = param->next){
+        Type* ty = param->ident->type;
+        if(ty->kind == TY_STRUCT || ty->kind == TY_UNION || ty->kind == TY_BOOL){
+            return false;
+        }
+        nparams++;
+    }
+    if(nparams > 6){
+        return false;
+    }
+    for(Node* cur = func->funcbody; cur; cur = cur->next){
+        if(any_node(cur, is_inline_barrier, NULL)){
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool should_inline(Node* node){
+    Ident* callee = node->ident;
+    if(!opt_level || inline_depth >= INLINE_DEPTH || callee == cur_func || !can_inline(callee)){
+        return false;
+    }
+    for(InlineFrame* frame = inline_frame; frame; frame = frame->prev){
+        if(frame->func == callee){
+            return false;
+        }
+    }
+
+    unroll_size = 0;
+    for(Node* cur = callee->funcbody; cur; cur = cur->next){
+        any_node(cur, count_node, NULL);
+    }
+    if(callee->is_inline){
+        return unroll_size <= INLINE_HINT_SIZE;
+    }
+    if(callee->is_static && callee->ncalls == 1){
+        return unroll_size <= INLINE_ONCE_SIZE;
+    }
+    return unroll_size <= INLINE_SMALL_SIZE;
+}
+
+// 展開している関数の局所変数の複製を返す
+static Ident* inline_var(Ident* ident){
+    InlineFrame* frame = inline_frame;
+    if(!frame || ident->kind != ID_LVAR || ident == frame->ret_var){
+        return ident;
+    }
+    for(int i = 0; i < frame->nvars; i++){
+        if(frame->from[i] == ident){
+            return frame->to[i];
+        }
+        if(frame->to[i] == ident){
+            return ident;
+        }
+    }
+    Ident* var = calloc(1, sizeof(Ident));
+    *var = *ident;
+    var->offset = frame->base + ident->offset;
+    var->next = NULL;
+    frame->from = realloc(frame->from, sizeof(Ident*) * (frame->nvars + 1));
+    frame->to = realloc(frame->to, sizeof(Ident*) * (frame->nvars + 1));
+    frame->from[frame->nvars] = ident;
+    frame->to[frame->nvars] = var;
+    frame->nvars++;
+    return var;
+}
+
+static Reg* gen_var_addr(Ident* ident){
+    Reg* reg = new_Reg();
+    new_IR(IR_REL, reg, new_RegVar(ident), NULL);
+    reg->size = ident->type->size;
+    reg->is_unsigned = ident->type->is_unsigned;
+    return reg;
+}
+
+// 展開した関数の中のreturn
+static bool gen_inline_return(Node* node){
+    if(!inline_frame){
+        return false;
+    }
+    if(node->lhs){
+        Reg* reg = gen_expr(node->lhs);
+        if(inline_frame->ret_var){
+            new_IR(IR_ASSIGN, new_Reg(), gen_var_addr(inline_frame->ret_var), reg);
+        }
+    }
+    new_IRJmp(inline_frame->l_ret);
+    return true;
+}
+
+static Reg* gen_inline_call(Node* node){
+    Ident* callee = node->ident;
+
+    // 引数は呼び出す側の変数で計算する
+    int nargs = 0;
+    for(Node* cur = node->params; cur; cur = cur->next){
+        nargs++;
+    }
+    Reg** args = calloc(nargs, sizeof(Reg*));
+    int i = 0;
+    for(Node* cur = node->params; cur; cur = cur->next){
+        args[i++] = gen_expr(cur);
+    }
+
+    InlineFrame frame = {};
+    frame.func = callee;
+    frame.base = (inline_top + 15) / 16 * 16;
+    frame.l_ret = get_label();
+    frame.prev = inline_frame;
+    int top_buf = inline_top;
+    inline_top = frame.base + callee->stack_size;
+    if(callee->type->kind != TY_VOID){
+        // 戻り値の変数はフレームの最後に置く
+        Type* ty = callee->type;
+        inline_top = align_to(inline_top + ty->size, ty->align);
+        frame.ret_var = calloc(1, sizeof(Ident));
+        frame.ret_var->kind = ID_LVAR;
+        frame.ret_var->name = callee->name;
+        frame.ret_var->tok = callee->tok;
+        frame.ret_var->type = ty;
+        frame.ret_var->offset = inline_top;
+    }
+    if(cur_func->stack_size < inline_top){
+        cur_func->stack_size = inline_top;
+    }
+
+    Node* body_buf = func_body;
+    long l_break_buf = g_break;
+    long l_continue_buf = g_continue;
+    inline_frame = &frame;
+    inline_depth++;
+    func_body = callee->funcbody;
+
+    // 仮引数の変数に代入する。引数の型への変換は代入で行う
+    i = 0;
+    for(Parameter* param = callee->params; param && i < nargs; param = param->next){
+        new_IR(IR_ASSIGN, new_Reg(), gen_var_addr(param->ident), args[i++]);
+    }
+    for(Node* cur = callee->funcbody; cur; cur = cur->next){
+        gen_stmt(cur);
+    }
+    new_IRLabel(frame.l_ret);
+
+    // 戻り値は展開した関数のフレームのうちに読む
+    Reg* ret = new_RegImm(0);
+    if(frame.ret_var){
+        ret = new_Reg();
+        new_IR(IR_LOAD, NULL, ret, gen_var_addr(frame.ret_var));
+    }
+
+    func_body = body_buf;
+    g_break = l_break_buf;
+    g_continue = l_continue_buf;
+    inline_frame = frame.prev;
+    inline_depth--;
+    inline_top = top_buf;
+
+    add_stat("inlined_calls", 1);
+    if(print_remarks){
+        remark_tok(node->pos, "inlined %s into %s", callee->name, cur_func->name);
+    }
+    return ret;
+}
+
+// 関数の本体の中で、calleeを呼び出している箇所の数
+static bool count_call(Node* node, Ident* callee){
+    if(node->kind == ND_FUNCCALL && node->ident == callee){
+        unroll_size++;
+    }
+    return false;
+}
+
+static int count_calls(Ident* func, Ident* callee){
+    unroll_size = 0;
+    for(Node* cur = func->funcbody; cur; cur = cur->next){
+        any_node(cur, count_call, callee);
+    }
+    return unroll_size;
+}
+
+// 関数ごとの呼び出されている箇所の数を数える
+static void count_call_sites(Scope* scope){
+    for(Ident* callee = scope->ident; callee; callee = callee->next){
+        if(callee->kind != ID_FUNC || !callee->funcbody || !callee->is_static){
+            continue;
+        }
+        callee->ncalls = 0;
+        for(Ident* func = scope->ident; func; func = func->next){
+            if(func->kind == ID_FUNC && func->funcbody){
+                callee->ncalls += count_calls(func, callee);
+            }
+        }
+    }
+}
+
+static bool calls_func(Ident* func, Ident* callee){
+    for(IR* cur = func->ir_cmd; cur; cur = cur->next){
+        if(cur->cmd == IR_FN_CALL && cur->s1->ident == callee){
+            return true;
+        }
+    }
+    return false;
+}
+
+// 他の関数から呼び出されなくなったstaticな関数を出力しない
+static void remove_unused_static(Scope* scope){
+    bool changed = true;
+    while(changed){
+        changed = false;
+        for(Ident* callee = scope->ident; callee; callee = callee->next){
+            if(callee->kind != ID_FUNC || !callee->is_static || !callee->ir_cmd){
+                continue;
+            }
+            bool used = false;
+            for(Ident* func = scope->ident; func && !used; func = func->next){
+                if(func != callee && func->kind == ID_FUNC && func->ir_cmd){
+                    used = calls_func(func, callee);
+                }
+            }
+            if(!used){
+                callee->ir_cmd = NULL;
+                changed = true;
+            }
+        }
+    }
+}
+
+/*
+    末尾の自己再帰呼び出しのループ化
+        -Oのとき、関数の中の return f(x, y); (fは自分自身) を
+            仮引数の変数に引数を代入する
+            goto L_tail;                    // 仮引数を受け取った直後
+        にする。再帰の深さにかかわらずスタックを使わない。
+        局所変数のアドレスを取る関数では、呼び出し先から呼び出し元の変数が
+        見えることがあるので行わない。
+*/
+static bool is_self_tail_call(Node* node, Ident* func){
+    return node->kind == ND_RETURN && node->lhs
+        && node->lhs->kind == ND_FUNCCALL && node->lhs->ident == func;
+}
+
+// 局所変数のアドレスが外に出るかもしれないノード
+static bool is_escaping_local(Node* node, Ident* var){
+    if(node->kind == ND_ADDR){
+        return true;
+    }
+    if(node->kind != ND_VAR || node->ident->kind != ID_LVAR){
+        return false;
+    }
+    TypeKind kind = node->ident->type->kind;
+    return kind == TY_ARRAY || kind == TY_STRUCT || kind == TY_UNION;
+}
+
+static bool can_tail_loop(Ident* func){
+    if(func->va_area){
+        return false;
+    }
+    int nparams = 0;
+    for(Parameter* param = func->params; param; param = param->next){
+        TypeKind kind = param->ident->type->kind;
+        if(kind == TY_STRUCT || kind == TY_UNION){
+            return false;
+        }
+        nparams++;
+    }
+
+    bool found = false;
+    for(Node* cur = func->funcbody; cur; cur = cur->next){
+        if(any_node(cur, is_escaping_local, NULL)){
+            return false;
+        }
+        if(any_node(cur, is_self_tail_call, func)){
+            found = true;
+        }
+    }
+    return found;
+}
+
+static bool gen_tail_loop(Node* node){
+    if(tail_label < 0 || inline_frame || !is_self_tail_call(node, cur_func)){
+        return false;
+    }
+
+    int nargs = 0;
+    for(Node* cur = node->lhs->params; cur; cur = cur->next){
+        nargs++;
+    }
+    int nparams = 0;
+    for(Parameter* param = cur_func->params; param; param = param->next){
+        nparams++;
+    }
+    if(nargs != nparams){
+        return false;
+    }
+
+    // 引数はすべて計算してから代入する。f(b, a)のように仮引数を入れ替えることがある
+    Reg** args = calloc(nargs, sizeof(Reg*));
+    int i = 0;
+    for(Node* cur = node->lhs->params; cur; cur = cur->next){
+        args[i++] = gen_expr(cur);
+    }
+    i = 0;
+    for(Parameter* param = cur_func->params; param; param = param->next){
+        new_IR(IR_ASSIGN, new_Reg(), gen_var_addr(param->ident), args[i++]);
+    }
+    new_IRJmp(tail_label);
+
+    add_stat("tail_recursion_loops", 1);
+    if(print_remarks){
+        remark_tok(node->pos, "tail recursion of %s turned into a loop", cur_func->name);
+    }
+    return true;
+}
+
+/*
+    switch文の分岐
+        caseの値を並べて、密なところ(値の範囲の40%以上がcase)をまとめてクラスタにする。
+        4つ以上のcaseを含むクラスタは範囲を確かめてからジャンプテーブルで飛び、
+        それ以外のcaseはひとつずつのクラスタにする。
+        クラスタが4つ以上あるときは、クラスタの下限で二分探索する。
+*/
+#define SWITCH_TABLE_MIN    4
+
+typedef struct SwitchCase {
+    long    val;
+    long    label;
+} SwitchCase;
+
+typedef struct SwitchCluster {
+    long    lo;
+    long    hi;
+    int     first;      // 先頭のcaseの添字
+    int     count;
+} SwitchCluster;
+
+static SwitchCase* switch_cases;
+static bool switch_unsigned;
+
+static bool case_less(long a, long b){
+    return switch_unsigned ? (unsigned long)a < (unsigned long)b : a < b;
+}
+
+static void gen_switch_cluster(Reg* reg, SwitchCluster* cl, long l_default){
+    if(cl->count == 1){
+        new_IR(IR_JE, new_RegImm(switch_cases[cl->first].label), reg, new_RegImm(cl->lo));
+        return;
+    }
+
+    // 0始まりの添字にして、範囲外なら次のクラスタへ
+    long l_next = get_label();
+    long range = (unsigned long)(cl->hi - cl->lo) + 1;
+    Reg* idx = reg;
+    if(cl->lo != 0){
+        idx = new_Reg();
+        new_IR(IR_MOV, NULL, idx, reg);
+        new_IR(IR_SUB, NULL, idx, new_RegImm(cl->lo));
+    }
+    new_IR(IR_JGT, new_RegImm(l_next), idx, new_RegImm(range - 1));
+    ir->is_unsigned = true;
+
+    IR* jt = new_IR(IR_JTABLE, NULL, idx, new_RegImm(get_label()));
+    jt->ntargets = range;
+    jt->targets = calloc(range, sizeof(long));
+    for(int i = 0; i < range; i++){
+        jt->targets[i] = l_default;
+    }
+    for(int i = cl->first; i < cl->first + cl->count; i++){
+        jt->targets[switch_cases[i].val - cl->lo] = switch_cases[i].label;
+    }
+    new_IRLabel(l_next);
+}
+
+static void gen_switch_tree(Reg* reg, SwitchCluster* cl, int n, long l_default){
+    if(n <= 3){
+        for(int i = 0; i < n; i++){
+            gen_switch_cluster(reg, &cl[i], l_default);
+        }
+        new_IRJmp(l_default);
+        return;
+    }
+
+    int mid = n / 2;
+    long l_right = get_label();
+    new_IR(IR_JGE, new_RegImm(l_right), reg, new_RegImm(cl[mid].lo));
+    ir->is_unsigned = switch_unsigned;
+    gen_switch_tree(reg, cl, mid, l_default);
+    new_IRLabel(l_right);
+    gen_switch_tree(reg, cl + mid, n - mid, l_default);
+}
+
+static void gen_switch(Node* node, Reg* reg, long l_default){
+    // caseの値は、整数拡張したswitchの式の型に変換して比べる
+    Type* type = node->cond->type;
+    int size = type->size < 4 ? 4 : type->size;
+    switch_unsigned = type->is_unsigned && type->size >= 4;
+
+    int n = 0;
+    for(Node* nc = node->next_case; nc; nc = nc->next_case){
+        n++;
+    }
+    switch_cases = calloc(n + 1, sizeof(SwitchCase));
+    int ncase = 0;
+    for(Node* nc = node->next_case; nc; nc = nc->next_case){
+        long val = nc->lhs->val;
+        if(size == 4){
+            val = switch_unsigned ? (long)(unsigned int)val : (long)(int)val;
+        }
+
+        // 値の順に並べる。同じ値は最初に登録したものだけを使う
+        int i = ncase;
+        while(i > 0 && case_less(val, switch_cases[i - 1].val)){
+            i--;
+        }
+        if(i > 0 && switch_cases[i - 1].val == val){
+            continue;
+        }
+        memmove(&switch_cases[i + 1], &switch_cases[i], sizeof(SwitchCase) * (ncase - i));
+        switch_cases[i].val = val;
+        switch_cases[i].label = nc->val;
+        ncase++;
+    }
+
+    SwitchCluster* cl = calloc(ncase + 1, sizeof(SwitchCluster));
+    int ncl = 0;
+    for(int i = 0; i < ncase; ){
+        int j = i;
+        while(j + 1 < ncase
+            && (unsigned long)(switch_cases[j + 1].val - switch_cases[i].val) + 1 <= (unsigned long)(j + 2 - i) * 5 / 2){
+            j++;
+        }
+        int count = j - i + 1;
+        if(count < SWITCH_TABLE_MIN){
+            count = 1;
+        }
+        cl[ncl].lo = switch_cases[i].val;
+        cl[ncl].hi = switch_cases[i + count - 1].val;
+        cl[ncl].first = i;
+        cl[ncl].count = count;
+        ncl++;
+        i += count;
+    }
+
+    gen_switch_tree(reg, cl, ncl, l_default);
+}
+
+// 通常の算術型変換をしたあとの演算が符号なしかどうか
+static bool is_unsigned_op(Node* node){
+    Type* lhs = node->lhs->type;
+    Type* rhs = node->rhs->type;
+    if(!lhs || !rhs){
+        return false;
+    }
+
+    // ポインタの大小比較は符号なしで行う
+    if(lhs->ptr_to || rhs->ptr_to){
+        return node->kind == ND_LT || node->kind == ND_LE;
+    }
+
+    // int未満の型はintに格上げされる
+    bool lhs_unsigned = lhs->is_unsigned && lhs->size >= 4;
+    bool rhs_unsigned = rhs->is_unsigned && rhs->size >= 4;
+
+    // シフトは左辺の型で行う
+    if(node->kind == ND_L_BITSHIFT || node->kind == ND_R_BITSHIFT){
+        return lhs_unsigned;
+    }
+
+    int lhs_size = lhs->size < 4 ? 4 : lhs->size;
+    int rhs_size = rhs->size < 4 ? 4 : rhs->size;
+    if(lhs_size != rhs_size){
+        return lhs_size > rhs_size ? lhs_unsigned : rhs_unsigned;
+    }
+    return lhs_unsigned || rhs_unsigned;
+}
+
+long get_label(){
     return g_label++;
 }
 
@@ -592,6 +2016,28 @@ static IR* new_IR(IRCmd cmd, Reg* t, Reg* s1, Reg* s2){
     r->t = t;
     r->s1 = s1;
     r->s2 = s2;
+
+    // アクセスするメモリのサイズとキャストの型は命令側に持たせる
+    switch(cmd){
+        case IR_LOAD:
+            r->size = s2->size;
+            r->is_unsigned = s2->is_unsigned;
+            break;
+        case IR_ASSIGN:
+        case IR_COPY:
+            r->size = s1->size;
+            r->is_unsigned = s1->is_unsigned;
+            break;
+        case IR_CAST:
+            r->size = t->size;
+            r->is_unsigned = t->is_unsigned;
+            r->src_size = s1->size;
+            r->src_unsigned = s1->is_unsigned;
+            break;
+        default:
+            break;
+    }
+
     ir->next = r;
     ir = r;
     return r;
@@ -605,15 +2051,16 @@ static IR* new_IRJmp(long label){
     new_IR(IR_JMP, NULL, new_RegImm(label), NULL);
 }
 
-static Reg* new_Reg(){
+Reg* new_Reg(){
     Reg* reg = calloc(1, sizeof(Reg));
     reg->idx = -1;
     reg->size = 8;
-    reg->spill_idx = -1;
+    reg->vn = -1;
+    reg->phys = -1;
     return reg;
 }
 
-static Reg* new_RegImm(unsigned long val){
+Reg* new_RegImm(unsigned long val){
     Reg* reg = new_Reg();
     reg->kind = REG_IMM;
     reg->val = val;
@@ -621,6 +2068,7 @@ static Reg* new_RegImm(unsigned long val){
 }
 
 static Reg* new_RegVar(Ident* ident){
+    ident = inline_var(ident);
     Reg* reg = new_Reg();
     reg->kind = REG_VAR;
     reg->ident = ident;
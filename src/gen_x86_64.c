@@ -3,14 +3,11 @@
 static void convert_ir2x86asm(IR* ir);                  // IR->x86アセンブリ変換
 static void dprint_Ident(Ident* ident, int level);     // 識別子のデバッグ出力
 
-static const char *rreg8[] = {"r10b", "r11b", "r12b", "r13b", "r14b", "r15b"};
-static const char *rreg16[] = {"r10w", "r11w", "r12w", "r13w", "r14w", "r15w"};
-static const char *rreg32[] = {"r10d", "r11d", "r12d", "r13d", "r14d", "r15d"};
-static const char *rreg64[] = {"r10", "r11", "r12", "r13", "r14", "r15"};
-static Reg* realReg[6] = { } ;
-
-static int spillReg[30] = { } ; // 仮想レジスタの退避領域（1: 退避済み, 0: 未退避）
-static int useReg[3] = { -1 };     // 処理対象の中間命令で使用する実レジスタのインデックス
+// 実レジスタの名前。添字はPhysReg
+static const char *rreg8[] = {"r10b", "r11b", "r12b", "r13b", "r14b", "r15b", "bl", "dil", "sil", "dl", "cl", "r8b", "r9b", "al"};
+static const char *rreg16[] = {"r10w", "r11w", "r12w", "r13w", "r14w", "r15w", "bx", "di", "si", "dx", "cx", "r8w", "r9w", "ax"};
+static const char *rreg32[] = {"r10d", "r11d", "r12d", "r13d", "r14d", "r15d", "ebx", "edi", "esi", "edx", "ecx", "r8d", "r9d", "eax"};
+static const char *rreg64[] = {"r10", "r11", "r12", "r13", "r14", "r15", "rbx", "rdi", "rsi", "rdx", "rcx", "r8", "r9", "rax"};
 
 static const char *argreg8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
 static const char *argreg16[] = {"di", "si", "dx", "cx", "r8w", "r9w"};
@@ -20,6 +17,15 @@ int depth = 0;
 
 int debug_regis = 0;    // レジスタのデバッグモード
 int debug_plvar = 0;    // ローカル変数のデバッグモード
+int omit_frame_pointer = 0;     // フレームを使わない関数でrbpを積まない（-fomit-frame-pointer）
+
+// 関数の先頭で積むcallee-savedのレジスタ(積む順)
+static const PhysReg callee_saved_regs[] = { PR_RBX, PR_R12, PR_R13, PR_R14, PR_R15 };
+#define NUM_CALLEE_SAVED_REGS   (sizeof(callee_saved_regs) / sizeof(callee_saved_regs[0]))
+
+static int saved_regs;          // 生成中の関数が積むcallee-savedのレジスタ(1 << PhysReg)
+static int frame_size;          // 生成中の関数がrspを下げる大きさ
+static bool use_frame_pointer;  // 生成中の関数がrbpを使うか
 
 /*
     CAST CMD のルール
@@ -71,14 +77,10 @@ static void gen_cast_x86(Reg* t, Reg* s1, CAST_CMD);
 static void pop(char* reg);
 static void push(char* reg);
 
-static int findReg();
-
 static void activateRegLhs(Reg* reg);
 static void activateRegRhs(Reg* reg);
 static void activateReg(Reg* reg, int is_lhs);
 
-static void freeReg(Reg* reg);
-
 static void pop(char* reg){
     print("  pop %s\n", reg);
     --depth;
@@ -86,68 +88,92 @@ static void pop(char* reg){
 
 static void push(char* reg){
     print("  push %s\n", reg);
-    --depth;
+    ++depth;
 }
 
-static int findSpillReg(){
-    for(int i = 0; i < 30; i++){
-        if(!spillReg[i]){
-            return i;
+/*
+    関数のフレームを決める
+        ローカル変数と退避領域(IR_FN_LABELのs2)はrbpから下に置く。
+        rbpからの読み書きがひとつもなければ、rspを下げない。
+        関数を呼び出さない関数(葉関数)で、callee-savedのレジスタを積まず、
+        フレームが128byte以下なら、rspより下のレッドゾーンに置いてrspを下げない。
+        -fomit-frame-pointerのときは、フレームを使わない関数ではrbpを積まない。
+*/
+static void plan_frame(Ident* func){
+    saved_regs = func->saved_regs;
+
+    int size = 0;
+    bool leaf = true;
+    bool uses_frame = false;
+    for(IR* ir = func->ir_cmd; ir; ir = ir->next){
+        if(ir->sym && ir->sym->kind == ID_LVAR){
+            uses_frame = true;
+        }
+        switch(ir->cmd){
+            case IR_FN_LABEL:
+                size = ir->s2->val;
+                break;
+            case IR_FN_CALL:
+                leaf = false;
+                break;
+            case IR_REL:
+                uses_frame |= ir->s1->ident->kind == ID_LVAR;
+                break;
+            case IR_STORE_ARG_REG:
+                uses_frame |= ir->s1->kind != REG_REG;
+                break;
+            case IR_VA_START:
+            case IR_SPILL:
+            case IR_RELOAD:
+            case IR_LEA:
+                uses_frame = true;
+                break;
+            default:
+                break;
         }
     }
-    error("full of spill register\n");
-    return -1;
+
+    frame_size = uses_frame ? (size + 15) / 16 * 16 : 0;
+    if(leaf && !saved_regs && frame_size <= 128){
+        frame_size = 0;
+    }
+    use_frame_pointer = !omit_frame_pointer || uses_frame;
 }
 
-static int findReg(){
-    for(int i = 0; i < 6; i++){
-        if(!realReg[i]){
-            return i;
+static void emit_prologue(){
+    if(use_frame_pointer){
+        // rbpを積むとスタックは16byte境界に揃うので、ここからの深さを数える
+        print("  push rbp\n");
+        print("  mov rbp, rsp\n");
+    } else {
+        // 戻り先のアドレスの分だけ16byte境界からずれている
+        depth++;
+    }
+    if(frame_size){
+        print("  sub rsp, %d\n", frame_size);
+    }
+    for(int i = 0; i < NUM_CALLEE_SAVED_REGS; i++){
+        if(saved_regs & (1 << callee_saved_regs[i])){
+            push((char*)rreg64[callee_saved_regs[i]]);
         }
     }
+}
 
-    // 実レジスタをすべて使用しているので、spillする
-    // 1. spill先を見つける。
-    int spill_idx = findSpillReg();
-
-    // 2. spillするレジスタを見つける。realRegを見て、markしていないものを探す
-    int src_reg_idx = -1;
-    for(int i = 0; i < 6; i++){
-        if(realReg[i]){
-            bool is_use = false;
-            for(int j = 0; j < 3; j++){
-                if(useReg[j] == i){
-                    is_use = true;
-                    break;
-                }
-            }
-            if(is_use) continue;
-            // 割当済の実レジスタで、使用中でないレジスタのidxを取得
-            src_reg_idx = i;
-            break;
+// callee-savedのレジスタを戻して、フレームを捨てる
+static void emit_epilogue(){
+    for(int i = NUM_CALLEE_SAVED_REGS - 1; i >= 0; i--){
+        if(saved_regs & (1 << callee_saved_regs[i])){
+            pop((char*)rreg64[callee_saved_regs[i]]);
         }
     }
-
-    // 3. spillする
-    if(debug_regis){
-        print("# spill %s to [rbp - %d]\n", rreg64[src_reg_idx], 8 * spill_idx);
+    if(use_frame_pointer){
+        if(frame_size || saved_regs){
+            print("  mov rsp, rbp\n");
+        }
+        print("  pop rbp\n");
+    } else {
+        depth--;
     }
-
-    print("  mov QWORD PTR [rbp - 240 + %d], %s\n", 8 * spill_idx, rreg64[src_reg_idx]);
-    spillReg[spill_idx] = 1;
-    realReg[src_reg_idx]->spill_idx = spill_idx;
-
-    return src_reg_idx;
-}
-
-// レジスタを割り当てる
-static void assignReg(Reg* reg){
-    if(reg->rreg) return;
-
-    int idx = findReg();
-    reg->idx = idx;
-    realReg[idx] = reg;
-    reg->rreg = format_string("%s", rreg64[idx]);
 }
 
 // レジスタを左辺値としてアクティベートする
@@ -161,136 +187,431 @@ static void activateRegRhs(Reg* reg){
 }
 
 // レジスタをアクティベートする
+// 仮想レジスタにはレジスタ割り当てで実レジスタを決めてある
 static void activateReg(Reg* reg, int is_lhs){
-    if(reg->spill_idx != -1){
-        // スピルレジスタからロードする
-        if(debug_regis){
-            print("# back from spill [rbp - %d] to %s\n", 8 * reg->spill_idx, rreg64[reg->idx]);
-        }
-
-        print("  mov %s, QWORD PTR [rbp - 240 + %d]\n", rreg64[reg->idx], 8 * reg->spill_idx);
-        spillReg[reg->spill_idx] = 0;
-        reg->spill_idx = -1;
-        return;
-    }
-
     if(reg->rreg) return;
 
     switch(reg->kind){
         case REG_IMM:
-            if(is_lhs){
-                assignReg(reg);
-                print("  mov %s, %lu\n", reg->rreg, reg->val);
-            } else {
-                reg->rreg = format_string("%lu\0", reg->val);
+            // レジスタに載せる必要のある直値は、レジスタ割り当てで仮想レジスタに移してある
+            if(is_lhs || (long)reg->val != (int)reg->val){
+                error("no register is allocated for immediate.\n");
             }
+            reg->rreg = format_string("%lu\0", reg->val);
             break;
         case REG_REG:
-            assignReg(reg);
-            break;
-        case REG_VAR:
-            {
-                assignReg(reg);
-                Ident* ident = reg->ident;
-                int size = ident->type->size;
-
-                if(ident->kind == ID_LVAR){
-                    if(size == 1){
-                        print("  movsx %s, BYTE PTR[rbp - %d]\n", reg->rreg, ident->offset);
-                    } else if(size == 2){
-                        print("  movsx %s, WORD PTR[rbp - %d]\n", reg->rreg, ident->offset);
-                    } else if(size == 8){
-                        print("  mov %s, QWORD PTR[rbp - %d]\n", reg->rreg, ident->offset);
-                    }
-                } else if(ident->kind == ID_GVAR){
-                    if(ident->is_static){
-                        if(size == 1){
-                            print("  movsx %s, BYTE PTR[.L%s]\n", reg->rreg, ident->name);
-                        } else if(size == 2){
-                            print("  movsx %s, WORD PTR[.L%s]\n", reg->rreg, ident->name);
-                        } else if(size == 8){
-                            print("  mov %s, QWORD PTR[.L%s]\n", reg->rreg, ident->name);
-                        }
-                    } else {
-                        if(size == 1){
-                            print("  movsx %s, BYTE PTR[%s]\n", reg->rreg, ident->name);
-                        } else if(size == 2){
-                            print("  movsx %s, WORD PTR[%s]\n", reg->rreg, ident->name);
-                        } else if(size == 8){
-                            print("  mov %s, QWORD PTR[%s]\n", reg->rreg, ident->name);
-                        }
-                    }
-                }  else if(ident->kind == ID_GVAR && ident->is_string_literal){
-                    print("  lea %s, [ rip + %s ]\n", reg->rreg, ident->name);
-                }
+            if(reg->phys == -1){
+                error("no register is allocated.\n");
             }
+            reg->idx = reg->phys;
+            reg->rreg = format_string("%s", rreg64[reg->phys]);
             break;
+        default:
+            unreachable();
     }
+}
 
-    // 使用するレジスタはマークする
-    for(int i = 0; i < 3; i++){
-        if(useReg[i] == -1){
-            useReg[i] = reg->idx;
-            break;
+static char* sym_name(Ident* ident){
+    return ident->is_static ? format_string(".L%s", ident->name) : ident->name;
+}
+
+// メモリオペランド SIZE PTR [base + index * scale + disp] を作る。baseはアドレスのレジスタ
+// symがあるときは、ローカル変数ならrbpから、グローバル変数ならripからの位置にする
+static char* mem_operand(IR* ir, Reg* base, int size){
+    static const char* ptr[] = { NULL, "BYTE", "WORD", NULL, "DWORD", NULL, NULL, NULL, "QWORD" };
+    char* addr;
+    long disp = ir->disp;
+    if(ir->sym && ir->sym->kind == ID_LVAR){
+        addr = "rbp";
+        disp -= ir->sym->offset;
+    } else if(ir->sym){
+        addr = format_string("rip + %s", sym_name(ir->sym));
+    } else {
+        activateRegLhs(base);
+        addr = base->rreg;
+    }
+    if(ir->index){
+        activateRegLhs(ir->index);
+        addr = format_string("%s + %s * %d", addr, ir->index->rreg, ir->scale);
+    }
+    if(disp > 0){
+        addr = format_string("%s + %ld", addr, disp);
+    } else if(disp < 0){
+        addr = format_string("%s - %ld", addr, -disp);
+    }
+    if(size > 8 || !ptr[size]){
+        return format_string("[%s]", addr);
+    }
+    return format_string("%s PTR [%s]", ptr[size], addr);
+}
+
+/*
+    構造体のコピー
+        16byte未満      : r8を通して8/4/2/1byteずつ
+        COPY_REP_SIZEまで: xmm15を通して16byteずつ。端数は最後の16byteを重ねてコピーする
+        それより大きい  : rep movsb
+*/
+static void emit_copy(IR* ir){
+    activateRegLhs(ir->t);
+    activateRegLhs(ir->s1);
+    char* dst = ir->t->rreg;
+    char* src = ir->s1->rreg;
+    int size = ir->size;
+
+    if(size > COPY_REP_SIZE){
+        print("  mov rdi, %s\n", dst);
+        print("  mov rsi, %s\n", src);
+        print("  mov ecx, %d\n", size);
+        print("  rep movsb\n");
+        return;
+    }
+
+    if(size >= 16){
+        char* mov = use_avx2 ? "vmovdqu" : "movdqu";
+        for(int i = 0; i < size; i += 16){
+            int off = i + 16 <= size ? i : size - 16;
+            print("  %s xmm15, XMMWORD PTR [%s + %d]\n", mov, src, off);
+            print("  %s XMMWORD PTR [%s + %d], xmm15\n", mov, dst, off);
+        }
+        return;
+    }
+
+    static const char* ptr[] = { NULL, "BYTE", "WORD", NULL, "DWORD", NULL, NULL, NULL, "QWORD" };
+    static const char* r8[] = { NULL, "r8b", "r8w", NULL, "r8d", NULL, NULL, NULL, "r8" };
+    int off = 0;
+    for(int n = 8; n >= 1; n /= 2){
+        while(size - off >= n){
+            print("  mov %s, %s PTR [%s + %d]\n", r8[n], ptr[n], src, off);
+            print("  mov %s PTR [%s + %d], %s\n", ptr[n], dst, off, r8[n]);
+            off += n;
         }
     }
 }
 
+static void emit_binop(char* op, Reg* t, Reg* s1, Reg* s2){
+    activateRegLhs(s1);
+    activateRegRhs(s2);
+
+    if(t){
+        // t = s1 op s2 の形式の場合は、tにs1をコピーしてから演算する
+        activateRegLhs(t);
+        print("  mov %s, %s\n", t->rreg, s1->rreg);
+        print("  %s %s, %s\n", op, t->rreg, s2->rreg);
+    } else {
+        // s1は残しておく
+        print("  %s %s, %s\n", op, s1->rreg, s2->rreg);
+    }
+}
 
-static void freeReg(Reg* reg){
-    free(reg->rreg);
-    reg->rreg = NULL;
+// 乗算。3,5,9倍はleaで計算する
+static void emit_mul(IR* ir){
+    Reg* s2 = ir->s2;
+    if(s2->kind != REG_IMM || (s2->val != 3 && s2->val != 5 && s2->val != 9)){
+        emit_binop("imul", ir->t, ir->s1, ir->s2);
+        return;
+    }
+    activateRegLhs(ir->s1);
+    Reg* dst = ir->s1;
+    if(ir->t){
+        activateRegLhs(ir->t);
+        dst = ir->t;
+    }
+    print("  lea %s, [%s + %s * %d]\n", dst->rreg, ir->s1->rreg, ir->s1->rreg, s2->val - 1);
+}
 
-    if(reg->idx == -1) return;
+// 64bitどうしの積の上位64bit(rdx)を格納する
+static void emit_mulhi(IR* ir){
+    activateRegLhs(ir->s1);
+    activateRegLhs(ir->s2);
+    print("  mov rax, %s\n", ir->s1->rreg);
+    print("  %s %s\n", ir->is_unsigned ? "mul" : "imul", ir->s2->rreg);
+    if(ir->t){
+        activateRegLhs(ir->t);
+        print("  mov %s, rdx\n", ir->t->rreg);
+    } else {
+        print("  mov %s, rdx\n", ir->s1->rreg);
+    }
+}
 
-    realReg[reg->idx] = NULL;
-    reg->idx = -1;
+// 除算・剰余の結果(raxまたはrdx)を格納する
+static void emit_div(IR* ir, char* result){
+    activateRegLhs(ir->s1);
+
+    // idivが受け取るoperandはレジスタなので、
+    // 左辺値として割り当てる
+    activateRegLhs(ir->s2);
+    print("  mov rax, %s\n", ir->s1->rreg);
+    if(ir->is_unsigned){
+        print("  xor edx, edx\n");
+        print("  div %s\n", ir->s2->rreg);
+    } else {
+        print("  cqo\n");
+        print("  idiv %s\n", ir->s2->rreg);
+    }
+    if(ir->t){
+        activateRegLhs(ir->t);
+        print("  mov %s, %s\n", ir->t->rreg, result);
+    } else {
+        print("  mov %s, %s\n", ir->s1->rreg, result);
+    }
 }
 
-static void freeRegAll(Reg* t, Reg* s1, Reg* s2){
-    if(t){
-        freeReg(s1);
+// シフト演算。シフト量が直値でない場合はclを使う
+static void emit_shift(IR* ir, char* op){
+    activateRegLhs(ir->s1);
+    activateRegRhs(ir->s2);
+
+    Reg* dst = ir->s1;
+    if(ir->t){
+        activateRegLhs(ir->t);
+        print("  mov %s, %s\n", ir->t->rreg, ir->s1->rreg);
+        dst = ir->t;
+    }
+
+    if(ir->s2->kind == REG_IMM){
+        print("  %s %s, %s\n", op, dst->rreg, ir->s2->rreg);
+    } else {
+        print("  mov rcx, %s\n", ir->s2->rreg);
+        print("  %s %s, cl\n", op, dst->rreg);
+    }
+}
+
+// 比較して分岐する命令の条件ジャンプ命令の名前
+static char* jcc_name(IR* ir){
+    switch(ir->cmd){
+        case IR_JE: return "je";
+        case IR_JNE: return "jne";
+        case IR_JLT: return ir->is_unsigned ? "jb" : "jl";
+        case IR_JLE: return ir->is_unsigned ? "jbe" : "jle";
+        case IR_JGT: return ir->is_unsigned ? "ja" : "jg";
+        case IR_JGE: return ir->is_unsigned ? "jae" : "jge";
+        default:
+            error("not a compare and jump.");
     }
-    freeReg(s2);
+    return NULL;
 }
 
-static void freeRegAllForce(){
-    for(int i = 0; i < 6; i++){
-        if(realReg[i]){
-            freeReg(realReg[i]);
+// 読み込みをオペランドにした演算・比較 (isel.c)
+static void emit_mem_op(IR* ir){
+    Reg* base = ir->mem == 1 ? ir->s1 : ir->s2;
+    char* mem = mem_operand(ir, base, ir->mem_size);
+    char* op = NULL;
+    switch(ir->cmd){
+        case IR_ADD: op = "add"; break;
+        case IR_SUB: op = "sub"; break;
+        case IR_MUL: op = "imul"; break;
+        case IR_BIT_AND: op = "and"; break;
+        case IR_BIT_OR: op = "or"; break;
+        case IR_BIT_XOR: op = "xor"; break;
+        default: break;
+    }
+    if(op){
+        activateRegLhs(ir->s1);
+        Reg* dst = ir->s1;
+        if(ir->t){
+            activateRegLhs(ir->t);
+            print("  mov %s, %s\n", ir->t->rreg, ir->s1->rreg);
+            dst = ir->t;
         }
+        print("  %s %s, %s\n", op, dst->rreg, mem);
+        return;
     }
+
+    if(ir->cmd == IR_JZ || ir->cmd == IR_JNZ){
+        print("  cmp %s, 0\n", mem);
+        print("  %s .L%d\n", ir->cmd == IR_JZ ? "je" : "jne", ir->s2->val);
+        return;
+    }
+
+    if(ir->mem == 1){
+        print("  cmp %s, %ld\n", mem, (long)ir->s2->val);
+    } else {
+        activateRegLhs(ir->s1);
+        print("  cmp %s, %s\n", ir->s1->rreg, mem);
+    }
+    switch(ir->cmd){
+        case IR_NOT_EQUAL:
+            print("  setne al\n");
+            break;
+        case IR_LT:
+            print("  %s al\n", ir->is_unsigned ? "setb" : "setl");
+            break;
+        case IR_LE:
+            print("  %s al\n", ir->is_unsigned ? "setbe" : "setle");
+            break;
+        default:
+            print("  %s .L%d\n", jcc_name(ir), ir->t->val);
+            return;
+    }
+    activateRegLhs(ir->t);
+    print("  movzb %s, al\n", ir->t->rreg);
 }
 
-static void emit_binop(char* op, Reg* t, Reg* s1, Reg* s2){
-    activateRegLhs(s1);
-    activateRegRhs(s2);
-    print("  %s %s, %s\n", op, s1->rreg, s2->rreg);
+/*
+    ベクトル命令
+        ベクトルレジスタの番号nは、-mavx2のときはymmn、それ以外はxmmnにする。
+        xmm13〜15はこのファイルの中だけで使う。
+        -mavx2のときは3オペランドのVEX形式(vpaddd ymm0, ymm1, ymm2)を使い、
+        それ以外はSSE2の2オペランド形式(movdqa xmm0, xmm1 / paddd xmm0, xmm2)にする。
+        SSE2にない符号付きの最小・最大(pminsb/pminsdなど)は、比較とマスクで計算する。
+*/
+#define VREG_TMP    13
 
-    if(t){
-        // あるならそっちにmovが入る
-        freeReg(s1);
+static char* vreg_name(Reg* reg){
+    return format_string("%s%lu", use_avx2 ? "ymm" : "xmm", reg->val);
+}
+
+static char* xreg_name(long n){
+    return format_string("xmm%ld", n);
+}
+
+// 要素ごとの演算のpから始まる命令の名前
+static char* vop_name(IRCmd cmd, int size, bool is_unsigned){
+    static char* add[] = {[1] = "paddb", [2] = "paddw", [4] = "paddd", [8] = "paddq"};
+    static char* sub[] = {[1] = "psubb", [2] = "psubw", [4] = "psubd", [8] = "psubq"};
+    switch(cmd){
+        case IR_VADD: return add[size];
+        case IR_VSUB: return sub[size];
+        case IR_VMUL: return "pmulld";
+        case IR_VAND: return "pand";
+        case IR_VOR: return "por";
+        case IR_VXOR: return "pxor";
+        case IR_VSHL: return size == 2 ? "psllw" : "pslld";
+        case IR_VSHR:
+            if(size == 2){
+                return is_unsigned ? "psrlw" : "psraw";
+            }
+            return is_unsigned ? "psrld" : "psrad";
+        case IR_VSAD: return "psadbw";
+        case IR_VMIN:
+            if(size == 1){
+                return is_unsigned ? "pminub" : "pminsb";
+            }
+            return "pminsd";
+        case IR_VMAX:
+            if(size == 1){
+                return is_unsigned ? "pmaxub" : "pmaxsb";
+            }
+            return "pmaxsd";
+        default:
+            error("not a vector operation.");
+    }
+    return NULL;
+}
+
+// t = s1 op s2
+static void emit_vop(IRCmd cmd, int size, bool is_unsigned, char* t, char* s1, char* s2){
+    char* op = vop_name(cmd, size, is_unsigned);
+    if(use_avx2){
+        print("  v%s %s, %s, %s\n", op, t, s1, s2);
+        return;
+    }
+    if((cmd == IR_VMIN || cmd == IR_VMAX) && !is_unsigned){
+        // mask = s1 > s2 で、最小ならs2、最大ならs1を選ぶ
+        char* tmp = xreg_name(VREG_TMP + 1);
+        char* mask = xreg_name(VREG_TMP + 2);
+        print("  movdqa %s, %s\n", mask, s1);
+        print("  %s %s, %s\n", size == 1 ? "pcmpgtb" : "pcmpgtd", mask, s2);
+        print("  movdqa %s, %s\n", tmp, mask);
+        print("  pand %s, %s\n", tmp, cmd == IR_VMIN ? s2 : s1);
+        print("  pandn %s, %s\n", mask, cmd == IR_VMIN ? s1 : s2);
+        print("  por %s, %s\n", mask, tmp);
+        print("  movdqa %s, %s\n", t, mask);
+        return;
+    }
+    if(strcmp(t, s1)){
+        print("  movdqa %s, %s\n", t, s1);
+    }
+    print("  %s %s, %s\n", op, t, s2);
+}
+
+// 128bitのレジスタの命令。-mavx2のときはVEX形式にする
+static void emit_x(const char* op, const char* dst, const char* src, const char* imm){
+    if(use_avx2 && imm){
+        print("  v%s %s, %s, %s\n", op, dst, src, imm);
+    } else if(use_avx2){
+        print("  v%s %s, %s\n", op, dst, src);
+    } else if(imm){
+        print("  %s %s, %s, %s\n", op, dst, src, imm);
     } else {
-        // s1は残しておく
+        print("  %s %s, %s\n", op, dst, src);
+    }
+}
+
+static void emit_vbcast(IR* ir){
+    activateRegLhs(ir->s1);
+    char* x = xreg_name(ir->t->val);
+    if(ir->size == 8){
+        emit_x("movq", x, ir->s1->rreg, NULL);
+    } else {
+        emit_x("movd", x, rreg32[ir->s1->idx], NULL);
+    }
+    if(use_avx2){
+        char* op = ir->size == 1 ? "vpbroadcastb" : ir->size == 4 ? "vpbroadcastd" : "vpbroadcastq";
+        print("  %s %s, %s\n", op, vreg_name(ir->t), x);
+        return;
+    }
+    if(ir->size == 1){
+        print("  punpcklbw %s, %s\n", x, x);
+        print("  punpcklwd %s, %s\n", x, x);
+    }
+    if(ir->size == 8){
+        print("  punpcklqdq %s, %s\n", x, x);
+    } else {
+        print("  pshufd %s, %s, 0\n", x, x);
     }
-    freeReg(s2);
 }
 
-static SIZE_TYPE_ID get_size_type_id(Reg* reg)
+// ベクトルレジスタの要素をまとめて、tに格納する
+static void emit_vreduce(IR* ir){
+    long n = ir->s1->val;
+    IRCmd op = ir->s2->val;
+    char* x = xreg_name(n);
+    char* tmp = xreg_name(VREG_TMP);
+    if(use_avx2){
+        print("  vextracti128 %s, %s, 1\n", tmp, vreg_name(ir->s1));
+        emit_vop(op, ir->size, ir->is_unsigned, x, x, tmp);
+    }
+    emit_x("pshufd", tmp, x, "0x4e");
+    emit_vop(op, ir->size, ir->is_unsigned, x, x, tmp);
+    if(ir->size <= 4){
+        emit_x("pshufd", tmp, x, "0xb1");
+        emit_vop(op, ir->size, ir->is_unsigned, x, x, tmp);
+    }
+    if(ir->size == 1){
+        emit_vop(IR_VSHR, 4, true, tmp, x, "16");
+        emit_vop(op, ir->size, ir->is_unsigned, x, x, tmp);
+        emit_vop(IR_VSHR, 2, true, tmp, x, "8");
+        emit_vop(op, ir->size, ir->is_unsigned, x, x, tmp);
+    }
+
+    activateRegLhs(ir->t);
+    if(ir->size == 8){
+        emit_x("movq", ir->t->rreg, x, NULL);
+    } else if(ir->size == 4){
+        emit_x("movd", "eax", x, NULL);
+        print("  movsxd %s, eax\n", ir->t->rreg);
+    } else {
+        emit_x("movd", "eax", x, NULL);
+        print("  %s %s, al\n", ir->is_unsigned ? "movzx" : "movsx", ir->t->rreg);
+    }
+}
+
+static SIZE_TYPE_ID get_size_type_id(int size, bool is_unsigned)
 {
     SIZE_TYPE_ID id = 0;
-    switch(reg->size){
+    switch(size){
         case 1:
-            id = reg->is_unsigned ? u8 : i8;
+            id = is_unsigned ? u8 : i8;
             break;
         case 2:
-            id = reg->is_unsigned ? u16 : i16;
+            id = is_unsigned ? u16 : i16;
             break;
         case 4:
-            id = reg->is_unsigned ? u32 : i32;
+            id = is_unsigned ? u32 : i32;
             break;
         case 8:
-            id = reg->is_unsigned ? u64 : i64;
+            id = is_unsigned ? u64 : i64;
             break;
         default:
             id = ierr;
@@ -300,10 +621,21 @@ static SIZE_TYPE_ID get_size_type_id(Reg* reg)
     return id;
 }
 
+// キャストで値の変換が必要かどうか
+bool need_cast(int src_size, bool src_unsigned, int dst_size, bool dst_unsigned){
+    SIZE_TYPE_ID dst_id = get_size_type_id(dst_size, dst_unsigned);
+    SIZE_TYPE_ID src_id = get_size_type_id(src_size, src_unsigned);
+    if(dst_id == ierr || src_id == ierr){
+        error("invalid cast\n");
+    }
+    return cast_table[src_id][dst_id] != NO_NEED;
+}
+
 static void gen_cast_x86(Reg* t, Reg* s1, CAST_CMD cmd){
     print("# cast st\n");
 
-    activateRegRhs(s1);
+    // 部分レジスタを参照するので、直値もレジスタに載せる
+    activateReg(s1, s1->kind == REG_IMM);
     activateRegLhs(t);
 
     switch(cmd){
@@ -349,7 +681,6 @@ static void gen_cast_x86(Reg* t, Reg* s1, CAST_CMD cmd){
         default:
             error("invalid cast %d \n", cmd);
     }
-    freeReg(s1);
 }
 
 void gen_x86(){
@@ -386,35 +717,116 @@ void gen_x86(){
                     }
                 }
             }
+            if(opt_level){
+                peephole_begin();
+            }
+            plan_frame(ident);
             convert_ir2x86asm(ir);
+            if(opt_level){
+                peephole_end();
+            }
         }
         ident = ident->next;
     }
 }
 
 
+// 文字列リテラルは読み出し専用のセクションに置く
+// 途中に終端の0を含まなければ、リンカが同じ文字列をまとめられるセクションにする
+static void emit_string_literal(Ident* ident){
+    Token* tok = ident->tok;
+    bool has_nul = false;
+    for(int i = 0; i + 1 < tok->len; i++){
+        if(tok->pos[i] == '\\'){
+            char c = tok->pos[i + 1];
+            if(c == '0' || c == 'x'){
+                has_nul = true;
+            }
+            i++;
+        }
+    }
+    if(has_nul){
+        print("  .section .rodata\n");
+    } else {
+        print("  .section .rodata.str1.1,\"aMS\",@progbits,1\n");
+    }
+    print("%s:\n", ident->name);
+    print("  .string \"%s\"\n", get_token_string(tok));
+}
+
+// 書き換えない(constの)変数か
+static bool is_readonly(Type* ty){
+    while(ty->kind == TY_ARRAY){
+        ty = ty->ptr_to;
+    }
+    return ty->is_const;
+}
+
+// 静的な初期値を出力する
+// アドレスは.quadで置き、それ以外は揃っている位置から大きい単位でまとめる
+static void emit_init_data(Ident* ident){
+    char* data = ident->init_data;
+    int size = ident->type->size;
+    Reloc* reloc = ident->relocs;
+    int pos = 0;
+    while(pos < size){
+        if(reloc && reloc->offset == pos){
+            if(reloc->addend){
+                print("  .quad %s%+ld\n", sym_name(reloc->ident), reloc->addend);
+            } else {
+                print("  .quad %s\n", sym_name(reloc->ident));
+            }
+            pos += 8;
+            reloc = reloc->next;
+            continue;
+        }
+
+        int end = reloc ? reloc->offset : size;
+        int zero = pos;
+        while(zero < end && !data[zero]){
+            zero++;
+        }
+        if(zero - pos >= 8){
+            print("  .zero %d\n", zero - pos);
+            pos = zero;
+        } else if(pos % 8 == 0 && pos + 8 <= end){
+            unsigned long val;
+            memcpy(&val, data + pos, 8);
+            print("  .quad %lu\n", val);
+            pos += 8;
+        } else if(pos % 4 == 0 && pos + 4 <= end){
+            unsigned int val;
+            memcpy(&val, data + pos, 4);
+            print("  .long %u\n", val);
+            pos += 4;
+        } else if(pos % 2 == 0 && pos + 2 <= end){
+            unsigned short val;
+            memcpy(&val, data + pos, 2);
+            print("  .short %u\n", val);
+            pos += 2;
+        } else {
+            print("  .byte %u\n", (unsigned char)data[pos]);
+            pos += 1;
+        }
+    }
+}
+
 static void convert_ir2x86asm(IR* ir){
     while(ir){
+        if(ir->mem){
+            emit_mem_op(ir);
+            ir = ir->next;
+            continue;
+        }
         switch(ir->cmd){
             case IR_FN_LABEL:
                 print("  .text\n");
                 print("%s:\n", ir->s1->str);
-                push("rbp");
-                print("  mov rbp, rsp\n");
-                print("  sub rsp, %d\n", ((ir->s2->val + 15) / 16) * 16);
-                push("r12");
-                push("r13");
-                push("r14");
-                push("r15");
+                emit_prologue();
                 break;
             case IR_FN_END_LABEL:
                 print("ret_%s:\n", ir->s1->str);
-                pop("r15");
-                pop("r14");
-                pop("r13");
-                pop("r12");
-                print("  mov rsp, rbp\n");
-                pop("rbp");
+                emit_epilogue();
                 print("  ret\n");
                 break;
             case IR_VA_START:
@@ -465,6 +877,23 @@ static void convert_ir2x86asm(IR* ir){
                 print(".global %s\n", ir->s1->str);
                 break;
             case IR_STORE_ARG_REG:
+                if(ir->s1->kind == REG_REG){
+                    // 仮想レジスタに昇格した引数は、引数レジスタから直接読み込む
+                    activateRegLhs(ir->s1);
+                    int idx = ir->s2->val;
+                    if(ir->size == 1){
+                        print("  %s %s, %s\n", ir->is_unsigned ? "movzx" : "movsx", ir->s1->rreg, argreg8[idx]);
+                    } else if(ir->size == 2){
+                        print("  %s %s, %s\n", ir->is_unsigned ? "movzx" : "movsx", ir->s1->rreg, argreg16[idx]);
+                    } else if(ir->size == 4 && ir->is_unsigned){
+                        print("  mov %s, %s\n", rreg32[ir->s1->idx], argreg32[idx]);
+                    } else if(ir->size == 4){
+                        print("  movsxd %s, %s\n", ir->s1->rreg, argreg32[idx]);
+                    } else {
+                        print("  mov %s, %s\n", ir->s1->rreg, argreg64[idx]);
+                    }
+                    break;
+                }
 
                 if(ir->s1->ident->type->size == 1){
                     print("  mov [rbp - %d], %s\n", ir->s1->ident->offset, argreg8[ir->s2->val]);
@@ -477,9 +906,12 @@ static void convert_ir2x86asm(IR* ir){
                 }
                 break;
             case IR_LOAD_ARG_REG:
+                if(ir->s1->kind == REG_IMM){
+                    print("  mov %s, %lu\n", argreg64[ir->t->val], ir->s1->val);
+                    break;
+                }
                 activateRegLhs(ir->s1);
                 print("  mov %s, %s\n", argreg64[ir->t->val], ir->s1->rreg);
-                freeReg(ir->s1);
                 break;
             case IR_SET_FLOAT_NUM:
                 print("  mov eax, %d\n", '\0');
@@ -495,16 +927,24 @@ static void convert_ir2x86asm(IR* ir){
             {
                 Ident* ident = ir->s1->ident;
                 if(ident->is_string_literal){
-                    print("  .data\n");
-                    print("%s:\n", ident->name);
-                    print("  .string \"%s\"\n", get_token_string(ident->tok));
-                } else if(ident->is_static) {
-                    print("  .bss\n");
-                    print(".L%s:\n", ir->s1->ident->name);
-                    print("  .zero %d\n", ir->s2->val);
+                    emit_string_literal(ident);
+                } else if(ident->init_data) {
+                    // constの変数は読み出し専用のセクションに置く
+                    // アドレスを含むときは、再配置のあと読み出し専用になるセクションにする
+                    if(!is_readonly(ident->type)){
+                        print("  .data\n");
+                    } else if(ident->relocs){
+                        print("  .section .data.rel.ro,\"aw\"\n");
+                    } else {
+                        print("  .section .rodata\n");
+                    }
+                    print("  .align %d\n", ident->type->align > 1 ? ident->type->align : 1);
+                    print("%s:\n", sym_name(ident));
+                    emit_init_data(ident);
                 } else {
                     print("  .bss\n");
-                    print("%s:\n", ir->s1->ident->name);
+                    print("  .align %d\n", ident->type->align > 1 ? ident->type->align : 1);
+                    print("%s:\n", sym_name(ident));
                     print("  .zero %d\n", ir->s2->val);
                 }
                 break;
@@ -516,31 +956,16 @@ static void convert_ir2x86asm(IR* ir){
                 emit_binop("sub", ir->t, ir->s1, ir->s2);
                 break;
             case IR_MUL:
-                emit_binop("imul", ir->t, ir->s1, ir->s2);
+                emit_mul(ir);
+                break;
+            case IR_MULHI:
+                emit_mulhi(ir);
                 break;
             case IR_DIV:
-                activateRegLhs(ir->s1);
-
-                // idivが受け取るoperandはレジスタなので、
-                // 左辺値として割り当てる
-                activateRegLhs(ir->s2);
-                print("  mov rax, %s\n", ir->s1->rreg);
-                print("  cqo\n");
-                print("  idiv %s\n", ir->s2->rreg);
-                print("  mov %s, rax\n", ir->s1->rreg);
-                freeRegAll(ir->t, ir->s1, ir->s2);
+                emit_div(ir, "rax");
                 break;
             case IR_MOD:
-                activateRegLhs(ir->s1);
-
-                // idivが受け取るoperandはレジスタなので、
-                // 左辺値として割り当てる
-                activateRegLhs(ir->s2);
-                print("  mov rax, %s\n", ir->s1->rreg);
-                print("  cqo\n");
-                print("  idiv %s\n", ir->s2->rreg);
-                print("  mov %s, rdx\n", ir->s1->rreg);
-                freeRegAll(ir->t, ir->s1, ir->s2);
+                emit_div(ir, "rdx");
                 break;
             case IR_EQUAL:
                 activateRegLhs(ir->t);
@@ -552,7 +977,6 @@ static void convert_ir2x86asm(IR* ir){
                 print("  cmp %s, %s\n", ir->s1->rreg, ir->s2->rreg);
                 print("  sete al\n");
                 print("  movzb %s, al\n", ir->t->rreg);
-                freeRegAll(ir->t, ir->s1, ir->s2);
                 break;
             case IR_NOT_EQUAL:
                 activateRegLhs(ir->t);
@@ -561,27 +985,22 @@ static void convert_ir2x86asm(IR* ir){
                 print("  cmp %s, %s\n", ir->s1->rreg, ir->s2->rreg);
                 print("  setne al\n");
                 print("  movzb %s, al\n", ir->t->rreg);
-                freeRegAll(ir->t, ir->s1, ir->s2);
                 break;
             case IR_LT:
                 activateRegLhs(ir->t);
                 activateRegLhs(ir->s1);
                 activateRegRhs(ir->s2);
                 print("  cmp %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                print("  setl al\n");
+                print("  %s al\n", ir->is_unsigned ? "setb" : "setl");
                 print("  movzb %s, al\n", ir->t->rreg);
-                freeReg(ir->s1);
-                freeReg(ir->s2);
                 break;
             case IR_LE:
                 activateRegLhs(ir->t);
                 activateRegLhs(ir->s1);
                 activateRegRhs(ir->s2);
                 print("  cmp %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                print("  setle al\n");
+                print("  %s al\n", ir->is_unsigned ? "setbe" : "setle");
                 print("  movzb %s, al\n", ir->t->rreg);
-                freeReg(ir->s1);
-                freeReg(ir->s2);
                 break;
             case IR_BIT_AND:
                 emit_binop("and", ir->t, ir->s1, ir->s2);
@@ -593,52 +1012,31 @@ static void convert_ir2x86asm(IR* ir){
                 emit_binop("or", ir->t, ir->s1, ir->s2);
                 break;
             case IR_L_BIT_SHIFT:
-                activateRegLhs(ir->s1);
-                activateRegRhs(ir->s2);
-                if(ir->s2->kind == REG_IMM){
-                    print("  sal %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                } else {
-                    print("  mov rcx, %s\n", ir->s2->rreg);
-                    print("  sal %s, cl\n", ir->s1->rreg);
-                }
-                if(ir->s2->kind == REG_IMM){
-                    freeRegAll(ir->t, ir->s1, ir->s2);
-                }
+                emit_shift(ir, "sal");
                 break;
             case IR_R_BIT_SHIFT:
-                activateRegLhs(ir->s1);
-                activateRegRhs(ir->s2);
-                if(ir->s2->kind == REG_IMM){
-                    print("  sar %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                } else {
-                    print("  mov rcx, %s\n", ir->s2->rreg);
-                    print("  sar %s, cl\n", ir->s1->rreg);
-                }
-                if(ir->s2->kind == REG_IMM){
-                    freeRegAll(ir->t, ir->s1, ir->s2);
-                }
+                emit_shift(ir, ir->is_unsigned ? "shr" : "sar");
                 break;
             case IR_ASSIGN:
-                activateRegLhs(ir->s1);
+            {
+                char* mem = mem_operand(ir, ir->s1, ir->size);
                 activateRegLhs(ir->s2);
-                if(ir->s1->size == 1){
-                    print("  mov [%s], %s\n", ir->s1->rreg, rreg8[ir->s2->idx]);
-                } else if(ir->s1->size == 2){
-                    print("  mov [%s], %s\n", ir->s1->rreg, rreg16[ir->s2->idx]);
-                } else if(ir->s1->size == 4){
-                    print("  mov [%s], %s\n", ir->s1->rreg, rreg32[ir->s2->idx]);
-                } else if(ir->s1->size == 8){
-                    print("  mov [%s], %s\n", ir->s1->rreg, rreg64[ir->s2->idx]);
+                if(ir->size == 1){
+                    print("  mov %s, %s\n", mem, rreg8[ir->s2->idx]);
+                } else if(ir->size == 2){
+                    print("  mov %s, %s\n", mem, rreg16[ir->s2->idx]);
+                } else if(ir->size == 4){
+                    print("  mov %s, %s\n", mem, rreg32[ir->s2->idx]);
+                } else if(ir->size == 8){
+                    print("  mov %s, %s\n", mem, rreg64[ir->s2->idx]);
                 }
-                
 
                 if(ir->t){
                     activateRegLhs(ir->t);
                     print("  mov %s, %s\n", ir->t->rreg, ir->s2->rreg);
                 }
-                freeReg(ir->s2);
-                freeReg(ir->s1);
                 break;
+            }
             case IR_FN_CALL:
                 {
                     if(depth % 2){
@@ -652,22 +1050,27 @@ static void convert_ir2x86asm(IR* ir){
                     print("  mov %s, rax\n", ir->t->rreg);
                 }
                 break;
+            case IR_TAIL_CALL:
+            {
+                // 関数の途中なので、積んだ深さは変えない
+                int depth_buf = depth;
+                emit_epilogue();
+                depth = depth_buf;
+                print("  jmp %s\n", ir->s1->ident->name);
+                break;
+            }
             case IR_REL:
                 activateRegLhs(ir->t);
                 if(ir->s1->ident->kind == ID_LVAR){
                     print("  lea %s, [rbp - %d]\n", ir->t->rreg, ir->s1->ident->offset);
                 } else if(ir->s1->ident->kind == ID_GVAR){
-                    if(ir->s1->ident->is_static){
-                        print("  lea %s, [ rip + .L%s ]\n", ir->t->rreg, ir->s1->ident->name);
-                    } else {
-                        print("  lea %s, [ rip + %s ]\n", ir->t->rreg, ir->s1->ident->name);
-                    }
+                    print("  lea %s, [ rip + %s ]\n", ir->t->rreg, sym_name(ir->s1->ident));
                 }
                 break;
             case IR_CAST:
                 {
-                    SIZE_TYPE_ID dst_id = get_size_type_id(ir->t);
-                    SIZE_TYPE_ID src_id = get_size_type_id(ir->s1);
+                    SIZE_TYPE_ID dst_id = get_size_type_id(ir->size, ir->is_unsigned);
+                    SIZE_TYPE_ID src_id = get_size_type_id(ir->src_size, ir->src_unsigned);
 
                     if(dst_id == ierr || src_id == ierr){
                         error("invalid cast\n");
@@ -679,28 +1082,33 @@ static void convert_ir2x86asm(IR* ir){
                 break;
             case IR_MOV:
                 activateRegLhs(ir->s1);
+                if(ir->s2->kind == REG_IMM){
+                    print("  mov %s, %lu\n", ir->s1->rreg, ir->s2->val);
+                    break;
+                }
                 activateRegRhs(ir->s2);
                 print("  mov %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                freeRegAll(ir->t, ir->s1, ir->s2);
                 break;
-            case IR_COPY:
-            {
-                activateRegLhs(ir->t);
+            case IR_SPILL:
+                activateRegRhs(ir->s2);
+                if(debug_regis){
+                    print("# spill %s to [rbp - %lu]\n", ir->s2->rreg, ir->s1->val);
+                }
+                print("  mov QWORD PTR [rbp - %lu], %s\n", ir->s1->val, ir->s2->rreg);
+                break;
+            case IR_RELOAD:
                 activateRegLhs(ir->s1);
-                for(int i = 0; i < ir->s1->size; i++){
-                    // r8bレジスタにbyteデータコピー
-                    print("  mov r8b, BYTE PTR [%s + %d]\n", ir->s1->rreg, i);
-
-                    // r8bレジスタのデータをtのレジスタにコピー
-                    print("  mov BYTE PTR [%s + %d], r8b\n", ir->t->rreg, i);
+                if(debug_regis){
+                    print("# reload %s from [rbp - %lu]\n", ir->s1->rreg, ir->s2->val);
                 }
-                freeReg(ir->s1);
-            }
-            case IR_RELEASE_REG_ALL:
-                freeRegAllForce();
+                print("  mov %s, QWORD PTR [rbp - %lu]\n", ir->s1->rreg, ir->s2->val);
+                break;
+            case IR_COPY:
+                emit_copy(ir);
                 break;
+            case IR_RELEASE_REG_ALL:
             case IR_RELEASE_REG:
-                freeReg(ir->t);
+                // レジスタ割り当てで取り除いてある
                 break;
             case IR_LABEL:
                 print(".L%d:\n", ir->s1->val);
@@ -710,82 +1118,110 @@ static void convert_ir2x86asm(IR* ir){
                 //activateRegRhs(ir->s2);
                 print("  cmp %s, 0\n", ir->s1->rreg);
                 print("  jne .L%d\n", ir->s2->val);
-                freeRegAll(ir->t, ir->s1, ir->s2);
                 break;
             case IR_JZ:
                 activateRegLhs(ir->s1);
                 //activateRegRhs(ir->s2);
                 print("  cmp %s, 0\n", ir->s1->rreg);
                 print("  je .L%d\n", ir->s2->val);
-                freeRegAll(ir->t, ir->s1, ir->s2);
                 break;
             case IR_JE:
+            case IR_JNE:
+            case IR_JLT:
+            case IR_JLE:
+            case IR_JGT:
+            case IR_JGE:
                 activateRegLhs(ir->s1);
                 activateRegRhs(ir->s2);
                 print("  cmp %s, %s\n", ir->s1->rreg, ir->s2->rreg);
-                print("  je .L%d\n", ir->t->val);
-                freeReg(ir->s2);
+                print("  %s .L%d\n", jcc_name(ir), ir->t->val);
                 break;
             case IR_JMP:
                 print("  jmp .L%d\n", ir->s1->val);
                 break;
+            case IR_JTABLE:
+                // テーブルにはテーブルからの相対位置を置く
+                activateRegLhs(ir->s1);
+                print("  lea rax, [rip + .L%d]\n", ir->s2->val);
+                print("  movsxd r11, DWORD PTR [rax + %s * 4]\n", ir->s1->rreg);
+                print("  add rax, r11\n");
+                print("  jmp rax\n");
+                print("  .section .rodata\n");
+                print("  .align 4\n");
+                print(".L%d:\n", ir->s2->val);
+                for(int i = 0; i < ir->ntargets; i++){
+                    print("  .long .L%d - .L%d\n", ir->targets[i], ir->s2->val);
+                }
+                print("  .text\n");
+                break;
             case IR_LEA:
                 activateRegLhs(ir->s1);
                 activateRegRhs(ir->s2);
                 print("  lea %s, [rbp - %s]\n", ir->s1->rreg, ir->s2->rreg);
-                freeReg(ir->s2);
                 break;
             case IR_LOAD:
+            {
                 activateRegLhs(ir->s1);
-                activateRegRhs(ir->s2);
-                if(ir->s2->is_unsigned){
-                    if(ir->s2->size == 1){
-                        print("  movzx %s, BYTE PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    } else if(ir->s2->size == 2){
-                        print("  movzx %s, WORD PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    } else if(ir->s2->size == 4){
-                        print("  mov %s, DWORD PTR [%s]\n", rreg32[ir->s1->idx], ir->s2->rreg);
-                    } else if(ir->s2->size == 8){
-                        print("  mov %s, QWORD PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    }
-                } else {
-                    if(ir->s2->size == 1){
-                        print("  movsx %s, BYTE PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    } else if(ir->s2->size == 2){
-                        print("  movsx %s, WORD PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    } else if(ir->s2->size == 4){
-                        print("  movsxd %s, DWORD PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    } else if(ir->s2->size == 8){
-                        print("  mov %s, QWORD PTR [%s]\n", ir->s1->rreg, ir->s2->rreg);
-                    }
+                char* mem = mem_operand(ir, ir->s2, ir->size);
+                if(ir->size == 8){
+                    print("  mov %s, %s\n", ir->s1->rreg, mem);
+                } else if(ir->size == 4 && ir->is_unsigned){
+                    print("  mov %s, %s\n", rreg32[ir->s1->idx], mem);
+                } else if(ir->size == 4){
+                    print("  movsxd %s, %s\n", ir->s1->rreg, mem);
+                } else if(ir->size == 1 || ir->size == 2){
+                    print("  %s %s, %s\n", ir->is_unsigned ? "movzx" : "movsx", ir->s1->rreg, mem);
+                }
+                break;
+            }
+            case IR_ADDR:
+                activateRegLhs(ir->t);
+                print("  lea %s, %s\n", ir->t->rreg, mem_operand(ir, ir->s1, 0));
+                break;
+            case IR_VLOAD:
+                activateRegLhs(ir->s1);
+                print("  %s %s, [%s]\n", use_avx2 ? "vmovdqu" : "movdqu", vreg_name(ir->t), ir->s1->rreg);
+                break;
+            case IR_VSTORE:
+                activateRegLhs(ir->s1);
+                print("  %s [%s], %s\n", use_avx2 ? "vmovdqu" : "movdqu", ir->s1->rreg, vreg_name(ir->t));
+                break;
+            case IR_VBCAST:
+                emit_vbcast(ir);
+                break;
+            case IR_VADD:
+            case IR_VSUB:
+            case IR_VMUL:
+            case IR_VAND:
+            case IR_VOR:
+            case IR_VXOR:
+            case IR_VMIN:
+            case IR_VMAX:
+            case IR_VSAD:
+                emit_vop(ir->cmd, ir->size, ir->is_unsigned,
+                    vreg_name(ir->t), vreg_name(ir->s1), vreg_name(ir->s2));
+                break;
+            case IR_VSHL:
+            case IR_VSHR:
+                emit_vop(ir->cmd, ir->size, ir->is_unsigned,
+                    vreg_name(ir->t), vreg_name(ir->s1), format_string("%lu", ir->s2->val));
+                break;
+            case IR_VREDUCE:
+                emit_vreduce(ir);
+                break;
+            case IR_VEND:
+                if(use_avx2){
+                    print("  vzeroupper\n");
                 }
-                freeReg(ir->s2);
                 break;
             case IR_COMMENT:
                 print("#");
                 printline(ir->s1->tok);
-                if(debug_regis)
-                {
-                    print("#");
-                    int remreg = 6;
-                    for(int i = 0; i < 6; i++){
-                        if(realReg[i]){
-                            remreg--;
-                        }
-                    }
-                    print(" remain register num : %d\n", remreg);
-                }
-
                 break;
             default:
                 unreachable();
         }
         ir = ir->next;
-
-        // レジスタの使用状況をクリア
-        for(int i = 0; i < 3; i++){
-            useReg[i] = -1;
-        }
     }
 }
 
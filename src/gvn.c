@@ -0,0 +1,242 @@
+#include "mcc2.h"
+
+/*
+    値番号付けによる共通部分式の削除 (Global Value Numbering)
+
+    SSA形式の上で支配木を前順にたどり、同じ演算を同じオペランドで行う命令が
+    支配しているブロックにすでにあれば、その結果を使い回して命令を消す。
+        - 同じ変数のアドレス(IR_REL)
+        - 算術演算、比較、キャスト(アドレス計算を含む)
+        - メモリからの読み込み(IR_LOAD)
+    仮想レジスタどうしのコピー(IR_MOV)は、コピー元をそのまま使う。
+
+    読み込みは、間に同じ場所へ書き込むかもしれない命令があれば使い回さない。
+    書き込み先との重なりはアドレスの解析(alias.c)で判断する。
+    読み込みの結果は、ブロックの中と、先行ブロックがひとつだけのブロックへ持ち越す。
+*/
+
+static CFG* cfg;
+static Reg** replace;       // [vn] 代わりに使う仮想レジスタ
+static int removed;
+
+static IR** exprs;          // 支配しているブロックで計算済みの演算
+static int nexprs;
+static int exprs_cap;
+
+static IR** loads;          // 使い回せる読み込み
+static int nloads;
+static int loads_cap;
+
+static void visit(BasicBlock* bb, IR** in_loads, int nin);
+
+int gvn(CFG* target){
+    cfg = target;
+    compute_dominators(cfg);
+
+    int n = cfg->nregs;
+    replace = calloc(n, sizeof(Reg*));
+    nexprs = 0;
+    nloads = 0;
+    removed = 0;
+
+    analyze_addresses(cfg);
+    visit(cfg->blocks[0], NULL, 0);
+    return removed;
+}
+
+static Reg* resolve(Reg* reg){
+    if(is_vreg(reg) && reg->vn >= 0 && replace[reg->vn]){
+        return replace[reg->vn];
+    }
+    return reg;
+}
+
+static bool same_operand(Reg* a, Reg* b){
+    if(a == b){
+        return true;
+    }
+    return a && b && a->kind == REG_IMM && b->kind == REG_IMM && a->val == b->val;
+}
+
+static bool is_commutative(IRCmd cmd){
+    switch(cmd){
+        case IR_ADD:
+        case IR_MUL:
+        case IR_MULHI:
+        case IR_BIT_AND:
+        case IR_BIT_XOR:
+        case IR_BIT_OR:
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 値だけで結果が決まる命令か
+static bool is_value_expr(IR* ir){
+    if(is_binop(ir->cmd)){
+        return ir->t != NULL;
+    }
+    switch(ir->cmd){
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_CAST:
+        case IR_REL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool same_expr(IR* a, IR* b){
+    if(a->cmd != b->cmd || a->size != b->size || a->is_unsigned != b->is_unsigned
+        || a->src_size != b->src_size || a->src_unsigned != b->src_unsigned){
+        return false;
+    }
+    switch(a->cmd){
+        case IR_REL:
+            return a->s1->ident == b->s1->ident;
+        case IR_LOAD:
+            return same_operand(a->s2, b->s2);
+        case IR_CAST:
+            return same_operand(a->s1, b->s1);
+        default:
+            break;
+    }
+    if(same_operand(a->s1, b->s1) && same_operand(a->s2, b->s2)){
+        return true;
+    }
+    return is_commutative(a->cmd) && same_operand(a->s1, b->s2) && same_operand(a->s2, b->s1);
+}
+
+// 命令を前に計算した結果で置き換えられれば置き換えて、trueを返す
+static bool reuse(BasicBlock* bb, IR* ir, IR** list, int n){
+    for(int i = n - 1; i >= 0; i--){
+        if(same_expr(list[i], ir)){
+            replace[(*ir_def_slot(ir))->vn] = *ir_def_slot(list[i]);
+            remove_ir(bb, ir);
+            removed++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void kill_loads(Ident* store, bool is_call){
+    int n = 0;
+    for(int i = 0; i < nloads; i++){
+        if(!may_clobber(loads[i]->s2, store, is_call)){
+            loads[n++] = loads[i];
+        }
+    }
+    nloads = n;
+}
+
+static void push_expr(IR* ir){
+    if(nexprs == exprs_cap){
+        exprs_cap = exprs_cap ? exprs_cap * 2 : 64;
+        exprs = realloc(exprs, sizeof(IR*) * exprs_cap);
+    }
+    exprs[nexprs++] = ir;
+}
+
+static void push_load(IR* ir){
+    if(nloads == loads_cap){
+        loads_cap = loads_cap ? loads_cap * 2 : 64;
+        loads = realloc(loads, sizeof(IR*) * loads_cap);
+    }
+    loads[nloads++] = ir;
+}
+
+static void visit(BasicBlock* bb, IR** in_loads, int nin){
+    int saved_nexprs = nexprs;
+    nloads = 0;
+    for(int i = 0; i < nin; i++){
+        push_load(in_loads[i]);
+    }
+
+    IR* next = NULL;
+    for(IR* ir = bb->ir; ir; ir = next){
+        next = ir->next;
+
+        // 解放命令は消した仮想レジスタを指したままにして、不要命令の削除で消す
+        if(ir->cmd != IR_PHI && ir->cmd != IR_RELEASE_REG){
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int i = 0; i < nuse; i++){
+                *slots[i] = resolve(*slots[i]);
+            }
+        }
+
+        switch(ir->cmd){
+            case IR_MOV:
+                if(is_vreg(ir->s1) && is_vreg(ir->s2)){
+                    replace[ir->s1->vn] = ir->s2;
+                    remove_ir(bb, ir);
+                    removed++;
+                }
+                break;
+            case IR_ASSIGN:
+                if(ir->t && is_vreg(ir->t) && is_vreg(ir->s2)){
+                    replace[ir->t->vn] = ir->s2;
+                    ir->t = NULL;
+                }
+                kill_loads(addr_base(ir->s1), false);
+                break;
+            case IR_COPY:
+                kill_loads(addr_base(ir->t), false);
+                break;
+            case IR_VSTORE:
+                kill_loads(addr_base(ir->s1), false);
+                break;
+            case IR_STORE_ARG_REG:
+                kill_loads(ir->s1->ident, false);
+                break;
+            case IR_FN_CALL:
+                kill_loads(NULL, true);
+                break;
+            case IR_VA_START:
+                nloads = 0;
+                break;
+            case IR_LOAD:
+                if(is_vreg(ir->s1) && !reuse(bb, ir, loads, nloads)){
+                    push_load(ir);
+                }
+                break;
+            default:
+                if(is_value_expr(ir) && is_vreg(*ir_def_slot(ir))
+                    && !reuse(bb, ir, exprs, nexprs)){
+                    push_expr(ir);
+                }
+                break;
+        }
+    }
+
+    // 後続ブロックのphiの引数も置き換える
+    for(int i = 0; i < bb->nsuccs; i++){
+        BasicBlock* succ = bb->succs[i];
+        int pidx = 0;
+        while(succ->preds[pidx] != bb) pidx++;
+        for(IR* ir = succ->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                ir->phi_args[pidx] = resolve(ir->phi_args[pidx]);
+            }
+        }
+    }
+
+    IR** out = calloc(nloads + 1, sizeof(IR*));
+    int nout = nloads;
+    memcpy(out, loads, sizeof(IR*) * nloads);
+    for(BasicBlock* child = bb->dom_child; child; child = child->dom_sibling){
+        if(child->npreds == 1){
+            visit(child, out, nout);
+        } else {
+            visit(child, NULL, 0);
+        }
+    }
+    nexprs = saved_nexprs;
+}
@@ -6,6 +6,7 @@ static Scope* func_scope = NULL;
 static int stack_size = 0;
 
 static int string_literal_num = 0;
+static int static_local_num = 0;
 
 
 
@@ -13,11 +14,7 @@ Ident* declare_ident(Token* tok, IdentKind kind, Type* ty){
     Ident* ident = calloc(1, sizeof(Ident));
 
     if((ident->kind == ID_LVAR) && (cur_scope->level != 0)){
-        if(ty->kind == TY_ARRAY){
-            stack_size += ty->size * ty->array_len;    
-        } else {
-            stack_size += ty->size;
-        }
+        stack_size = align_to(stack_size + ty->size, ty->align);
     }
 
     ident->kind = kind;
@@ -48,11 +45,8 @@ void register_ident(Ident* ident){
     Type* ty = ident->type;
     if((ident->kind == ID_LVAR) && (cur_scope->level != 0)){
         if(!ident->is_extern){
-            if(ty->kind == TY_ARRAY){
-                stack_size += ty->size * ty->array_len;
-            } else {
-                stack_size += ty->size;
-            }
+            // 変数の先頭(rbp - offset)が型のアラインメントに揃うようにする
+            stack_size = align_to(stack_size + ty->size, ty->align);
         }
     }
 
@@ -68,8 +62,15 @@ void register_tag(Type* type){
 }
 
 Ident* register_string_literal(Token* tok){
+    // 翻訳単位の中で同じ内容のリテラルは1つにまとめる
+    for(StringLiteral* sl = global_scope.string_literal; sl; sl = sl->next){
+        if(sl->val->len == tok->len && memcmp(sl->val->pos, tok->pos, tok->len) == 0){
+            return sl->ident;
+        }
+    }
+
     StringLiteral* sl = calloc(1, sizeof(StringLiteral));
-    sl->name = calloc(1, sizeof(20));
+    sl->name = calloc(1, 20);
     sprintf(sl->name, ".LSTR%d", string_literal_num++);
     sl->val = tok;
 
@@ -82,7 +83,27 @@ Ident* register_string_literal(Token* tok){
     ident->tok = sl->val;
     ident->is_string_literal = 1;
     ident->type = array_of(ty_char, sl->val->len + 1);
+    sl->ident = ident;
+
+    ident->next = global_scope.ident;
+    global_scope.ident = ident;
+    return ident;
+}
+
+// 関数の中のstatic変数は、名前を変えたグローバル変数として登録する
+// 関数の中からは元の名前で見つかるように、実体を指す識別子をスコープに置く
+Ident* register_static_local(Ident* ident){
+    Ident* alias = calloc(1, sizeof(Ident));
+    alias->kind = ID_GVAR;
+    alias->name = ident->name;
+    alias->tok = ident->tok;
+    alias->type = ident->type;
+    alias->real = ident;
+    alias->next = cur_scope->ident;
+    cur_scope->ident = alias;
 
+    ident->kind = ID_GVAR;
+    ident->name = format_string("%s.%d", ident->name, static_local_num++);
     ident->next = global_scope.ident;
     global_scope.ident = ident;
     return ident;
@@ -111,7 +132,7 @@ Ident* find_ident(Token* tok){
             Token* lhs = tok;
             if((lhs->len == strlen(id->name))
                     && (!memcmp(lhs->pos, id->name, lhs->len))){
-                return id;
+                return id->real ? id->real : id;
             }
         }
     }
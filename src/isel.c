@@ -0,0 +1,406 @@
+#include "mcc2.h"
+
+/*
+    命令選択 (アドレッシングモード)
+
+    SSA形式の最後に、読み書きするアドレスを作る命令をx86-64のメモリオペランド
+        [base + index * scale + disp]   (scaleは1,2,4,8。dispは32bitに収まる定数)
+        [rbp + index * scale - ofs]     (ローカル変数)
+        [rip + name + disp]             (グローバル変数。添字は使えない)
+    にまとめる。
+        load/assign   アドレスを作る加算、定数の加算・減算、1〜3の左シフト、ローカル変数・
+                      グローバル変数のアドレス(rel)をメモリオペランドにたどる
+        add           添字のシフトやrelをたどれる加算は、leaで計算する(IR_ADDR)
+        演算・比較    8byteの読み込みの結果を一度だけ使う add/sub/imul/and/or/xor と比較は、
+                      読み込みを演算のオペランドにする (add r, QWORD PTR [...])
+                      0との比較(jz/jnz)と定数との一致の比較は、読み込みの大きさのまま比較する
+    たどった命令がほかで使われなければ、dce()で消える。
+    たどった数は --stats の isel_folded、演算に入れた読み込みの数は isel_fused_loads で確認できる。
+*/
+
+typedef struct Addr {
+    Reg*    base;
+    Reg*    index;
+    int     scale;
+    long    disp;
+    Ident*  sym;
+    int     folded;     // たどった命令の数
+} Addr;
+
+static IR** def;
+static int* nuses;
+static int folded;
+static int fused;
+
+static bool fits_int(long v){
+    return v == (int)v;
+}
+
+static IR* def_of(Reg* reg){
+    return is_vreg(reg) ? def[reg->vn] : NULL;
+}
+
+// 1,2,4,8倍の添字なら、元の値とscaleを返す
+static Reg* match_scale(Reg* reg, int* scale){
+    IR* d = def_of(reg);
+    *scale = 1;
+    if(!d || !is_vreg(d->s1) || !d->s2 || d->s2->kind != REG_IMM){
+        return reg;
+    }
+    if(d->cmd == IR_L_BIT_SHIFT && d->s2->val >= 1 && d->s2->val <= 3){
+        *scale = 1 << d->s2->val;
+        return d->s1;
+    }
+    if(d->cmd == IR_MUL && (d->s2->val == 2 || d->s2->val == 4 || d->s2->val == 8)){
+        *scale = d->s2->val;
+        return d->s1;
+    }
+    return reg;
+}
+
+// regの値をアドレスとして、できるだけ多くの命令をたどってaに入れる
+static void match_addr(Reg* reg, Addr* a){
+    a->base = reg;
+    a->index = NULL;
+    a->scale = 0;
+    a->disp = 0;
+    a->sym = NULL;
+    a->folded = 0;
+
+    while(a->base){
+        IR* d = def_of(a->base);
+        if(!d){
+            break;
+        }
+        Reg* x = d->s1;
+        Reg* y = d->s2;
+        if(d->cmd == IR_ADD || d->cmd == IR_SUB){
+            if(y->kind == REG_IMM && is_vreg(x)){
+                long disp = d->cmd == IR_ADD ? a->disp + (long)y->val : a->disp - (long)y->val;
+                if(!fits_int(disp)){
+                    break;
+                }
+                a->base = x;
+                a->disp = disp;
+                a->folded++;
+                continue;
+            }
+            if(d->cmd == IR_ADD && x->kind == REG_IMM && is_vreg(y) && fits_int(a->disp + (long)x->val)){
+                a->base = y;
+                a->disp += x->val;
+                a->folded++;
+                continue;
+            }
+            if(d->cmd == IR_ADD && !a->index && is_vreg(x) && is_vreg(y)){
+                // シフトしているほうを添字にする
+                int scale;
+                Reg* idx = match_scale(y, &scale);
+                if(scale == 1){
+                    idx = match_scale(x, &scale);
+                    if(scale != 1){
+                        x = y;
+                    } else {
+                        idx = y;
+                    }
+                }
+                a->folded += scale == 1 ? 1 : 2;
+                a->base = x;
+                a->index = idx;
+                a->scale = scale;
+                continue;
+            }
+            break;
+        }
+        if(d->cmd == IR_REL){
+            Ident* sym = x->ident;
+            if(sym->kind == ID_GVAR && a->index){
+                break;
+            }
+            if(sym->kind != ID_LVAR && sym->kind != ID_GVAR){
+                break;
+            }
+            a->sym = sym;
+            a->base = NULL;
+            a->folded++;
+            break;
+        }
+        break;
+    }
+
+    // 添字に定数を足しているなら、定数はdispにする
+    while(a->index){
+        IR* d = def_of(a->index);
+        if(!d || d->cmd != IR_ADD || !d->s2 || d->s2->kind != REG_IMM || !is_vreg(d->s1)){
+            break;
+        }
+        long disp = a->disp + (long)d->s2->val * a->scale;
+        if(!fits_int(disp)){
+            break;
+        }
+        a->index = d->s1;
+        a->disp = disp;
+        a->folded++;
+    }
+}
+
+static void set_mem(IR* ir, Addr* a){
+    ir->index = a->index;
+    ir->scale = a->scale;
+    ir->disp = a->disp;
+    ir->sym = a->sym;
+}
+
+// 読み書きのアドレスをメモリオペランドにする
+static void select_address(IR* ir, Reg** addr){
+    Addr a;
+    match_addr(*addr, &a);
+    if(a.folded == 0){
+        return;
+    }
+    *addr = a.base;
+    set_mem(ir, &a);
+    folded += a.folded;
+}
+
+// 加算で作るアドレスを、leaで計算する
+static void select_lea(IR* ir){
+    if(!is_vreg(ir->t)){
+        return;
+    }
+    Addr a;
+    match_addr(ir->t, &a);
+    // 加算そのものの分を除いて、ほかにたどれた命令がなければ、加算のままでよい
+    if(a.folded < 2){
+        return;
+    }
+    ir->cmd = IR_ADDR;
+    ir->s1 = a.base;
+    ir->s2 = NULL;
+    set_mem(ir, &a);
+    folded += a.folded - 1;
+}
+
+static bool is_commutative(IRCmd cmd){
+    return cmd == IR_ADD || cmd == IR_MUL || cmd == IR_BIT_AND || cmd == IR_BIT_OR || cmd == IR_BIT_XOR;
+}
+
+// 比較の向きを入れ替えた命令
+static IRCmd swap_compare(IRCmd cmd){
+    switch(cmd){
+        case IR_JLT: return IR_JGT;
+        case IR_JLE: return IR_JGE;
+        case IR_JGT: return IR_JLT;
+        case IR_JGE: return IR_JLE;
+        default: return cmd;
+    }
+}
+
+// 読み込みの大きさの型で表せる定数か
+static bool fits_load(IR* load, Reg* imm){
+    if(load->size == 8){
+        return fits_int(imm->val);
+    }
+    long v = imm->val;
+    int bits = load->size * 8;
+    if(load->is_unsigned){
+        return 0 <= v && v < (1L << bits);
+    }
+    return -(1L << (bits - 1)) <= v && v < (1L << (bits - 1));
+}
+
+// 読み込みの結果をuseのどのオペランドにできるかを返す (1: s1, 2: s2, 0: できない)
+static int fusable_operand(IR* load, IR* use){
+    Reg* val = load->s1;
+    switch(use->cmd){
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_BIT_AND:
+        case IR_BIT_OR:
+        case IR_BIT_XOR:
+            if(load->size != 8 || use->s1 == use->s2){
+                return 0;
+            }
+            if(use->s2 == val){
+                return 2;
+            }
+            if(use->s1 == val && is_commutative(use->cmd) && use->s2->kind != REG_IMM){
+                use->s1 = use->s2;
+                use->s2 = val;
+                return 2;
+            }
+            return 0;
+        case IR_JZ:
+        case IR_JNZ:
+            return 1;
+        case IR_JE:
+        case IR_JNE:
+        case IR_JLT:
+        case IR_JLE:
+        case IR_JGT:
+        case IR_JGE:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+            if(use->s1 == use->s2){
+                return 0;
+            }
+            if(use->s1 == val && use->s2->kind == REG_IMM){
+                // 一致の比較は大きさによらず、読み込みの大きさのまま比べられる
+                bool eq = use->cmd == IR_JE || use->cmd == IR_JNE || use->cmd == IR_NOT_EQUAL;
+                return (load->size == 8 || eq) && fits_load(load, use->s2) ? 1 : 0;
+            }
+            if(load->size != 8){
+                return 0;
+            }
+            if(use->s2 == val){
+                return 2;
+            }
+            if(use->s1 == val && use->cmd != IR_LT && use->cmd != IR_LE){
+                use->s1 = use->s2;
+                use->s2 = val;
+                use->cmd = swap_compare(use->cmd);
+                return 2;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+// 読み込みと、その結果を使う命令の間に、読み込む場所を変えるかもしれない命令がないか
+static bool is_pure_between(IR* ir){
+    if(is_binop(ir->cmd)){
+        return true;
+    }
+    switch(ir->cmd){
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_CAST:
+        case IR_REL:
+        case IR_MOV:
+        case IR_LOAD:
+        case IR_ADDR:
+        case IR_COMMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 一度だけ使われる読み込みを、同じブロックの後ろの演算のオペランドにする
+static void fuse_load(BasicBlock* bb, IR* load){
+    if(!is_vreg(load->s1) || nuses[load->s1->vn] != 1 || (load->s2 && !is_vreg(load->s2))){
+        return;
+    }
+    for(IR* use = load->next; use; use = use->next){
+        Reg** slots[MAX_IR_OPERANDS];
+        int nuse = ir_use_slots(use, slots);
+        bool uses_val = false;
+        for(int i = 0; i < nuse; i++){
+            uses_val |= *slots[i] == load->s1;
+        }
+        if(!uses_val){
+            if(!is_pure_between(use)){
+                return;
+            }
+            continue;
+        }
+
+        if(use->mem){
+            return;
+        }
+        int opnd = fusable_operand(load, use);
+        if(!opnd){
+            return;
+        }
+        use->mem = opnd;
+        use->mem_size = load->size;
+        if(opnd == 1){
+            use->s1 = load->s2;
+        } else {
+            use->s2 = load->s2;
+        }
+        use->index = load->index;
+        use->scale = load->scale;
+        use->disp = load->disp;
+        use->sym = load->sym;
+        remove_ir(bb, load);
+        fused++;
+        return;
+    }
+}
+
+// 定義している命令と、使われている数を数えなおす
+static void count_uses(CFG* cfg){
+    int n = cfg->nregs;
+    def = calloc(n, sizeof(IR*));
+    nuses = calloc(n, sizeof(int));
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                def[(*d)->vn] = ir;
+            }
+            if(ir->cmd == IR_PHI){
+                for(int j = 0; j < bb->npreds; j++){
+                    if(is_vreg(ir->phi_args[j])){
+                        nuses[ir->phi_args[j]->vn]++;
+                    }
+                }
+                continue;
+            }
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int j = 0; j < nuse; j++){
+                nuses[(*slots[j])->vn]++;
+            }
+        }
+    }
+}
+
+int isel(CFG* cfg){
+    folded = 0;
+    fused = 0;
+
+    count_uses(cfg);
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_LOAD){
+                select_address(ir, &ir->s2);
+            } else if(ir->cmd == IR_ASSIGN){
+                select_address(ir, &ir->s1);
+            }
+        }
+    }
+    // メモリオペランドにしたアドレスの計算を消してから、残った加算を調べる
+    dce(cfg);
+
+    count_uses(cfg);
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_ADD){
+                select_lea(ir);
+            }
+        }
+    }
+    dce(cfg);
+
+    count_uses(cfg);
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+            if(ir->cmd == IR_LOAD){
+                fuse_load(bb, ir);
+            }
+        }
+    }
+
+    add_stat("isel_fused_loads", fused);
+    return folded;
+}
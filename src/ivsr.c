@@ -0,0 +1,426 @@
+#include "mcc2.h"
+
+/*
+    誘導変数の強度低減 (Induction Variable Strength Reduction)
+
+    SSA形式の上で、ループのたびに一定の数だけ増える変数(誘導変数)を見つけ、
+    その変数から計算している配列の要素のアドレスを、要素の大きさずつ増やす
+    ポインタに置き換える。
+        i = phi(init, i')   i' = i + c   (intのときは i' = cast(i + c))
+        a = base + i * s                 -> p = phi(base + init * s, p')
+                                            p' = p + c * s
+    ループの中で値が変わらないbaseに、定数倍した誘導変数を足したものが対象になる。
+    intの誘導変数の桁あふれは未定義動作なので、あふれないものとして扱う。
+
+    展開したループでは i + 1, i + 2, ... と加算がつながるので、
+    誘導変数に定数を足した値もたどり、そのアドレスは p + k * s にする。
+        i1 = i + 1   a1 = base + i1 * s             -> a1 = p + s
+
+    ループの条件が誘導変数と不変な値の比較なら、置き換えたポインタと
+    base + n * s の比較に書き換える(Linear Function Test Replacement)。
+    これで誘導変数がアドレスの計算にしか使われていなければ、
+    不要命令の削除で誘導変数ごと消える。
+*/
+
+static CFG* cfg;
+static IR** def_ir;         // [vn] 定義している命令
+static int* def_bb;         // [vn] 定義しているブロックのid
+static int ndefs;
+static int reduced;
+
+// 基本誘導変数 : phi = phi(init, next)、next = phi + step
+typedef struct IndVar {
+    IR*     phi;
+    Reg*    init;
+    IR*     inc;        // 加算の命令。ポインタの加算はこの後ろに置く
+    long    step;
+} IndVar;
+
+static void collect_defs(){
+    ndefs = cfg->nregs;
+    def_ir = calloc(ndefs + 1, sizeof(IR*));
+    def_bb = calloc(ndefs + 1, sizeof(int));
+    for(int i = 0; i < ndefs; i++){
+        def_bb[i] = -1;
+    }
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                def_ir[(*d)->vn] = ir;
+                def_bb[(*d)->vn] = bb->id;
+            }
+        }
+    }
+}
+
+static IR* def_of(Reg* reg){
+    if(!is_vreg(reg) || reg->vn >= ndefs){
+        return NULL;
+    }
+    return def_ir[reg->vn];
+}
+
+static bool in_loop(Loop* loop, Reg* reg){
+    return is_vreg(reg) && reg->vn < ndefs && def_bb[reg->vn] >= 0
+        && loop->contains[def_bb[reg->vn]];
+}
+
+static bool is_imm(Reg* reg){
+    return reg->kind == REG_IMM;
+}
+
+// 値を変えないキャスト(符号付きの値を8byteに広げるもの)か
+static bool is_widening(IR* ir){
+    return ir && ir->cmd == IR_CAST && ir->size == 8
+        && (ir->src_size == 8 || !ir->src_unsigned);
+}
+
+// regが phi + off の値ならtrueを返す。intの加算の結果は符号付きの4byteにキャストしている
+static bool iv_offset(Reg* reg, Reg* phi, long* off){
+    *off = 0;
+    for(int depth = 0; depth < 256; depth++){
+        if(reg == phi){
+            return true;
+        }
+        IR* ir = def_of(reg);
+        if(!ir){
+            return false;
+        }
+        if(ir->cmd == IR_CAST && ir->size == 4 && !ir->is_unsigned){
+            reg = ir->s1;
+        } else if(ir->cmd == IR_ADD && ir->t && is_imm(ir->s2)){
+            *off += ir->s2->val;
+            reg = ir->s1;
+        } else if(ir->cmd == IR_ADD && ir->t && is_imm(ir->s1)){
+            *off += ir->s1->val;
+            reg = ir->s2;
+        } else if(ir->cmd == IR_SUB && ir->t && is_imm(ir->s2)){
+            *off -= (long)ir->s2->val;
+            reg = ir->s1;
+        } else {
+            return false;
+        }
+    }
+    return false;
+}
+
+// next が phi + step の形なら、最後の加算の命令を返す
+static IR* match_increment(Reg* next, Reg* phi, long* step){
+    if(!iv_offset(next, phi, step) || *step == 0){
+        return NULL;
+    }
+    IR* ir = def_of(next);
+    if(ir->cmd == IR_CAST){
+        ir = def_of(ir->s1);
+    }
+    return ir;
+}
+
+// regが (iv + off) の値ならtrueを返す。8byteに広げたものも含む
+static bool iv_value(Reg* reg, IndVar* iv, long* off){
+    IR* ir = def_of(reg);
+    if(is_widening(ir)){
+        reg = ir->s1;
+    }
+    return iv_offset(reg, iv->phi->t, off);
+}
+
+// regが (iv + off) * s の値なら、sを返す。そうでなければ0を返す
+static long scale_of(Reg* reg, IndVar* iv, long* off){
+    if(iv_value(reg, iv, off)){
+        return 1;
+    }
+    IR* ir = def_of(reg);
+    if(!ir || (ir->cmd != IR_L_BIT_SHIFT && ir->cmd != IR_MUL)){
+        return 0;
+    }
+    if(!ir->t || !is_imm(ir->s2) || !iv_value(ir->s1, iv, off)){
+        return 0;
+    }
+    long s = ir->s2->val;
+    if(ir->cmd == IR_L_BIT_SHIFT){
+        return s >= 0 && s < 16 ? 1L << s : 0;
+    }
+    return s > 0 && s < 65536 ? s : 0;
+}
+
+static Reg* emit(BasicBlock* bb, IRCmd cmd, Reg* base, Reg* s1, Reg* s2){
+    Reg* t = cfg_new_reg(cfg, base);
+    insert_before_terminator(bb, make_IR(cmd, t, s1, s2));
+    return t;
+}
+
+// プリヘッダで base + val * s を計算する
+static Reg* emit_offset(Loop* loop, Reg* like, Reg* base, Reg* val, long s){
+    if(is_imm(val)){
+        if(val->val * s == 0){
+            return base;
+        }
+        return emit(loop->preheader, IR_ADD, like, base, new_RegImm(val->val * s));
+    }
+    Reg* off = val;
+    if(s != 1){
+        int k = 0;
+        while((1L << k) < s) k++;
+        if((1L << k) == s){
+            off = emit(loop->preheader, IR_L_BIT_SHIFT, like, val, new_RegImm(k));
+        } else {
+            off = emit(loop->preheader, IR_MUL, like, val, new_RegImm(s));
+        }
+    }
+    return emit(loop->preheader, IR_ADD, like, base, off);
+}
+
+// ループの外で使えるbaseを返す。ループの中で計算したアドレスは、プリヘッダで計算しなおす
+static Reg* invariant_base(Loop* loop, Reg* reg){
+    if(!is_vreg(reg)){
+        return NULL;
+    }
+    if(!in_loop(loop, reg)){
+        return reg;
+    }
+    IR* ir = def_of(reg);
+    if(ir->cmd != IR_REL){
+        return NULL;
+    }
+    Reg* t = cfg_new_reg(cfg, reg);
+    insert_before_terminator(loop->preheader, make_IR(IR_REL, t, ir->s1, NULL));
+    return t;
+}
+
+static void replace_uses(Reg* from, Reg* to){
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                for(int j = 0; j < bb->npreds; j++){
+                    if(ir->phi_args[j] == from) ir->phi_args[j] = to;
+                }
+                continue;
+            }
+            Reg** slots[MAX_IR_OPERANDS];
+            int n = ir_use_slots(ir, slots);
+            for(int j = 0; j < n; j++){
+                if(*slots[j] == from) *slots[j] = to;
+            }
+        }
+    }
+}
+
+// ループの条件 iv + k < n を、ポインタどうしの比較 p + k * s < base + n * s に書き換える
+static void replace_test(Loop* loop, IndVar* iv, Reg* ptr, Reg* base, long s){
+    for(int i = 0; i < loop->nbody; i++){
+        for(IR* ir = loop->body[i]->ir; ir; ir = ir->next){
+            bool is_cmp = is_cmp_jump(ir->cmd)
+                || ((ir->cmd == IR_LT || ir->cmd == IR_LE || ir->cmd == IR_EQUAL
+                    || ir->cmd == IR_NOT_EQUAL) && ir->t);
+            if(!is_cmp || ir->is_unsigned){
+                continue;
+            }
+            Reg** limit = NULL;
+            Reg** var = NULL;
+            long off = 0;
+            if(is_vreg(ir->s1) && iv_offset(ir->s1, iv->phi->t, &off)){
+                var = &ir->s1;
+                limit = &ir->s2;
+            } else if(is_vreg(ir->s2) && iv_offset(ir->s2, iv->phi->t, &off)){
+                var = &ir->s2;
+                limit = &ir->s1;
+            }
+            if(!var || (!is_imm(*limit) && in_loop(loop, *limit))){
+                continue;
+            }
+            if(!is_imm(*limit) && !is_vreg(*limit)){
+                continue;
+            }
+            *limit = emit_offset(loop, ptr, base, *limit, s);
+            if(off){
+                // ポインタに足すのは、比較する値を計算したところ
+                Reg* t = cfg_new_reg(cfg, ptr);
+                insert_ir_after(def_of(*var), make_IR(IR_ADD, t, ptr, new_RegImm(off * s)));
+                *var = t;
+            } else {
+                *var = ptr;
+            }
+        }
+    }
+}
+
+// ふたつのbaseが同じアドレスか
+static bool same_base(Reg* a, Reg* b){
+    if(a == b){
+        return true;
+    }
+    IR* da = def_of(a);
+    IR* db = def_of(b);
+    return da && db && da->cmd == IR_REL && db->cmd == IR_REL
+        && da->s1->ident == db->s1->ident;
+}
+
+// 置き換えたポインタ。baseとsが同じアドレスは、同じポインタからの距離で表す
+typedef struct IndPtr {
+    Reg*    base;       // 置き換える前のbase
+    Reg*    ptr;
+    long    scale;
+} IndPtr;
+
+static void reduce_iv(Loop* loop, IndVar* iv, int pre, int latch){
+    IndPtr ptrs[16];
+    int nptrs = 0;
+    Reg* first_base = NULL;
+
+    for(int i = 0; i < loop->nbody; i++){
+        BasicBlock* bb = loop->body[i];
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+            if(ir->cmd != IR_ADD || !ir->t){
+                continue;
+            }
+            long off = 0;
+            long unused = 0;
+            Reg* b = ir->s1;
+            long s = scale_of(ir->s2, iv, &off);
+            if(!s){
+                b = ir->s2;
+                s = scale_of(ir->s1, iv, &off);
+            }
+            if(!s || !is_vreg(b) || scale_of(b, iv, &unused)){
+                continue;
+            }
+
+            IndPtr* p = NULL;
+            for(int j = 0; j < nptrs; j++){
+                if(ptrs[j].scale == s && same_base(ptrs[j].base, b)){
+                    p = &ptrs[j];
+                }
+            }
+            if(!p){
+                if(nptrs >= 16){
+                    continue;
+                }
+                Reg* base = invariant_base(loop, b);
+                if(!base){
+                    continue;
+                }
+                Reg* start = emit_offset(loop, ir->t, base, iv->init, s);
+
+                Reg* ptr = cfg_new_reg(cfg, ir->t);
+                Reg* ptr_next = cfg_new_reg(cfg, ir->t);
+                IR* phi = make_IR(IR_PHI, ptr, NULL, NULL);
+                phi->phi_args = calloc(loop->header->npreds, sizeof(Reg*));
+                phi->phi_args[pre] = start;
+                phi->phi_args[latch] = ptr_next;
+                insert_after_phis(loop->header, phi);
+                insert_ir_after(iv->inc, make_IR(IR_ADD, ptr_next, ptr, new_RegImm(iv->step * s)));
+
+                p = &ptrs[nptrs++];
+                p->base = b;
+                p->ptr = ptr;
+                p->scale = s;
+                if(!first_base){
+                    first_base = base;
+                }
+            }
+
+            if(off){
+                ir->s1 = p->ptr;
+                ir->s2 = new_RegImm(off * s);
+            } else {
+                remove_ir(bb, ir);
+                replace_uses(ir->t, p->ptr);
+            }
+            reduced++;
+        }
+    }
+
+    if(nptrs){
+        replace_test(loop, iv, ptrs[0].ptr, first_base, ptrs[0].scale);
+    }
+}
+
+// 展開したループの i + 1 + 1 + ... を、次の値を i + step で計算するようにまとめる。
+// 途中の値が使われなくなれば、不要命令の削除で消える
+static void collapse_chain(IR* phi, int latch, IndVar* iv){
+    IR* inc = iv->inc;
+    if((is_imm(inc->s2) ? inc->s1 : inc->s2) == phi->t){
+        return;
+    }
+    Reg* next = phi->phi_args[latch];
+    IR* last = def_of(next);
+    Reg* t = cfg_new_reg(cfg, inc->t);
+    IR* add = make_IR(IR_ADD, t, phi->t, new_RegImm(iv->step));
+    insert_ir_after(last, add);
+    if(last != inc){
+        // intの加算の結果のキャスト
+        Reg* c = cfg_new_reg(cfg, next);
+        IR* cast = make_IR(IR_CAST, c, t, NULL);
+        cast->size = last->size;
+        cast->is_unsigned = last->is_unsigned;
+        cast->src_size = last->src_size;
+        cast->src_unsigned = last->src_unsigned;
+        insert_ir_after(add, cast);
+        t = c;
+    }
+    replace_uses(next, t);
+    iv->inc = add;
+}
+
+static void reduce_loop(Loop* loop){
+    // 戻り辺がひとつのループだけを扱う
+    BasicBlock* header = loop->header;
+    int pre = -1;
+    int latch = -1;
+    for(int i = 0; i < header->npreds; i++){
+        if(header->preds[i] == loop->preheader){
+            pre = i;
+        } else if(latch < 0){
+            latch = i;
+        } else {
+            return;
+        }
+    }
+    if(pre < 0 || latch < 0){
+        return;
+    }
+
+    collect_defs();
+
+    IndVar ivs[16];
+    int nivs = 0;
+    for(IR* ir = header->ir; ir && nivs < 16; ir = ir->next){
+        if(ir->cmd != IR_PHI){
+            continue;
+        }
+        IndVar* iv = &ivs[nivs];
+        iv->phi = ir;
+        iv->init = ir->phi_args[pre];
+        iv->inc = match_increment(ir->phi_args[latch], ir->t, &iv->step);
+        if(!iv->inc || !iv->init || !loop->contains[def_bb[iv->inc->t->vn]]){
+            continue;
+        }
+        if(!is_imm(iv->init) && !is_vreg(iv->init)){
+            continue;
+        }
+        collapse_chain(ir, latch, iv);
+        nivs++;
+    }
+
+    for(int i = 0; i < nivs; i++){
+        reduce_iv(loop, &ivs[i], pre, latch);
+    }
+}
+
+int iv_reduce(CFG* target){
+    cfg = target;
+    reduced = 0;
+
+    int nloops;
+    Loop** loops = find_loops(cfg, &nloops);
+    for(int i = 0; i < nloops; i++){
+        reduce_loop(loops[i]);
+    }
+    return reduced;
+}
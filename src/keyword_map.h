@@ -19,6 +19,7 @@ static KEYWORD_MAP keyword_map[] = {
     {   "void",         TK_VOID     },
     {   "_Bool",        TK_BOOL     },
     {   "sizeof",       TK_SIZEOF   },
+    {   "_Alignof",     TK_ALIGNOF  },
     {   "break",        TK_BREAK    },
     {   "continue",     TK_CONTINUE },
     {   "switch",       TK_SWITCH   },
@@ -40,6 +41,7 @@ static KEYWORD_MAP keyword_map[] = {
     {   "static",       TK_STATIC   },
     {   "auto",         TK_AUTO     },
     {   "register",     TK_REGISTER },
+    {   "inline",       TK_INLINE   },
     {   "__builtin_va_start",       TK_VA_START },
     {   "__builtin_va_end",         TK_VA_END   },
     {   "__builtin_va_arg",         TK_VA_ARG   },
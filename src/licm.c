@@ -0,0 +1,213 @@
+#include "mcc2.h"
+
+/*
+    ループ不変式の移動 (Loop Invariant Code Motion)
+
+    SSA形式の上で自然ループ(loop.c)を見つけ、ループの中で値が変わらない命令を
+    ループの直前のブロック(プリヘッダ)へ移す。
+
+    移すのは、オペランドがすべてループの外で定義された(または移した)命令のうち、
+    例外を起こさないものだけにする。
+        - 算術演算、比較、キャスト(除算・剰余は0除算があるので除く)
+        - グローバル変数のアドレス(IR_REL)
+        - メモリからの読み込み(IR_LOAD)
+    読み込みは、ループを抜けるときに必ず通るブロックにあり、ループの中に
+    同じ場所へ書き込むかもしれない命令がないときだけ移す。
+    ループを抜けるまでに必ず一度は読むので、先に読んでもアクセスできない場所を読むことはない。
+    内側のループから順に処理するので、外側のループでも不変ならさらに外へ移る。
+
+    --remarks を指定すると、ループごとに移した命令を標準エラーに出力する。
+*/
+
+static CFG* cfg;
+static int* def_bb;         // [vn] 定義しているブロックのid。ループの外の値は-1
+static Loop* cur_loop;
+static int hoisted;
+
+static char* remark_buf;    // 報告する命令の一覧
+static int remark_len;
+
+static bool defined_outside(Reg* reg){
+    if(reg->kind == REG_IMM){
+        return true;
+    }
+    if(!is_vreg(reg)){
+        return false;
+    }
+    int id = def_bb[reg->vn];
+    return id < 0 || !cur_loop->contains[id];
+}
+
+// ループの中に、読み込みの結果を変えるかもしれない命令があるか
+static bool clobbered_in_loop(Loop* loop, Reg* addr){
+    for(int i = 0; i < loop->nbody; i++){
+        for(IR* ir = loop->body[i]->ir; ir; ir = ir->next){
+            bool clobber = false;
+            switch(ir->cmd){
+                case IR_ASSIGN:
+                case IR_VSTORE:
+                    clobber = may_clobber(addr, addr_base(ir->s1), false);
+                    break;
+                case IR_COPY:
+                    clobber = may_clobber(addr, addr_base(ir->t), false);
+                    break;
+                case IR_STORE_ARG_REG:
+                    clobber = may_clobber(addr, ir->s1->ident, false);
+                    break;
+                case IR_FN_CALL:
+                    clobber = may_clobber(addr, NULL, true);
+                    break;
+                case IR_VA_START:
+                    clobber = true;
+                    break;
+                default:
+                    break;
+            }
+            if(clobber){
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ループを抜けるときに必ず通るブロックか
+static bool dominates_exits(Loop* loop, BasicBlock* bb){
+    for(int i = 0; i < loop->nbody; i++){
+        BasicBlock* b = loop->body[i];
+        for(int j = 0; j < b->nsuccs; j++){
+            if(!loop->contains[b->succs[j]->id] && !dominates(bb, b)){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool can_hoist(Loop* loop, BasicBlock* bb, IR* ir){
+    Reg** d = ir_def_slot(ir);
+    if(!d || !is_vreg(*d)){
+        return false;
+    }
+
+    switch(ir->cmd){
+        case IR_DIV:
+        case IR_MOD:
+            return false;
+        case IR_EQUAL:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_CAST:
+            break;
+        case IR_REL:
+            return ir->s1->ident->kind == ID_GVAR;
+        case IR_LOAD:
+            break;
+        default:
+            if(!is_binop(ir->cmd) || !ir->t){
+                return false;
+            }
+            break;
+    }
+
+    Reg** slots[MAX_IR_OPERANDS];
+    int n = ir_operand_slots(ir, slots);
+    for(int i = 0; i < n; i++){
+        if(!defined_outside(*slots[i])){
+            return false;
+        }
+    }
+
+    if(ir->cmd == IR_LOAD){
+        return dominates_exits(loop, bb) && !clobbered_in_loop(loop, ir->s2);
+    }
+    return true;
+}
+
+static void add_remark(IR* ir){
+    char buf[128];
+    if(ir->cmd == IR_REL){
+        snprintf(buf, sizeof(buf), "%s(%s)", ir_cmd_name(ir->cmd), ir->s1->ident->name);
+    } else {
+        snprintf(buf, sizeof(buf), "%s", ir_cmd_name(ir->cmd));
+    }
+    int len = strlen(buf);
+    remark_buf = realloc(remark_buf, remark_len + len + 3);
+    if(remark_len){
+        strcpy(remark_buf + remark_len, ", ");
+        remark_len += 2;
+    }
+    strcpy(remark_buf + remark_len, buf);
+    remark_len += len;
+}
+
+static void hoist_loop(Loop* loop){
+    cur_loop = loop;
+    int count = 0;
+    remark_len = 0;
+    bool changed = true;
+    while(changed){
+        changed = false;
+        // 逆後順にたどると、定義が使う側より先に移る
+        for(int i = 0; i < cfg->nblocks; i++){
+            BasicBlock* bb = cfg->blocks[i];
+            if(!loop->contains[bb->id]){
+                continue;
+            }
+            IR* next = NULL;
+            for(IR* ir = bb->ir; ir; ir = next){
+                next = ir->next;
+                if(!can_hoist(loop, bb, ir)){
+                    continue;
+                }
+                remove_ir(bb, ir);
+                ir->next = NULL;
+                insert_before_terminator(loop->preheader, ir);
+                def_bb[(*ir_def_slot(ir))->vn] = loop->preheader->id;
+                if(print_remarks){
+                    add_remark(ir);
+                }
+                count++;
+                changed = true;
+            }
+        }
+    }
+
+    if(print_remarks && count && loop->tok){
+        remark_tok(loop->tok, "%s: loop .L%ld: hoisted %d: %s",
+            cfg->func->name, block_label(loop->header), count, remark_buf);
+    }
+    hoisted += count;
+}
+
+int licm(CFG* target){
+    cfg = target;
+    hoisted = 0;
+
+    int nloops;
+    Loop** loops = find_loops(cfg, &nloops);
+    if(nloops == 0){
+        return 0;
+    }
+
+    def_bb = calloc(cfg->nregs + 1, sizeof(int));
+    for(int i = 0; i < cfg->nregs; i++){
+        def_bb[i] = -1;
+    }
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                def_bb[(*d)->vn] = bb->id;
+            }
+        }
+    }
+    analyze_addresses(cfg);
+
+    for(int i = 0; i < nloops; i++){
+        hoist_loop(loops[i]);
+    }
+    return hoisted;
+}
@@ -0,0 +1,131 @@
+#include "mcc2.h"
+
+/*
+    自然ループの検出
+
+    SSA形式のCFGから自然ループを見つける。
+        - 戻り辺 : ヘッダが支配しているブロックからヘッダへの辺
+        - 本体   : 戻り辺の元から、ヘッダを通らずに逆向きに辿れるブロック
+    ループの外からヘッダへ入る辺がひとつだけのループを対象にする。
+    その辺の元が分岐していれば、辺の間に空のブロックを挟んでプリヘッダにする。
+    ループ不変式の移動(licm.c)と誘導変数の強度低減(ivsr.c)で使う。
+*/
+
+static bool has_back_edge(BasicBlock* header){
+    for(int i = 0; i < header->npreds; i++){
+        if(dominates(header, header->preds[i])){
+            return true;
+        }
+    }
+    return false;
+}
+
+// ループの外からヘッダへ入る辺の元を返す。ひとつでなければNULLを返す
+static BasicBlock* outside_pred(BasicBlock* header){
+    BasicBlock* out = NULL;
+    for(int i = 0; i < header->npreds; i++){
+        BasicBlock* pred = header->preds[i];
+        if(dominates(header, pred)){
+            continue;
+        }
+        if(out){
+            return NULL;
+        }
+        out = pred;
+    }
+    return out;
+}
+
+static bool is_jtable_block(BasicBlock* bb){
+    IR* last = block_tail(bb);
+    return last && last->cmd == IR_JTABLE;
+}
+
+// 分岐してからヘッダへ入るループに、プリヘッダを挟む
+static void make_preheaders(CFG* cfg){
+    bool changed = false;
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* header = cfg->blocks[i];
+        if(!has_back_edge(header)){
+            continue;
+        }
+        BasicBlock* out = outside_pred(header);
+        if(!out || out->nsuccs == 1 || is_jtable_block(out)){
+            continue;
+        }
+        split_edge(cfg, out, header);
+        changed = true;
+    }
+    if(changed){
+        cfg_refresh(cfg);
+        compute_dominators(cfg);
+    }
+}
+
+static void add_body(Loop* loop, BasicBlock* bb){
+    if(loop->contains[bb->id]){
+        return;
+    }
+    loop->contains[bb->id] = true;
+    loop->body[loop->nbody++] = bb;
+    for(int i = 0; i < bb->npreds; i++){
+        add_body(loop, bb->preds[i]);
+    }
+}
+
+// ループを見つけて、内側のループが先に来るように本体の小さい順に並べて返す
+Loop** find_loops(CFG* cfg, int* nloops){
+    compute_dominators(cfg);
+    make_preheaders(cfg);
+
+    Loop** loops = calloc(cfg->nblocks + 1, sizeof(Loop*));
+    int n = 0;
+
+    // ループの文の位置は、ヘッダの前にある最後の文のコメントから取る
+    Token** tok = calloc(cfg->nblock_ids, sizeof(Token*));
+    Token* last = NULL;
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        tok[bb->id] = last;
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_COMMENT){
+                last = ir->s1->tok;
+            }
+        }
+    }
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* header = cfg->blocks[i];
+        if(!has_back_edge(header)){
+            continue;
+        }
+        BasicBlock* out = outside_pred(header);
+        if(!out || out->nsuccs != 1 || is_jtable_block(out)){
+            continue;
+        }
+
+        Loop* loop = calloc(1, sizeof(Loop));
+        loop->header = header;
+        loop->preheader = out;
+        loop->body = calloc(cfg->nblocks, sizeof(BasicBlock*));
+        loop->contains = calloc(cfg->nblock_ids, sizeof(bool));
+        loop->tok = tok[header->id];
+
+        loop->contains[header->id] = true;
+        loop->body[loop->nbody++] = header;
+        for(int j = 0; j < header->npreds; j++){
+            if(dominates(header, header->preds[j])){
+                add_body(loop, header->preds[j]);
+            }
+        }
+
+        int pos = n++;
+        while(pos > 0 && loops[pos - 1]->nbody > loop->nbody){
+            loops[pos] = loops[pos - 1];
+            pos--;
+        }
+        loops[pos] = loop;
+    }
+
+    *nloops = n;
+    return loops;
+}
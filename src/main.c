@@ -1,4 +1,5 @@
 #include "mcc2.h"
+#include <getopt.h>
 
 static char* filename = NULL;
 bool is_preprocess = false;
@@ -9,6 +10,8 @@ void enable_debug_mode(const char *mode) {
         debug_regis = 1;
     } else if (strcmp(mode, "plvar") == 0){
         debug_plvar = 1;
+    } else if (strcmp(mode, "ssa") == 0){
+        debug_ssa = 1;
     } else {
         fprintf(stderr, "Unknown debug mode: %s\n", mode);
         exit(1); // 不明なモードの場合は終了
@@ -22,9 +25,16 @@ char* get_filename(char* path){
     return buf;
 }
 
+static struct option long_opts[] = {
+    {"stats", no_argument, NULL, 'S'},
+    {"remarks", no_argument, NULL, 'R'},
+    {"layout-report", no_argument, NULL, 'L'},
+    {NULL, 0, NULL, 0},
+};
+
 void analy_opt(int argc, char** argv){
     int opt;
-    while((opt = getopt(argc, argv, "c:o:i:d:x:E")) != -1){
+    while((opt = getopt_long(argc, argv, "c:o:i:d:x:EO::m:f:", long_opts, NULL)) != -1){
         switch(opt){
             case 'c':
                 filename = optarg;
@@ -60,6 +70,37 @@ void analy_opt(int argc, char** argv){
             case 'E':
                 is_preprocess = true;
                 break;
+            case 'O':
+                opt_level = optarg ? atoi(optarg) : 1;
+                if(opt_level){
+                    add_predefine_macro("__OPTIMIZE__");
+                }
+                break;
+            case 'S':
+                print_stats = 1;
+                break;
+            case 'R':
+                print_remarks = 1;
+                break;
+            case 'L':
+                print_layout = 1;
+                break;
+            case 'm':
+                if(strcmp(optarg, "avx2") == 0){
+                    use_avx2 = 1;
+                } else {
+                    fprintf(stderr, "Unknown target option: -m%s\n", optarg);
+                    exit(1);
+                }
+                break;
+            case 'f':
+                if(strcmp(optarg, "omit-frame-pointer") == 0){
+                    omit_frame_pointer = 1;
+                } else {
+                    fprintf(stderr, "Unknown option: -f%s\n", optarg);
+                    exit(1);
+                }
+                break;
             default:
                 error("invalid option.");
         }
@@ -104,9 +145,14 @@ int main(int argc, char **argv){
 
     // generate
     gen_ir();
+    optimize();
     gen_x86();
 
     close_output_file();
 
+    if(print_stats){
+        dump_stats();
+    }
+
     return 0;
 }
\ No newline at end of file
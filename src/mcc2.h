@@ -32,11 +32,16 @@ typedef struct Type Type;
 typedef struct Member Member;
 typedef struct Label Label;
 typedef struct StringLiteral StringLiteral;
+typedef struct Reloc Reloc;
 typedef struct SrcFile SrcFile;
 typedef struct IncludePath IncludePath;
 typedef struct Macro Macro;
 typedef struct Warning Warning;
 typedef struct IF_GROUP IF_GROUP;
+typedef struct BasicBlock BasicBlock;
+typedef struct CFG CFG;
+typedef struct Loop Loop;
+typedef struct BitSet BitSet;
 typedef enum TypeKind TypeKind;
 
 extern FILE* fp;
@@ -109,6 +114,7 @@ typedef enum TokenKind {
     TK_BREAK,                   // break
     TK_CONTINUE,                // continue
     TK_SIZEOF,                  // sizeof
+    TK_ALIGNOF,                 // _Alignof
     TK_SWITCH,
     TK_CASE,
     TK_DEFAULT,
@@ -137,6 +143,7 @@ typedef enum TokenKind {
     TK_STATIC,                  // static
     TK_AUTO,                    // auto
     TK_REGISTER,                // register
+    TK_INLINE,                  // inline
     TK_NEWLINE,                 // "\n"
 
     // builtin
@@ -151,6 +158,7 @@ typedef enum TokenKind {
     TK_UNDEF,                   // #undef
     TK_PRAGMA,                  // #pragma
     TK_ONCE,                    // #pragma once
+    TK_PRAGMA_UNROLL,           // #pragma unroll N (valに回数。省略したときは0)
     TK_PP_IF,
     TK_PP_IFDEF,
     TK_PP_IFNDEF,
@@ -210,7 +218,13 @@ struct Ident {
     int is_var_params;      // 可変長引数受け取るか？
     int is_extern;          // externか？
     int is_static;          // staticか？
+    int is_inline;          // inline指定があるか？
+    int ncalls;             // 関数を呼び出している箇所の数(staticな関数だけ数える)
+    int saved_regs;         // レジスタ割り当てで使ったcallee-savedのレジスタ(1 << PhysReg)
     Ident* va_area;         // 可変長引数のエリア
+    char* init_data;        // 静的な初期値のバイト列(初期値がなければNULL)
+    Reloc* relocs;          // 初期値の中に置くアドレス(オフセットの小さい順)
+    Ident* real;            // 関数の中のstatic変数の名前なら、実体のグローバル変数
 
     IR* ir_cmd;          // 中間命令の先頭
 
@@ -287,6 +301,7 @@ struct Node {
     Node*           body;
     Node*           init;
     Node*           incr;
+    int             unroll;     // #pragma unroll で指定した展開回数(ND_FOR)
 
     Node*           next_case;
     Node*           default_label;
@@ -305,6 +320,7 @@ struct Node {
         int val     : レジスタが直値を扱う場合の数値
         Ident* ident: レジスタに割り当てられた識別子
                         ex) ラベル、変数、関数名...
+        int vn      : CFG内での仮想レジスタ番号（最適化で使用する）
 */
 typedef enum RegKind {
     REG_REG = 0,    // 普通のレジスタ
@@ -318,7 +334,6 @@ typedef enum RegKind {
 struct Reg {
     RegKind kind;
     int idx;
-    int spill_idx;
     unsigned long val;
     bool is_unsigned;
     Ident*  ident;
@@ -327,8 +342,39 @@ struct Reg {
     char*   str;
     char*   rreg;
     Token*  tok;
+    int     vn;
+    int     phys;   // レジスタ割り当てで決めた実レジスタ(PhysReg)
 };
 
+/*
+    実レジスタの番号 (gen_x86_64.cのレジスタ名の表の添字)
+        r10, r11        : 退避した仮想レジスタの読み書きに使う
+        r12〜r15, rbx   : callee-saved。関数呼び出しをまたぐ値に使う
+        rdi〜r9         : 引数レジスタの順に並べる。caller-saved
+    raxは戻り値や除算、比較の結果に使うので割り当てない。
+    オペランドが3つとも退避した命令で、3つ目を読み込むのに使う
+*/
+typedef enum PhysReg {
+    PR_R10 = 0,
+    PR_R11,
+    PR_R12,
+    PR_R13,
+    PR_R14,
+    PR_R15,
+    PR_RBX,
+    PR_RDI,
+    PR_RSI,
+    PR_RDX,
+    PR_RCX,
+    PR_R8,
+    PR_R9,
+    PR_RAX,
+    PR_NUM,
+} PhysReg;
+
+// この大きさより大きい構造体のコピー(IR_COPY)はrep movsbで行うので、rdi、rsi、rcxを使う
+#define COPY_REP_SIZE   256
+
 typedef enum {
     ierr = -1,
     i8 = 0,
@@ -348,6 +394,9 @@ typedef enum IRCmd{
     IR_MUL,
     IR_DIV,
     IR_MOD,
+    IR_MULHI,
+        // mulhi t s1 s2
+        //  s1 * s2 の128bitの積の上位64bitをtに格納する。is_unsignedなら符号なしで掛ける
     IR_EQUAL,
     IR_NOT_EQUAL,
     IR_LT,
@@ -359,6 +408,9 @@ typedef enum IRCmd{
     IR_R_BIT_SHIFT,
     IR_ASSIGN,
     IR_FN_CALL,
+    IR_TAIL_CALL,
+        // tailcall (null) (fname)
+        //  フレームを戻してからfnameに飛ぶ。fnameの戻り値がそのまま関数の戻り値になる
     IR_REL,
     IR_CAST,
         // cast t, s1, (null)
@@ -374,13 +426,17 @@ typedef enum IRCmd{
     IR_LEA,
         // lea (null) s1 s2
         //  write address of s2 to s1
+    IR_ADDR,
+        // addr t s1 (null)
+        //  メモリオペランド[s1 + index * scale + disp]のアドレスをtに格納する
     IR_LOAD,
         // load (null) s1 s2
         //  [s2] -> s1
 
     IR_COPY,
-        // copy (null) s1 s2
-        //  s2 -> s1
+        // copy t s1 (null)
+        //  s1の指す構造体をtの指す場所にsizeバイトコピーする
+        //  COPY_REP_SIZEより大きいものはrep movsbでコピーする
 
     // CONTROL
     IR_RET,
@@ -398,6 +454,18 @@ typedef enum IRCmd{
     IR_JE,
         // je imm s1 s2
         //  if s1 == s2, then go to imm
+    IR_JNE,
+    IR_JLT,
+    IR_JLE,
+    IR_JGT,
+    IR_JGE,
+        // jne/jlt/jle/jgt/jge imm s1 s2
+        //  s1とs2を比較して、条件が成り立てばimmに飛ぶ
+        //  is_unsignedが立っていれば符号なしで比較する
+    IR_JTABLE,
+        // jtable (null) s1 (imm)
+        //  ジャンプテーブル.L(imm)のs1番目のラベルに飛ぶ
+        //  飛び先のラベルはtargetsに持つ。s1は範囲内であること
     IR_LABEL,
         // label (null) (imm)
         //   .L(imm):
@@ -429,11 +497,60 @@ typedef enum IRCmd{
         // imm1は固定引数の数
         // imm2は浮動小数点引数の数
 
+    // VECTOR
+    //  ベクトルレジスタ(xmm/ymm)は番号の直値で指定する。
+    //  -mavx2のときは256bit、それ以外は128bitのレジスタで、sizeは1要素の大きさ
+    IR_VLOAD,
+        // vload (imm) s1
+        //  s1のアドレスからベクトルレジスタimmに読み込む
+    IR_VSTORE,
+        // vstore (imm) s1
+        //  ベクトルレジスタimmをs1のアドレスに書き込む
+    IR_VBCAST,
+        // vbcast (imm) s1
+        //  s1の値をベクトルレジスタimmのすべての要素に入れる
+    IR_VADD,
+    IR_VSUB,
+    IR_VMUL,
+    IR_VAND,
+    IR_VOR,
+    IR_VXOR,
+    IR_VSHL,
+    IR_VSHR,
+    IR_VMIN,
+    IR_VMAX,
+    IR_VSAD,
+        // vadd (imm1) (imm2) (imm3)
+        //  ベクトルレジスタimm2とimm3の要素ごとの演算結果をimm1に格納する
+        //  vshl/vshrのimm3はシフトする量。vshr/vmin/vmaxはis_unsignedで符号を決める
+        //  vsadは1byteの要素の絶対値の差を8byteごとに足す(psadbw)
+    IR_VREDUCE,
+        // vreduce t (imm1) (imm2)
+        //  ベクトルレジスタimm1の要素をすべて、imm2の命令(vadd/vmin/vmax)でまとめてtに格納する
+    IR_VEND,
+        // vend
+        //  ベクトルレジスタを使い終わる(AVX2のときはvzeroupper)
+
     // DEBUG
     IR_COMMENT,
         // comment (string)
         // stringをコメントとして出力する
 
+    // SSA
+    IR_PHI,
+        // phi t (null) (null)
+        //  先行ブロックから来た値(phi_args[i])を選んでtに格納する
+        //  SSA形式の間だけ現れる
+
+    // REGISTER ALLOCATION
+    IR_SPILL,
+        // spill (null) (imm) s2
+        //  s2を退避領域[rbp - imm]に書き込む
+    IR_RELOAD,
+        // reload (null) s1 (imm)
+        //  退避領域[rbp - imm]をs1に読み込む
+        //  どちらもレジスタ割り当てが挿入する
+
 } IRCmd;
 
 /*
@@ -445,6 +562,15 @@ typedef enum IRCmd{
 
         演算はs1とs2に対して実施して、tに格納する。
         tがNULLの場合は、s1を上書きする。
+
+        int size, bool is_unsigned
+                    : load/assign/copyでアクセスするメモリのサイズ、
+                      castではキャスト先の型
+        int src_size, bool src_unsigned
+                    : castのキャスト元の型
+        Reg** phi_args : IR_PHIの引数（所属するブロックの先行ブロック順）
+        long* targets, int ntargets
+                    : IR_JTABLEの飛び先のラベル番号
 */
 struct IR {
     IRCmd cmd;
@@ -452,6 +578,94 @@ struct IR {
     Reg*    t;
     Reg*    s1;
     Reg*    s2;
+    int     size;
+    bool    is_unsigned;
+    int     src_size;
+    bool    src_unsigned;
+    Reg**   phi_args;
+    long*   targets;
+    int     ntargets;
+
+    // メモリオペランド [base + index * scale + disp] (isel.c)
+    //  baseはload/assign/addrのアドレスのオペランド。NULLならsymからの位置
+    //  (ローカル変数はrbp、グローバル変数はrip相対)
+    //  演算と比較では、memが1ならs1、2ならs2をmem_sizeの大きさのメモリオペランドにする
+    Reg*    index;
+    int     scale;
+    long    disp;
+    Ident*  sym;
+    int     mem;
+    int     mem_size;
+};
+
+/*
+    BasicBlock : 基本ブロック
+        IR* ir          : 先頭の中間命令（ブロック内でNULL終端）
+        preds, succs    : 先行ブロック、後続ブロック
+                          succs[0]はフォールスルー先、succs[1]は分岐先
+                          ジャンプテーブルで終わるブロックは、飛び先を重複なく持つ
+        idom            : 直接支配ブロック
+        df              : 支配辺境
+        live_in/out     : ブロックの入口/出口で生存している仮想レジスタ
+        next            : 出力時の配置順
+*/
+struct BasicBlock {
+    int             id;
+    IR*             ir;
+    BasicBlock**    preds;
+    int             npreds;
+    BasicBlock**    succs;
+    int             nsuccs;
+    BasicBlock*     idom;
+    BasicBlock*     dom_child;
+    BasicBlock*     dom_sibling;
+    BasicBlock**    df;
+    int             ndf;
+    int             rpo;
+    bool            reachable;
+    BitSet*         live_in;
+    BitSet*         live_out;
+    BasicBlock*     next;
+};
+
+/*
+    CFG : 関数ひとつ分の制御フローグラフ
+        blocks  : 逆後順に並べた到達可能なブロック
+        head    : 配置順の先頭ブロック(=入口)
+        regs    : 仮想レジスタ番号(vn) -> 仮想レジスタ
+*/
+struct CFG {
+    Ident*          func;
+    BasicBlock*     head;
+    BasicBlock*     exit;
+    BasicBlock**    blocks;
+    int             nblocks;
+    int             nblock_ids;
+    Reg**           regs;
+    int             nregs;
+    int             reg_cap;
+    bool            is_ssa;
+};
+
+/*
+    Loop : 自然ループ
+        preheader   : ループの外からヘッダへ入る唯一のブロック。後続ブロックはヘッダだけ
+        body        : ヘッダを含む本体のブロック
+        contains    : [ブロックのid] 本体に含まれるか
+        tok         : ループの文の位置(報告用)
+*/
+struct Loop {
+    BasicBlock*     header;
+    BasicBlock*     preheader;
+    BasicBlock**    body;
+    int             nbody;
+    bool*           contains;
+    Token*          tok;
+};
+
+struct BitSet {
+    int             size;
+    unsigned long*  bits;
 };
 
 struct Label {
@@ -518,7 +732,8 @@ enum {
 struct Type {
     TypeKind    kind;
     Token*      name;
-    int         size;
+    int         size;           // 配列は全体の大きさ
+    int         align;
     int         is_unsigned;
     int         array_len;
     bool        is_const;
@@ -533,18 +748,70 @@ struct Type {
 struct StringLiteral{
     char*           name;
     Token*          val;
+    Ident*          ident;      // 同じ内容のリテラルはこのIdentを共有する
     StringLiteral*  next;
 };
 
+// 静的な初期値の中のアドレス(.quad ident + addend)
+struct Reloc {
+    int         offset;
+    Ident*      ident;
+    long        addend;
+    Reloc*      next;
+};
+
 struct Warning {
     char*       warn;
     Warning*    next;
 };
 
 // ---------- function prototype ----------
+// alias.c
+void analyze_addresses(CFG* cfg);
+Ident* addr_base(Reg* reg);
+bool addr_escaped(Ident* ident);
+bool may_clobber(Reg* addr, Ident* store, bool is_call);
+
+// cfg.c
+CFG* build_cfg(Ident* func);
+void linearize_cfg(CFG* cfg);
+void cfg_refresh(CFG* cfg);
+BasicBlock* split_edge(CFG* cfg, BasicBlock* from, BasicBlock* to);
+int remove_unreachable_blocks(CFG* cfg);
+void compute_dominators(CFG* cfg);
+void compute_liveness(CFG* cfg);
+bool dominates(BasicBlock* a, BasicBlock* b);
+IR* make_IR(IRCmd cmd, Reg* t, Reg* s1, Reg* s2);
+Reg* cfg_new_reg(CFG* cfg, Reg* base);
+void cfg_add_reg(CFG* cfg, Reg* reg);
+bool is_vreg(Reg* reg);
+bool is_binop(IRCmd cmd);
+bool is_terminator(IRCmd cmd);
+bool is_cmp_jump(IRCmd cmd);
+Reg** ir_def_slot(IR* ir);
+#define MAX_IR_OPERANDS 3
+int ir_operand_slots(IR* ir, Reg*** slots);
+int ir_use_slots(IR* ir, Reg*** slots);
+char* ir_cmd_name(IRCmd cmd);
+IR* block_tail(BasicBlock* bb);
+long block_label(BasicBlock* bb);
+void remove_ir(BasicBlock* bb, IR* ir);
+void insert_ir_before(BasicBlock* bb, IR* pos, IR* ir);
+void insert_ir_after(IR* pos, IR* ir);
+void insert_before_terminator(BasicBlock* bb, IR* ir);
+void insert_after_phis(BasicBlock* bb, IR* ir);
+void dump_cfg(CFG* cfg);
+
+// dce.c
+int dce(CFG* cfg);
+
+// isel.c
+int isel(CFG* cfg);
+
 // error.c
 void error_tok(Token* tok, char* fmt, ...);
 void warn_tok(Token* tok, char* fmt, ...);
+void remark_tok(Token* tok, char* fmt, ...);
 void error_at_src(char* pos, SrcFile* src, char* fmt, ...);
 void warn_at_src(char* pos, SrcFile* src, char* fmt, ...);
 void error(char* fmt, ...);
@@ -560,18 +827,27 @@ void close_output_file();
 
 // gen_ir.c
 void gen_ir();
+long get_label();
+Reg* new_Reg();
+Reg* new_RegImm(unsigned long val);
 
 // gen_x86_64.c
 extern int debug_regis;
 extern int debug_plvar;
+extern int omit_frame_pointer;
+bool need_cast(int src_size, bool src_unsigned, int dst_size, bool dst_unsigned);
 void gen_x86_64_init();
 void gen_x86();
 
+// gvn.c
+int gvn(CFG* cfg);
+
 // ident.c
 Ident* declare_ident(Token* ident, IdentKind kind, Type* ty);
 Ident* make_ident(Token* ident, IdentKind kind, Type* ty);
 void register_ident(Ident* ident);
 Ident* register_string_literal(Token* tok);
+Ident* register_static_local(Ident* ident);
 void register_tag(Type* type);
 Ident* find_ident(Token* tok);
 Ident* find_typedef(Token* tok);
@@ -584,18 +860,60 @@ int get_stack_size();
 Scope* get_current_scope();
 Scope* get_global_scope();
 
+// ivsr.c
+int iv_reduce(CFG* cfg);
+
+// licm.c
+int licm(CFG* cfg);
+
+// loop.c
+Loop** find_loops(CFG* cfg, int* nloops);
+
+// mem2reg.c
+int mem2reg(CFG* cfg);
+
+// optimize.c
+extern int opt_level;
+extern int debug_ssa;
+extern int print_stats;
+extern int print_remarks;
+extern int use_avx2;
+void add_stat(char* name, long n);
+void dump_stats();
+void optimize();
+
 // parse.c
 void parse(Token* tok);
 
+// peephole.c
+void peephole_begin();
+void peephole_end();
+
 // preprocess.c
 Token* preprocess(Token* token);
 void add_include_path(char* path);
 void add_predefine_macro(char* path);
 void init_preprocess();
 
+// regalloc.c
+void regalloc(CFG* cfg);
+
+// sccp.c
+void sccp(CFG* cfg);
+
 // semantics.c
 void semantics();
 
+// strength.c
+int strength_reduce(CFG* cfg);
+
+// ssa.c
+void to_ssa(CFG* cfg);
+void from_ssa(CFG* cfg);
+
+// tailcall.c
+int tail_call(Ident* func);
+
 // tokenize.c
 Token* tokenize(char* path);
 bool is_equal_token(Token* lhs, Token* rhs);
@@ -623,11 +941,15 @@ extern Type* ty_uchar;
 extern Type* ty_ushort;
 extern Type* ty_uint;
 extern Type* ty_ulong;
+extern int print_layout;
 
 void ty_init();
 Type* copy_type(Type* type);
 Type* pointer_to(Type* base);
 Type* array_of(Type* base, int len);
+int align_to(int n, int align);
+void layout_struct(Type* ty, bool is_union);
+void report_layout(Type* ty, Token* tok);
 void add_type(Node* node);
 bool equal_type(Type* ty1, Type* ty2);
 Type* new_type(TypeKind kind, int size);
@@ -639,3 +961,11 @@ bool is_integer_type(Type* type);
 char* strnewcpyn(char* src, int n);
 char* format_string(const char* format, ...);
 void printline(Token* loc);
+BitSet* new_bitset(int size);
+BitSet* copy_bitset(BitSet* src);
+void bitset_set(BitSet* set, int idx);
+void bitset_clear(BitSet* set, int idx);
+bool bitset_test(BitSet* set, int idx);
+bool bitset_union(BitSet* dst, BitSet* src);
+bool bitset_equal(BitSet* a, BitSet* b);
+bool bitset_intersects(BitSet* a, BitSet* b);
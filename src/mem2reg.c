@@ -0,0 +1,189 @@
+#include "mcc2.h"
+
+/*
+    ローカル変数の仮想レジスタへの昇格 (mem2reg)
+
+    gen_ir()はローカル変数を読み書きするたびに
+        rel a, x / load v, [a]   または   rel a, x / assign [a], v
+    を出力し、引数もいったんIR_STORE_ARG_REGでスタックに書き込む。
+    アドレスを読み書き以外に使っていないスカラ変数(&xを取っていない、
+    配列・構造体でない)は、変数ごとに仮想レジスタをひとつ用意して
+        load v, [a]     ->  mov v, x
+        assign [a], v   ->  cast x, v   (変数の型で切り詰める。8byteならmov)
+        store_arg_reg x ->  引数レジスタから直接xに読み込む
+    に書き換える。あとはSSA形式への変換で普通の仮想レジスタとして扱われる。
+*/
+
+typedef struct Promoted {
+    Ident*  ident;
+    Reg*    reg;        // 変数の値を持つ仮想レジスタ。NULLなら昇格しない
+} Promoted;
+
+static Promoted* vars;
+static int nvars;
+static Ident** addr_of;     // [vn] 変数のアドレスを持つ仮想レジスタなら、その変数
+
+static Promoted* find_var(Ident* ident){
+    for(int i = 0; i < nvars; i++){
+        if(vars[i].ident == ident) return &vars[i];
+    }
+    return NULL;
+}
+
+static bool is_scalar(Type* ty){
+    switch(ty->kind){
+        case TY_ARRAY:
+        case TY_STRUCT:
+        case TY_UNION:
+            return false;
+        default:
+            return ty->size == 1 || ty->size == 2 || ty->size == 4 || ty->size == 8;
+    }
+}
+
+static void add_candidate(CFG* cfg, Ident* ident){
+    if(ident->kind != ID_LVAR || !is_scalar(ident->type) || find_var(ident)){
+        return;
+    }
+    vars = realloc(vars, sizeof(Promoted) * (nvars + 1));
+    vars[nvars].ident = ident;
+    vars[nvars].reg = cfg_new_reg(cfg, NULL);
+    vars[nvars].reg->size = ident->type->size;
+    vars[nvars].reg->is_unsigned = ident->type->is_unsigned;
+    nvars++;
+}
+
+static void reject(Ident* ident){
+    Promoted* var = find_var(ident);
+    if(var){
+        var->reg = NULL;
+    }
+}
+
+// 変数のアドレスを、変数と同じサイズの読み書きにだけ使っているか
+static bool is_plain_access(IR* ir, Reg** slot, Ident* ident){
+    switch(ir->cmd){
+        case IR_LOAD:
+            return slot == &ir->s2 && ir->size == ident->type->size;
+        case IR_ASSIGN:
+            return slot == &ir->s1 && ir->size == ident->type->size;
+        case IR_RELEASE_REG:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 昇格した変数の数を返す
+int mem2reg(CFG* cfg){
+    nvars = 0;
+    vars = NULL;
+
+    // 1. 変数のアドレスを持つ仮想レジスタと、候補の変数を集める
+    int n = cfg->nregs;
+    addr_of = calloc(n, sizeof(Ident*));
+    int* ndefs = calloc(n, sizeof(int));
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d) && (*d)->vn < n){
+                ndefs[(*d)->vn]++;
+                if(ir->cmd == IR_REL){
+                    addr_of[(*d)->vn] = ir->s1->ident;
+                    add_candidate(cfg, ir->s1->ident);
+                }
+            }
+            if(ir->cmd == IR_STORE_ARG_REG){
+                add_candidate(cfg, ir->s1->ident);
+            }
+        }
+    }
+
+    // 2. アドレスを読み書き以外に使っている変数は昇格しない
+    for(int vn = 0; vn < n; vn++){
+        if(addr_of[vn] && ndefs[vn] != 1){
+            reject(addr_of[vn]);
+        }
+    }
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int j = 0; j < nuse; j++){
+                Reg* reg = *slots[j];
+                Ident* ident = reg->vn < n ? addr_of[reg->vn] : NULL;
+                if(ident && !is_plain_access(ir, slots[j], ident)){
+                    reject(ident);
+                }
+            }
+        }
+    }
+
+    // 3. 読み書きを仮想レジスタの定義と使用に書き換える
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+
+            if(ir->cmd == IR_STORE_ARG_REG){
+                Promoted* var = find_var(ir->s1->ident);
+                if(var && var->reg){
+                    // レジスタの合流で大きさの違うレジスタに付け替わることがあるので、
+                    // 引数の大きさは命令に持たせる
+                    ir->s1 = var->reg;
+                    ir->size = var->reg->size;
+                    ir->is_unsigned = var->reg->is_unsigned;
+                }
+                continue;
+            }
+
+            Reg* addr = NULL;
+            if(ir->cmd == IR_REL || ir->cmd == IR_RELEASE_REG){
+                addr = ir->t;
+            } else if(ir->cmd == IR_LOAD){
+                addr = ir->s2;
+            } else if(ir->cmd == IR_ASSIGN){
+                addr = ir->s1;
+            }
+            if(!is_vreg(addr) || addr->vn >= n || !addr_of[addr->vn]){
+                continue;
+            }
+            Promoted* var = find_var(addr_of[addr->vn]);
+            if(!var || !var->reg){
+                continue;
+            }
+
+            if(ir->cmd == IR_LOAD){
+                insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, ir->s1, var->reg));
+            } else if(ir->cmd == IR_ASSIGN){
+                IR* store;
+                if(var->reg->size == 8){
+                    store = make_IR(IR_MOV, NULL, var->reg, ir->s2);
+                } else {
+                    store = make_IR(IR_CAST, var->reg, ir->s2, NULL);
+                    store->size = var->reg->size;
+                    store->is_unsigned = var->reg->is_unsigned;
+                    store->src_size = 8;
+                    store->src_unsigned = ir->s2->is_unsigned;
+                }
+                insert_ir_before(bb, ir, store);
+                if(ir->t){
+                    // 代入式の値は書き込んだ値。直値はオペランドごとに作る
+                    Reg* value = ir->s2;
+                    if(value->kind == REG_IMM){
+                        value = new_RegImm(value->val);
+                    }
+                    insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, ir->t, value));
+                }
+            }
+            remove_ir(bb, ir);
+        }
+    }
+
+    int promoted = 0;
+    for(int i = 0; i < nvars; i++){
+        if(vars[i].reg) promoted++;
+    }
+    return promoted;
+}
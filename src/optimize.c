@@ -0,0 +1,101 @@
+#include "mcc2.h"
+
+/*
+    中間命令の最適化とレジスタ割り当て
+        gen_ir()の後に関数ごとに実行する。関数をCFGに変換し、
+        -O を指定したときはSSA形式で最適化してから戻す。
+        最後にレジスタを割り当てて命令列に戻し、gen_x86()に渡す。
+*/
+
+int opt_level = 0;      // 最適化レベル（-O）
+int debug_ssa = 0;      // SSA形式のデバッグ出力（-x ssa）
+int print_stats = 0;    // 最適化の統計情報の出力（--stats）
+int print_remarks = 0;  // 最適化の報告の出力（--remarks）
+int use_avx2 = 0;       // AVX2の命令を使う（-mavx2）
+
+typedef struct Stat Stat;
+struct Stat {
+    char*   name;
+    long    count;
+    Stat*   next;
+};
+
+static Stat* stats = NULL;
+static Stat* stats_tail = NULL;
+
+// 統計情報のカウンタに加算する。カウンタは最初に加算した順に出力する
+void add_stat(char* name, long n){
+    Stat* stat = stats;
+    while(stat && strcmp(stat->name, name) != 0){
+        stat = stat->next;
+    }
+    if(!stat){
+        stat = calloc(1, sizeof(Stat));
+        stat->name = name;
+        if(stats_tail){
+            stats_tail->next = stat;
+        } else {
+            stats = stat;
+        }
+        stats_tail = stat;
+    }
+    stat->count += n;
+}
+
+// 統計情報を "stats: 名前 値" の形式で標準エラーに出力する
+void dump_stats(){
+    for(Stat* stat = stats; stat; stat = stat->next){
+        fprintf(stderr, "stats: %s %ld\n", stat->name, stat->count);
+    }
+}
+
+// 関数の中間命令の数を返す。ラベルとコメントは数えない
+static long count_ir(Ident* func){
+    long n = 0;
+    for(IR* ir = func->ir_cmd; ir; ir = ir->next){
+        if(ir->cmd != IR_LABEL && ir->cmd != IR_COMMENT){
+            n++;
+        }
+    }
+    return n;
+}
+
+static void optimize_function(Ident* func){
+    add_stat("ir_before", count_ir(func));
+
+    CFG* cfg = build_cfg(func);
+    add_stat("unreachable_blocks", remove_unreachable_blocks(cfg));
+    if(opt_level){
+        add_stat("promoted_vars", mem2reg(cfg));
+
+        to_ssa(cfg);
+        sccp(cfg);
+        add_stat("strength_reduced", strength_reduce(cfg));
+        add_stat("gvn_removed", gvn(cfg));
+        add_stat("licm_hoisted", licm(cfg));
+        add_stat("iv_reduced", iv_reduce(cfg));
+        add_stat("dce_removed", dce(cfg));
+        add_stat("isel_folded", isel(cfg));
+        if(debug_ssa){
+            dump_cfg(cfg);
+        }
+        from_ssa(cfg);
+    }
+    regalloc(cfg);
+
+    linearize_cfg(cfg);
+    if(opt_level){
+        add_stat("tail_calls", tail_call(func));
+    }
+
+    add_stat("ir_after", count_ir(func));
+}
+
+void optimize(){
+    Scope* scope = get_global_scope();
+    for(Ident* cur = scope->ident; cur; cur = cur->next){
+        if(cur->kind == ID_FUNC && cur->ir_cmd){
+            optimize_function(cur);
+        }
+    }
+}
@@ -14,8 +14,9 @@
             'default:' |
             'goto' ident ';'
     compound_stmt = stmt* | declaration* '}'
-    declaration = declare '=' (expr)? ';'
-    declare = declspec ident
+    declaration = declare ('=' initializer)? ';'
+    declare = declspec ident ('[' num? ']')?
+    initializer = assign | string_literal | '{' initializer (',' initializer)* ','? '}'
     declspec = 'int' '*' * | 'char' '*' * | 'short' '*' * | 'struct' ident | 'union' ident
     expr = assign (',' assign)*
     assign = cond_expr ( '=' assign
@@ -46,6 +47,7 @@
 
 static Node* switch_node = NULL;
 static Type* cur_func_type = NULL;
+static bool decl_inline = false;    // 宣言にinline指定があったか
 static Token* token = NULL;
 
 static void Program();
@@ -54,6 +56,9 @@ static Node* stmt();
 static Node* compound_stmt();
 static Node* declaration(Type* ty, StorageClassKind sck);
 static Ident* declare(Type* ty, StorageClassKind sck);
+static void static_initializer(Ident* ident);
+static Type* array_initializer(Type* ty, int offset);
+static void initializer(Type* ty, int offset);
 static Type* declspec(StorageClassKind* sck);
 static bool check_storage_class_keyword(StorageClassKind* sck, Token* tok);
 static void count_decl_spec(int* type_flg, int flg, Token* tok);
@@ -112,7 +117,6 @@ Token unnamed_struct_token = MAKE_TOKEN(TK_IDENT, "__unnamed_struct");
 Token unnamed_enum_token = MAKE_TOKEN(TK_IDENT, "__unnamed_enum");
 Token va_arena_token = MAKE_TOKEN(TK_IDENT, "__va_area__");
 Token builtin_va_elem_token = MAKE_TOKEN(TK_IDENT, "__builtin_va_elem");
-Token spill_area_token = MAKE_TOKEN(TK_IDENT, "__spill_area__");
 Token va_elem_gp_offset_token = MAKE_TOKEN(TK_IDENT, "gp_offset");
 Token va_elem_fp_offset_token = MAKE_TOKEN(TK_IDENT, "fp_offset");
 Token va_elem_overflow_arg_area_token = MAKE_TOKEN(TK_IDENT, "overflow_arg_area");
@@ -129,7 +133,13 @@ void parse(Token* tok){
 
 void Program(){
     while(!is_eof()){
+        // ループの外の #pragma unroll は無視する
+        if(consume_token(TK_PRAGMA_UNROLL)){
+            continue;
+        }
+
         StorageClassKind sck = SCK_NONE;
+        decl_inline = false;
         Type* ty = declspec(&sck);
 
         if(consume_token(TK_SEMICORON)){
@@ -170,6 +180,12 @@ static void function(Type* func_type, StorageClassKind sck){
         }
         has_forward_def = true;
     }
+    if(sck == SCK_STATIC){
+        func->is_static = true;
+    }
+    if(decl_inline){
+        func->is_inline = true;
+    }
 
     // ここでスコープインして、仮引数は関数スコープ内で宣言するため、ローカル変数と同等に扱える。
     scope_in();
@@ -209,11 +225,6 @@ static void function(Type* func_type, StorageClassKind sck){
         }
     }
 
-    // 実レジスタ退避用の領域を確保(とりあえず30個確保する)
-    Ident* spill_area = make_ident(&spill_area_token, ID_LVAR, ty_char);
-    spill_area->type = array_of(ty_char, 8 * 30);
-    register_ident(spill_area);
-
     // ここまで来たら関数の定義
     // 可変長引数ありの関数の場合は、__va_area__を宣言
     if(func->is_var_params){
@@ -239,7 +250,16 @@ static void function(Type* func_type, StorageClassKind sck){
 
 static Node* stmt(){
     Token* tok = get_token();
-    if(consume_token(TK_RETURN)){
+    if(consume_token(TK_PRAGMA_UNROLL)){
+        // 次の文がforループなら展開回数を付ける
+        Node* node = stmt();
+        if(node->kind == ND_FOR){
+            node->unroll = tok->val ? tok->val : -1;
+        } else {
+            warn_tok(tok, "#pragma unroll is ignored.");
+        }
+        return node;
+    } else if(consume_token(TK_RETURN)){
         Node* node = NULL;
 
         if(cur_func_type->kind == TY_VOID){
@@ -471,13 +491,30 @@ static Node* declaration(Type* ty, StorageClassKind sck){
         node = new_node(ND_VOID_STMT, NULL, NULL);
     } else {
         // グローバルスコープならID_GVAR、それ以外はID_LVAR
-        ident->kind = (get_current_scope() == get_global_scope()) ? ID_GVAR : ID_LVAR;
-        register_ident(ident);
+        // 関数の中のstatic変数は、名前を変えたグローバル変数にする
+        bool is_global = get_current_scope() == get_global_scope();
+        if(!is_global && sck == SCK_STATIC){
+            ident = register_static_local(ident);
+        } else {
+            ident->kind = is_global ? ID_GVAR : ID_LVAR;
+            register_ident(ident);
+        }
 
         if(consume_token(TK_ASSIGN)){
-            Node* var_node = new_node_var(ident);
-            var_node->pos = ident->tok;
-            node = new_node(ND_ASSIGN, var_node, assign());
+            if(ident->kind == ID_GVAR){
+                static_initializer(ident);
+            } else {
+                if(ident->type->kind == TY_ARRAY || token->kind == TK_L_BRACKET){
+                    error_tok(token, "initializer list is supported only for static variables.\n");
+                }
+                Node* var_node = new_node_var(ident);
+                var_node->pos = ident->tok;
+                node = new_node(ND_ASSIGN, var_node, assign());
+            }
+        }
+
+        if(ident->type->kind == TY_ARRAY && ident->type->array_len == 0 && !ident->is_extern){
+            error_tok(ident->tok, "array size is missing.\n");
         }
     }
 
@@ -492,9 +529,13 @@ static Ident* declare(Type* ty, StorageClassKind sck){
 
     Token* ident_tok = expect_ident();
     if(consume_token(TK_L_SQUARE_BRACKET)){
-        int len = expect_num();
+        // 大きさを省略した配列は、初期値の要素の数で大きさを決める
+        int len = 0;
+        if(!consume_token(TK_R_SQUARE_BRACKET)){
+            len = expect_num();
+            expect_token(TK_R_SQUARE_BRACKET);
+        }
         ty = array_of(ty, len);
-        expect_token(TK_R_SQUARE_BRACKET);
     }
 
     Ident* ident = make_ident(ident_tok, ID_LVAR, ty);
@@ -508,6 +549,270 @@ static Ident* declare(Type* ty, StorageClassKind sck){
     return ident;
 }
 
+/*
+    静的な初期化子
+        グローバル変数と関数の中のstatic変数の初期値は、コンパイル時に計算して
+        バイト列(Ident::init_data)と、その中に置くアドレス(Ident::relocs)にする。
+        {}の中の要素は順に配列の要素・構造体のメンバーに入れ、足りない分は0にする。
+        入れ子の配列・構造体の{}は省略してもよい。
+*/
+static char* init_data = NULL;      // 作っている初期値のバイト列
+static int init_cap = 0;
+static Reloc* init_reloc = NULL;    // 最後に追加したアドレス
+
+static void init_reserve(int size){
+    if(size <= init_cap){
+        return;
+    }
+    int cap = init_cap ? init_cap : 16;
+    while(cap < size){
+        cap *= 2;
+    }
+    init_data = realloc(init_data, cap);
+    memset(init_data + init_cap, 0, cap - init_cap);
+    init_cap = cap;
+}
+
+static void static_initializer(Ident* ident){
+    Reloc head = {};
+    init_data = NULL;
+    init_cap = 0;
+    init_reloc = &head;
+
+    init_reserve(ident->type->size);
+    if(ident->type->kind == TY_ARRAY){
+        ident->type = array_initializer(ident->type, 0);
+    } else {
+        initializer(ident->type, 0);
+    }
+
+    ident->init_data = init_data;
+    ident->relocs = head.next;
+}
+
+// i番目の要素があれば、要素の前の','を読んでtrueを返す
+static bool next_element(int i){
+    if(token->kind == TK_R_BRACKET){
+        return false;
+    }
+    if(i == 0){
+        return true;
+    }
+    if(token->kind != TK_COMMA || token->next->kind == TK_R_BRACKET){
+        return false;
+    }
+    expect_token(TK_COMMA);
+    return true;
+}
+
+static void close_initializer(bool braced){
+    if(!braced){
+        return;
+    }
+    consume_token(TK_COMMA);
+    if(token->kind != TK_R_BRACKET){
+        error_tok(token, "excess elements in initializer.\n");
+    }
+    expect_token(TK_R_BRACKET);
+}
+
+// 値を型の大きさに切り詰める
+static long truncate_value(long val, Type* ty){
+    switch(ty->size){
+        case 1:
+            return ty->is_unsigned ? (unsigned char)val : (char)val;
+        case 2:
+            return ty->is_unsigned ? (unsigned short)val : (short)val;
+        case 4:
+            return ty->is_unsigned ? (unsigned int)val : (int)val;
+    }
+    return val;
+}
+
+static long eval_static(Node* node, Ident** var, Token* tok);
+
+// 変数のアドレスを、*varの変数とそこからのオフセットにする
+static long eval_address(Node* node, Ident** var, Token* tok){
+    switch(node->kind){
+        case ND_VAR:
+            if(node->ident->kind == ID_GVAR){
+                *var = node->ident;
+                return 0;
+            }
+            break;
+        case ND_DREF:
+            return eval_static(node->lhs, var, tok);
+        case ND_MEMBER:
+            return eval_address(node->lhs, var, tok) + node->val;
+    }
+    error_tok(tok, "initializer element is not constant.\n");
+    return 0;
+}
+
+// 初期値の式を計算する
+// アドレスになる式は、*varにその変数を入れて変数からのオフセットを返す
+static long eval_static(Node* node, Ident** var, Token* tok){
+    switch(node->kind){
+        case ND_NUM:
+            return node->val;
+        case ND_VAR:
+            // 配列(文字列リテラルを含む)は先頭のアドレスになる
+            if(node->type->kind == TY_ARRAY){
+                return eval_address(node, var, tok);
+            }
+            break;
+        case ND_ADDR:
+            return eval_address(node->lhs, var, tok);
+        case ND_CAST:
+        {
+            long val = eval_static(node->lhs, var, tok);
+            return *var ? val : truncate_value(val, node->type);
+        }
+        case ND_ADD:
+        {
+            Ident* lvar = NULL;
+            Ident* rvar = NULL;
+            long val = eval_static(node->lhs, &lvar, tok) + eval_static(node->rhs, &rvar, tok);
+            if(lvar && rvar){
+                break;
+            }
+            *var = lvar ? lvar : rvar;
+            return val;
+        }
+        case ND_SUB:
+        {
+            Ident* rvar = NULL;
+            long val = eval_static(node->lhs, var, tok) - eval_static(node->rhs, &rvar, tok);
+            if(rvar){
+                break;
+            }
+            return val;
+        }
+        default:
+            return exchange_constant_expr(node)->val;
+    }
+    error_tok(tok, "initializer element is not constant.\n");
+    return 0;
+}
+
+static void scalar_initializer(Type* ty, int offset){
+    bool braced = consume_token(TK_L_BRACKET);
+    Token* tok = token;
+    Ident* var = NULL;
+    long val = eval_static(assign(), &var, tok);
+    if(var){
+        if(ty->size != 8){
+            error_tok(tok, "initializer element is not computable at load time.\n");
+        }
+        Reloc* reloc = calloc(1, sizeof(Reloc));
+        reloc->offset = offset;
+        reloc->ident = var;
+        reloc->addend = val;
+        init_reloc = init_reloc->next = reloc;
+    } else {
+        memcpy(init_data + offset, &val, ty->size);
+    }
+    close_initializer(braced);
+}
+
+// 文字列リテラルのエスケープシーケンスを解釈して書く。書いた文字数を返す
+static int string_initializer(Token* tok, int offset){
+    int len = 0;
+    for(char* p = tok->pos; p < tok->pos + tok->len; p++){
+        char c = *p;
+        if(c == '\\'){
+            p++;
+            switch(*p){
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'a': c = '\a'; break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'v': c = '\v'; break;
+                case 'e': c = 27; break;
+                case 'x':
+                    c = 0;
+                    while(isxdigit(p[1])){
+                        p++;
+                        c = c * 16 + (isdigit(*p) ? *p - '0' : tolower(*p) - 'a' + 10);
+                    }
+                    break;
+                default:
+                    if('0' <= *p && *p <= '7'){
+                        c = 0;
+                        for(int i = 0; i < 3 && '0' <= *p && *p <= '7'; i++, p++){
+                            c = c * 8 + *p - '0';
+                        }
+                        p--;
+                    } else {
+                        c = *p;
+                    }
+                    break;
+            }
+        }
+        init_reserve(offset + len + 1);
+        init_data[offset + len++] = c;
+    }
+    init_reserve(offset + len + 1);
+    return len;
+}
+
+// 配列の初期値。大きさを省略した配列(array_len == 0)は要素の数で大きさを決める
+static Type* array_initializer(Type* ty, int offset){
+    Type* base = ty->ptr_to;
+    bool braced = consume_token(TK_L_BRACKET);
+
+    int len = 0;
+    if(base->size == 1 && token->kind == TK_STRING_LITERAL){
+        // 文字の配列は、終端の0まで入れる(大きさが決まっていれば収まる分だけ)
+        int n = string_initializer(consume_string_literal(), offset);
+        len = n + 1;
+        if(ty->array_len && len > ty->array_len){
+            if(n > ty->array_len){
+                error_tok(token, "initializer-string for char array is too long.\n");
+            }
+            len = ty->array_len;
+        }
+    } else {
+        while((ty->array_len == 0 || len < ty->array_len) && next_element(len)){
+            init_reserve(offset + (len + 1) * base->size);
+            initializer(base, offset + len * base->size);
+            len++;
+        }
+    }
+    close_initializer(braced);
+
+    if(ty->array_len == 0){
+        ty = array_of(base, len);
+    }
+    init_reserve(offset + ty->size);
+    return ty;
+}
+
+// 構造体の初期値。共用体は最初のメンバーだけに入れる
+static void struct_initializer(Type* ty, int offset){
+    bool braced = consume_token(TK_L_BRACKET);
+    int i = 0;
+    for(Member* mem = ty->member; mem && next_element(i); mem = mem->next){
+        initializer(mem->ident->type, offset + mem->ident->offset);
+        i++;
+        if(ty->kind == TY_UNION){
+            break;
+        }
+    }
+    close_initializer(braced);
+}
+
+static void initializer(Type* ty, int offset){
+    if(ty->kind == TY_ARRAY){
+        array_initializer(ty, offset);
+    } else if(ty->kind == TY_STRUCT || ty->kind == TY_UNION){
+        struct_initializer(ty, offset);
+    } else {
+        scalar_initializer(ty, offset);
+    }
+}
 
 static void count_decl_spec(int* type_flg, int flg, Token* tok){
     // error check
@@ -559,6 +864,12 @@ static bool check_storage_class_keyword(StorageClassKind* sck, Token* tok){
         return true;
     }
 
+    // inlineは記憶域クラスではないので、他の指定と組み合わせられる
+    if(consume_token(TK_INLINE)){
+        decl_inline = true;
+        return true;
+    }
+
     return false;
 }
 
@@ -746,48 +1057,19 @@ static Type* struct_or_union_spec(bool is_union){
                 // すでに宣言されているが、不完全な構造体
                 ty->member = struct_or_union_member();
                 ty->is_imcomplete = false;
-                
-                if(is_union){
-                    int max_size = 0;
-                    for(Member* cur = ty->member; cur; cur = cur->next){
-                        cur->ident->offset = 0;
-                        if(max_size < cur->ident->type->size){
-                            max_size = cur->ident->type->size;
-                        }
-                    }
-                    ty->size = max_size;
-                } else {
-                    int offset = 0;
-                    for(Member* cur = ty->member; cur; cur = cur->next){
-                        cur->ident->offset = offset;
-                        offset += cur->ident->type->size;
-                    }
-                    ty->size = offset;
+                layout_struct(ty, is_union);
+                if(print_layout){
+                    report_layout(ty, tok);
                 }
-
             } else {
                 // まだ登録されていない構造体
                 ty = new_type(is_union ? TY_UNION : TY_STRUCT, 0);
                 ty->member = struct_or_union_member();
                 ty->name = tok;
                 ty->is_imcomplete = false;
-
-                if(is_union){
-                    int max_size = 0;
-                    for(Member* cur = ty->member; cur; cur = cur->next){
-                        cur->ident->offset = 0;
-                        if(max_size < cur->ident->type->size){
-                            max_size = cur->ident->type->size;
-                        }
-                    }
-                    ty->size = max_size;
-                } else {
-                    int offset = 0;
-                    for(Member* cur = ty->member; cur; cur = cur->next){
-                        cur->ident->offset = offset;
-                        offset += cur->ident->type->size;
-                    }
-                    ty->size = offset;
+                layout_struct(ty, is_union);
+                if(print_layout){
+                    report_layout(ty, tok);
                 }
                 register_tag(ty);
             }
@@ -804,27 +1086,14 @@ static Type* struct_or_union_spec(bool is_union){
     } else {
         // 無名構造体
         Type* ty = new_type(is_union ? TY_UNION : TY_STRUCT, 0);
+        Token* pos = get_token();
         expect_token(TK_L_BRACKET);
         ty->member = struct_or_union_member();
-
-            if(is_union){
-                int max_size = 0;
-                for(Member* cur = ty->member; cur; cur = cur->next){
-                    cur->ident->offset = 0;
-                    if(max_size < cur->ident->type->size){
-                        max_size = cur->ident->type->size;
-                    }
-                }
-                ty->size = max_size;
-            } else {
-                int offset = 0;
-                for(Member* cur = ty->member; cur; cur = cur->next){
-                    cur->ident->offset = offset;
-                    offset += cur->ident->type->size;
-                }
-                ty->size = offset;
-            }
+        layout_struct(ty, is_union);
         ty->name = &unnamed_struct_token;
+        if(print_layout){
+            report_layout(ty, pos);
+        }
         return ty;
     }
 }
@@ -924,9 +1193,9 @@ static Node* exchange_constant_expr(Node* expr){
     expr->lhs = exchange_constant_expr(expr->lhs);
     expr->rhs = exchange_constant_expr(expr->rhs);
 
-    int retval = 0;
-    int lhs = expr->lhs->val;
-    int rhs = expr->rhs->val;
+    long retval = 0;
+    long lhs = expr->lhs->val;
+    long rhs = expr->rhs->val;
     switch(expr->kind){
         case ND_ADD:
             retval = lhs + rhs;
@@ -938,9 +1207,15 @@ static Node* exchange_constant_expr(Node* expr){
             retval = lhs * rhs;
             break;
         case ND_DIV:
+            if(rhs == 0){
+                error("division by zero in constant expression.\n");
+            }
             retval = lhs / rhs;
             break;
         case ND_MOD:
+            if(rhs == 0){
+                error("division by zero in constant expression.\n");
+            }
             retval = lhs % rhs;
             break;
         case ND_EQUAL:
@@ -979,7 +1254,7 @@ static Node* exchange_constant_expr(Node* expr){
         case ND_COND_EXPR:
         {
             expr->cond = exchange_constant_expr(expr->cond);
-            int cond = expr->cond->val;
+            long cond = expr->cond->val;
             retval = cond ? lhs : rhs;
             break;
         }
@@ -1281,13 +1556,26 @@ static Node* unary(){
         } else {
             node = unary();
             add_type(node);
-            if(node->type->kind == TY_ARRAY){
-                node = new_node_num(node->type->array_len * node->type->size);
-            } else if(node->type->kind == TY_STRUCT || node->type->kind == TY_UNION){
-                node = new_node_num(node->type->size);
-            } else {
-                node = new_node_num(node->type->size);
+            node = new_node_num(node->type->size);
+        }
+        if(is_l_paren){
+            expect_token(TK_R_PAREN);
+        }
+        return node;
+    } else if(consume_token(TK_ALIGNOF)){
+        bool is_l_paren = consume_token(TK_L_PAREN);
+        Node* node = NULL;
+        if(is_type()){
+            StorageClassKind sck = 0;
+            Type* ty = declspec(&sck);
+            while(consume_token(TK_MUL)){
+                ty = pointer_to(ty);
             }
+            node = new_node_num(ty->align);
+        } else {
+            node = unary();
+            add_type(node);
+            node = new_node_num(node->type->align);
         }
         if(is_l_paren){
             expect_token(TK_R_PAREN);
@@ -1756,6 +2044,7 @@ bool is_type(){
         || token->kind == TK_RESTRICT
         || token->kind == TK_EXTERN
         || token->kind == TK_STATIC
+        || token->kind == TK_INLINE
         || token->kind == TK_BOOL
         || token->kind == TK_VOID
         || token->kind == TK_INT
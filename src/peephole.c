@@ -0,0 +1,503 @@
+#include "mcc2.h"
+
+/*
+    のぞき穴最適化 (peephole optimization)
+
+    -O のときは、関数ひとつ分のアセンブリをいったん一時ファイルに出力させ、
+    命令の並びをパターンの表と照らし合わせて書き換えてから、本来の出力先に出す。
+        self_mov        mov r, r                        -> (削除)
+        mov_back        mov a, b / mov b, a             -> mov a, b
+        imm_forward     mov r, imm / op x, r            -> op x, imm     (rがその後使われない)
+        dead_mov        mov r, x                        -> (削除)       (rがその後使われない)
+        cmp_zero        cmp r, 0                        -> test r, r
+        setcc_branch    setcc al / movzb r, al / test r, r / je L
+                                                        -> setcc al / movzb r, al / jncc L
+        branch_over_jmp jcc L1 / jmp L2 / L1:           -> jncc L2 / L1:
+        jmp_next        jmp L / L:                      -> L:
+    パターンごとの適用回数は --stats に peephole_名前 として出る。
+
+    レジスタがその後使われないかは、同じブロックの中で読まれる前に
+    書き潰されることを確かめられたときだけとする。
+*/
+
+typedef enum LineKind {
+    LN_INSN,        // 命令
+    LN_LABEL,       // ラベル
+    LN_COMMENT,     // コメント。命令の並びを調べるときは読み飛ばす
+    LN_OTHER,       // ディレクティブなど
+} LineKind;
+
+typedef struct Line {
+    LineKind kind;
+    char*   text;       // 行の文字列(改行を含まない)
+    char*   op;         // 命令の名前
+    char*   dst;        // 1番目のオペランド
+    char*   src;        // 2番目のオペランド
+    bool    deleted;
+} Line;
+
+typedef bool (*PatternFn)(int i);
+
+typedef struct Pattern {
+    char*       name;
+    PatternFn   apply;      // 行iから始まる並びを書き換えたらtrueを返す
+} Pattern;
+
+static Line* lines;
+static int nlines;
+
+static FILE* saved_fp;
+
+// レジスタの名前の表。同じ行は同じレジスタの一部
+static const char* reg_names[][4] = {
+    { "rax", "eax", "ax", "al" },
+    { "rbx", "ebx", "bx", "bl" },
+    { "rcx", "ecx", "cx", "cl" },
+    { "rdx", "edx", "dx", "dl" },
+    { "rsi", "esi", "si", "sil" },
+    { "rdi", "edi", "di", "dil" },
+    { "rbp", "ebp", "bp", "bpl" },
+    { "rsp", "esp", "sp", "spl" },
+    { "r8", "r8d", "r8w", "r8b" },
+    { "r9", "r9d", "r9w", "r9b" },
+    { "r10", "r10d", "r10w", "r10b" },
+    { "r11", "r11d", "r11w", "r11b" },
+    { "r12", "r12d", "r12w", "r12b" },
+    { "r13", "r13d", "r13w", "r13b" },
+    { "r14", "r14d", "r14w", "r14b" },
+    { "r15", "r15d", "r15w", "r15b" },
+};
+#define NUM_REG_NAMES   (sizeof(reg_names) / sizeof(reg_names[0]))
+#define REG_RAX     0
+#define REG_RCX     2
+#define REG_RDX     3
+#define REG_RSI     4
+#define REG_RDI     5
+#define REG_RBP     6
+#define REG_RSP     7
+
+// 条件の反転の表
+static const char* cond_pairs[][2] = {
+    { "e", "ne" },
+    { "l", "ge" },
+    { "le", "g" },
+    { "b", "ae" },
+    { "be", "a" },
+};
+#define NUM_COND_PAIRS  (sizeof(cond_pairs) / sizeof(cond_pairs[0]))
+
+// レジスタの名前なら、レジスタの番号を返す。wide64なら64bitの名前だけを受け付ける
+static int reg_family(const char* name, int len, bool wide64){
+    for(int i = 0; i < NUM_REG_NAMES; i++){
+        for(int j = 0; j < (wide64 ? 1 : 4); j++){
+            if(strlen(reg_names[i][j]) == len && strncmp(reg_names[i][j], name, len) == 0){
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+// オペランドが64bitのレジスタそのものなら、その番号を返す
+static int reg64(const char* operand){
+    return operand ? reg_family(operand, strlen(operand), true) : -1;
+}
+
+// オペランドがレジスタfamilyのどこかを参照しているか
+static bool mentions(const char* operand, int family){
+    if(!operand){
+        return false;
+    }
+    const char* p = operand;
+    while(*p){
+        if(isalnum(*p)){
+            const char* q = p;
+            while(isalnum(*q)) q++;
+            if(reg_family(p, q - p, false) == family){
+                return true;
+            }
+            p = q;
+        } else {
+            p++;
+        }
+    }
+    return false;
+}
+
+static char* trim(char* s){
+    while(*s == ' ' || *s == '\t') s++;
+    char* e = s + strlen(s);
+    while(e > s && (e[-1] == ' ' || e[-1] == '\t')) e--;
+    *e = '\0';
+    return s;
+}
+
+static void parse_line(Line* line){
+    char* s = calloc(strlen(line->text) + 1, sizeof(char));
+    strcpy(s, line->text);
+    s = trim(s);
+    int len = strlen(s);
+    if(len == 0 || s[0] == '#'){
+        line->kind = LN_COMMENT;
+    } else if(s[len - 1] == ':' && !strchr(s, ' ')){
+        line->kind = LN_LABEL;
+        s[len - 1] = '\0';
+        line->op = s;
+    } else if(s[0] == '.'){
+        line->kind = LN_OTHER;
+    } else {
+        line->kind = LN_INSN;
+        char* sp = strchr(s, ' ');
+        if(sp){
+            *sp = '\0';
+            char* comma = strchr(sp + 1, ',');
+            if(comma){
+                *comma = '\0';
+                line->src = trim(comma + 1);
+            }
+            line->dst = trim(sp + 1);
+        }
+        line->op = s;
+    }
+}
+
+// 書き換えた命令の文字列を作り直す
+static void set_insn(Line* line, char* op, char* dst, char* src){
+    line->op = op;
+    line->dst = dst;
+    line->src = src;
+    if(src){
+        line->text = format_string("  %s %s, %s", op, dst, src);
+    } else if(dst){
+        line->text = format_string("  %s %s", op, dst);
+    } else {
+        line->text = format_string("  %s", op);
+    }
+}
+
+// iの次の行。コメントと削除した行は読み飛ばす。なければ-1
+static int next_line(int i){
+    for(int j = i + 1; j < nlines; j++){
+        if(!lines[j].deleted && lines[j].kind != LN_COMMENT){
+            return j;
+        }
+    }
+    return -1;
+}
+
+static bool is_insn(int i, char* op){
+    return i != -1 && lines[i].kind == LN_INSN && strcmp(lines[i].op, op) == 0;
+}
+
+// 条件分岐なら、条件の部分(jneならne)を返す
+static const char* jcc_cond(int i){
+    if(i == -1 || lines[i].kind != LN_INSN || lines[i].op[0] != 'j' || strcmp(lines[i].op, "jmp") == 0){
+        return NULL;
+    }
+    return lines[i].op + 1;
+}
+
+static const char* invert_cond(const char* cond){
+    for(int i = 0; i < NUM_COND_PAIRS; i++){
+        if(strcmp(cond_pairs[i][0], cond) == 0) return cond_pairs[i][1];
+        if(strcmp(cond_pairs[i][1], cond) == 0) return cond_pairs[i][0];
+    }
+    return NULL;
+}
+
+// 32bitに収まる直値なら、その値をvalに入れてtrueを返す
+static bool parse_imm32(const char* operand, long* val){
+    if(!operand || !isdigit(operand[0])){
+        return false;
+    }
+    char* end;
+    unsigned long v = strtoul(operand, &end, 10);
+    if(*end || (long)v != (int)v){
+        return false;
+    }
+    *val = (long)v;
+    return true;
+}
+
+// 書き込み先を読まずに書き込むだけの命令か
+static bool is_write_only(Line* line){
+    return strcmp(line->op, "mov") == 0 || strcmp(line->op, "lea") == 0
+        || strncmp(line->op, "movz", 4) == 0 || strncmp(line->op, "movs", 4) == 0
+        || strncmp(line->op, "set", 3) == 0;
+}
+
+// 命令がレジスタfamilyを読むか。オペランドに現れなくても読む命令も考える
+static bool reads_reg(Line* line, int family){
+    if(strcmp(line->op, "cqo") == 0){
+        return family == REG_RAX;
+    }
+    // rep movsbはrcx、rsi、rdiを暗黙に使う
+    if(strcmp(line->op, "rep") == 0){
+        return family == REG_RCX || family == REG_RSI || family == REG_RDI;
+    }
+    // 除算とオペランドがひとつの乗算は、raxとrdxを暗黙に使う
+    if(strcmp(line->op, "idiv") == 0 || strcmp(line->op, "div") == 0 || strcmp(line->op, "mul") == 0
+        || (strcmp(line->op, "imul") == 0 && !line->src)){
+        if(family == REG_RAX || family == REG_RDX) return true;
+    }
+    if(mentions(line->src, family)){
+        return true;
+    }
+    if(line->dst && is_write_only(line) && reg_family(line->dst, strlen(line->dst), false) == family){
+        return false;
+    }
+    return mentions(line->dst, family);
+}
+
+// 命令がレジスタfamilyの値をすべて書き潰すか(32bitの書き込みは上位を0にする)
+static bool kills_reg(Line* line, int family){
+    if(!line->dst || !is_write_only(line)){
+        return false;
+    }
+    return strcmp(line->dst, reg_names[family][0]) == 0 || strcmp(line->dst, reg_names[family][1]) == 0;
+}
+
+// 行iの後でレジスタfamilyの値が使われないことを確かめられればtrue
+static bool dead_after(int i, int family){
+    if(family == REG_RBP || family == REG_RSP){
+        return false;
+    }
+    for(int j = next_line(i); j != -1; j = next_line(j)){
+        Line* line = &lines[j];
+        if(line->kind != LN_INSN || line->op[0] == 'j'
+            || strcmp(line->op, "call") == 0 || strcmp(line->op, "ret") == 0){
+            return false;
+        }
+        if(reads_reg(line, family)){
+            return false;
+        }
+        if(kills_reg(line, family)){
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool self_mov(int i){
+    Line* line = &lines[i];
+    if(strcmp(line->op, "mov") != 0 || reg64(line->dst) == -1 || !line->src || strcmp(line->dst, line->src) != 0){
+        return false;
+    }
+    line->deleted = true;
+    return true;
+}
+
+static bool mov_back(int i){
+    Line* a = &lines[i];
+    int j = next_line(i);
+    if(strcmp(a->op, "mov") != 0 || reg64(a->dst) == -1 || reg64(a->src) == -1 || !is_insn(j, "mov")){
+        return false;
+    }
+    Line* b = &lines[j];
+    if(!b->src || strcmp(a->dst, b->src) != 0 || strcmp(a->src, b->dst) != 0){
+        return false;
+    }
+    b->deleted = true;
+    return true;
+}
+
+static bool imm_forward(int i){
+    Line* a = &lines[i];
+    long val;
+    int family = reg64(a->dst);
+    if(strcmp(a->op, "mov") != 0 || family == -1 || !parse_imm32(a->src, &val)){
+        return false;
+    }
+    int j = next_line(i);
+    if(j == -1 || lines[j].kind != LN_INSN){
+        return false;
+    }
+    Line* b = &lines[j];
+    static char* ops[] = { "mov", "add", "sub", "imul", "and", "or", "xor", "cmp" };
+    bool ok = false;
+    for(int k = 0; k < sizeof(ops) / sizeof(ops[0]); k++){
+        if(strcmp(b->op, ops[k]) == 0) ok = true;
+    }
+    if(!ok || !b->src || strcmp(b->src, a->dst) != 0 || mentions(b->dst, family)){
+        return false;
+    }
+    // 大きさのわからないメモリには直値を書き込めない
+    if(strchr(b->dst, '[') && !strstr(b->dst, "PTR")){
+        return false;
+    }
+    if(!dead_after(j, family)){
+        return false;
+    }
+    set_insn(b, b->op, b->dst, format_string("%ld", val));
+    a->deleted = true;
+    return true;
+}
+
+static bool dead_mov(int i){
+    Line* line = &lines[i];
+    int family = reg64(line->dst);
+    if(strcmp(line->op, "mov") != 0 || family == -1 || !dead_after(i, family)){
+        return false;
+    }
+    line->deleted = true;
+    return true;
+}
+
+static bool cmp_zero(int i){
+    Line* line = &lines[i];
+    if(strcmp(line->op, "cmp") != 0 || reg64(line->dst) == -1 || !line->src || strcmp(line->src, "0") != 0){
+        return false;
+    }
+    set_insn(line, "test", line->dst, line->dst);
+    return true;
+}
+
+static bool setcc_branch(int i){
+    Line* set = &lines[i];
+    if(strncmp(set->op, "set", 3) != 0 || !set->dst || strcmp(set->dst, "al") != 0){
+        return false;
+    }
+    int j = next_line(i);
+    int k = next_line(j);
+    int l = next_line(k);
+    if(!is_insn(j, "movzb") || !is_insn(k, "test") || !jcc_cond(l)){
+        return false;
+    }
+    char* r = lines[j].dst;
+    if(strcmp(lines[j].src, "al") != 0 || strcmp(lines[k].dst, r) != 0 || strcmp(lines[k].src, r) != 0){
+        return false;
+    }
+    const char* cond = set->op + 3;
+    const char* jcond = jcc_cond(l);
+    if(strcmp(jcond, "e") == 0){
+        cond = invert_cond(cond);
+    } else if(strcmp(jcond, "ne") != 0){
+        return false;
+    }
+    if(!cond){
+        return false;
+    }
+    // movzbはフラグを変えないので、比較の結果でそのまま分岐する
+    lines[k].deleted = true;
+    set_insn(&lines[l], format_string("j%s", cond), lines[l].dst, NULL);
+    return true;
+}
+
+// 後ろに続くラベルの中にlabelがあるか
+static bool label_follows(int i, char* label){
+    for(int j = next_line(i); j != -1 && lines[j].kind == LN_LABEL; j = next_line(j)){
+        if(strcmp(lines[j].op, label) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool branch_over_jmp(int i){
+    const char* cond = jcc_cond(i);
+    int j = next_line(i);
+    if(!cond || !invert_cond(cond) || !is_insn(j, "jmp") || !label_follows(j, lines[i].dst)){
+        return false;
+    }
+    set_insn(&lines[i], format_string("j%s", invert_cond(cond)), lines[j].dst, NULL);
+    lines[j].deleted = true;
+    return true;
+}
+
+static bool jmp_next(int i){
+    Line* line = &lines[i];
+    if(line->op[0] != 'j' || !line->dst || !label_follows(i, line->dst)){
+        return false;
+    }
+    line->deleted = true;
+    return true;
+}
+
+static Pattern patterns[] = {
+    { "self_mov",        self_mov },
+    { "mov_back",        mov_back },
+    { "imm_forward",     imm_forward },
+    { "dead_mov",        dead_mov },
+    { "cmp_zero",        cmp_zero },
+    { "setcc_branch",    setcc_branch },
+    { "branch_over_jmp", branch_over_jmp },
+    { "jmp_next",        jmp_next },
+};
+#define NUM_PATTERNS    (sizeof(patterns) / sizeof(patterns[0]))
+
+// 関数のアセンブリを一時ファイルに出力させる
+void peephole_begin(){
+    saved_fp = fp;
+    fp = tmpfile();
+    if(!fp){
+        error("cannot open temporary file\n");
+    }
+}
+
+static char* read_line(FILE* in){
+    int cap = 128;
+    int len = 0;
+    char* buf = malloc(cap);
+    int c;
+    while((c = fgetc(in)) != EOF && c != '\n'){
+        if(len + 1 == cap){
+            cap *= 2;
+            buf = realloc(buf, cap);
+        }
+        buf[len++] = c;
+    }
+    if(c == EOF && len == 0){
+        free(buf);
+        return NULL;
+    }
+    buf[len] = '\0';
+    return buf;
+}
+
+// 一時ファイルの命令を書き換えて、本来の出力先に出す
+void peephole_end(){
+    FILE* in = fp;
+    fp = saved_fp;
+    rewind(in);
+
+    nlines = 0;
+    int cap = 0;
+    lines = NULL;
+    for(char* text = read_line(in); text; text = read_line(in)){
+        if(nlines == cap){
+            cap = cap ? cap * 2 : 256;
+            lines = realloc(lines, sizeof(Line) * cap);
+        }
+        Line* line = &lines[nlines++];
+        memset(line, 0, sizeof(Line));
+        line->text = text;
+        parse_line(line);
+    }
+    fclose(in);
+
+    long hits[NUM_PATTERNS] = { 0 };
+    bool changed = true;
+    while(changed){
+        changed = false;
+        for(int i = 0; i < nlines; i++){
+            for(int p = 0; p < NUM_PATTERNS; p++){
+                if(lines[i].deleted || lines[i].kind != LN_INSN){
+                    break;
+                }
+                if(patterns[p].apply(i)){
+                    hits[p]++;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    for(int p = 0; p < NUM_PATTERNS; p++){
+        add_stat(format_string("peephole_%s", patterns[p].name), hits[p]);
+    }
+    for(int i = 0; i < nlines; i++){
+        if(!lines[i].deleted){
+            print("%s\n", lines[i].text);
+        }
+    }
+}
@@ -164,6 +164,19 @@ Token* preprocess(Token* token){
                                     error("too many once header paths");
                                 }
                                 once_header_paths[once_header_paths_cnt++] = target->file->name;
+                            } else if(strcmp(get_token_string(command), "unroll") == 0 && !is_preprocess){
+                                // 次のループに展開回数を伝えるトークンを残す
+                                Token* unroll = calloc(1, sizeof(Token));
+                                memcpy(unroll, command, sizeof(Token));
+                                unroll->kind = TK_PRAGMA_UNROLL;
+                                unroll->val = 0;
+                                Token* count = next_token(command);
+                                if(count->kind == TK_NUM){
+                                    unroll->val = count->val;
+                                }
+                                unroll->next = next_newline(target);
+                                cur->next = unroll;
+                                break;
                             }
                         }
                     }
@@ -0,0 +1,576 @@
+#include "mcc2.h"
+
+/*
+    レジスタ割り当て (線形走査)
+
+    gen_ir()の後、関数ごとに仮想レジスタへ実レジスタを割り当てる。
+    gen_x86()は割り当て済みの実レジスタをそのまま使うので、
+    ひとつの値を何度読み出してもよく、ブロックをまたいで持ち越してもよい。
+
+        rbx, r12〜r15   : callee-savedなので関数呼び出しをまたぐ値に優先して使う
+        rdi〜r9         : 空いていれば使う。関数呼び出しをまたぐときは前後で退避・復帰する
+        r10, r11        : 退避した仮想レジスタを、命令の直前に読み込み、直後に書き戻すのに使う(3つ目はrax)
+
+    ブロックの配置順に命令へ番号を振り、命令iでの読み出しを2i、書き込みを2i+1とする。
+    生存情報から仮想レジスタごとに区間[開始, 終了]を作り、開始の早い順に
+    空いている実レジスタを割り当てる。空きがなければ、次に使う位置が
+    最も遠い区間を退避領域に追い出す。退避領域はローカル変数の下に必要な数だけ
+    確保し、区間が重ならない仮想レジスタどうしで使い回す。
+    変数のアドレスや直値のように、命令ひとつで作り直せる値は退避せずに、
+    使う直前に作り直す。
+
+    除算のrdx、可変シフトのrcx、構造体コピーのr8(大きいものはrdi、rsi、rcx)、引数レジスタのように
+    命令が決まった実レジスタを使う区間では、そのレジスタを割り当てない。
+*/
+
+// 関数呼び出しをまたがない区間は、caller-savedのレジスタから使う
+static const PhysReg caller_saved[] = { PR_R8, PR_R9, PR_RCX, PR_RDX, PR_RSI, PR_RDI };
+static const PhysReg callee_saved[] = { PR_RBX, PR_R12, PR_R13, PR_R14, PR_R15 };
+static const PhysReg scratch_regs[] = { PR_R10, PR_R11, PR_RAX };
+
+#define NUM_CALLER_SAVED    (sizeof(caller_saved) / sizeof(caller_saved[0]))
+#define NUM_CALLEE_SAVED    (sizeof(callee_saved) / sizeof(callee_saved[0]))
+
+typedef struct Range {
+    int from;
+    int to;
+} Range;
+
+static int* start;
+static int* end;
+static int** uses;          // [vn] 読み出す位置(昇順)
+static int* nuses;
+static int* slot;           // [vn] 退避領域の番号。-1: 退避しない、REMAT: 作り直す
+static IR** remat;          // [vn] 作り直せる値の定義
+static int* slot_end;       // [退避領域] 使っている区間の終わり
+static int nslots;          // 使った退避領域の数
+static int frame_base;      // 退避領域の上端(rbpからのオフセット)
+
+static Range* fixed[PR_NUM];    // 命令が実レジスタを使う区間
+static int nfixed[PR_NUM];
+
+static IR** calls;          // 関数呼び出しの命令と、その位置
+static int* call_pos;
+static int ncalls;
+
+#define REMAT   -2
+
+static void prepare(CFG* cfg);
+static void build_intervals(CFG* cfg);
+static void linear_scan(CFG* cfg);
+static void rewrite_spills(CFG* cfg);
+static void save_caller_saved(CFG* cfg);
+static void finish_frame(CFG* cfg);
+
+void regalloc(CFG* cfg){
+    add_stat("spilled_vregs", 0);
+    add_stat("caller_saves", 0);
+    frame_base = (cfg->func->stack_size + 7) / 8 * 8;
+    prepare(cfg);
+    compute_liveness(cfg);
+    build_intervals(cfg);
+    linear_scan(cfg);
+    rewrite_spills(cfg);
+    save_caller_saved(cfg);
+    finish_frame(cfg);
+}
+
+// 直値のままオペランドにできるか
+static bool imm_operand_ok(IR* ir, Reg** operand){
+    Reg* reg = *operand;
+    if(ir->cmd == IR_MOV || ir->cmd == IR_LOAD_ARG_REG){
+        return true;
+    }
+    if(operand != &ir->s2 || (long)reg->val != (int)reg->val){
+        return false;
+    }
+    switch(ir->cmd){
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+        case IR_BIT_AND:
+        case IR_BIT_XOR:
+        case IR_BIT_OR:
+        case IR_L_BIT_SHIFT:
+        case IR_R_BIT_SHIFT:
+        case IR_NOT_EQUAL:
+        case IR_LT:
+        case IR_LE:
+        case IR_JE:
+        case IR_JNE:
+        case IR_JLT:
+        case IR_JLE:
+        case IR_JGT:
+        case IR_JGE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+    割り当ての前に命令を整える
+        - レジスタの解放命令は使わないので消す
+        - t = s1 op s2 は、mov t, s1 / op t, s2 にする
+          (バックエンドはs2を読む前にtへ書き込むので、tとs2を同じレジスタにできない)
+        - レジスタに載せる必要のある直値は、先に仮想レジスタへ移す
+*/
+static void prepare(CFG* cfg){
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+            if(ir->cmd == IR_RELEASE_REG || ir->cmd == IR_RELEASE_REG_ALL){
+                remove_ir(bb, ir);
+                continue;
+            }
+
+            // SSA形式を通らないときは、直値に書き込む命令が残っている。
+            // 直値を仮想レジスタに変えて、直前で値を設定する
+            Reg** d = ir_def_slot(ir);
+            if(d && *d && (*d)->kind == REG_IMM){
+                Reg* reg = *d;
+                insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, reg, new_RegImm(reg->val)));
+                reg->kind = REG_REG;
+                cfg_add_reg(cfg, reg);
+            }
+
+            if(is_binop(ir->cmd) && ir->t){
+                if(ir->t != ir->s1){
+                    if(ir->s2 == ir->t){
+                        Reg* tmp = cfg_new_reg(cfg, ir->s2);
+                        insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, tmp, ir->s2));
+                        ir->s2 = tmp;
+                    }
+                    insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, ir->t, ir->s1));
+                    ir->s1 = ir->t;
+                }
+                ir->t = NULL;
+            }
+
+            Reg** slots[MAX_IR_OPERANDS];
+            int nslot = ir_operand_slots(ir, slots);
+            for(int i = 0; i < nslot; i++){
+                if((*slots[i])->kind == REG_IMM && !imm_operand_ok(ir, slots[i])){
+                    Reg* tmp = cfg_new_reg(cfg, NULL);
+                    insert_ir_before(bb, ir, make_IR(IR_MOV, NULL, tmp, *slots[i]));
+                    *slots[i] = tmp;
+                }
+            }
+        }
+    }
+}
+
+static void extend(int vn, int pos){
+    if(pos < start[vn]) start[vn] = pos;
+    if(pos > end[vn]) end[vn] = pos;
+}
+
+static void add_use(int vn, int pos){
+    if((nuses[vn] & (nuses[vn] - 1)) == 0){
+        uses[vn] = realloc(uses[vn], sizeof(int) * (nuses[vn] ? nuses[vn] * 2 : 1));
+    }
+    uses[vn][nuses[vn]++] = pos;
+}
+
+// 命令がfrom〜toで実レジスタregを使う
+static void add_fixed(PhysReg reg, int from, int to){
+    fixed[reg] = realloc(fixed[reg], sizeof(Range) * (nfixed[reg] + 1));
+    fixed[reg][nfixed[reg]].from = from;
+    fixed[reg][nfixed[reg]].to = to;
+    nfixed[reg]++;
+}
+
+static void build_intervals(CFG* cfg){
+    int n = cfg->nregs;
+    start = calloc(n, sizeof(int));
+    end = calloc(n, sizeof(int));
+    uses = calloc(n, sizeof(int*));
+    nuses = calloc(n, sizeof(int));
+    remat = calloc(n, sizeof(IR*));
+    int* ndefs = calloc(n, sizeof(int));
+    for(int i = 0; i < n; i++){
+        start[i] = 0x7fffffff;
+        end[i] = -1;
+    }
+    for(int r = 0; r < PR_NUM; r++){
+        nfixed[r] = 0;
+    }
+    ncalls = 0;
+    calls = NULL;
+    call_pos = NULL;
+
+    int arg_pos[6];         // 引数レジスタに書き込んだ位置。-1: 書き込んでいない
+    for(int i = 0; i < 6; i++){
+        arg_pos[i] = -1;
+    }
+    int pos = 0;
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        int from = pos;
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int i = 0; i < nuse; i++){
+                extend((*slots[i])->vn, pos);
+                add_use((*slots[i])->vn, pos);
+            }
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                extend((*d)->vn, pos + 1);
+                if(ir->cmd == IR_REL || (ir->cmd == IR_MOV && ir->s2->kind == REG_IMM)){
+                    remat[(*d)->vn] = ir;
+                }
+                ndefs[(*d)->vn]++;
+            }
+
+            switch(ir->cmd){
+                case IR_DIV:
+                case IR_MOD:
+                case IR_MULHI:
+                    add_fixed(PR_RDX, pos, pos + 1);
+                    break;
+                case IR_L_BIT_SHIFT:
+                case IR_R_BIT_SHIFT:
+                    if(ir->s2->kind != REG_IMM){
+                        add_fixed(PR_RCX, pos, pos + 1);
+                    }
+                    break;
+                case IR_COPY:
+                    add_fixed(PR_R8, pos, pos + 1);
+                    if(ir->size > COPY_REP_SIZE){
+                        add_fixed(PR_RDI, pos, pos + 1);
+                        add_fixed(PR_RSI, pos, pos + 1);
+                        add_fixed(PR_RCX, pos, pos + 1);
+                    }
+                    break;
+                case IR_STORE_ARG_REG:
+                    // 関数の入口から、引数レジスタを読み出すまで
+                    add_fixed(PR_RDI + ir->s2->val, 0, pos);
+                    break;
+                case IR_VA_START:
+                    for(int i = 0; i < 6; i++){
+                        add_fixed(PR_RDI + i, 0, pos);
+                    }
+                    break;
+                case IR_LOAD_ARG_REG:
+                    arg_pos[ir->t->val] = pos + 1;
+                    break;
+                case IR_FN_CALL:
+                    // 引数レジスタに書き込んでから、関数を呼び出すまで
+                    for(int i = 0; i < 6; i++){
+                        if(arg_pos[i] != -1){
+                            add_fixed(PR_RDI + i, arg_pos[i], pos);
+                            arg_pos[i] = -1;
+                        }
+                    }
+                    calls = realloc(calls, sizeof(IR*) * (ncalls + 1));
+                    call_pos = realloc(call_pos, sizeof(int) * (ncalls + 1));
+                    calls[ncalls] = ir;
+                    call_pos[ncalls] = pos;
+                    ncalls++;
+                    break;
+                default:
+                    break;
+            }
+            pos += 2;
+        }
+        int to = pos > from ? pos - 1 : from;
+
+        // ブロックの出入口で生きている値は、ブロック全体で生きている
+        if(!bb->live_in){
+            continue;
+        }
+        for(int vn = 0; vn < n; vn++){
+            if(bitset_test(bb->live_in, vn)){
+                extend(vn, from);
+            }
+            if(bitset_test(bb->live_out, vn)){
+                extend(vn, to);
+            }
+        }
+    }
+
+    for(int vn = 0; vn < n; vn++){
+        if(ndefs[vn] != 1){
+            remat[vn] = NULL;
+        }
+    }
+}
+
+static int cmp_start(const void* a, const void* b){
+    return start[*(int*)a] - start[*(int*)b];
+}
+
+// pos以降で最初に読み出す位置。なければ区間の終わり
+static int next_use(int vn, int pos){
+    int lo = 0;
+    int hi = nuses[vn];
+    while(lo < hi){
+        int mid = (lo + hi) / 2;
+        if(uses[vn][mid] < pos){
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < nuses[vn] ? uses[vn][lo] : end[vn];
+}
+
+// 区間が関数呼び出しをまたぐか
+static bool crosses_call(int vn){
+    for(int i = 0; i < ncalls; i++){
+        if(start[vn] < call_pos[i] && end[vn] > call_pos[i] + 1){
+            return true;
+        }
+    }
+    return false;
+}
+
+// 実レジスタを区間の間ずっと使えるか
+static bool is_usable(PhysReg reg, int vn){
+    for(int i = 0; i < nfixed[reg]; i++){
+        if(fixed[reg][i].from <= end[vn] && fixed[reg][i].to >= start[vn]){
+            return false;
+        }
+    }
+    return true;
+}
+
+// 仮想レジスタを退避領域に割り当てる
+// 新しい退避領域を確保して、その番号を返す
+static int new_slot(){
+    slot_end = realloc(slot_end, sizeof(int) * (nslots + 1));
+    slot_end[nslots] = -1;
+    return nslots++;
+}
+
+static void spill(int vn){
+    add_stat("spilled_vregs", 1);
+    if(remat[vn]){
+        slot[vn] = REMAT;
+        return;
+    }
+    int i = 0;
+    while(i < nslots && slot_end[i] >= start[vn]) i++;
+    if(i == nslots){
+        new_slot();
+    }
+    slot[vn] = i;
+    slot_end[i] = end[vn];
+}
+
+// 退避領域のrbpからのオフセット
+static Reg* slot_offset(int i){
+    return new_RegImm(frame_base + 8 * (i + 1));
+}
+
+// 追い出すなら、作り直せる値を優先し、次に読み出す位置が遠いものを選ぶ
+static bool is_better_victim(int a, int b, int pos){
+    if(!remat[a] != !remat[b]){
+        return remat[a] != NULL;
+    }
+    return next_use(a, pos) > next_use(b, pos);
+}
+
+// 空いている実レジスタを選ぶ。関数呼び出しをまたぐ区間はcallee-savedを優先する
+static int find_free(int vn, int* owner){
+    const PhysReg* first = caller_saved;
+    const PhysReg* second = callee_saved;
+    int nfirst = NUM_CALLER_SAVED;
+    int nsecond = NUM_CALLEE_SAVED;
+    if(crosses_call(vn)){
+        first = callee_saved;
+        second = caller_saved;
+        nfirst = NUM_CALLEE_SAVED;
+        nsecond = NUM_CALLER_SAVED;
+    }
+    for(int i = 0; i < nfirst; i++){
+        if(owner[first[i]] == -1 && is_usable(first[i], vn)) return first[i];
+    }
+    for(int i = 0; i < nsecond; i++){
+        if(owner[second[i]] == -1 && is_usable(second[i], vn)) return second[i];
+    }
+    return -1;
+}
+
+static void linear_scan(CFG* cfg){
+    int n = cfg->nregs;
+    int* order = calloc(n, sizeof(int));
+    int norder = 0;
+    slot = calloc(n, sizeof(int));
+    nslots = 0;
+    slot_end = NULL;
+    for(int vn = 0; vn < n; vn++){
+        slot[vn] = -1;
+        if(end[vn] >= 0){
+            order[norder++] = vn;
+        }
+    }
+    qsort(order, norder, sizeof(int), cmp_start);
+
+    int owner[PR_NUM];
+    for(int i = 0; i < PR_NUM; i++) owner[i] = -1;
+
+    for(int i = 0; i < norder; i++){
+        int vn = order[i];
+
+        // 区間が終わった仮想レジスタの実レジスタを空ける
+        for(int r = 0; r < PR_NUM; r++){
+            if(owner[r] != -1 && end[owner[r]] < start[vn]){
+                owner[r] = -1;
+            }
+        }
+
+        int reg = find_free(vn, owner);
+        if(reg == -1){
+            // 作り直せる区間か、次に読み出す位置が最も遠い区間を追い出して、そのレジスタを使う
+            int victim = -1;
+            for(int r = 0; r < PR_NUM; r++){
+                if(owner[r] == -1 || !is_usable(r, vn)) continue;
+                if(victim == -1 || is_better_victim(owner[r], owner[victim], start[vn])){
+                    victim = r;
+                }
+            }
+            if(victim != -1 && !remat[vn] && is_better_victim(owner[victim], vn, start[vn])){
+                spill(owner[victim]);
+                cfg->regs[owner[victim]]->phys = -1;
+                reg = victim;
+            }
+        }
+        if(reg == -1){
+            spill(vn);
+            continue;
+        }
+        owner[reg] = vn;
+        cfg->regs[vn]->phys = reg;
+    }
+}
+
+// 退避した仮想レジスタを、posの前でregに読み込む。作り直せる値は定義を複製する
+static void reload(BasicBlock* bb, IR* pos, Reg* vreg, Reg* reg){
+    IR* def = remat[vreg->vn];
+    if(slot[vreg->vn] != REMAT){
+        insert_ir_before(bb, pos, make_IR(IR_RELOAD, NULL, reg, slot_offset(slot[vreg->vn])));
+    } else if(def->cmd == IR_REL){
+        insert_ir_before(bb, pos, make_IR(IR_REL, reg, def->s1, NULL));
+    } else {
+        insert_ir_before(bb, pos, make_IR(IR_MOV, NULL, reg, new_RegImm(def->s2->val)));
+    }
+}
+
+static Reg* phys_reg(PhysReg reg){
+    Reg* r = new_Reg();
+    r->phys = reg;
+    return r;
+}
+
+// 退避した仮想レジスタは、命令ごとにr10/r11(3つ目はrax)へ読み込み、書き込んだら退避領域に戻す
+static void rewrite_spills(CFG* cfg){
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        IR* next = NULL;
+        for(IR* ir = bb->ir; ir; ir = next){
+            next = ir->next;
+
+            Reg* orig[MAX_IR_OPERANDS];
+            Reg* tmp[MAX_IR_OPERANDS];
+            int ntmp = 0;
+
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int i = 0; i < nuse; i++){
+                Reg* reg = *slots[i];
+                if(slot[reg->vn] == -1) continue;
+                int j = 0;
+                while(j < ntmp && orig[j] != reg) j++;
+                if(j == ntmp){
+                    orig[j] = reg;
+                    tmp[j] = phys_reg(scratch_regs[j]);
+                    ntmp++;
+                    reload(bb, ir, reg, tmp[j]);
+                }
+                *slots[i] = tmp[j];
+            }
+
+            Reg** d = ir_def_slot(ir);
+            if(!d || !is_vreg(*d)) continue;
+
+            // 読み出しと同じ仮想レジスタ(2番地形式のs1)なら、読み込んだレジスタに書く
+            Reg* def = *d;
+            for(int j = 0; j < ntmp; j++){
+                if(tmp[j] == def) def = orig[j];
+            }
+            if(slot[def->vn] == -1) continue;
+            if(slot[def->vn] == REMAT){
+                remove_ir(bb, ir);
+                continue;
+            }
+
+            if(*d == def){
+                // 命令は読み出しを終えてから書き込むので、r10を使ってよい
+                *d = phys_reg(scratch_regs[0]);
+            }
+            IR* spill_ir = make_IR(IR_SPILL, NULL, slot_offset(slot[def->vn]), *d);
+            insert_ir_after(ir, spill_ir);
+            next = spill_ir->next;
+        }
+    }
+}
+
+static BasicBlock* block_of(CFG* cfg, IR* target){
+    for(BasicBlock* bb = cfg->head; bb; bb = bb->next){
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ir == target) return bb;
+        }
+    }
+    return NULL;
+}
+
+// 関数呼び出しをまたいでcaller-savedのレジスタに置いた値は、呼び出しの前後で退避・復帰する
+static void save_caller_saved(CFG* cfg){
+    int save_slot[PR_NUM];
+    for(int r = 0; r < PR_NUM; r++){
+        save_slot[r] = -1;
+    }
+
+    for(int i = 0; i < ncalls; i++){
+        BasicBlock* bb = NULL;
+        for(int vn = 0; vn < cfg->nregs; vn++){
+            int reg = cfg->regs[vn]->phys;
+            if(reg < PR_RDI || slot[vn] != -1 || end[vn] < 0){
+                continue;
+            }
+            if(!(start[vn] < call_pos[i] && end[vn] > call_pos[i] + 1)){
+                continue;
+            }
+            if(save_slot[reg] == -1){
+                save_slot[reg] = new_slot();
+            }
+            if(!bb){
+                bb = block_of(cfg, calls[i]);
+            }
+            insert_ir_before(bb, calls[i], make_IR(IR_SPILL, NULL, slot_offset(save_slot[reg]), phys_reg(reg)));
+            insert_ir_after(calls[i], make_IR(IR_RELOAD, NULL, phys_reg(reg), slot_offset(save_slot[reg])));
+            add_stat("caller_saves", 1);
+        }
+    }
+}
+
+// 関数のフレームを、ローカル変数と使った退避領域の大きさにする
+// 関数の先頭で積むのは、割り当てに使ったcallee-savedのレジスタだけにする
+static void finish_frame(CFG* cfg){
+    for(IR* ir = cfg->head->ir; ir; ir = ir->next){
+        if(ir->cmd == IR_FN_LABEL){
+            ir->s2->val = frame_base + 8 * nslots;
+        }
+    }
+
+    cfg->func->saved_regs = 0;
+    for(int vn = 0; vn < cfg->nregs; vn++){
+        int reg = cfg->regs[vn]->phys;
+        for(int i = 0; i < NUM_CALLEE_SAVED; i++){
+            if(reg == callee_saved[i]){
+                cfg->func->saved_regs |= 1 << reg;
+            }
+        }
+    }
+}
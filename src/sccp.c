@@ -0,0 +1,436 @@
+#include "mcc2.h"
+
+/*
+    疎な条件付き定数伝播 (Sparse Conditional Constant Propagation)
+
+    SSA形式の仮想レジスタごとに
+        TOP(未定) -> CONST(定数) -> BOTTOM(定数でない)
+    の値を持たせ、実行されうる辺だけをたどって定数を伝播する。
+    最後に
+        - 定数になった仮想レジスタの使用を直値に置き換えて、定義を消す
+        - 条件が定数になった分岐を無条件ジャンプにするか、消す
+        - 実行されないブロックを消す
+    を行う。
+
+    演算の意味はバックエンドが出力する命令に合わせる。
+    値はすべて64bitのレジスタで計算し、除算・右シフト・大小比較は
+    中間命令のis_unsignedで符号の有無を切り替える。
+*/
+
+typedef enum {
+    LAT_TOP = 0,
+    LAT_CONST,
+    LAT_BOTTOM,
+} LatticeKind;
+
+typedef struct SccpUse {
+    IR* ir;
+    BasicBlock* bb;
+} SccpUse;
+
+static CFG* cfg;
+static LatticeKind* lat;
+static unsigned long* val;
+static SccpUse** uses;
+static int* nuses;
+static bool* block_exec;
+static bool** edge_exec;       // [block id][succのindex]
+
+static BasicBlock** cfg_work;
+static int ncfg_work;
+static int* ssa_work;
+static int nssa_work;
+static int ssa_work_cap;
+
+static void visit_block(BasicBlock* bb);
+static void visit_phi(BasicBlock* bb, IR* ir);
+static void visit_ir(BasicBlock* bb, IR* ir);
+static void rewrite();
+
+void sccp(CFG* target){
+    cfg = target;
+    int n = cfg->nregs;
+    lat = calloc(n, sizeof(LatticeKind));
+    val = calloc(n, sizeof(unsigned long));
+    nuses = calloc(n, sizeof(int));
+    uses = calloc(n, sizeof(SccpUse*));
+    block_exec = calloc(cfg->nblock_ids, sizeof(bool));
+    edge_exec = calloc(cfg->nblock_ids, sizeof(bool*));
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        edge_exec[bb->id] = calloc(bb->nsuccs + 1, sizeof(bool));
+    }
+    cfg_work = calloc(cfg->nblock_ids, sizeof(BasicBlock*));
+    ncfg_work = 0;
+    nssa_work = 0;
+
+    // 仮想レジスタごとに使用している命令を集める
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** slots[MAX_IR_OPERANDS];
+            Reg** phi_slots = ir->phi_args;
+            int nslot = ir->cmd == IR_PHI ? bb->npreds : ir_use_slots(ir, slots);
+            for(int j = 0; j < nslot; j++){
+                Reg* reg = ir->cmd == IR_PHI ? phi_slots[j] : *slots[j];
+                if(!is_vreg(reg)) continue;
+                int vn = reg->vn;
+                uses[vn] = realloc(uses[vn], sizeof(SccpUse) * (nuses[vn] + 1));
+                uses[vn][nuses[vn]].ir = ir;
+                uses[vn][nuses[vn]].bb = bb;
+                nuses[vn]++;
+            }
+        }
+    }
+
+    block_exec[cfg->blocks[0]->id] = true;
+    visit_block(cfg->blocks[0]);
+
+    while(ncfg_work || nssa_work){
+        while(ncfg_work){
+            BasicBlock* bb = cfg_work[--ncfg_work];
+            visit_block(bb);
+        }
+        while(nssa_work){
+            int vn = ssa_work[--nssa_work];
+            for(int i = 0; i < nuses[vn]; i++){
+                SccpUse* use = &uses[vn][i];
+                if(!block_exec[use->bb->id]) continue;
+                if(use->ir->cmd == IR_PHI){
+                    visit_phi(use->bb, use->ir);
+                } else {
+                    visit_ir(use->bb, use->ir);
+                }
+            }
+        }
+    }
+
+    rewrite();
+}
+
+static void set_lattice(Reg* reg, LatticeKind kind, unsigned long v){
+    int vn = reg->vn;
+    if(lat[vn] == kind && (kind != LAT_CONST || val[vn] == v)){
+        return;
+    }
+    if(lat[vn] == LAT_BOTTOM){
+        return;
+    }
+    if(lat[vn] == LAT_CONST && kind == LAT_CONST){
+        // 違う定数が来たら定数ではない
+        kind = LAT_BOTTOM;
+    }
+    lat[vn] = kind;
+    val[vn] = v;
+
+    if(nssa_work == ssa_work_cap){
+        ssa_work_cap = ssa_work_cap ? ssa_work_cap * 2 : 64;
+        ssa_work = realloc(ssa_work, sizeof(int) * ssa_work_cap);
+    }
+    ssa_work[nssa_work++] = vn;
+}
+
+// オペランドの値を返す。直値はCONST、仮想レジスタ以外はBOTTOM
+static LatticeKind get_value(Reg* reg, unsigned long* v){
+    if(!reg){
+        return LAT_BOTTOM;
+    }
+    if(reg->kind == REG_IMM){
+        *v = reg->val;
+        return LAT_CONST;
+    }
+    if(!is_vreg(reg)){
+        return LAT_BOTTOM;
+    }
+    *v = val[reg->vn];
+    return lat[reg->vn];
+}
+
+static void mark_edge(BasicBlock* bb, int idx){
+    if(edge_exec[bb->id][idx]){
+        return;
+    }
+    edge_exec[bb->id][idx] = true;
+
+    BasicBlock* succ = bb->succs[idx];
+    if(!block_exec[succ->id]){
+        block_exec[succ->id] = true;
+        cfg_work[ncfg_work++] = succ;
+    } else {
+        // 新しい辺から来る値でphiを評価しなおす
+        for(IR* ir = succ->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                visit_phi(succ, ir);
+            }
+        }
+    }
+}
+
+static bool is_edge_exec(BasicBlock* from, BasicBlock* to){
+    for(int i = 0; i < from->nsuccs; i++){
+        if(from->succs[i] == to && edge_exec[from->id][i]){
+            return true;
+        }
+    }
+    return false;
+}
+
+static void visit_block(BasicBlock* bb){
+    for(IR* ir = bb->ir; ir; ir = ir->next){
+        if(ir->cmd == IR_PHI){
+            visit_phi(bb, ir);
+        } else {
+            visit_ir(bb, ir);
+        }
+    }
+
+    IR* last = block_tail(bb);
+    if(!last || !is_terminator(last->cmd)){
+        if(bb->nsuccs){
+            mark_edge(bb, 0);
+        }
+    }
+}
+
+static void visit_phi(BasicBlock* bb, IR* ir){
+    LatticeKind kind = LAT_TOP;
+    unsigned long v = 0;
+    for(int i = 0; i < bb->npreds; i++){
+        if(!is_edge_exec(bb->preds[i], bb)) continue;
+
+        unsigned long arg_val;
+        LatticeKind arg = ir->phi_args[i] ? get_value(ir->phi_args[i], &arg_val) : LAT_TOP;
+        if(arg == LAT_TOP) continue;
+        if(arg == LAT_BOTTOM || (kind == LAT_CONST && v != arg_val)){
+            kind = LAT_BOTTOM;
+            break;
+        }
+        kind = LAT_CONST;
+        v = arg_val;
+    }
+    if(kind != LAT_TOP){
+        set_lattice(ir->t, kind, v);
+    }
+}
+
+// 64bitの値をsizeバイトに切り詰めて、符号に合わせて拡張する
+static unsigned long extend(unsigned long v, int size, bool is_unsigned){
+    switch(size){
+        case 1: return is_unsigned ? (unsigned char)v : (unsigned long)(signed char)v;
+        case 2: return is_unsigned ? (unsigned short)v : (unsigned long)(short)v;
+        case 4: return is_unsigned ? (unsigned int)v : (unsigned long)(int)v;
+        default: return v;
+    }
+}
+
+// 定数どうしの演算を畳み込む。畳み込めない場合はfalseを返す
+static bool fold(IR* ir, unsigned long a, unsigned long b, unsigned long* out){
+    long sa = a;
+    long sb = b;
+    switch(ir->cmd){
+        case IR_ADD: *out = a + b; return true;
+        case IR_SUB: *out = a - b; return true;
+        case IR_MUL: *out = a * b; return true;
+        case IR_BIT_AND: *out = a & b; return true;
+        case IR_BIT_XOR: *out = a ^ b; return true;
+        case IR_BIT_OR: *out = a | b; return true;
+        case IR_L_BIT_SHIFT: *out = a << (b & 63); return true;
+        case IR_R_BIT_SHIFT:
+            *out = ir->is_unsigned ? a >> (b & 63) : (unsigned long)(sa >> (b & 63));
+            return true;
+        case IR_DIV:
+        case IR_MOD:
+            // 0除算やオーバーフローは実行時に任せる
+            if(b == 0) return false;
+            if(ir->is_unsigned){
+                *out = ir->cmd == IR_DIV ? a / b : a % b;
+            } else {
+                if(sb == -1 && sa == (long)(1UL << 63)) return false;
+                *out = ir->cmd == IR_DIV ? (unsigned long)(sa / sb) : (unsigned long)(sa % sb);
+            }
+            return true;
+        case IR_EQUAL: *out = a == b; return true;
+        case IR_NOT_EQUAL: *out = a != b; return true;
+        case IR_LT: *out = ir->is_unsigned ? a < b : sa < sb; return true;
+        case IR_LE: *out = ir->is_unsigned ? a <= b : sa <= sb; return true;
+
+        // 比較して分岐する命令は、分岐するかどうかを求める
+        case IR_JE: *out = a == b; return true;
+        case IR_JNE: *out = a != b; return true;
+        case IR_JLT: *out = ir->is_unsigned ? a < b : sa < sb; return true;
+        case IR_JLE: *out = ir->is_unsigned ? a <= b : sa <= sb; return true;
+        case IR_JGT: *out = ir->is_unsigned ? a > b : sa > sb; return true;
+        case IR_JGE: *out = ir->is_unsigned ? a >= b : sa >= sb; return true;
+        default:
+            return false;
+    }
+}
+
+static void visit_terminator(BasicBlock* bb, IR* ir){
+    if(ir->cmd == IR_JMP || ir->cmd == IR_RET){
+        mark_edge(bb, 0);
+        return;
+    }
+    if(ir->cmd == IR_JTABLE){
+        for(int i = 0; i < bb->nsuccs; i++){
+            mark_edge(bb, i);
+        }
+        return;
+    }
+
+    unsigned long v = 0;
+    LatticeKind kind;
+    bool taken = false;
+    if(is_cmp_jump(ir->cmd)){
+        unsigned long v2;
+        LatticeKind k1 = get_value(ir->s1, &v);
+        LatticeKind k2 = get_value(ir->s2, &v2);
+        kind = (k1 == LAT_BOTTOM || k2 == LAT_BOTTOM) ? LAT_BOTTOM
+            : (k1 == LAT_TOP || k2 == LAT_TOP) ? LAT_TOP : LAT_CONST;
+        unsigned long out = 0;
+        taken = fold(ir, v, v2, &out) && out;
+    } else {
+        kind = get_value(ir->s1, &v);
+        taken = ir->cmd == IR_JZ ? v == 0 : v != 0;
+    }
+
+    if(kind == LAT_TOP){
+        return;
+    }
+    if(kind == LAT_BOTTOM || bb->nsuccs == 1){
+        for(int i = 0; i < bb->nsuccs; i++){
+            mark_edge(bb, i);
+        }
+        return;
+    }
+    mark_edge(bb, taken ? 1 : 0);
+}
+
+static void visit_ir(BasicBlock* bb, IR* ir){
+    if(is_terminator(ir->cmd)){
+        visit_terminator(bb, ir);
+        return;
+    }
+
+    Reg** d = ir_def_slot(ir);
+    if(!d || !is_vreg(*d)){
+        return;
+    }
+
+    unsigned long a = 0, b = 0, out = 0;
+    LatticeKind ka, kb;
+    switch(ir->cmd){
+        case IR_MOV:
+            ka = get_value(ir->s2, &a);
+            if(ka != LAT_TOP) set_lattice(*d, ka, a);
+            return;
+        case IR_ASSIGN:
+            // 代入式の値は書き込んだ値
+            ka = get_value(ir->s2, &a);
+            if(ka != LAT_TOP) set_lattice(*d, ka, a);
+            return;
+        case IR_CAST:
+            ka = get_value(ir->s1, &a);
+            if(ka == LAT_CONST && need_cast(ir->src_size, ir->src_unsigned, ir->size, ir->is_unsigned)){
+                a = extend(a, ir->size, ir->is_unsigned);
+            }
+            if(ka != LAT_TOP) set_lattice(*d, ka, a);
+            return;
+        default:
+            break;
+    }
+
+    if(is_binop(ir->cmd) || ir->cmd == IR_EQUAL || ir->cmd == IR_NOT_EQUAL
+        || ir->cmd == IR_LT || ir->cmd == IR_LE){
+        ka = get_value(ir->s1, &a);
+        kb = get_value(ir->s2, &b);
+        if(ka == LAT_BOTTOM || kb == LAT_BOTTOM){
+            set_lattice(*d, LAT_BOTTOM, 0);
+        } else if(ka == LAT_CONST && kb == LAT_CONST){
+            if(fold(ir, a, b, &out)){
+                set_lattice(*d, LAT_CONST, out);
+            } else {
+                set_lattice(*d, LAT_BOTTOM, 0);
+            }
+        }
+        return;
+    }
+
+    // load, call などは定数にならない
+    set_lattice(*d, LAT_BOTTOM, 0);
+}
+
+static bool is_const(Reg* reg){
+    return is_vreg(reg) && lat[reg->vn] == LAT_CONST;
+}
+
+// 定数を直値に置き換える。直値はバックエンドで命令ごとに扱うので使用ごとに作る
+static void rewrite_block(BasicBlock* bb){
+    IR head = {};
+    head.next = bb->ir;
+    for(IR* prev = &head; prev->next; ){
+        IR* ir = prev->next;
+
+        // 値が定数になった副作用のない命令は消す
+        Reg** d = ir_def_slot(ir);
+        bool pure = ir->cmd == IR_PHI || ir->cmd == IR_MOV || ir->cmd == IR_CAST
+            || ir->cmd == IR_EQUAL || ir->cmd == IR_NOT_EQUAL
+            || ir->cmd == IR_LT || ir->cmd == IR_LE || is_binop(ir->cmd);
+        if(d && is_const(*d) && pure){
+            prev->next = ir->next;
+            continue;
+        }
+
+        if(ir->cmd == IR_RELEASE_REG && is_const(ir->t)){
+            prev->next = ir->next;
+            continue;
+        }
+
+        if(ir->cmd == IR_PHI){
+            for(int i = 0; i < bb->npreds; i++){
+                if(is_const(ir->phi_args[i])){
+                    ir->phi_args[i] = new_RegImm(val[ir->phi_args[i]->vn]);
+                }
+            }
+        } else {
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int i = 0; i < nuse; i++){
+                if(is_const(*slots[i])){
+                    *slots[i] = new_RegImm(val[(*slots[i])->vn]);
+                }
+            }
+        }
+
+        // 条件が定数になった分岐
+        if((ir->cmd == IR_JZ || ir->cmd == IR_JNZ || is_cmp_jump(ir->cmd)) && bb->nsuccs == 2){
+            bool taken_exec = edge_exec[bb->id][1];
+            bool fall_exec = edge_exec[bb->id][0];
+            if(taken_exec && !fall_exec){
+                long label = is_cmp_jump(ir->cmd) ? ir->t->val : ir->s2->val;
+                ir->cmd = IR_JMP;
+                ir->t = NULL;
+                ir->s1 = new_RegImm(label);
+                ir->s2 = NULL;
+                bb->succs[0] = bb->succs[1];
+                bb->succs[1] = NULL;
+            } else if(fall_exec && !taken_exec){
+                prev->next = ir->next;
+                bb->succs[1] = NULL;
+                continue;
+            }
+        }
+
+        prev = ir;
+    }
+    bb->ir = head.next;
+}
+
+static void rewrite(){
+    for(int i = 0; i < cfg->nblocks; i++){
+        rewrite_block(cfg->blocks[i]);
+    }
+
+    cfg_refresh(cfg);
+    add_stat("unreachable_blocks", remove_unreachable_blocks(cfg));
+}
@@ -0,0 +1,379 @@
+#include "mcc2.h"
+
+/*
+    SSA形式への変換と、SSA形式からの復帰
+
+    to_ssa()
+        1. 2オペランド形式の演算(s1を上書きする)を t = s1 op s2 の形式にする
+        2. 複数のブロックで定義される仮想レジスタに、支配辺境を使ってphiを置く
+           (ブロックの入口で生存しているものだけに置く pruned SSA)
+        3. 支配木をたどって仮想レジスタを定義ごとに別のレジスタに付け替える
+    from_ssa()
+        1. phiをコピーに置き換える(Sreedhar method I)
+           d = phi(a1, a2) は、先行ブロックの末尾に P = ai、ブロックの先頭に d = P
+        2. 干渉しないコピーの両辺と、演算のtとs1を同じレジスタにまとめる
+*/
+
+static void normalize(CFG* cfg);
+static void place_phis(CFG* cfg);
+static void rename_block(CFG* cfg, BasicBlock* bb);
+static void coalesce(CFG* cfg);
+
+// 名前の付け替えで使う、元の仮想レジスタごとの定義のスタック
+static int norig;
+static Reg*** stack;
+static int* sp;
+static int* push_log;
+static int log_len;
+static int log_cap;
+
+void to_ssa(CFG* cfg){
+    normalize(cfg);
+    compute_liveness(cfg);
+    compute_dominators(cfg);
+
+    place_phis(cfg);
+
+    norig = cfg->nregs;
+    stack = calloc(norig, sizeof(Reg**));
+    sp = calloc(norig, sizeof(int));
+    for(int i = 0; i < norig; i++){
+        stack[i] = calloc(4, sizeof(Reg*));
+    }
+    log_len = 0;
+    rename_block(cfg, cfg->blocks[0]);
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                ir->s1 = NULL;
+            }
+        }
+    }
+    cfg->is_ssa = true;
+}
+
+static void normalize(CFG* cfg){
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR** link = &bb->ir; *link; link = &(*link)->next){
+            IR* ir = *link;
+
+            // 直値に書き込む命令があれば、その直値は以降仮想レジスタとして扱われている。
+            // 直値を仮想レジスタに変えて、直前で値を設定する
+            Reg** d = ir_def_slot(ir);
+            if(d && *d && (*d)->kind == REG_IMM){
+                Reg* reg = *d;
+                IR* mov = make_IR(IR_MOV, NULL, reg, new_RegImm(reg->val));
+                reg->kind = REG_REG;
+                cfg_add_reg(cfg, reg);
+                mov->next = ir;
+                *link = mov;
+                link = &mov->next;
+            }
+
+            if(is_binop(ir->cmd) && !ir->t){
+                ir->t = ir->s1;
+            }
+        }
+    }
+}
+
+static void place_phis(CFG* cfg){
+    int n = cfg->nregs;
+
+    // ブロックをまたいで生存する仮想レジスタだけがphiの対象になる
+    BitSet* global = new_bitset(n);
+    for(int i = 0; i < cfg->nblocks; i++){
+        bitset_union(global, cfg->blocks[i]->live_in);
+    }
+
+    // 仮想レジスタごとに定義のあるブロックを集める
+    BasicBlock*** defs = calloc(n, sizeof(BasicBlock**));
+    int* ndefs = calloc(n, sizeof(int));
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            Reg** d = ir_def_slot(ir);
+            if(!d || !is_vreg(*d)) continue;
+            int vn = (*d)->vn;
+            if(!bitset_test(global, vn)) continue;
+            if(ndefs[vn] && defs[vn][ndefs[vn] - 1] == bb) continue;
+            defs[vn] = realloc(defs[vn], sizeof(BasicBlock*) * (ndefs[vn] + 1));
+            defs[vn][ndefs[vn]++] = bb;
+        }
+    }
+
+    int* has_phi = calloc(cfg->nblock_ids, sizeof(int));
+    int* in_work = calloc(cfg->nblock_ids, sizeof(int));
+    BasicBlock** work = calloc(cfg->nblock_ids, sizeof(BasicBlock*));
+    for(int vn = 0; vn < n; vn++){
+        if(!bitset_test(global, vn)) continue;
+
+        int nwork = 0;
+        for(int i = 0; i < ndefs[vn]; i++){
+            work[nwork++] = defs[vn][i];
+            in_work[defs[vn][i]->id] = vn + 1;
+        }
+        while(nwork){
+            BasicBlock* bb = work[--nwork];
+            for(int i = 0; i < bb->ndf; i++){
+                BasicBlock* df = bb->df[i];
+                if(has_phi[df->id] == vn + 1) continue;
+                if(!bitset_test(df->live_in, vn)) continue;
+
+                IR* phi = make_IR(IR_PHI, cfg->regs[vn], cfg->regs[vn], NULL);
+                phi->phi_args = calloc(df->npreds, sizeof(Reg*));
+                insert_after_phis(df, phi);
+                has_phi[df->id] = vn + 1;
+
+                if(in_work[df->id] != vn + 1){
+                    in_work[df->id] = vn + 1;
+                    work[nwork++] = df;
+                }
+            }
+        }
+    }
+}
+
+static Reg* top(int vn){
+    if(sp[vn] == 0) return NULL;
+    return stack[vn][sp[vn] - 1];
+}
+
+static void push(int vn, Reg* reg){
+    if((sp[vn] & (sp[vn] - 1)) == 0 && sp[vn] >= 4){
+        stack[vn] = realloc(stack[vn], sizeof(Reg*) * sp[vn] * 2);
+    }
+    stack[vn][sp[vn]++] = reg;
+
+    if(log_len == log_cap){
+        log_cap = log_cap ? log_cap * 2 : 256;
+        push_log = realloc(push_log, sizeof(int) * log_cap);
+    }
+    push_log[log_len++] = vn;
+}
+
+static void rename_block(CFG* cfg, BasicBlock* bb){
+    int saved = log_len;
+
+    for(IR* ir = bb->ir; ir; ir = ir->next){
+        if(ir->cmd != IR_PHI){
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int i = 0; i < nuse; i++){
+                Reg* reg = *slots[i];
+                if(reg->vn < norig && top(reg->vn)){
+                    *slots[i] = top(reg->vn);
+                }
+            }
+        }
+
+        Reg** d = ir_def_slot(ir);
+        if(d && is_vreg(*d) && (*d)->vn < norig){
+            int vn = (*d)->vn;
+            Reg* reg = cfg_new_reg(cfg, *d);
+            push(vn, reg);
+            *d = reg;
+        }
+    }
+
+    // 後続ブロックのphiの引数を埋める
+    for(int i = 0; i < bb->nsuccs; i++){
+        BasicBlock* succ = bb->succs[i];
+        int pidx = 0;
+        while(succ->preds[pidx] != bb) pidx++;
+        for(IR* ir = succ->ir; ir; ir = ir->next){
+            if(ir->cmd == IR_PHI){
+                // どこでも定義されていない経路(未初期化の変数)からは0が来るものとする
+                Reg* arg = top(ir->s1->vn);
+                ir->phi_args[pidx] = arg ? arg : new_RegImm(0);
+            }
+        }
+    }
+
+    for(BasicBlock* child = bb->dom_child; child; child = child->dom_sibling){
+        rename_block(cfg, child);
+    }
+
+    while(log_len > saved){
+        sp[push_log[--log_len]]--;
+    }
+}
+
+void from_ssa(CFG* cfg){
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+
+        IR** copies = NULL;
+        int ncopies = 0;
+        IR head = {};
+        head.next = bb->ir;
+        for(IR* prev = &head; prev->next; ){
+            IR* phi = prev->next;
+            if(phi->cmd != IR_PHI){
+                prev = phi;
+                continue;
+            }
+
+            Reg* p = cfg_new_reg(cfg, phi->t);
+            for(int j = 0; j < bb->npreds; j++){
+                Reg* arg = phi->phi_args[j];
+                if(!arg) continue;
+                if(arg->kind == REG_IMM){
+                    arg = new_RegImm(arg->val);
+                }
+                insert_before_terminator(bb->preds[j], make_IR(IR_MOV, NULL, p, arg));
+            }
+            copies = realloc(copies, sizeof(IR*) * (ncopies + 1));
+            copies[ncopies++] = make_IR(IR_MOV, NULL, phi->t, p);
+
+            prev->next = phi->next;
+        }
+        bb->ir = head.next;
+
+        for(int j = ncopies - 1; j >= 0; j--){
+            insert_after_phis(bb, copies[j]);
+        }
+    }
+
+    coalesce(cfg);
+    cfg->is_ssa = false;
+}
+
+// 干渉グラフを作り、union-findでレジスタをまとめる
+static int* parent;
+static BitSet** adj;
+static BitSet** members;
+
+static int find(int x){
+    while(parent[x] != x){
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+static void interfere(int a, int b){
+    if(a == b) return;
+    bitset_set(adj[a], b);
+    bitset_set(adj[b], a);
+}
+
+static void try_coalesce(Reg* a, Reg* b){
+    if(!is_vreg(a) || !is_vreg(b)) return;
+    int ra = find(a->vn);
+    int rb = find(b->vn);
+    if(ra == rb) return;
+    if(bitset_intersects(adj[ra], members[rb])) return;
+
+    parent[rb] = ra;
+    bitset_union(adj[ra], adj[rb]);
+    bitset_union(members[ra], members[rb]);
+}
+
+static void build_interference(CFG* cfg){
+    int n = cfg->nregs;
+    IR** insns = NULL;
+    int cap = 0;
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        int ninsns = 0;
+        for(IR* ir = bb->ir; ir; ir = ir->next){
+            if(ninsns == cap){
+                cap = cap ? cap * 2 : 64;
+                insns = realloc(insns, sizeof(IR*) * cap);
+            }
+            insns[ninsns++] = ir;
+        }
+
+        BitSet* live = copy_bitset(bb->live_out);
+        for(int j = ninsns - 1; j >= 0; j--){
+            IR* ir = insns[j];
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            Reg** d = ir_def_slot(ir);
+
+            if(d && is_vreg(*d)){
+                int dvn = (*d)->vn;
+                for(int v = 0; v < n; v++){
+                    if(!bitset_test(live, v)) continue;
+                    // コピー元とコピー先は干渉しない
+                    if(ir->cmd == IR_MOV && is_vreg(ir->s2) && ir->s2->vn == v) continue;
+                    interfere(dvn, v);
+                }
+
+                // 演算結果はs1以外のオペランドと同じレジスタにできない
+                if(ir->cmd != IR_MOV){
+                    for(int k = 0; k < nuse; k++){
+                        if(is_binop(ir->cmd) && slots[k] == &ir->s1) continue;
+                        if(*slots[k] == *d) continue;
+                        interfere(dvn, (*slots[k])->vn);
+                    }
+                }
+                bitset_clear(live, dvn);
+            }
+
+            for(int k = 0; k < nuse; k++){
+                bitset_set(live, (*slots[k])->vn);
+            }
+        }
+    }
+}
+
+static void coalesce(CFG* cfg){
+    compute_liveness(cfg);
+
+    int n = cfg->nregs;
+    parent = calloc(n, sizeof(int));
+    adj = calloc(n, sizeof(BitSet*));
+    members = calloc(n, sizeof(BitSet*));
+    for(int i = 0; i < n; i++){
+        parent[i] = i;
+        adj[i] = new_bitset(n);
+        members[i] = new_bitset(n);
+        bitset_set(members[i], i);
+    }
+
+    build_interference(cfg);
+
+    for(int i = 0; i < cfg->nblocks; i++){
+        for(IR* ir = cfg->blocks[i]->ir; ir; ir = ir->next){
+            if(is_binop(ir->cmd)){
+                try_coalesce(ir->t, ir->s1);
+            } else if(ir->cmd == IR_MOV){
+                try_coalesce(ir->s1, ir->s2);
+            }
+        }
+    }
+
+    // 代表のレジスタに付け替えて、不要になったコピーを消す
+    for(int i = 0; i < cfg->nblocks; i++){
+        BasicBlock* bb = cfg->blocks[i];
+        IR head = {};
+        head.next = bb->ir;
+        for(IR* prev = &head; prev->next; ){
+            IR* ir = prev->next;
+            Reg** slots[MAX_IR_OPERANDS];
+            int nuse = ir_use_slots(ir, slots);
+            for(int k = 0; k < nuse; k++){
+                *slots[k] = cfg->regs[find((*slots[k])->vn)];
+            }
+            Reg** d = ir_def_slot(ir);
+            if(d && is_vreg(*d)){
+                *d = cfg->regs[find((*d)->vn)];
+            }
+
+            if(ir->cmd == IR_MOV && ir->s1 == ir->s2){
+                prev->next = ir->next;
+                continue;
+            }
+            if(is_binop(ir->cmd) && ir->t == ir->s1){
+                ir->t = NULL;
+            }
+            prev = ir;
+        }
+        bb->ir = head.next;
+    }
+}
@@ -0,0 +1,312 @@
+#include "mcc2.h"
+
+/*
+    定数による乗算・除算・剰余の強度低減 (Strength Reduction)
+
+    SSA形式の上で、定数との乗算・除算・剰余をより軽い命令の並びに置き換える。
+    SCCPで定数をオペランドに埋め込んだ後に行う。
+        乗算    2^k             -> 左シフト
+                3,5,9 * 2^k     -> lea(バックエンド) と左シフト
+                2^k + 1, 2^k - 1 -> 左シフトと加算・減算
+        除算    2^k             -> 符号なしは右シフト、符号付きは負の数を切り上げる補正をしてから右シフト
+                その他の定数    -> 上位64bitの乗算(IR_MULHI)とシフトによる、魔法数の乗算
+        剰余    2^k             -> 符号なしはマスク、符号付きは除算の結果から求める
+                その他の定数    -> n - (n / d) * d
+    魔法数の求め方は Hacker's Delight (10章) による。
+    演算はすべて64bitで行うので、もとのidiv/divと同じ結果になる。
+*/
+
+static CFG* cfg;
+static BasicBlock* cur_bb;
+static IR* cur_ir;
+static int reduced;
+
+// 置き換える命令の前に、新しい仮想レジスタtに結果を持つ命令を追加する
+static Reg* emit(IRCmd cmd, Reg* s1, Reg* s2, bool is_unsigned){
+    Reg* t = cfg_new_reg(cfg, cur_ir->t);
+    IR* ir = make_IR(cmd, t, s1, s2);
+    ir->is_unsigned = is_unsigned;
+    insert_ir_before(cur_bb, cur_ir, ir);
+    return t;
+}
+
+// 置き換える命令を t = s1 cmd s2 に書き換える
+static void finish(IRCmd cmd, Reg* s1, Reg* s2, bool is_unsigned){
+    cur_ir->cmd = cmd;
+    cur_ir->s1 = s1;
+    cur_ir->s2 = s2;
+    cur_ir->is_unsigned = is_unsigned;
+    reduced++;
+}
+
+// 置き換える命令を t = src のコピーに書き換える
+static void finish_mov(Reg* src){
+    cur_ir->cmd = IR_MOV;
+    cur_ir->s1 = cur_ir->t;
+    cur_ir->s2 = src;
+    cur_ir->t = NULL;
+    cur_ir->is_unsigned = false;
+    reduced++;
+}
+
+static Reg* imm(long val){
+    return new_RegImm(val);
+}
+
+// 2の冪ならその指数を、そうでなければ-1を返す
+static int log2_exact(unsigned long v){
+    if(v == 0 || (v & (v - 1))){
+        return -1;
+    }
+    int k = 0;
+    while((v >> k) != 1){
+        k++;
+    }
+    return k;
+}
+
+static void reduce_mul(Reg* n, long c){
+    if(c == 0 || c == 1){
+        finish_mov(c ? n : imm(0));
+        return;
+    }
+    if(c < 0){
+        return;
+    }
+
+    int k = log2_exact(c);
+    if(k > 0){
+        finish(IR_L_BIT_SHIFT, n, imm(k), false);
+        return;
+    }
+
+    // 3,5,9倍はバックエンドがleaにする
+    static long lea_factors[] = { 9, 5, 3 };
+    for(int i = 0; i < 3; i++){
+        long m = lea_factors[i];
+        if(c == m){
+            return;
+        }
+        if(c % m == 0 && (k = log2_exact(c / m)) > 0){
+            Reg* t = emit(IR_MUL, n, imm(m), false);
+            finish(IR_L_BIT_SHIFT, t, imm(k), false);
+            return;
+        }
+    }
+
+    if((k = log2_exact(c - 1)) > 0){
+        Reg* t = emit(IR_L_BIT_SHIFT, n, imm(k), false);
+        finish(IR_ADD, t, n, false);
+        return;
+    }
+    if((k = log2_exact(c + 1)) > 0){
+        Reg* t = emit(IR_L_BIT_SHIFT, n, imm(k), false);
+        finish(IR_SUB, t, n, false);
+        return;
+    }
+}
+
+// 符号付きで2^kで割った商(0方向への切り捨て)
+static Reg* emit_sdiv_pow2(Reg* n, int k){
+    // 負の数は 2^k - 1 を足してから算術シフトする
+    Reg* sign = emit(IR_R_BIT_SHIFT, n, imm(63), false);
+    Reg* bias = emit(IR_R_BIT_SHIFT, sign, imm(64 - k), true);
+    return emit(IR_ADD, n, bias, false);
+}
+
+// 符号付きの魔法数 (Hacker's Delight 図10-1)。|d| >= 2 で2の冪でないこと
+static void signed_magic(long d, long* magic, int* shift){
+    const unsigned long two63 = 1UL << 63;
+    unsigned long ad = d < 0 ? -(unsigned long)d : (unsigned long)d;
+    unsigned long t = two63 + ((unsigned long)d >> 63);
+    unsigned long anc = t - 1 - t % ad;
+    int p = 63;
+    unsigned long q1 = two63 / anc;
+    unsigned long r1 = two63 - q1 * anc;
+    unsigned long q2 = two63 / ad;
+    unsigned long r2 = two63 - q2 * ad;
+    unsigned long delta;
+    do {
+        p++;
+        q1 = 2 * q1;
+        r1 = 2 * r1;
+        if(r1 >= anc){
+            q1++;
+            r1 -= anc;
+        }
+        q2 = 2 * q2;
+        r2 = 2 * r2;
+        if(r2 >= ad){
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while(q1 < delta || (q1 == delta && r1 == 0));
+
+    *magic = d < 0 ? -(long)(q2 + 1) : (long)(q2 + 1);
+    *shift = p - 64;
+}
+
+// 符号なしの魔法数 (Hacker's Delight 図10-2)。d >= 2 であること
+// 魔法数が64bitに収まらないときはaddに1を入れる
+static void unsigned_magic(unsigned long d, unsigned long* magic, int* shift, int* add){
+    const unsigned long two63 = 1UL << 63;
+    unsigned long nc = -1UL - (-d) % d;
+    int p = 63;
+    unsigned long q1 = two63 / nc;
+    unsigned long r1 = two63 - q1 * nc;
+    unsigned long q2 = (two63 - 1) / d;
+    unsigned long r2 = (two63 - 1) - q2 * d;
+    unsigned long delta;
+    *add = 0;
+    do {
+        p++;
+        if(r1 >= nc - r1){
+            q1 = 2 * q1 + 1;
+            r1 = 2 * r1 - nc;
+        } else {
+            q1 = 2 * q1;
+            r1 = 2 * r1;
+        }
+        if(r2 + 1 >= d - r2){
+            if(q2 >= two63 - 1) *add = 1;
+            q2 = 2 * q2 + 1;
+            r2 = 2 * r2 + 1 - d;
+        } else {
+            if(q2 >= two63) *add = 1;
+            q2 = 2 * q2;
+            r2 = 2 * r2 + 1;
+        }
+        delta = d - 1 - r2;
+    } while(p < 128 && (q1 < delta || (q1 == delta && r1 == 0)));
+
+    *magic = q2 + 1;
+    *shift = p - 64;
+}
+
+// n / d の商を計算する命令を追加して、商の仮想レジスタを返す
+// 置き換えられないときはNULLを返す
+static Reg* emit_quotient(Reg* n, long d, bool is_unsigned){
+    if(is_unsigned){
+        unsigned long ud = d;
+        int k = log2_exact(ud);
+        if(k > 0){
+            return emit(IR_R_BIT_SHIFT, n, imm(k), true);
+        }
+        if(ud < 2 || ud > (1UL << 63)){
+            return NULL;
+        }
+        unsigned long magic;
+        int shift, add;
+        unsigned_magic(ud, &magic, &shift, &add);
+        Reg* q = emit(IR_MULHI, n, imm(magic), true);
+        if(add){
+            // q = (((n - q) >> 1) + q) >> (shift - 1)
+            Reg* t = emit(IR_SUB, n, q, true);
+            t = emit(IR_R_BIT_SHIFT, t, imm(1), true);
+            q = emit(IR_ADD, t, q, true);
+            shift--;
+        }
+        if(shift > 0){
+            q = emit(IR_R_BIT_SHIFT, q, imm(shift), true);
+        }
+        return q;
+    }
+
+    if(d == 0 || d == 1 || d == -1 || d == (long)(1UL << 63)){
+        return NULL;
+    }
+    int k = log2_exact(d);
+    if(k > 0){
+        return emit(IR_R_BIT_SHIFT, emit_sdiv_pow2(n, k), imm(k), false);
+    }
+    if(d < 0 && log2_exact(-d) > 0){
+        return NULL;
+    }
+
+    long magic;
+    int shift;
+    signed_magic(d, &magic, &shift);
+    Reg* q = emit(IR_MULHI, n, imm(magic), false);
+    if(d > 0 && magic < 0){
+        q = emit(IR_ADD, q, n, false);
+    } else if(d < 0 && magic > 0){
+        q = emit(IR_SUB, q, n, false);
+    }
+    if(shift > 0){
+        q = emit(IR_R_BIT_SHIFT, q, imm(shift), false);
+    }
+
+    // 負の商は1を足して0方向に切り捨てる
+    Reg* sign = emit(IR_R_BIT_SHIFT, q, imm(63), true);
+    return emit(IR_ADD, q, sign, false);
+}
+
+static void reduce_div(Reg* n, long d, bool is_unsigned){
+    // 商へのコピーは、この後の値番号付けで消える
+    Reg* q = d == 1 ? n : emit_quotient(n, d, is_unsigned);
+    if(q){
+        finish_mov(q);
+    }
+}
+
+static void reduce_mod(Reg* n, long d, bool is_unsigned){
+    int k = log2_exact(d);
+    if(is_unsigned && k > 0){
+        finish(IR_BIT_AND, n, imm(d - 1), true);
+        return;
+    }
+    if(!is_unsigned && d > 0 && k > 0){
+        Reg* t = emit_sdiv_pow2(n, k);
+        t = emit(IR_BIT_AND, t, imm(-d), false);
+        finish(IR_SUB, n, t, false);
+        return;
+    }
+
+    Reg* q = emit_quotient(n, d, is_unsigned);
+    if(q){
+        Reg* m = emit(IR_MUL, q, imm(d), is_unsigned);
+        finish(IR_SUB, n, m, is_unsigned);
+    }
+}
+
+int strength_reduce(CFG* target){
+    cfg = target;
+    reduced = 0;
+    for(int i = 0; i < cfg->nblocks; i++){
+        cur_bb = cfg->blocks[i];
+        IR* next = NULL;
+        for(IR* ir = cur_bb->ir; ir; ir = next){
+            next = ir->next;
+            cur_ir = ir;
+            if(!ir->t){
+                continue;
+            }
+            switch(ir->cmd){
+                case IR_MUL:
+                    if(ir->s1->kind == REG_IMM && ir->s2->kind != REG_IMM){
+                        Reg* tmp = ir->s1;
+                        ir->s1 = ir->s2;
+                        ir->s2 = tmp;
+                    }
+                    if(ir->s2->kind == REG_IMM && ir->s1->kind != REG_IMM){
+                        reduce_mul(ir->s1, ir->s2->val);
+                    }
+                    break;
+                case IR_DIV:
+                    if(ir->s2->kind == REG_IMM && ir->s1->kind != REG_IMM){
+                        reduce_div(ir->s1, ir->s2->val, ir->is_unsigned);
+                    }
+                    break;
+                case IR_MOD:
+                    if(ir->s2->kind == REG_IMM && ir->s1->kind != REG_IMM){
+                        reduce_mod(ir->s1, ir->s2->val, ir->is_unsigned);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return reduced;
+}
@@ -0,0 +1,105 @@
+#include "mcc2.h"
+
+/*
+    末尾呼び出しの最適化
+
+    レジスタ割り当ての後、関数呼び出しの結果をそのまま返すところ
+        call f
+        (mov r, 結果 / cast r, 結果)
+        ret r
+    を、フレームを戻してからfへ飛ぶ命令(IR_TAIL_CALL)にする。
+    fはこの関数の戻り先へ直接戻るので、呼び出しの深さだけスタックが伸びることがない。
+
+    呼び出し先から呼び出し元のフレームが見えてはいけないので、
+    ローカル変数のアドレスを作る関数(IR_RELでローカル変数を指す)と、
+    可変長引数を受け取る関数では行わない。
+    構造体を返す関数の呼び出しも対象にしない。
+*/
+
+static bool same_reg(Reg* a, Reg* b){
+    if(a == b){
+        return true;
+    }
+    return a && b && a->kind == REG_REG && b->kind == REG_REG && a->phys >= 0 && a->phys == b->phys;
+}
+
+// 呼び出し元のフレームのアドレスを使う関数か
+static bool uses_frame_addr(Ident* func){
+    for(IR* ir = func->ir_cmd; ir; ir = ir->next){
+        if(ir->cmd == IR_VA_START){
+            return true;
+        }
+        if(ir->cmd == IR_REL && ir->s1->ident->kind == ID_LVAR){
+            return true;
+        }
+    }
+    return false;
+}
+
+// callの結果を、そのまま関数の戻り値にしているか
+// 戻り値の型への変換は、呼び出し先の戻り値の幅に収まる(上位を捨てるだけの)ものなら同じ値とみなす
+static bool returns_result(Ident* func, IR* call){
+    Reg* result = call->t;
+    int ret_size = call->s1->ident->type->size;
+    for(IR* ir = call->next; ir; ir = ir->next){
+        switch(ir->cmd){
+            case IR_COMMENT:
+            case IR_LABEL:
+            case IR_RELEASE_REG:
+            case IR_RELEASE_REG_ALL:
+                break;
+            case IR_MOV:
+                if(ir->s2->kind == REG_IMM || !same_reg(ir->s2, result)){
+                    return false;
+                }
+                result = ir->s1;
+                break;
+            case IR_CAST:
+                if(!same_reg(ir->s1, result) || ir->size > ret_size || ir->size != func->type->size){
+                    return false;
+                }
+                result = ir->t;
+                break;
+            case IR_RET:
+                return func->type->kind == TY_VOID || same_reg(ir->s1, result);
+            case IR_FN_END_LABEL:
+                return func->type->kind == TY_VOID;
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
+static bool is_struct_type(Type* ty){
+    return ty->kind == TY_STRUCT || ty->kind == TY_UNION;
+}
+
+int tail_call(Ident* func){
+    if(is_struct_type(func->type) || uses_frame_addr(func)){
+        return 0;
+    }
+
+    int count = 0;
+    for(IR* ir = func->ir_cmd; ir; ir = ir->next){
+        if(ir->cmd != IR_FN_CALL || is_struct_type(ir->s1->ident->type)){
+            continue;
+        }
+        if(!returns_result(func, ir)){
+            continue;
+        }
+        ir->cmd = IR_TAIL_CALL;
+        ir->t = NULL;
+
+        // 続くretは、ラベルを越えなければほかから使われない
+        while(ir->next && (ir->next->cmd == IR_COMMENT || ir->next->cmd == IR_MOV || ir->next->cmd == IR_CAST
+            || ir->next->cmd == IR_RELEASE_REG || ir->next->cmd == IR_RELEASE_REG_ALL)){
+            ir->next = ir->next->next;
+        }
+        if(ir->next && ir->next->cmd == IR_RET){
+            ir->next = ir->next->next;
+        }
+        count++;
+    }
+    return count;
+}
@@ -11,6 +11,8 @@ Type* ty_ushort;
 Type* ty_uint;
 Type* ty_ulong;
 
+int print_layout = 0;  // 構造体のレイアウトの出力（--layout-report）
+
 
 void ty_init(){
     ty_void = new_type(TY_VOID, 1);
@@ -48,7 +50,8 @@ Type* pointer_to(Type* base){
 Type* array_of(Type* base, int len){
     Type* type = new_type(TY_ARRAY, 8);
     type->ptr_to = base;
-    type->size = base->size;
+    type->size = base->size * len;
+    type->align = base->align;
     type->array_len = len;
     return type;
 }
@@ -57,9 +60,153 @@ Type* new_type(TypeKind kind, int size){
     Type* type = calloc(1, sizeof(Type));
     type->kind = kind;
     type->size = size;
+    type->align = size;
     return type;
 }
 
+// nをalignの倍数に切り上げる
+int align_to(int n, int align){
+    if(align <= 1){
+        return n;
+    }
+    return (n + align - 1) / align * align;
+}
+
+/*
+    構造体・共用体のメンバーの配置を決める (System V ABI)
+        - メンバーはそれぞれの型のアラインメントの倍数のオフセットに置く
+        - 構造体のアラインメントはメンバーの最大のアラインメント
+        - 大きさは、配列にしても各要素が揃うようにアラインメントの倍数に切り上げる
+*/
+void layout_struct(Type* ty, bool is_union){
+    int offset = 0;
+    int size = 0;
+    int align = 1;
+    for(Member* cur = ty->member; cur; cur = cur->next){
+        Type* mty = cur->ident->type;
+        if(align < mty->align){
+            align = mty->align;
+        }
+        if(is_union){
+            cur->ident->offset = 0;
+            if(size < mty->size){
+                size = mty->size;
+            }
+        } else {
+            offset = align_to(offset, mty->align);
+            cur->ident->offset = offset;
+            offset += mty->size;
+            size = offset;
+        }
+    }
+    ty->align = align;
+    ty->size = align_to(size, align);
+}
+
+static char* type_name(Type* ty){
+    switch(ty->kind){
+        case TY_VOID:
+            return "void";
+        case TY_BOOL:
+            return "_Bool";
+        case TY_POINTER:
+            return format_string("%s*", type_name(ty->ptr_to));
+        case TY_ARRAY:
+            return format_string("%s[%d]", type_name(ty->ptr_to), ty->array_len);
+        case TY_STRUCT:
+        case TY_UNION:
+        {
+            char* kw = ty->kind == TY_STRUCT ? "struct" : "union";
+            if(!ty->name || !ty->name->file){
+                return kw;
+            }
+            return format_string("%s %.*s", kw, ty->name->len, ty->name->pos);
+        }
+        default:
+        {
+            char* name = ty->size == 1 ? "char" : ty->size == 2 ? "short" : ty->size == 4 ? "int" : "long";
+            return ty->is_unsigned ? format_string("unsigned %s", name) : name;
+        }
+    }
+}
+
+static int member_cmp(const void* a, const void* b){
+    Member* ma = *(Member**)a;
+    Member* mb = *(Member**)b;
+    if(ma->ident->type->align != mb->ident->type->align){
+        return mb->ident->type->align - ma->ident->type->align;
+    }
+    // 同じアラインメントなら元の順番を保つ
+    return ma->ident->offset - mb->ident->offset;
+}
+
+/*
+    --layout-report : 構造体のメンバーのオフセットと大きさ、詰め物(padding)の位置を表示する。
+    詰め物があるときは、アラインメントの大きい順に並べ替えたときの大きさも表示する。
+*/
+void report_layout(Type* ty, Token* tok){
+    if(!tok->file){
+        // コンパイラが用意した構造体
+        return;
+    }
+    bool is_union = ty->kind == TY_UNION;
+    int nmembers = 0;
+    int padding = 0;
+    int end = 0;
+    for(Member* cur = ty->member; cur; cur = cur->next){
+        nmembers++;
+        if(is_union){
+            if(end < cur->ident->type->size){
+                end = cur->ident->type->size;
+            }
+        } else {
+            padding += cur->ident->offset - end;
+            end = cur->ident->offset + cur->ident->type->size;
+        }
+    }
+    padding += ty->size - end;
+
+    remark_tok(tok, "%s: size %d, align %d, padding %d", type_name(ty), ty->size, ty->align, padding);
+
+    end = 0;
+    for(Member* cur = ty->member; cur; cur = cur->next){
+        Ident* m = cur->ident;
+        if(!is_union && end < m->offset){
+            fprintf(stderr, "    offset %4d  size %4d  (padding)\n", end, m->offset - end);
+        }
+        fprintf(stderr, "    offset %4d  size %4d  %s %s\n", m->offset, m->type->size, type_name(m->type), m->name);
+        end = m->offset + m->type->size;
+    }
+    if(!is_union && end < ty->size){
+        fprintf(stderr, "    offset %4d  size %4d  (tail padding)\n", end, ty->size - end);
+    }
+
+    if(is_union || padding == 0){
+        return;
+    }
+
+    // アラインメントの大きい順に並べたときの大きさ
+    Member** sorted = calloc(nmembers, sizeof(Member*));
+    int i = 0;
+    for(Member* cur = ty->member; cur; cur = cur->next){
+        sorted[i++] = cur;
+    }
+    qsort(sorted, nmembers, sizeof(Member*), member_cmp);
+
+    int offset = 0;
+    for(i = 0; i < nmembers; i++){
+        offset = align_to(offset, sorted[i]->ident->type->align) + sorted[i]->ident->type->size;
+    }
+    int size = align_to(offset, ty->align);
+    if(size < ty->size){
+        fprintf(stderr, "    suggested order (size %d):", size);
+        for(i = 0; i < nmembers; i++){
+            fprintf(stderr, " %s", sorted[i]->ident->name);
+        }
+        fprintf(stderr, "\n");
+    }
+}
+
 Type* register_typedef(Ident* ident, Type* ty){
     ident->type = ty;
     ident->kind = ID_TYPE;
@@ -96,6 +243,7 @@ void add_type(Node* node){
                 || (node->rhs->type->kind == TY_VOID)){
                 error_tok(node->pos, "invalid operands of types 'void' to binary 'operator'");
             }
+        case ND_NOT:                // 論理否定（1 or 0）
         case ND_LT:
         case ND_LE:
         case ND_NUM:
@@ -56,4 +56,68 @@ void printline(Token* tok){
     int indent = fprintf(fp, "%s:%d: ", filename, line_num);
     fprintf(fp, "%.*s\n", (int)(end - line), line);
 
-}
\ No newline at end of file
+}
+// ---------- BitSet ----------
+// 最適化のデータフロー解析で使う固定長のビット集合
+
+#define BITSET_WORD_BITS (8 * sizeof(unsigned long))
+
+static int bitset_words(int size){
+    return (size + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+}
+
+BitSet* new_bitset(int size){
+    BitSet* set = calloc(1, sizeof(BitSet));
+    set->size = size;
+    set->bits = calloc(bitset_words(size) + 1, sizeof(unsigned long));
+    return set;
+}
+
+BitSet* copy_bitset(BitSet* src){
+    BitSet* set = new_bitset(src->size);
+    memcpy(set->bits, src->bits, bitset_words(src->size) * sizeof(unsigned long));
+    return set;
+}
+
+void bitset_set(BitSet* set, int idx){
+    set->bits[idx / BITSET_WORD_BITS] |= 1UL << (idx % BITSET_WORD_BITS);
+}
+
+void bitset_clear(BitSet* set, int idx){
+    set->bits[idx / BITSET_WORD_BITS] &= ~(1UL << (idx % BITSET_WORD_BITS));
+}
+
+bool bitset_test(BitSet* set, int idx){
+    return (set->bits[idx / BITSET_WORD_BITS] >> (idx % BITSET_WORD_BITS)) & 1;
+}
+
+// dst |= src。dstが変化した場合はtrueを返す
+bool bitset_union(BitSet* dst, BitSet* src){
+    bool changed = false;
+    for(int i = 0; i < bitset_words(dst->size); i++){
+        unsigned long v = dst->bits[i] | src->bits[i];
+        if(v != dst->bits[i]){
+            dst->bits[i] = v;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool bitset_equal(BitSet* a, BitSet* b){
+    for(int i = 0; i < bitset_words(a->size); i++){
+        if(a->bits[i] != b->bits[i]){
+            return false;
+        }
+    }
+    return true;
+}
+
+bool bitset_intersects(BitSet* a, BitSet* b){
+    for(int i = 0; i < bitset_words(a->size); i++){
+        if(a->bits[i] & b->bits[i]){
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,234 @@
+.intel_syntax noprefix
+.global test_assignment
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of assignment..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_assignment
+#	 stack size: 4
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_assignment:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+#test/c/assignment.c:4:     printf("test of assignment..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 3
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 3
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 0
+  sub r9, 3
+  cmp r8, r9
+  jne .L2
+  mov rbx, 0
+  jmp .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L3:
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+  lea r8, [rbp - 4]
+  mov r9, 2
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r8, [r8 + r8 * 2]
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 6
+  jne .L4
+  mov rbx, 0
+  jmp .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L5:
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+  lea r8, [rbp - 4]
+  mov r9, 8
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 4
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rax
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jne .L6
+  mov rbx, 0
+  jmp .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L7:
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+  lea r8, [rbp - 4]
+  mov r9, 13
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  mov r9, 5
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+  lea r8, [rbp - 4]
+  mov r9, 56
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sar r8, 3
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+  lea r8, [rbp - 4]
+  mov r9, 7
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sal r8, 3
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 56
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#test/c/assignment.c:13:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_assignment
+ret_test_assignment:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
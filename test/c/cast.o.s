@@ -0,0 +1,1209 @@
+.intel_syntax noprefix
+.global test_cast
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of pointer cast..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of cast..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_cast
+#	 stack size: 60
+#	 pcs2( ofs: 60, size: 4) : level0
+#	 a( ofs: 56, size: 8) : level0
+#	 pcs( ofs: 48, size: 8) : level0
+#	 pi( ofs: 40, size: 8) : level0
+#	 ul( ofs: 32, size: 8) : level0
+#	 ui( ofs: 24, size: 4) : level0
+#	 us( ofs: 20, size: 2) : level0
+#	 uc( ofs: 17, size: 1) : level0
+#	 l( ofs: 16, size: 8) : level0
+#	 i( ofs: 8, size: 4) : level0
+#	 s( ofs: 4, size: 2) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  push rbx
+#test/c/cast.c:4:     printf("test of cast..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 1]
+  mov r9, 0
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 16]
+  mov r9, 0
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+  lea r8, [rbp - 17]
+  mov r9, 0
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+  lea r8, [rbp - 20]
+  mov r9, 0
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+  lea r8, [rbp - 24]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 32]
+  mov r9, 0
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/cast.c:16:     c = -1;
+  mov r8, 0
+  sub r8, 1
+  lea r9, [rbp - 1]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L2
+  mov rbx, 0
+  jmp .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L3:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L4
+  mov rbx, 0
+  jmp .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L5:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L6
+  mov rbx, 0
+  jmp .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L7:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 18446744073709551615
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#test/c/cast.c:26:     s = -1;
+  mov r8, 0
+  sub r8, 1
+  lea r9, [rbp - 4]
+  mov WORD PTR [r9], r8w
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L14
+  mov rbx, 0
+  jmp .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L16
+  mov rbx, 0
+  jmp .L17
+.L16:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L20
+  mov rbx, 0
+  jmp .L21
+.L20:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L22
+  mov rbx, 0
+  jmp .L23
+.L22:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L23:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L24
+  mov rbx, 0
+  jmp .L25
+.L24:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 18446744073709551615
+  jne .L26
+  mov rbx, 0
+  jmp .L27
+.L26:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L27:
+#test/c/cast.c:36:     i = -1;
+  mov r8, 0
+  sub r8, 1
+  lea r9, [rbp - 8]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L28
+  mov rbx, 0
+  jmp .L29
+.L28:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  movsx r8, r8w
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L30
+  mov rbx, 0
+  jmp .L31
+.L30:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L32
+  mov rbx, 0
+  jmp .L33
+.L32:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L34
+  mov rbx, 0
+  jmp .L35
+.L34:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L36
+  mov rbx, 0
+  jmp .L37
+.L36:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L37:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L38
+  mov rbx, 0
+  jmp .L39
+.L38:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 18446744073709551615
+  jne .L40
+  mov rbx, 0
+  jmp .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L41:
+#test/c/cast.c:46:     l = -1;
+  mov r8, 0
+  sub r8, 1
+  lea r9, [rbp - 16]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L42
+  mov rbx, 0
+  jmp .L43
+.L42:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L43:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsx r8, r8w
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L44
+  mov rbx, 0
+  jmp .L45
+.L44:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsxd r8, r8d
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L46
+  mov rbx, 0
+  jmp .L47
+.L46:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L47:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L48
+  mov rbx, 0
+  jmp .L49
+.L48:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L50
+  mov rbx, 0
+  jmp .L51
+.L50:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L52
+  mov rbx, 0
+  jmp .L53
+.L52:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  mov r8, QWORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 18446744073709551615
+  jne .L54
+  mov rbx, 0
+  jmp .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L55:
+#test/c/cast.c:56:     uc = 255;
+  lea r8, [rbp - 17]
+  mov r9, 255
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L56
+  mov rbx, 0
+  jmp .L57
+.L56:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L58
+  mov rbx, 0
+  jmp .L59
+.L58:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L60
+  mov rbx, 0
+  jmp .L61
+.L60:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L62
+  mov rbx, 0
+  jmp .L63
+.L62:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L64
+  mov rbx, 0
+  jmp .L65
+.L64:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L66
+  mov rbx, 0
+  jmp .L67
+.L66:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 17]
+  movzx r8, BYTE PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 255
+  jne .L68
+  mov rbx, 0
+  jmp .L69
+.L68:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L69:
+#test/c/cast.c:66:     us = 65535;
+  lea r8, [rbp - 20]
+  mov r9, 65535
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L70
+  mov rbx, 0
+  jmp .L71
+.L70:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  movsx r8, r8w
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L72
+  mov rbx, 0
+  jmp .L73
+.L72:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 65535
+  jne .L74
+  mov rbx, 0
+  jmp .L75
+.L74:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 65535
+  jne .L76
+  mov rbx, 0
+  jmp .L77
+.L76:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L78
+  mov rbx, 0
+  jmp .L79
+.L78:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 65535
+  jne .L80
+  mov rbx, 0
+  jmp .L81
+.L80:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L81:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  movzx r8, WORD PTR [r8]
+# cast st
+  mov r8, r8
+  cmp r8, 65535
+  jne .L82
+  mov rbx, 0
+  jmp .L83
+.L82:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L83:
+#test/c/cast.c:76:     ui = 4294967295;
+  lea r8, [rbp - 24]
+  mov r9, 4294967295
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L84
+  mov rbx, 0
+  jmp .L85
+.L84:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L85:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  movsx r8, r8w
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L86
+  mov rbx, 0
+  jmp .L87
+.L86:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  movsxd r8, r8d
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L88
+  mov rbx, 0
+  jmp .L89
+.L88:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L89:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L90
+  mov rbx, 0
+  jmp .L91
+.L90:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L92
+  mov rbx, 0
+  jmp .L93
+.L92:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L93:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L94
+  mov rbx, 0
+  jmp .L95
+.L94:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L95:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 24]
+  mov r8d, DWORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L96
+  mov rbx, 0
+  jmp .L97
+.L96:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L97:
+#test/c/cast.c:86:     ul = 18446744073709551615ul;
+  lea r8, [rbp - 32]
+  mov r9, 18446744073709551615
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsx r8, r8b
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L98
+  mov rbx, 0
+  jmp .L99
+.L98:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsx r8, r8w
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L100
+  mov rbx, 0
+  jmp .L101
+.L100:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L101:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movsxd r8, r8d
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L102
+  mov rbx, 0
+  jmp .L103
+.L102:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  mov r8, r8
+  mov r9, 0
+  sub r9, 1
+  cmp r8, r9
+  jne .L104
+  mov rbx, 0
+  jmp .L105
+.L104:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L105:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  jne .L106
+  mov rbx, 0
+  jmp .L107
+.L106:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L107:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  jne .L108
+  mov rbx, 0
+  jmp .L109
+.L108:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L109:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 32]
+  mov r8, QWORD PTR [r8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  jne .L110
+  mov rbx, 0
+  jmp .L111
+.L110:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L111:
+#test/c/cast.c:96:     printf("test of pointer cast..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/cast.c:97:     i = 5555;
+  lea r8, [rbp - 8]
+  mov r9, 5555
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 8]
+  lea r9, [rbp - 40]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 40]
+  mov r8, QWORD PTR [r8]
+  movsx r8, BYTE PTR [r8]
+  mov r9, 0
+  sub r9, 77
+  cmp r8, r9
+  jne .L112
+  mov rbx, 0
+  jmp .L113
+.L112:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L113:
+  lea r8, [rbp - 56]
+  mov r9, 123456
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 56]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 64
+  jne .L114
+  mov rbx, 0
+  jmp .L115
+.L114:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L115:
+#test/c/cast.c:112:     pcs2.a = 1;
+  lea r8, [rbp - 60]
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/cast.c:113:     pcs2.b = 12;
+  lea r8, [rbp - 60]
+  add r8, 1
+  mov r9, 12
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/cast.c:118:     (PointerCastStruct2*)&pcs2;
+  lea r8, [rbp - 60]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 60]
+  add r8, 1
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 12
+  jne .L116
+  mov rbx, 0
+  jmp .L117
+.L116:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L117:
+ret_test_cast:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -1,5 +1,11 @@
 #include "testinc.h"
 
+int logic_calls;
+int logic_call(int v);
+long op_by(int op, long n, long d);
+unsigned long uop_by(int op, unsigned long n, unsigned long d);
+int strength_mismatch(long n);
+
 int test_expression(){
     printf("test of expression..\n");
     ASSERT( 3 + 5, 8);
@@ -41,6 +47,38 @@ int test_expression(){
     ASSERT(0 || 5, 1);
     ASSERT(0 || 0, 0);
 
+    printf("test of short-circuit evaluation...\n");
+    logic_calls = 0;
+    ASSERT(logic_call(0) && logic_call(1), 0);
+    ASSERT(logic_calls, 1);
+    ASSERT(logic_call(2) || logic_call(3), 1);
+    ASSERT(logic_calls, 2);
+    ASSERT(logic_call(4) && logic_call(0) || logic_call(5), 1);
+    ASSERT(logic_calls, 5);
+    int* logic_p = 0;
+    ASSERT(logic_p && *logic_p, 0);
+    ASSERT(!logic_p || *logic_p, 1);
+    int logic_v = 7;
+    logic_p = &logic_v;
+    ASSERT(logic_p && *logic_p == 7, 1);
+
+    printf("test of multiply and divide by constants...\n");
+    int sr_bad = 0;
+    for(long sr_i = -6; sr_i <= 6; sr_i++){
+        sr_bad += strength_mismatch(sr_i);
+        sr_bad += strength_mismatch(sr_i * 987654321987);
+        sr_bad += strength_mismatch(sr_i * 1234567 + 89);
+    }
+    ASSERT(sr_bad, 0);
+    int sr_int = -100;
+    ASSERT(sr_int / 8, -12);
+    ASSERT(sr_int % 8, -4);
+    ASSERT(sr_int / 7, -14);
+    ASSERT(sr_int % 7, -2);
+    unsigned int sr_uint = 4000000000;
+    ASSERT(sr_uint / 3 == 1333333333, 1);
+    ASSERT(sr_uint % 7, 3);
+
     printf("test of comma operator...\n");
     ASSERT(3, (4, 3));
     ASSERT(4, (3, 4));
@@ -108,7 +146,7 @@ int test_expression(){
         short a;
         int b;
     } TestStruct;
-    ASSERT(sizeof(TestStruct), 6);
+    ASSERT(sizeof(TestStruct), 8);
     ASSERT(sizeof(TestStruct*), 8);
 
     typedef union {
@@ -132,5 +170,85 @@ int test_expression(){
     ASSERT(reg2[1], 2);
     ASSERT(reg2[2], 1);
 
+    printf("test of signed and unsigned arithmetic ...\n");
+    long sl = -7;
+    ASSERT(sl / 2, -3);
+    ASSERT(sl % 2, -1);
+    ASSERT(sl >> 1, -4);
+    ASSERT(sl < 1, 1);
+    unsigned long ul = 0;
+    ul = ul - 1;
+    ASSERT(ul > 5, 1);
+    ASSERT(ul <= 5, 0);
+    ASSERT(ul >> 60, 15);
+    ASSERT(ul / 1152921504606846976, 15);
+    ASSERT(ul % 16, 15);
+    unsigned int ui = 7;
+    ASSERT(ui / 2, 3);
+    ASSERT(-7 / 2, -3);
+    ASSERT(1L << 40 >> 38, 4);
+    ASSERT((char)300, 44);
+    ASSERT((unsigned char)-1, 255);
+    int folded = 4 * 8;
+    if(0){
+        folded = 0;
+    }
+    while(0){
+        folded = 1;
+    }
+    ASSERT(folded, 32);
+
     return 0;
 }
+
+int logic_call(int v){
+    logic_calls++;
+    return v;
+}
+
+// 定数で割ると強度低減される。引数で渡すとidivのまま
+long op_by(int op, long n, long d){
+    if(op == 0) return n * d;
+    if(op == 1) return n / d;
+    return n % d;
+}
+
+unsigned long uop_by(int op, unsigned long n, unsigned long d){
+    if(op == 1) return n / d;
+    return n % d;
+}
+
+int strength_mismatch(long n){
+    int bad = 0;
+    unsigned long u = n;
+    bad += n * 0 != op_by(0, n, 0);
+    bad += n * 1 != op_by(0, n, 1);
+    bad += n * 3 != op_by(0, n, 3);
+    bad += n * 8 != op_by(0, n, 8);
+    bad += n * 10 != op_by(0, n, 10);
+    bad += n * 17 != op_by(0, n, 17);
+    bad += n * 31 != op_by(0, n, 31);
+    bad += n * 72 != op_by(0, n, 72);
+    bad += n / 1 != op_by(1, n, 1);
+    bad += n / 2 != op_by(1, n, 2);
+    bad += n / 16 != op_by(1, n, 16);
+    bad += n / 3 != op_by(1, n, 3);
+    bad += n / 7 != op_by(1, n, 7);
+    bad += n / 10 != op_by(1, n, 10);
+    bad += n / 1000 != op_by(1, n, 1000);
+    bad += n / -3 != op_by(1, n, -3);
+    bad += n / -10 != op_by(1, n, -10);
+    bad += n % 2 != op_by(2, n, 2);
+    bad += n % 64 != op_by(2, n, 64);
+    bad += n % 3 != op_by(2, n, 3);
+    bad += n % 7 != op_by(2, n, 7);
+    bad += n % -10 != op_by(2, n, -10);
+    bad += u / 4 != uop_by(1, u, 4);
+    bad += u / 3 != uop_by(1, u, 3);
+    bad += u / 7 != uop_by(1, u, 7);
+    bad += u / 10 != uop_by(1, u, 10);
+    bad += u % 8 != uop_by(2, u, 8);
+    bad += u % 7 != uop_by(2, u, 7);
+    bad += u % 10 != uop_by(2, u, 10);
+    return bad;
+}
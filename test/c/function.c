@@ -12,6 +12,108 @@ void void_func(){
     return;
 }
 
+int times_ten(int x){
+    return x * 10;
+}
+
+int combine(int a, int b, int c){
+    return a * 100 + b * 10 + c;
+}
+
+static inline int inl_clamp(int v, int lo, int hi){
+    if(v < lo) return lo;
+    if(v > hi) return hi;
+    return v;
+}
+
+static int inl_once(int n){
+    int s = 0;
+    for(int i = 0; i < n; i++){
+        if(i == 5) break;
+        s += i;
+    }
+    return s;
+}
+
+int inl_fact(int n){
+    if(n <= 1) return 1;
+    return n * inl_fact(n - 1);
+}
+
+inline int inl_add1(int x){
+    return x + 1;
+}
+
+inline int inl_twice(int x){
+    int a = inl_add1(x);
+    int b = inl_add1(a);
+    return a + b;
+}
+
+static void inl_store(int* p, int v){
+    int tmp = v;
+    *p = tmp;
+}
+
+inline int inl_swap_sum(int a, int b){
+    int t = a;
+    a = b;
+    b = t;
+    inl_store(&t, a * 10 + b);
+    return t;
+}
+
+long tc_sum(long n, long acc){
+    if(n == 0) return acc;
+    return tc_sum(n - 1, acc + n);
+}
+
+int tc_gcd(int a, int b){
+    if(b == 0){
+        return a;
+    }
+    return tc_gcd(b, a % b);
+}
+
+int tc_even(int n);
+
+int tc_odd(int n){
+    if(n == 0) return 0;
+    return tc_even(n - 1);
+}
+
+int tc_even(int n){
+    if(n == 0) return 1;
+    return tc_odd(n - 1);
+}
+
+int tc_addr(int n, int* p){
+    int x = n;
+    if(n == 0) return *p;
+    return tc_addr(n - 1, &x);
+}
+
+// 関数を呼び出さない、ローカル変数がレッドゾーンに収まる関数
+int fr_leaf(int n){
+    int a[8];
+    for(int i = 0; i < 8; i++){
+        a[i] = i * n;
+    }
+    int s = 0;
+    for(int i = 0; i < 8; i++){
+        s = s + a[i];
+    }
+    return s;
+}
+
+// 呼び出しをまたぐ値があり、callee-savedのレジスタを使う関数
+long fr_keep(long a){
+    long x = a * 2;
+    long y = times_ten(a);
+    long z = times_ten(x) + fr_leaf(a);
+    return x + y + z + times_ten(y);
+}
+
 int test_function(){
 
     printf("test of function call..\n");
@@ -25,5 +127,45 @@ int test_function(){
     printf("test of void function call..\n");
     void_func();
 
+    printf("test of nested function call..\n");
+    ASSERT(combine(1, times_ten(2) / 10, 3), 123);
+    ASSERT(combine(times_ten(1) / 10, 2, times_ten(3) / 10), 123);
+
+    printf("test of value live across function call..\n");
+    int x = 4;
+    int y = 5;
+    int z = times_ten(x) + y;
+    ASSERT(z + x + y, 54);
+
+    printf("test of inline expansion..\n");
+    ASSERT(inl_clamp(-3, 0, 10), 0);
+    ASSERT(inl_clamp(3, 0, 10), 3);
+    ASSERT(inl_clamp(30, 0, 10), 10);
+    ASSERT(inl_once(10), 10);
+    ASSERT(inl_fact(5), 120);
+    ASSERT(inl_twice(3), 9);
+    ASSERT(inl_twice(inl_twice(1)), 13);
+    ASSERT(inl_swap_sum(1, 2), 21);
+    int w = 0;
+    inl_store(&w, 7);
+    ASSERT(w, 7);
+
+    printf("test of frame layout..\n");
+    ASSERT(fr_leaf(3), 84);
+    ASSERT(fr_keep(1), 160);
+    ASSERT(fr_keep(fr_leaf(1)), 4480);
+
+    printf("test of tail call..\n");
+    ASSERT(tc_sum(1000, 0), 500500);
+    ASSERT(tc_gcd(1071, 462), 21);
+    ASSERT(tc_even(1001), 0);
+    ASSERT(tc_odd(1001), 1);
+    ASSERT(tc_addr(5, &w), 1);
+#ifdef __OPTIMIZE__
+    // 末尾呼び出しがスタックを使わなければ、深い再帰でもあふれない
+    ASSERT(tc_sum(10000000, 0), 50000005000000);
+    ASSERT(tc_even(10000000), 1);
+#endif
+
     return 0;
 }
\ No newline at end of file
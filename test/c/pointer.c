@@ -1,5 +1,19 @@
 #include "testinc.h"
 
+void set_through(int* p, int v);
+
+struct am_node {
+    char tag;
+    long val;
+    struct am_node* next;
+};
+long am_table[8];
+long am_sum_side(long* a, int i);
+long am_sum_tag(struct am_node* p, char tag);
+long am_max(long* a, int n);
+int am_len(char* s);
+long am_global(int i);
+
 int test_pointer(){
     int data; data = 10;
     int* a; a = &data;
@@ -33,5 +47,79 @@ int test_pointer(){
     ASSERT(ld, 15);
     ASSERT(sizeof lp, 8);
 
+    int arr[4];
+    arr[1] = 3;
+    int ai = 1;
+    int* ap = &arr[1];
+    int twice = arr[ai] + arr[ai];
+    *ap = 10;
+    ASSERT(twice, 6);
+    ASSERT(arr[ai] + arr[ai], 20);
+    set_through(ap, 7);
+    ASSERT(arr[ai] * arr[ai], 49);
+
+    printf("test of addressing mode..\n");
+    long la[5];
+    for(int i = 0; i < 5; i++){
+        la[i] = i * i + 1;
+    }
+    ASSERT(am_sum_side(la, 2), 12);
+    ASSERT(am_max(la, 5), 17);
+    struct am_node n3;
+    struct am_node n2;
+    struct am_node n1;
+    n1.tag = 2; n1.val = 10; n1.next = &n2;
+    n2.tag = 1; n2.val = 20; n2.next = &n3;
+    n3.tag = 2; n3.val = 30; n3.next = 0;
+    ASSERT(am_sum_tag(&n1, 2), 40);
+    ASSERT(am_sum_tag(&n1, 1), 20);
+    ASSERT(am_len("address"), 7);
+    ASSERT(am_global(5), 15);
+    ASSERT(am_global(0), 0);
+    ASSERT(am_table[5], 15);
+
     return 0;
 }
+
+void set_through(int* p, int v){
+    *p = v;
+}
+
+long am_sum_side(long* a, int i){
+    return a[i + 1] + a[i - 1];
+}
+
+long am_sum_tag(struct am_node* p, char tag){
+    long sum = 0;
+    while(p){
+        if(p->tag == tag){
+            sum += p->val;
+        }
+        p = p->next;
+    }
+    return sum;
+}
+
+long am_max(long* a, int n){
+    long m = a[0];
+    for(int i = 1; i < n; i++){
+        if(m < a[i]){
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+int am_len(char* s){
+    int n = 0;
+    while(*s){
+        n++;
+        s++;
+    }
+    return n;
+}
+
+long am_global(int i){
+    am_table[i] = i * 3;
+    return am_table[i] + am_table[0];
+}
@@ -0,0 +1,268 @@
+.intel_syntax noprefix
+.global test_preprocess
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of preprocess if directive..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of preprocess if-group..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of preprocess..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_preprocess
+#	 stack size: 16
+#	 func_arg_owner( ofs: 16, size: 4) : level0
+#	 TEST_CIRC_A( ofs: 12, size: 4) : level0
+#	 pp_ans( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_preprocess:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  push rbx
+#test/c/preprocessor.c:8:     printf("test of preprocess..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 4]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/preprocessor.c:10:     a = TEST_MACRO;
+  lea r8, [rbp - 4]
+  mov r9, 123
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 123
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  add r8, 2
+  cmp r8, 3
+  jne .L2
+  mov rbx, 0
+  jmp .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L3:
+#test/c/preprocessor.c:14:     printf("test of preprocess if-group..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/preprocessor.c:26:     a = 20;
+  lea r8, [rbp - 4]
+  mov r9, 20
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 20
+  jne .L4
+  mov rbx, 0
+  jmp .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L5:
+  lea r8, [rbp - 8]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/preprocessor.c:32:     printf("test of preprocess if directive..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/preprocessor.c:41:     pp_ans = 10;
+  lea r8, [rbp - 8]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L6
+  mov rbx, 0
+  jmp .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L7:
+#test/c/preprocessor.c:52:     pp_ans = 20;
+  lea r8, [rbp - 8]
+  mov r9, 20
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 20
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+  lea r8, [rbp - 12]
+  mov r9, 30
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  lea r8, [rbp - 12]
+  mov r9, 50
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 51
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+  mov r8, 3
+  imul r8, 4
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 12
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  add r8, 1
+  add r8, 2
+  cmp r8, 6
+  jne .L14
+  mov rbx, 0
+  jmp .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  jne .L16
+  mov rbx, 0
+  jmp .L17
+.L16:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L17:
+  lea r8, [rbp - 16]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#test/c/preprocessor.c:163:     OBJLIKE_VACANCY_MACRO;
+#test/c/preprocessor.c:164:     FUNC_ARG_OWNER(OBJLIKE_VACANCY_MACRO);
+#test/c/preprocessor.c:167:     FUNC_MACRO_VACANCY(3);
+#test/c/preprocessor.c:168:     FUNC_MACRO_VACANCY(XXXXXXX_NODEFINED);
+#test/c/preprocessor.c:170:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_preprocess
+ret_test_preprocess:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
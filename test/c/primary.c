@@ -10,6 +10,11 @@ int test_primary(){
     c = "abc"[2]; ASSERT(c, 'c');
     c = "abc"[3]; ASSERT(c, 0);
     ASSERT(sizeof "abd", 4);
+    char* s1 = "pooled";
+    char* s2 = "pooled";
+    ASSERT(s1 == s2, 1);
+    ASSERT(s1 == "pool", 0);
+    c = "a\0b"[2]; ASSERT(c, 'b');
 
     printf("test of function call..\n");
     ASSERT(add(3, 4), 7);
@@ -1,6 +1,41 @@
 #include "testinc.h"
 
 int test_return();
+int count_up();
+int branch_code(int a, int b);
+int unsigned_less(unsigned int a, unsigned int b);
+int in_range(int x);
+int switch_dense(int x);
+int switch_sparse(int x);
+int switch_mixed(int x);
+int switch_unsigned(unsigned int x);
+struct InvVec { int len; int* data; };
+int inv_limit;
+int inv_sum(struct InvVec* v, int k);
+int inv_shrink(struct InvVec* v);
+int inv_through_ptr(int* p);
+int inv_call();
+int inv_guard(struct InvVec* v);
+int iv_sum(int* a, int n);
+long iv_stride(long* a, long* b, int n);
+int iv_reverse();
+int iv_after(char* str, int n);
+int iv_weighted(int* a, int n);
+int unroll_sum(int* a, int n);
+int unroll_known();
+int unroll_jump(int n);
+int unroll_down(int n);
+int unroll_full();
+int unroll_heuristic(int* a, int n, int k);
+int vec_map(int* d, int* s, int n, int k);
+int vec_sum(int* a, int n);
+long vec_csum(char* a, int n);
+int vec_ucsum(unsigned char* a, int n);
+int vec_min(int* a, int n);
+int vec_max(int* a, int n);
+int vec_cmin(char* a, int n);
+int vec_ucmax(unsigned char* a, int n);
+int vec_overlap(int* d, int* s, int n);
 
 int test_statement(){
     printf("test of while-statement...\n");
@@ -77,6 +112,27 @@ int test_statement(){
     }
     ASSERT(if_a, 12);
 
+    printf("test of condition branch..\n");
+    ASSERT(branch_code(1, 2), 35);
+    ASSERT(branch_code(2, 2), 90);
+    ASSERT(branch_code(3, 2), 108);
+    ASSERT(branch_code(-1, 1), 35);
+    ASSERT(unsigned_less(-1, 1), 0);
+    ASSERT(unsigned_less(1, -1), 1);
+    ASSERT(in_range(-1), 0);
+    ASSERT(in_range(0), 1);
+    ASSERT(in_range(9), 1);
+    ASSERT(in_range(10), 0);
+    ASSERT(in_range(100), 1);
+    int cond_sc = 0;
+    if(0 && (cond_sc = 1)) cond_sc = 2;
+    ASSERT(cond_sc, 0);
+    if(1 || (cond_sc = 1)) cond_sc += 3;
+    ASSERT(cond_sc, 3);
+    int cond_n = 0;
+    while(!(cond_n >= 4)) cond_n += 1;
+    ASSERT(cond_n, 4);
+
     printf("test of return-statement...\n");
     ASSERT(test_return(), 5);
 
@@ -184,6 +240,121 @@ int test_statement(){
     ASSERT(s3, 10);
     ASSERT(s4, 12);
 
+    int s5 = 0;
+    switch(s2){
+        case 1:
+            s5 = 1;
+            break;
+    }
+    ASSERT(s5, 0);
+
+    int sw_sum = 0;
+    for(int sw_i = -3; sw_i < 12; sw_i++){
+        sw_sum = sw_sum * 3 + switch_dense(sw_i);
+        sw_sum = sw_sum % 1000003;
+    }
+    ASSERT(sw_sum, 55398);
+    ASSERT(switch_sparse(3), 1);
+    ASSERT(switch_sparse(1), 2);
+    ASSERT(switch_sparse(77), 3);
+    ASSERT(switch_sparse(100), 4);
+    ASSERT(switch_sparse(1000), 5);
+    ASSERT(switch_sparse(5000), 6);
+    ASSERT(switch_sparse(2), 0);
+    ASSERT(switch_sparse(4999), 0);
+    ASSERT(switch_sparse(-3), 0);
+    ASSERT(switch_mixed(3), 100);
+    ASSERT(switch_mixed(9), 0);
+    ASSERT(switch_mixed(10), 10);
+    ASSERT(switch_mixed(13), 13);
+    ASSERT(switch_mixed(15), 15);
+    ASSERT(switch_mixed(16), 0);
+    ASSERT(switch_mixed(1000), 200);
+    ASSERT(switch_mixed(2000), 300);
+    ASSERT(switch_mixed(1999), 0);
+    ASSERT(switch_unsigned(0), 1);
+    ASSERT(switch_unsigned(3), 4);
+    ASSERT(switch_unsigned(-1), 9);
+    ASSERT(switch_unsigned(-2), 0);
+
+    printf("test of loop invariant..\n");
+    int inv_data[5];
+    for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+    struct InvVec inv_v;
+    inv_v.len = 5;
+    inv_v.data = inv_data;
+    ASSERT(inv_sum(&inv_v, 2), 115);
+    ASSERT(inv_sum(&inv_v, 0), 25);
+    ASSERT(inv_guard(&inv_v), 15);
+    ASSERT(inv_guard(0), 0);
+    inv_v.len = 10;
+    ASSERT(inv_shrink(&inv_v), 3);
+    ASSERT(inv_v.len, 3);
+    int inv_other = 0;
+    ASSERT(inv_through_ptr(&inv_other), 10);
+    ASSERT(inv_through_ptr(&inv_limit), 4);
+    ASSERT(inv_call(), 6);
+
+    printf("test of induction variable..\n");
+    ASSERT(iv_sum(inv_data, 5), 15);
+    ASSERT(iv_sum(inv_data, 0), 0);
+    long iv_a[6];
+    long iv_b[6];
+    for(int iv_i = 0; iv_i < 6; iv_i++){
+        iv_a[iv_i] = iv_i;
+        iv_b[iv_i] = 10 - iv_i;
+    }
+    ASSERT(iv_stride(iv_a, iv_b, 6), 40);
+    ASSERT(iv_stride(iv_a, iv_b, 1), 0);
+    ASSERT(iv_reverse(), 2155287);
+    ASSERT(iv_after("abcde", 5), 500);
+    ASSERT(iv_weighted(inv_data, 5), 45);
+
+    printf("test of loop unrolling..\n");
+    int ur_a[20];
+    for(int ur_i = 0; ur_i < 20; ur_i++){
+        ur_a[ur_i] = ur_i * ur_i + 1;
+    }
+    ASSERT(unroll_sum(ur_a, 7), 98);
+    ASSERT(unroll_sum(ur_a, 0), 0);
+    ASSERT(unroll_sum(ur_a, 20), 2490);
+    ASSERT(unroll_sum(ur_a, 3), 8);
+    ASSERT(unroll_known(), 1013);
+    ASSERT(unroll_jump(20), 37);
+    ASSERT(unroll_jump(5), 7);
+    ASSERT(unroll_jump(0), 0);
+    ASSERT(unroll_down(10), 344);
+    ASSERT(unroll_down(9), 303);
+    ASSERT(unroll_down(-1), -1);
+    ASSERT(unroll_full(), 123);
+    ASSERT(unroll_heuristic(ur_a, 20, 0), 361);
+    ASSERT(unroll_heuristic(ur_a, 20, 5), 196);
+    ASSERT(unroll_heuristic(ur_a, 1, 0), 0);
+
+    printf("test of loop vectorization..\n");
+    int vec_a[100];
+    int vec_d[100];
+    char vec_c[100];
+    unsigned char vec_u[100];
+    for(int vec_i = 0; vec_i < 100; vec_i++){
+        vec_a[vec_i] = vec_i * 7919 % 2001 - 1000;
+        vec_c[vec_i] = vec_i * 53 % 256 - 128;
+        vec_u[vec_i] = vec_i * 71 % 256;
+    }
+    ASSERT(vec_map(vec_d, &vec_a[1], 37, 5), -217499273);
+    ASSERT(vec_map(vec_d, vec_a, 0, 5), 0);
+    ASSERT(vec_sum(&vec_a[3], 50), 1209);
+    ASSERT(vec_sum(vec_a, 3), 747);
+    ASSERT(vec_csum(&vec_c[1], 70), -391);
+    ASSERT(vec_ucsum(vec_u, 70), 8905);
+    ASSERT(vec_min(&vec_a[2], 60), -993);
+    ASSERT(vec_min(vec_a, 0), 10000);
+    ASSERT(vec_max(vec_a, 60), 962);
+    ASSERT(vec_cmin(vec_c, 70), -128);
+    ASSERT(vec_ucmax(&vec_u[5], 64), 254);
+    ASSERT(vec_overlap(&vec_a[1], vec_a, 40), -960);
+    ASSERT(vec_a[20], -980);
+
     printf("test of label and goto..\n");
 
     int li = 0;
@@ -194,10 +365,331 @@ int test_statement(){
     LABEL_TEST_END:
     ASSERT(li, 10);
 
+    printf("test of expression statement..\n");
+    int es = 3;
+    es * 2 + 1;
+    es == 4;
+    (long)es;
+    es++;
+    ASSERT(es, 4);
+    int* esp = &es;
+    *esp + 1;
+    count_up() * 2;
+    count_up() + es;
+    ASSERT(count_up(), 3);
+
     return 0;
 }
 
+int up_count;
+int count_up(){
+    up_count++;
+    return up_count;
+}
+
 int test_return(){
     return 5;
     123;
 }
+
+int branch_code(int a, int b){
+    int code = 0;
+    if(a < b) code += 1;
+    if(a <= b) code += 2;
+    if(a > b) code += 4;
+    if(a >= b) code += 8;
+    if(a == b) code += 16;
+    if(a != b) code += 32;
+    if(!(a < b)) code += 64;
+    return code;
+}
+
+int unsigned_less(unsigned int a, unsigned int b){
+    if(a < b) return 1;
+    return 0;
+}
+
+int in_range(int x){
+    if(x >= 0 && x < 10 || x == 100) return 1;
+    return 0;
+}
+
+int switch_dense(int x){
+    switch(x){
+        case 0: return 3;
+        case 1: return 1;
+        case 2: return 4;
+        case 3: return 1;
+        case 4: return 5;
+        case 6: return 9;
+        case 7: return 2;
+        case 8:
+        case 9: return 6;
+        default: return 7;
+    }
+}
+
+int switch_sparse(int x){
+    switch(x){
+        case 1000: return 5;
+        case 1: return 2;
+        case 3: return 1;
+        case 5000: return 6;
+        case 77: return 3;
+        case 100: return 4;
+    }
+    return 0;
+}
+
+int switch_mixed(int x){
+    int r = 0;
+    switch(x){
+        case 3: r = 100; break;
+        case 10: r = 10; break;
+        case 11: r = 11; break;
+        case 12: r = 12; break;
+        case 13: r = 13; break;
+        case 14: r = 14; break;
+        case 15: r = 15; break;
+        case 1000: r = 200; break;
+        case 2000: r = 300; break;
+    }
+    return r;
+}
+
+int switch_unsigned(unsigned int x){
+    switch(x){
+        case 0: return 1;
+        case 1: return 2;
+        case 2: return 3;
+        case 3: return 4;
+        case 4294967295: return 9;
+    }
+    return 0;
+}
+
+int inv_scale;
+
+int inv_sum(struct InvVec* v, int k){
+    inv_scale = 2;
+    int s = 0;
+    for(int i = 0; i < v->len; i++){
+        s = s + v->data[i] * (k * 3 + 1) + inv_scale;
+    }
+    return s;
+}
+
+int inv_shrink(struct InvVec* v){
+    int n = 0;
+    for(int i = 0; i < v->len; i++){
+        if(i == 2) v->len = 3;
+        n++;
+    }
+    return n;
+}
+
+int inv_through_ptr(int* p){
+    int n = 0;
+    inv_limit = 10;
+    for(int i = 0; i < inv_limit; i++){
+        *p = 4;
+        n++;
+    }
+    return n;
+}
+
+int inv_set_limit(int n){
+    inv_limit = n;
+    return 0;
+}
+
+int inv_call(){
+    int n = 0;
+    inv_limit = 3;
+    for(int i = 0; i < inv_limit; i++){
+        if(i == 0) inv_set_limit(6);
+        n++;
+    }
+    return n;
+}
+
+int inv_guard(struct InvVec* v){
+    int s = 0;
+    for(int i = 0; v && i < v->len; i++){
+        s += v->data[i];
+    }
+    return s;
+}
+
+int iv_sum(int* a, int n){
+    int s = 0;
+    for(int i = 0; i < n; i++){
+        s += a[i];
+    }
+    return s;
+}
+
+long iv_stride(long* a, long* b, int n){
+    long s = 0;
+    for(int i = 2; i < n; i += 2){
+        s += a[i] * b[i];
+    }
+    return s;
+}
+
+int iv_reverse(){
+    int arr[10];
+    for(int i = 0; i < 10; i++) arr[i] = i * i;
+    int t = 0;
+    for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+    return t;
+}
+
+int iv_after(char* str, int n){
+    int s = 0;
+    int i;
+    for(i = 0; i < n; i++){
+        s += str[i];
+    }
+    return s + i;
+}
+
+int iv_weighted(int* a, int n){
+    int s = 0;
+    for(int i = 0; i < n; i++){
+        s += a[i] * i;
+    }
+    return s + n;
+}
+
+int unroll_sum(int* a, int n){
+    int s = 0;
+#pragma unroll 4
+    for(int i = 0; i < n; i++){
+        s += a[i];
+    }
+    return s;
+}
+
+int unroll_known(){
+    int s = 0;
+#pragma unroll 3
+    for(int i = 0; i < 10; i++){
+        s = s * 2 + i;
+    }
+    return s;
+}
+
+int unroll_jump(int n){
+    int s = 0;
+#pragma unroll
+    for(int i = 0; i < n; i++){
+        if(i % 3 == 0) continue;
+        if(i == 11) break;
+        s += i;
+    }
+    return s;
+}
+
+int unroll_down(int n){
+    int s = 0;
+    int i;
+#pragma unroll 2
+    for(i = n; i >= 0; i -= 3){
+        s = s * 3 + i;
+    }
+    return s + i;
+}
+
+int unroll_full(){
+    int s = 0;
+#pragma unroll 8
+    for(long i = 1; i <= 3; ++i){
+        s = s * 10 + i;
+    }
+    return s;
+}
+
+int unroll_heuristic(int* a, int n, int k){
+    int s = 0;
+    for(int i = 1; i < n - k; i++){
+        s += a[i] - a[i - 1];
+    }
+    return s;
+}
+
+int vec_map(int* d, int* s, int n, int k){
+    for(int i = 0; i < n; i++){
+        d[i] = (s[i] << 2) - s[i] + k;
+    }
+    int h = 0;
+    for(int i = 0; i < n; i++){
+        h = h * 3 + d[i];
+    }
+    return h;
+}
+
+int vec_sum(int* a, int n){
+    int s = 0;
+    for(int i = 0; i < n; i++){
+        s += a[i];
+    }
+    return s;
+}
+
+long vec_csum(char* a, int n){
+    long s = 0;
+    for(int i = 0; i < n; i++){
+        s += a[i];
+    }
+    return s;
+}
+
+int vec_ucsum(unsigned char* a, int n){
+    int s = 0;
+    for(int i = 0; i < n; i++){
+        s = s + a[i];
+    }
+    return s;
+}
+
+int vec_min(int* a, int n){
+    int m = 10000;
+    for(int i = 0; i < n; i++){
+        if(a[i] < m){
+            m = a[i];
+        }
+    }
+    return m;
+}
+
+int vec_max(int* a, int n){
+    int m = -10000;
+    for(int i = 0; i < n; i++){
+        m = m < a[i] ? a[i] : m;
+    }
+    return m;
+}
+
+int vec_cmin(char* a, int n){
+    int m = 1000;
+    for(int i = 0; i < n; i++){
+        if(a[i] < m) m = a[i];
+    }
+    return m;
+}
+
+int vec_ucmax(unsigned char* a, int n){
+    unsigned char m = 0;
+    for(int i = 0; i < n; i++){
+        if(m < a[i]) m = a[i];
+    }
+    return m;
+}
+
+int vec_overlap(int* d, int* s, int n){
+    for(int i = 0; i < n; i++){
+        d[i] = s[i] + 1;
+    }
+    return d[n - 1];
+}
@@ -0,0 +1,129 @@
+.intel_syntax noprefix
+.global main
+.global test_extern_int
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test is complete!!!\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "mcc2 test...\n\n"
+  .bss
+  .align 4
+test_extern_int:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# main
+#	 stack size: 0
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  push rbx
+#test/c/test.c:6:     printf("mcc2 test...\n\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:8:     test_extern_int = 10;
+  lea r8, [ rip + test_extern_int ]
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/test.c:9:     test_static = 20;
+  lea r8, [ rip + .Ltest_static ]
+  mov r9, 20
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/test.c:11:     test_expression();
+  sub rsp, 8
+  call test_expression
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:12:     test_statement();
+  sub rsp, 8
+  call test_statement
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:13:     test_variable();
+  sub rsp, 8
+  call test_variable
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:14:     test_type();
+  sub rsp, 8
+  call test_type
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:15:     test_primary();
+  sub rsp, 8
+  call test_primary
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:16:     test_pointer();
+  sub rsp, 8
+  call test_pointer
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:17:     test_assignment();
+  sub rsp, 8
+  call test_assignment
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:18:     test_preprocess();
+  sub rsp, 8
+  call test_preprocess
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:19:     test_cast();
+  sub rsp, 8
+  call test_cast
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:20:     test_function();
+  sub rsp, 8
+  call test_function
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:21:     test_varg();
+  sub rsp, 8
+  call test_varg
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .Ltest_static ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 20
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#test/c/test.c:25:     printf("test is complete!!!\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/test.c:26:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_main
+ret_main:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -194,5 +194,94 @@ int test_type(){
     b = -1;
     ASSERT(b, 1);
 
+    printf("test of struct copy..\n");
+    // コピーの前後のメンバが壊れないことも確かめる
+    struct CP3 { char a; char b; char c; };
+    struct CP15 { char a; char b[13]; char d; };
+    struct CP32 { long a; long b; long c; long d; };
+    struct CP36 { struct CP32 x; int y; };
+    struct CP128 { struct CP32 a; struct CP32 b; struct CP32 c; struct CP32 d; };
+    struct CP384 { struct CP128 a; struct CP128 b; struct CP128 c; };
+    struct { char pre; struct CP3 v; char post; } w3;
+    struct { char pre; struct CP15 v; char post; } w15;
+    struct { char pre; struct CP36 v; char post; } w36;
+    struct { char pre; struct CP384 v; char post; } w384;
+    struct CP3 s3;
+    struct CP15 s15;
+    struct CP36 s36;
+    struct CP384 s384;
+    w3.pre = 1; w3.post = 2;
+    w15.pre = 3; w15.post = 4;
+    w36.pre = 5; w36.post = 6;
+    w384.pre = 7; w384.post = 8;
+    s3.a = 30; s3.b = 3; s3.c = 33;
+    s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+    s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+    s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+    w3.v = s3;
+    w15.v = s15;
+    w36.v = s36;
+    w384.v = s384;
+    ASSERT(sizeof(s3), 3);
+    ASSERT(sizeof(s15), 15);
+    ASSERT(w3.v.a, 30);
+    ASSERT(w3.v.b, 3);
+    ASSERT(w3.v.c, 33);
+    ASSERT(w15.v.a, 15);
+    ASSERT(w15.v.b[0], 50);
+    ASSERT(w15.v.b[12], 12);
+    ASSERT(w15.v.d, 5);
+    ASSERT(w36.v.x.a, 3600);
+    ASSERT(w36.v.x.d, 360);
+    ASSERT(w36.v.y, 36);
+    ASSERT(w384.v.a.a.a, 384);
+    ASSERT(w384.v.b.c.b, 38);
+    ASSERT(w384.v.c.d.d, 4);
+    ASSERT(w3.pre + w3.post * 10, 21);
+    ASSERT(w15.pre + w15.post * 10, 43);
+    ASSERT(w36.pre + w36.post * 10, 65);
+    ASSERT(w384.pre + w384.post * 10, 87);
+
+    printf("test of struct alignment..\n");
+    struct AL1 { char c; int i; } al1;
+    ASSERT(sizeof(struct AL1), 8);
+    ASSERT((long)&al1.i - (long)&al1, 4);
+    struct AL2 { char c; long l; short s; } al2;
+    ASSERT(sizeof(al2), 24);
+    ASSERT((long)&al2.l - (long)&al2, 8);
+    ASSERT((long)&al2.s - (long)&al2, 16);
+    struct AL3 { char c; int a[3]; char d; } al3;
+    ASSERT(sizeof(al3), 20);
+    ASSERT((long)&al3.a[0] - (long)&al3, 4);
+    ASSERT((long)&al3.d - (long)&al3, 16);
+    al3.a[2] = 32; al3.d = 3;
+    ASSERT(al3.a[2] * 10 + al3.d, 323);
+    struct AL4 { char c; struct { char x; long y; } in; } al4;
+    ASSERT(sizeof(al4), 24);
+    ASSERT((long)&al4.in.y - (long)&al4, 16);
+    struct AL1 al1s[3];
+    ASSERT(sizeof(al1s), 24);
+    ASSERT((long)&al1s[2] - (long)&al1s[0], 16);
+    al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+    ASSERT(al1s[1].i * 10 + al1s[1].c + al1s[2].c, 113);
+    union AU { char c[5]; int i; } au;
+    ASSERT(sizeof(au), 8);
+    char apad;
+    long along;
+    ASSERT((long)&along % 8, 0);
+    ASSERT((long)&al2 % 8, 0);
+
+    printf("test of _Alignof..\n");
+    ASSERT(_Alignof(char), 1);
+    ASSERT(_Alignof(short), 2);
+    ASSERT(_Alignof(int), 4);
+    ASSERT(_Alignof(long), 8);
+    ASSERT(_Alignof(char*), 8);
+    ASSERT(_Alignof(struct AL1), 4);
+    ASSERT(_Alignof(struct AL2), 8);
+    ASSERT(_Alignof(union AU), 4);
+    ASSERT(_Alignof(al3.a), 4);
+    ASSERT(_Alignof(struct CP3), 1);
+
     return 0;
 }
@@ -0,0 +1,2262 @@
+.intel_syntax noprefix
+.global test_type
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR15:
+  .string "test of _Alignof..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR14:
+  .string "test of struct alignment..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR13:
+  .string "test of struct copy..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR12:
+  .string "test of _Bool...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR11:
+  .string "test of imcomplete enum..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR10:
+  .string "test of imcomplete struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of type qualifier..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of enum..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of union..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of struct pointer..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of struct of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "test of long type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of int type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of short type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of char type..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_type
+#	 stack size: 1288
+#	 along( ofs: 1288, size: 8) : level0
+#	 apad( ofs: 1273, size: 1) : level0
+#	 au( ofs: 1272, size: 8) : level0
+#	 al1s( ofs: 1264, size: 24) : level0
+#	 al4( ofs: 1240, size: 24) : level0
+#	 al3( ofs: 1212, size: 20) : level0
+#	 al2( ofs: 1192, size: 24) : level0
+#	 al1( ofs: 1168, size: 8) : level0
+#	 s384( ofs: 1160, size: 384) : level0
+#	 s36( ofs: 776, size: 40) : level0
+#	 s15( ofs: 730, size: 15) : level0
+#	 s3( ofs: 715, size: 3) : level0
+#	 w384( ofs: 712, size: 400) : level0
+#	 w36( ofs: 312, size: 56) : level0
+#	 w15( ofs: 250, size: 17) : level0
+#	 w3( ofs: 233, size: 5) : level0
+#	 okng( ofs: 228, size: 4) : level0
+#	 b( ofs: 221, size: 1) : level0
+#	 ime( ofs: 220, size: 4) : level0
+#	 ims( ofs: 216, size: 8) : level0
+#	 volatile_b( ofs: 208, size: 4) : level0
+#	 const_a( ofs: 204, size: 4) : level0
+#	 ts( ofs: 200, size: 8) : level0
+#	 ddd2( ofs: 192, size: 4) : level0
+#	 ddd( ofs: 188, size: 4) : level0
+#	 test_union( ofs: 184, size: 4) : level0
+#	 s( ofs: 180, size: 4) : level0
+#	 sptr( ofs: 176, size: 8) : level0
+#	 abc_struct_2( ofs: 168, size: 8) : level0
+#	 abc_struct_1( ofs: 160, size: 8) : level0
+#	 struct_array( ofs: 152, size: 40) : level0
+#	 test_struct_struct( ofs: 112, size: 8) : level0
+#	 test_strcut( ofs: 104, size: 8) : level0
+#	 lp( ofs: 96, size: 8) : level0
+#	 larr( ofs: 88, size: 24) : level0
+#	 l( ofs: 64, size: 8) : level0
+#	 ip( ofs: 56, size: 8) : level0
+#	 iarr( ofs: 48, size: 12) : level0
+#	 i( ofs: 36, size: 4) : level0
+#	 sp( ofs: 32, size: 8) : level0
+#	 sarr( ofs: 24, size: 6) : level0
+#	 s( ofs: 18, size: 2) : level0
+#	 cp( ofs: 16, size: 8) : level0
+#	 carr( ofs: 4, size: 3) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 1296
+  push rbx
+#test/c/type.c:4:     printf("test of char type..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:5:     char c; c = 5;
+  lea r8, [rbp - 1]
+  mov r9, 5
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 5
+  jne .L0
+  mov rbx, 0
+  jmp .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L2
+  mov rbx, 0
+  jmp .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L3:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  jne .L4
+  mov rbx, 0
+  jmp .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L5:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L6
+  mov rbx, 0
+  jmp .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L7:
+#test/c/type.c:13:     printf("test of short type..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:14:     short s; s = 7;
+  lea r8, [rbp - 18]
+  mov r9, 7
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 18]
+  movsx r8, WORD PTR [r8]
+  cmp r8, 7
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  cmp r8, 2
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 6
+  cmp r8, 6
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L14
+  mov rbx, 0
+  jmp .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L15:
+#test/c/type.c:22:     printf("test of int type..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:23:     int i; i = 17;
+  lea r8, [rbp - 36]
+  mov r9, 17
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 36]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 17
+  jne .L16
+  mov rbx, 0
+  jmp .L17
+.L16:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 12
+  cmp r8, 12
+  jne .L20
+  mov rbx, 0
+  jmp .L21
+.L20:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L22
+  mov rbx, 0
+  jmp .L23
+.L22:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L23:
+#test/c/type.c:31:     printf("test of long type..\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:32:     long l; l = 17;
+  lea r8, [rbp - 64]
+  mov r9, 17
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 64]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 17
+  jne .L24
+  mov rbx, 0
+  jmp .L25
+.L24:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L26
+  mov rbx, 0
+  jmp .L27
+.L26:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L27:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 24
+  cmp r8, 24
+  jne .L28
+  mov rbx, 0
+  jmp .L29
+.L28:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L30
+  mov rbx, 0
+  jmp .L31
+.L30:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L31:
+#test/c/type.c:40:     printf("test of struct..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:46:     test_strcut.c = 1;
+  lea r8, [rbp - 104]
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:47:     test_strcut.s = 2;
+  lea r8, [rbp - 104]
+  add r8, 2
+  mov r9, 2
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#test/c/type.c:48:     test_strcut.i = 3;
+  lea r8, [rbp - 104]
+  add r8, 4
+  mov r9, 3
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 104]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 1
+  jne .L32
+  mov rbx, 0
+  jmp .L33
+.L32:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 104]
+  add r8, 2
+  movsx r8, WORD PTR [r8]
+  cmp r8, 2
+  jne .L34
+  mov rbx, 0
+  jmp .L35
+.L34:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 104]
+  add r8, 4
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L36
+  mov rbx, 0
+  jmp .L37
+.L36:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L37:
+#test/c/type.c:53:     printf("test of struct of struct..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:61:     test_struct_struct.ss.c = 8;
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 0
+  mov r9, 8
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:62:     test_struct_struct.ss.s = 9;
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 2
+  mov r9, 9
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#test/c/type.c:63:     test_struct_struct.ss.i = 10;
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 4
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 8
+  jne .L38
+  mov rbx, 0
+  jmp .L39
+.L38:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 2
+  movsx r8, WORD PTR [r8]
+  cmp r8, 9
+  jne .L40
+  mov rbx, 0
+  jmp .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L41:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 112]
+  add r8, 0
+  add r8, 4
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L42
+  mov rbx, 0
+  jmp .L43
+.L42:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L43:
+#test/c/type.c:72:     struct_array[5].c = 10;
+  lea r8, [rbp - 152]
+  mov r9, 5
+  imul r9, 4
+  add r8, r9
+  add r8, 0
+  mov r9, 10
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:73:     struct_array[5].s = 235;
+  lea r8, [rbp - 152]
+  mov r9, 5
+  imul r9, 4
+  add r8, r9
+  add r8, 2
+  mov r9, 235
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 152]
+  mov r9, 5
+  imul r9, 4
+  add r8, r9
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 10
+  jne .L44
+  mov rbx, 0
+  jmp .L45
+.L44:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 152]
+  mov r9, 5
+  imul r9, 4
+  add r8, r9
+  add r8, 2
+  movsx r8, WORD PTR [r8]
+  cmp r8, 235
+  jne .L46
+  mov rbx, 0
+  jmp .L47
+.L46:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L47:
+#test/c/type.c:82:     abc_struct_2.a = 10;
+  lea r8, [rbp - 168]
+  add r8, 0
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:83:     abc_struct_2.s = 34;
+  lea r8, [rbp - 168]
+  add r8, 4
+  mov r9, 34
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 168]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L48
+  mov rbx, 0
+  jmp .L49
+.L48:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 168]
+  add r8, 4
+  movsx r8, WORD PTR [r8]
+  cmp r8, 34
+  jne .L50
+  mov rbx, 0
+  jmp .L51
+.L50:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L51:
+#test/c/type.c:91:     printf("test of struct pointer..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:94:     sptr = &s;
+  lea r8, [rbp - 180]
+  lea r9, [rbp - 176]
+  mov QWORD PTR [r9], r8
+  mov r8, r8
+#test/c/type.c:95:     sptr->sss = 100;
+  lea r8, [rbp - 176]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  mov r9, 100
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 176]
+  mov r8, QWORD PTR [r8]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 100
+  jne .L52
+  mov rbx, 0
+  jmp .L53
+.L52:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L53:
+#test/c/type.c:98:     printf("test of union..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:104:     test_union.c = 1;
+  lea r8, [rbp - 184]
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:105:     test_union.s = 2;
+  lea r8, [rbp - 184]
+  add r8, 0
+  mov r9, 2
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#test/c/type.c:106:     test_union.i = 3;
+  lea r8, [rbp - 184]
+  add r8, 0
+  mov r9, 3
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 184]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 3
+  jne .L54
+  mov rbx, 0
+  jmp .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 184]
+  add r8, 0
+  movsx r8, WORD PTR [r8]
+  cmp r8, 3
+  jne .L56
+  mov rbx, 0
+  jmp .L57
+.L56:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 184]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L58
+  mov rbx, 0
+  jmp .L59
+.L58:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L60
+  mov rbx, 0
+  jmp .L61
+.L60:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L61:
+#test/c/type.c:112:     printf("test of enum..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  cmp r8, 0
+  jne .L62
+  mov rbx, 0
+  jmp .L63
+.L62:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 200
+  cmp r8, 200
+  jne .L64
+  mov rbx, 0
+  jmp .L65
+.L64:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 201
+  cmp r8, 201
+  jne .L66
+  mov rbx, 0
+  jmp .L67
+.L66:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 100
+  cmp r8, 100
+  jne .L68
+  mov rbx, 0
+  jmp .L69
+.L68:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L69:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 200
+  cmp r8, 200
+  jne .L70
+  mov rbx, 0
+  jmp .L71
+.L70:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  cmp r8, 2
+  jne .L72
+  mov rbx, 0
+  jmp .L73
+.L72:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L74
+  mov rbx, 0
+  jmp .L75
+.L74:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  jne .L76
+  mov rbx, 0
+  jmp .L77
+.L76:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  cmp r8, 2
+  jne .L78
+  mov rbx, 0
+  jmp .L79
+.L78:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L80
+  mov rbx, 0
+  jmp .L81
+.L80:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L81:
+#test/c/type.c:145:     ts.a = 10;
+  lea r8, [rbp - 200]
+  add r8, 0
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:146:     ts.s = 20;
+  lea r8, [rbp - 200]
+  add r8, 4
+  mov r9, 20
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 200]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L82
+  mov rbx, 0
+  jmp .L83
+.L82:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L83:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 200]
+  add r8, 4
+  movsx r8, WORD PTR [r8]
+  cmp r8, 20
+  jne .L84
+  mov rbx, 0
+  jmp .L85
+.L84:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L85:
+#test/c/type.c:150:     printf("test of type qualifier..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  lea r8, [rbp - 204]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 208]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:156:     printf("test of imcomplete struct..\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:164:     ims.a = 10;
+  lea r8, [rbp - 216]
+  add r8, 0
+  mov r9, 10
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:165:     ims.s = 20;
+  lea r8, [rbp - 216]
+  add r8, 4
+  mov r9, 20
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 216]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L86
+  mov rbx, 0
+  jmp .L87
+.L86:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L87:
+#test/c/type.c:168:     printf("test of imcomplete enum..\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:177:     ime = B;
+  lea r8, [rbp - 220]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 220]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L88
+  mov rbx, 0
+  jmp .L89
+.L88:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L89:
+#test/c/type.c:180:     printf("test of _Bool...\n");
+  lea r8, [ rip + .LSTR12 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+  mov r8, 1
+  cmp r8, 0
+  setne al
+  movzb r8, al
+  lea r9, [rbp - 221]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 221]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 1
+  jne .L90
+  mov rbx, 0
+  jmp .L91
+.L90:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L92
+  mov rbx, 0
+  jmp .L93
+.L92:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L93:
+  lea r8, [rbp - 228]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:186:     if(b)
+  lea r8, [rbp - 221]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  je .L94
+#test/c/type.c:187:         okng = 1;
+  lea r8, [rbp - 228]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L94:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 228]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 1
+  jne .L95
+  mov rbx, 0
+  jmp .L96
+.L95:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L96:
+#test/c/type.c:190:     b = 5;
+  mov r8, 5
+  cmp r8, 0
+  setne al
+  movzb r8, al
+  lea r9, [rbp - 221]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 221]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 1
+  jne .L97
+  mov rbx, 0
+  jmp .L98
+.L97:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L98:
+#test/c/type.c:192:     b = 0;
+  mov r8, 0
+  cmp r8, 0
+  setne al
+  movzb r8, al
+  lea r9, [rbp - 221]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 221]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  jne .L99
+  mov rbx, 0
+  jmp .L100
+.L99:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L100:
+#test/c/type.c:194:     b = -1;
+  mov r8, 0
+  sub r8, 1
+  cmp r8, 0
+  setne al
+  movzb r8, al
+  lea r9, [rbp - 221]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 221]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 1
+  jne .L101
+  mov rbx, 0
+  jmp .L102
+.L101:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L102:
+#test/c/type.c:197:     printf("test of struct copy..\n");
+  lea r8, [ rip + .LSTR13 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/type.c:213:     w3.pre = 1; w3.post = 2;
+  lea r8, [rbp - 233]
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:213:     w3.pre = 1; w3.post = 2;
+  lea r8, [rbp - 233]
+  add r8, 4
+  mov r9, 2
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:214:     w15.pre = 3; w15.post = 4;
+  lea r8, [rbp - 250]
+  add r8, 0
+  mov r9, 3
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:214:     w15.pre = 3; w15.post = 4;
+  lea r8, [rbp - 250]
+  add r8, 16
+  mov r9, 4
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:215:     w36.pre = 5; w36.post = 6;
+  lea r8, [rbp - 312]
+  add r8, 0
+  mov r9, 5
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:215:     w36.pre = 5; w36.post = 6;
+  lea r8, [rbp - 312]
+  add r8, 48
+  mov r9, 6
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:216:     w384.pre = 7; w384.post = 8;
+  lea r8, [rbp - 712]
+  add r8, 0
+  mov r9, 7
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:216:     w384.pre = 7; w384.post = 8;
+  lea r8, [rbp - 712]
+  add r8, 392
+  mov r9, 8
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  lea r8, [rbp - 715]
+  add r8, 0
+  mov r9, 30
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  lea r8, [rbp - 715]
+  add r8, 1
+  mov r9, 3
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  lea r8, [rbp - 715]
+  add r8, 2
+  mov r9, 33
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  lea r8, [rbp - 730]
+  add r8, 0
+  mov r9, 15
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  lea r8, [rbp - 730]
+  add r8, 1
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  mov r9, 50
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  lea r8, [rbp - 730]
+  add r8, 1
+  mov r9, 12
+  imul r9, 1
+  add r8, r9
+  mov r9, 12
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  lea r8, [rbp - 730]
+  add r8, 14
+  mov r9, 5
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  lea r8, [rbp - 776]
+  add r8, 0
+  add r8, 0
+  mov r9, 3600
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  lea r8, [rbp - 776]
+  add r8, 0
+  add r8, 24
+  mov r9, 360
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  lea r8, [rbp - 776]
+  add r8, 32
+  mov r9, 36
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  lea r8, [rbp - 1160]
+  add r8, 0
+  add r8, 0
+  add r8, 0
+  mov r9, 384
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  lea r8, [rbp - 1160]
+  add r8, 128
+  add r8, 64
+  add r8, 8
+  mov r9, 38
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  lea r8, [rbp - 1160]
+  add r8, 256
+  add r8, 96
+  add r8, 24
+  mov r9, 4
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#test/c/type.c:221:     w3.v = s3;
+  lea r9, [rbp - 715]
+  lea rcx, [rbp - 233]
+  add rcx, 1
+  mov r8w, WORD PTR [r9 + 0]
+  mov WORD PTR [rcx + 0], r8w
+  mov r8b, BYTE PTR [r9 + 2]
+  mov BYTE PTR [rcx + 2], r8b
+#test/c/type.c:222:     w15.v = s15;
+  lea r9, [rbp - 730]
+  lea rcx, [rbp - 250]
+  add rcx, 1
+  mov r8, QWORD PTR [r9 + 0]
+  mov QWORD PTR [rcx + 0], r8
+  mov r8d, DWORD PTR [r9 + 8]
+  mov DWORD PTR [rcx + 8], r8d
+  mov r8w, WORD PTR [r9 + 12]
+  mov WORD PTR [rcx + 12], r8w
+  mov r8b, BYTE PTR [r9 + 14]
+  mov BYTE PTR [rcx + 14], r8b
+#test/c/type.c:223:     w36.v = s36;
+  lea r9, [rbp - 776]
+  lea rcx, [rbp - 312]
+  add rcx, 8
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 16]
+  movdqu XMMWORD PTR [rcx + 16], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 24]
+  movdqu XMMWORD PTR [rcx + 24], xmm15
+#test/c/type.c:224:     w384.v = s384;
+  lea r9, [rbp - 1160]
+  lea rdx, [rbp - 712]
+  add rdx, 8
+  mov rdi, rdx
+  mov rsi, r9
+  mov ecx, 384
+  rep movsb
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 3
+  cmp r8, 3
+  jne .L103
+  mov rbx, 0
+  jmp .L104
+.L103:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L104:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 15
+  cmp r8, 15
+  jne .L105
+  mov rbx, 0
+  jmp .L106
+.L105:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L106:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 233]
+  add r8, 1
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 30
+  jne .L107
+  mov rbx, 0
+  jmp .L108
+.L107:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L108:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 233]
+  add r8, 1
+  add r8, 1
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 3
+  jne .L109
+  mov rbx, 0
+  jmp .L110
+.L109:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L110:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 233]
+  add r8, 1
+  add r8, 2
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 33
+  jne .L111
+  mov rbx, 0
+  jmp .L112
+.L111:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L112:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 250]
+  add r8, 1
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 15
+  jne .L113
+  mov rbx, 0
+  jmp .L114
+.L113:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L114:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 250]
+  add r8, 1
+  add r8, 1
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 50
+  jne .L115
+  mov rbx, 0
+  jmp .L116
+.L115:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L116:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 250]
+  add r8, 1
+  add r8, 1
+  mov r9, 12
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 12
+  jne .L117
+  mov rbx, 0
+  jmp .L118
+.L117:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L118:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 250]
+  add r8, 1
+  add r8, 14
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 5
+  jne .L119
+  mov rbx, 0
+  jmp .L120
+.L119:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L120:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 312]
+  add r8, 8
+  add r8, 0
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  cmp r8, 3600
+  jne .L121
+  mov rbx, 0
+  jmp .L122
+.L121:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L122:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 312]
+  add r8, 8
+  add r8, 0
+  add r8, 24
+  mov r8, QWORD PTR [r8]
+  cmp r8, 360
+  jne .L123
+  mov rbx, 0
+  jmp .L124
+.L123:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L124:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 312]
+  add r8, 8
+  add r8, 32
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 36
+  jne .L125
+  mov rbx, 0
+  jmp .L126
+.L125:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L126:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 712]
+  add r8, 8
+  add r8, 0
+  add r8, 0
+  add r8, 0
+  mov r8, QWORD PTR [r8]
+  cmp r8, 384
+  jne .L127
+  mov rbx, 0
+  jmp .L128
+.L127:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L128:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 712]
+  add r8, 8
+  add r8, 128
+  add r8, 64
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  cmp r8, 38
+  jne .L129
+  mov rbx, 0
+  jmp .L130
+.L129:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L130:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 712]
+  add r8, 8
+  add r8, 256
+  add r8, 96
+  add r8, 24
+  mov r8, QWORD PTR [r8]
+  cmp r8, 4
+  jne .L131
+  mov rbx, 0
+  jmp .L132
+.L131:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L132:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 233]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 233]
+  add r9, 4
+  movsx r9, BYTE PTR [r9]
+  imul r9, 10
+  add r8, r9
+  cmp r8, 21
+  jne .L133
+  mov rbx, 0
+  jmp .L134
+.L133:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L134:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 250]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 250]
+  add r9, 16
+  movsx r9, BYTE PTR [r9]
+  imul r9, 10
+  add r8, r9
+  cmp r8, 43
+  jne .L135
+  mov rbx, 0
+  jmp .L136
+.L135:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L136:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 312]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 312]
+  add r9, 48
+  movsx r9, BYTE PTR [r9]
+  imul r9, 10
+  add r8, r9
+  cmp r8, 65
+  jne .L137
+  mov rbx, 0
+  jmp .L138
+.L137:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L138:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 712]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  lea r9, [rbp - 712]
+  add r9, 392
+  movsx r9, BYTE PTR [r9]
+  imul r9, 10
+  add r8, r9
+  cmp r8, 87
+  jne .L139
+  mov rbx, 0
+  jmp .L140
+.L139:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L140:
+#test/c/type.c:245:     printf("test of struct alignment..\n");
+  lea r8, [ rip + .LSTR14 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L141
+  mov rbx, 0
+  jmp .L142
+.L141:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L142:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1168]
+  add r8, 4
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1168]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 4
+  jne .L143
+  mov rbx, 0
+  jmp .L144
+.L143:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L144:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 24
+  cmp r8, 24
+  jne .L145
+  mov rbx, 0
+  jmp .L146
+.L145:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L146:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1192]
+  add r8, 8
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1192]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 8
+  jne .L147
+  mov rbx, 0
+  jmp .L148
+.L147:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L148:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1192]
+  add r8, 16
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1192]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 16
+  jne .L149
+  mov rbx, 0
+  jmp .L150
+.L149:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L150:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 20
+  cmp r8, 20
+  jne .L151
+  mov rbx, 0
+  jmp .L152
+.L151:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L152:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1212]
+  add r8, 4
+  mov r9, 0
+  imul r9, 4
+  add r8, r9
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1212]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 4
+  jne .L153
+  mov rbx, 0
+  jmp .L154
+.L153:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L154:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1212]
+  add r8, 16
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1212]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 16
+  jne .L155
+  mov rbx, 0
+  jmp .L156
+.L155:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L156:
+#test/c/type.c:257:     al3.a[2] = 32; al3.d = 3;
+  lea r8, [rbp - 1212]
+  add r8, 4
+  mov r9, 2
+  imul r9, 4
+  add r8, r9
+  mov r9, 32
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:257:     al3.a[2] = 32; al3.d = 3;
+  lea r8, [rbp - 1212]
+  add r8, 16
+  mov r9, 3
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1212]
+  add r8, 4
+  mov r9, 2
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  lea r9, [rbp - 1212]
+  add r9, 16
+  movsx r9, BYTE PTR [r9]
+  add r8, r9
+  cmp r8, 323
+  jne .L157
+  mov rbx, 0
+  jmp .L158
+.L157:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L158:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 24
+  cmp r8, 24
+  jne .L159
+  mov rbx, 0
+  jmp .L160
+.L159:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L160:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1240]
+  add r8, 8
+  add r8, 8
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1240]
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 16
+  jne .L161
+  mov rbx, 0
+  jmp .L162
+.L161:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L162:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 24
+  cmp r8, 24
+  jne .L163
+  mov rbx, 0
+  jmp .L164
+.L163:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L164:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1264]
+  mov r9, 2
+  imul r9, 8
+  add r8, r9
+# cast st
+  mov r8, r8
+  lea r9, [rbp - 1264]
+  mov rcx, 0
+  imul rcx, 8
+  add r9, rcx
+# cast st
+  mov r9, r9
+  sub r8, r9
+  cmp r8, 16
+  jne .L165
+  mov rbx, 0
+  jmp .L166
+.L165:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L166:
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  lea r8, [rbp - 1264]
+  mov r9, 1
+  imul r9, 8
+  add r8, r9
+  add r8, 0
+  mov r9, 1
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  lea r8, [rbp - 1264]
+  mov r9, 1
+  imul r9, 8
+  add r8, r9
+  add r8, 4
+  mov r9, 11
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  lea r8, [rbp - 1264]
+  mov r9, 2
+  imul r9, 8
+  add r8, r9
+  add r8, 0
+  mov r9, 2
+  mov BYTE PTR [r8], r9b
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1264]
+  mov r9, 1
+  imul r9, 8
+  add r8, r9
+  add r8, 4
+  movsxd r8, DWORD PTR [r8]
+  imul r8, 10
+  lea r9, [rbp - 1264]
+  mov rcx, 1
+  imul rcx, 8
+  add r9, rcx
+  add r9, 0
+  movsx r9, BYTE PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 1264]
+  mov rcx, 2
+  imul rcx, 8
+  add r9, rcx
+  add r9, 0
+  movsx r9, BYTE PTR [r9]
+  add r8, r9
+  cmp r8, 113
+  jne .L167
+  mov rbx, 0
+  jmp .L168
+.L167:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L168:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L169
+  mov rbx, 0
+  jmp .L170
+.L169:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L170:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1288]
+# cast st
+  mov r8, r8
+  mov r9, 8
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L171
+  mov rbx, 0
+  jmp .L172
+.L171:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L172:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1192]
+# cast st
+  mov r8, r8
+  mov r9, 8
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+  cmp r8, 0
+  jne .L173
+  mov rbx, 0
+  jmp .L174
+.L173:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L174:
+#test/c/type.c:274:     printf("test of _Alignof..\n");
+  lea r8, [ rip + .LSTR15 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L175
+  mov rbx, 0
+  jmp .L176
+.L175:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L176:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 2
+  cmp r8, 2
+  jne .L177
+  mov rbx, 0
+  jmp .L178
+.L177:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L178:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L179
+  mov rbx, 0
+  jmp .L180
+.L179:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L180:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L181
+  mov rbx, 0
+  jmp .L182
+.L181:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L182:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L183
+  mov rbx, 0
+  jmp .L184
+.L183:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L184:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L185
+  mov rbx, 0
+  jmp .L186
+.L185:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L186:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L187
+  mov rbx, 0
+  jmp .L188
+.L187:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L188:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L189
+  mov rbx, 0
+  jmp .L190
+.L189:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L190:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 4
+  cmp r8, 4
+  jne .L191
+  mov rbx, 0
+  jmp .L192
+.L191:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L192:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  cmp r8, 1
+  jne .L193
+  mov rbx, 0
+  jmp .L194
+.L193:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L194:
+#test/c/type.c:286:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_type
+ret_test_type:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
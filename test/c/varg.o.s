@@ -0,0 +1,262 @@
+.intel_syntax noprefix
+.global vafuncstr
+.global vafunc
+.global test_varg
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "d"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "c"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "b"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "a"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "%s %s %s %s\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "%d %d %d %d\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of varg with string..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of varg..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# vafuncstr
+#	 stack size: 168
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 144, size: 136) : level0
+#	 fmt( ofs: 8, size: 8) : level0
+  .text
+vafuncstr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov DWORD PTR [rbp - 144], 8
+  mov DWORD PTR [rbp - 144 + 4], 48
+  lea rax, [rbp - 144 + 16]
+  mov QWORD PTR [rbp - 144 + 8], rax
+  lea rax, [rbp - 144 + 24]
+  mov QWORD PTR [rbp - 144 + 16], rax
+  mov QWORD PTR [rbp - 144 + 24], rdi
+  mov QWORD PTR [rbp - 144 + 32], rsi
+  mov QWORD PTR [rbp - 144 + 40], rdx
+  mov QWORD PTR [rbp - 144 + 48], rcx
+  mov QWORD PTR [rbp - 144 + 56], r8
+  mov QWORD PTR [rbp - 144 + 64], r9
+  movsd QWORD PTR [rbp - 144 + 72], xmm0
+  movsd QWORD PTR [rbp - 144 + 80], xmm1
+  movsd QWORD PTR [rbp - 144 + 88], xmm2
+  movsd QWORD PTR [rbp - 144 + 96], xmm3
+  movsd QWORD PTR [rbp - 144 + 104], xmm4
+  movsd QWORD PTR [rbp - 144 + 112], xmm5
+  movsd QWORD PTR [rbp - 144 + 120], xmm6
+  movsd QWORD PTR [rbp - 144 + 128], xmm7
+  mov [rbp - 8], rdi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 144]
+  lea rcx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+#test/c/varg.c:18:     vprintf(fmt, ap);
+  lea r8, [rbp - 8]
+  mov r8, QWORD PTR [r8]
+  lea r9, [rbp - 168]
+  mov rdi, r8
+  mov rsi, r9
+  call vprintf
+  mov r8, rax
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+ret_vafuncstr:
+  mov rsp, rbp
+  pop rbp
+  ret
+# vafunc
+#	 stack size: 180
+#	 i( ofs: 176, size: 4) : level0
+#	 sum( ofs: 172, size: 4) : level0
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 140, size: 136) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+vafunc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov DWORD PTR [rbp - 140], 8
+  mov DWORD PTR [rbp - 140 + 4], 48
+  lea rax, [rbp - 140 + 16]
+  mov QWORD PTR [rbp - 140 + 8], rax
+  lea rax, [rbp - 140 + 24]
+  mov QWORD PTR [rbp - 140 + 16], rax
+  mov QWORD PTR [rbp - 140 + 24], rdi
+  mov QWORD PTR [rbp - 140 + 32], rsi
+  mov QWORD PTR [rbp - 140 + 40], rdx
+  mov QWORD PTR [rbp - 140 + 48], rcx
+  mov QWORD PTR [rbp - 140 + 56], r8
+  mov QWORD PTR [rbp - 140 + 64], r9
+  movsd QWORD PTR [rbp - 140 + 72], xmm0
+  movsd QWORD PTR [rbp - 140 + 80], xmm1
+  movsd QWORD PTR [rbp - 140 + 88], xmm2
+  movsd QWORD PTR [rbp - 140 + 96], xmm3
+  movsd QWORD PTR [rbp - 140 + 104], xmm4
+  movsd QWORD PTR [rbp - 140 + 112], xmm5
+  movsd QWORD PTR [rbp - 140 + 120], xmm6
+  movsd QWORD PTR [rbp - 140 + 128], xmm7
+  mov [rbp - 4], edi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea r9, [rbp - 140]
+  lea rcx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [r9 + 0]
+  movdqu XMMWORD PTR [rcx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [r9 + 8]
+  movdqu XMMWORD PTR [rcx + 8], xmm15
+  lea r8, [rbp - 172]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/varg.c:8:     for (int i = 0; i < a; i++){
+  lea r8, [rbp - 176]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L0:
+  lea r8, [rbp - 176]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jge .L2
+#test/c/varg.c:9:         sum += va_arg(ap, int);
+  lea r8, [rbp - 172]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 168]
+  add r9, 0
+  mov r9d, DWORD PTR [r9]
+  add r9, 8
+  lea rcx, [rbp - 168]
+  add rcx, 0
+  mov DWORD PTR [rcx], r9d
+  mov r9, r9
+  lea r9, [rbp - 168]
+  add r9, 16
+  mov r9, QWORD PTR [r9]
+  lea rcx, [rbp - 168]
+  add rcx, 0
+  mov ecx, DWORD PTR [rcx]
+  sub rcx, 8
+  imul rcx, 1
+  add r9, rcx
+  mov r9, QWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 172]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+.L1:
+  lea r8, [rbp - 176]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 180]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 176]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 176]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 180]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L0
+.L2:
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+#test/c/varg.c:12:     return sum;
+  lea r8, [rbp - 172]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_vafunc
+ret_vafunc:
+  mov rsp, rbp
+  pop rbp
+  ret
+# test_varg
+#	 stack size: 0
+  .text
+test_varg:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+#test/c/varg.c:23:     printf("test of varg..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 1
+  mov rdx, 2
+  mov rcx, 3
+  mov eax, 0
+  call vafunc
+  mov r8, rax
+  cmp r8, 6
+  jne .L3
+  mov rbx, 0
+  jmp .L4
+.L3:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+  mov rbx, r8
+.L4:
+#test/c/varg.c:26:     printf("test of varg with string..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/varg.c:27:     vafuncstr("%d %d %d %d\n", 1, 2, 3, 4);
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov rsi, 1
+  mov rdx, 2
+  mov rcx, 3
+  mov r8, 4
+  mov eax, 0
+  call vafuncstr
+  mov r8, rax
+#test/c/varg.c:28:     vafuncstr("%s %s %s %s\n", "a", "b", "c", "d");
+  lea r8, [ rip + .LSTR3 ]
+  lea r9, [ rip + .LSTR4 ]
+  lea rcx, [ rip + .LSTR5 ]
+  lea rbx, [ rip + .LSTR6 ]
+  lea r12, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov r8, r12
+  mov eax, 0
+  call vafuncstr
+  mov r8, rax
+#test/c/varg.c:29:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_varg
+ret_test_varg:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -3,9 +3,42 @@
 int g_a;
 int g_b;
 int test_global_variable();
+int sum_to(int n);
+int narrow_char(int x);
+int narrow_arg(unsigned char c);
+int swap_loop(int n);
+int many_live_values(int n);
 
 extern int test_extern_int;
 
+struct init_point {
+    char tag;
+    int x;
+    long y;
+};
+struct init_shape {
+    int n;
+    struct init_point pts[2];
+    char name[8];
+};
+int init_int = 42;
+long init_neg = -5;
+char init_char = 'A';
+short init_short = 1000 * 3;
+int init_arr[5] = {1, 2, 3};
+int init_unsized[] = {10, 20, 30, 40,};
+char init_str[] = "hi\tall\n";
+char init_exact[4] = "abcd";
+char* init_ptr = "pooled";
+int* init_elem = &init_arr[2];
+struct init_point init_pt = {'z', 7, 99};
+struct init_shape init_shape = { 3, { {'a', 1, 2}, 'b', 3, 4 }, "sq" };
+const int init_table[] = {5, 6, 7};
+const char* init_names[] = {"zero", "one", "two"};
+long* init_member = &init_pt.y;
+union init_union { long l; char c[8]; } init_u = { 258 };
+int init_counter();
+
 int test_variable(){
     printf("test of local variable..\n");
     int a; a = 15;
@@ -47,11 +80,133 @@ int test_variable(){
 
     test_static = 30;
 
+    printf("test of local variable in register..\n");
+    ASSERT(sum_to(10), 55);
+    ASSERT(narrow_char(300), 44);
+    ASSERT(narrow_arg(-1), 255);
+    ASSERT(swap_loop(6), 8);
+    ASSERT(many_live_values(1), 1190);
+
+    printf("test of static initializer..\n");
+    ASSERT(init_int, 42);
+    ASSERT(init_neg, -5);
+    ASSERT(init_char, 'A');
+    ASSERT(init_short, 3000);
+    ASSERT(init_arr[0] + init_arr[2], 4);
+    ASSERT(init_arr[4], 0);
+    ASSERT(sizeof(init_unsized), 16);
+    ASSERT(init_unsized[3], 40);
+    ASSERT(sizeof(init_str), 8);
+    ASSERT(init_str[2], 9);
+    ASSERT(init_str[7], 0);
+    ASSERT(init_exact[3], 'd');
+    ASSERT(init_ptr[0], 'p');
+    ASSERT(*init_elem, 3);
+    ASSERT(init_pt.tag, 'z');
+    ASSERT(init_pt.x, 7);
+    ASSERT(init_pt.y, 99);
+    ASSERT(init_shape.n, 3);
+    ASSERT(init_shape.pts[0].y, 2);
+    ASSERT(init_shape.pts[1].tag, 'b');
+    ASSERT(init_shape.pts[1].y, 4);
+    ASSERT(init_shape.name[1], 'q');
+    ASSERT(init_shape.name[2], 0);
+    ASSERT(init_table[2], 7);
+    ASSERT(init_names[1][0], 'o');
+    ASSERT(init_names[2][1], 'w');
+    ASSERT(*init_member, 99);
+    ASSERT(init_u.c[0], 2);
+    ASSERT(init_u.c[1], 1);
+    ASSERT(init_counter(), 11);
+    ASSERT(init_counter(), 12);
+
     printf("test of assignment..\n");
     return 0;
 }
 
+int init_counter(){
+    static int count = 10;
+    count++;
+    return count;
+}
+
 int test_global_variable(){
     g_b = 14;
     return 0;
 }
+
+int sum_to(int n){
+    int sum = 0;
+    for(int i = 1; i <= n; i++){
+        sum = sum + i;
+    }
+    return sum;
+}
+
+int narrow_char(int x){
+    char c = x;
+    return c;
+}
+
+int narrow_arg(unsigned char c){
+    return c;
+}
+
+int swap_loop(int n){
+    int a = 0;
+    int b = 1;
+    while(n){
+        int t = a + b;
+        a = b;
+        b = t;
+        n = n - 1;
+    }
+    return a;
+}
+
+int many_live_values(int n){
+    int a0 = n + 0;
+    int a1 = n + 1;
+    int a2 = n + 2;
+    int a3 = n + 3;
+    int a4 = n + 4;
+    int a5 = n + 5;
+    int a6 = n + 6;
+    int a7 = n + 7;
+    int a8 = n + 8;
+    int a9 = n + 9;
+    int a10 = n + 10;
+    int a11 = n + 11;
+    int a12 = n + 12;
+    int a13 = n + 13;
+    int a14 = n + 14;
+    int a15 = n + 15;
+    int a16 = n + 16;
+    int a17 = n + 17;
+    int a18 = n + 18;
+    int a19 = n + 19;
+    int a20 = n + 20;
+    int a21 = n + 21;
+    int a22 = n + 22;
+    int a23 = n + 23;
+    int a24 = n + 24;
+    int a25 = n + 25;
+    int a26 = n + 26;
+    int a27 = n + 27;
+    int a28 = n + 28;
+    int a29 = n + 29;
+    int a30 = n + 30;
+    int a31 = n + 31;
+    int a32 = n + 32;
+    int a33 = n + 33;
+    int sum = 0;
+    for(int i = 0; i < 2; i++){
+        sum = sum + a0 + a1 + a2 + a3 + a4 + a5
+            + a6 + a7 + a8 + a9 + a10 + a11
+            + a12 + a13 + a14 + a15 + a16 + a17
+            + a18 + a19 + a20 + a21 + a22 + a23
+            + a24 + a25 + a26 + a27 + a28 + a29
+            + a30 + a31 + a32 + a33;
+    }
+    return sum;
+}
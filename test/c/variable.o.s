@@ -0,0 +1,1690 @@
+.intel_syntax noprefix
+.global init_counter
+.global init_u
+.global init_member
+.global init_names
+.global init_table
+.global init_shape
+.global init_pt
+.global init_elem
+.global init_ptr
+.global init_exact
+.global init_str
+.global init_unsized
+.global init_arr
+.global init_short
+.global init_char
+.global init_neg
+.global init_int
+.global many_live_values
+.global swap_loop
+.global narrow_arg
+.global narrow_char
+.global sum_to
+.global test_global_variable
+.global g_b
+.global g_a
+.global test_variable
+  .data
+  .align 4
+.Lcount.0:
+  .long 10
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of assignment..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of static initializer..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of local variable in register..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of array..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of global variable..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of local variable..\n"
+  .data
+  .align 8
+init_u:
+  .quad 258
+  .data
+  .align 8
+init_member:
+  .quad init_pt+8
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "two"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "one"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "zero"
+  .data
+  .align 8
+init_names:
+  .quad .LSTR1
+  .quad .LSTR2
+  .quad .LSTR3
+  .section .rodata
+  .align 4
+init_table:
+  .quad 25769803781
+  .long 7
+  .data
+  .align 8
+init_shape:
+  .quad 3
+  .quad 4294967393
+  .quad 2
+  .quad 12884901986
+  .quad 4
+  .quad 29043
+  .data
+  .align 8
+init_pt:
+  .quad 30064771194
+  .quad 99
+  .data
+  .align 8
+init_elem:
+  .quad init_arr+8
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "pooled"
+  .data
+  .align 8
+init_ptr:
+  .quad .LSTR0
+  .data
+  .align 1
+init_exact:
+  .long 1684234849
+  .data
+  .align 1
+init_str:
+  .quad 2933962507381096
+  .data
+  .align 4
+init_unsized:
+  .quad 85899345930
+  .quad 171798691870
+  .data
+  .align 4
+init_arr:
+  .quad 8589934593
+  .quad 3
+  .long 0
+  .data
+  .align 2
+init_short:
+  .short 3000
+  .data
+  .align 1
+init_char:
+  .byte 65
+  .data
+  .align 8
+init_neg:
+  .quad 18446744073709551611
+  .data
+  .align 4
+init_int:
+  .long 42
+  .bss
+  .align 4
+g_b:
+  .zero 4
+  .bss
+  .align 4
+g_a:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# init_counter
+#	 stack size: 4
+  .text
+init_counter:
+  push rbp
+  mov rbp, rsp
+#test/c/variable.c:129:     count++;
+  lea r8, [ rip + .Lcount.0 ]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [ rip + .Lcount.0 ]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [ rip + .Lcount.0 ]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+#test/c/variable.c:130:     return count;
+  lea r8, [ rip + .Lcount.0 ]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_init_counter
+ret_init_counter:
+  pop rbp
+  ret
+# many_live_values
+#	 stack size: 152
+#	 i( ofs: 148, size: 4) : level0
+#	 sum( ofs: 144, size: 4) : level0
+#	 a33( ofs: 140, size: 4) : level0
+#	 a32( ofs: 136, size: 4) : level0
+#	 a31( ofs: 132, size: 4) : level0
+#	 a30( ofs: 128, size: 4) : level0
+#	 a29( ofs: 124, size: 4) : level0
+#	 a28( ofs: 120, size: 4) : level0
+#	 a27( ofs: 116, size: 4) : level0
+#	 a26( ofs: 112, size: 4) : level0
+#	 a25( ofs: 108, size: 4) : level0
+#	 a24( ofs: 104, size: 4) : level0
+#	 a23( ofs: 100, size: 4) : level0
+#	 a22( ofs: 96, size: 4) : level0
+#	 a21( ofs: 92, size: 4) : level0
+#	 a20( ofs: 88, size: 4) : level0
+#	 a19( ofs: 84, size: 4) : level0
+#	 a18( ofs: 80, size: 4) : level0
+#	 a17( ofs: 76, size: 4) : level0
+#	 a16( ofs: 72, size: 4) : level0
+#	 a15( ofs: 68, size: 4) : level0
+#	 a14( ofs: 64, size: 4) : level0
+#	 a13( ofs: 60, size: 4) : level0
+#	 a12( ofs: 56, size: 4) : level0
+#	 a11( ofs: 52, size: 4) : level0
+#	 a10( ofs: 48, size: 4) : level0
+#	 a9( ofs: 44, size: 4) : level0
+#	 a8( ofs: 40, size: 4) : level0
+#	 a7( ofs: 36, size: 4) : level0
+#	 a6( ofs: 32, size: 4) : level0
+#	 a5( ofs: 28, size: 4) : level0
+#	 a4( ofs: 24, size: 4) : level0
+#	 a3( ofs: 20, size: 4) : level0
+#	 a2( ofs: 16, size: 4) : level0
+#	 a1( ofs: 12, size: 4) : level0
+#	 a0( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+many_live_values:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp - 4], edi
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 0
+  lea r9, [rbp - 8]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 2
+  lea r9, [rbp - 16]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 3
+  lea r9, [rbp - 20]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 4
+  lea r9, [rbp - 24]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 5
+  lea r9, [rbp - 28]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 6
+  lea r9, [rbp - 32]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 7
+  lea r9, [rbp - 36]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 8
+  lea r9, [rbp - 40]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 9
+  lea r9, [rbp - 44]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 10
+  lea r9, [rbp - 48]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 11
+  lea r9, [rbp - 52]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 12
+  lea r9, [rbp - 56]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 13
+  lea r9, [rbp - 60]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 14
+  lea r9, [rbp - 64]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 15
+  lea r9, [rbp - 68]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 16
+  lea r9, [rbp - 72]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 17
+  lea r9, [rbp - 76]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 18
+  lea r9, [rbp - 80]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 19
+  lea r9, [rbp - 84]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 20
+  lea r9, [rbp - 88]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 21
+  lea r9, [rbp - 92]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 22
+  lea r9, [rbp - 96]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 23
+  lea r9, [rbp - 100]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 24
+  lea r9, [rbp - 104]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 25
+  lea r9, [rbp - 108]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 26
+  lea r9, [rbp - 112]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 27
+  lea r9, [rbp - 116]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 28
+  lea r9, [rbp - 120]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 29
+  lea r9, [rbp - 124]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 30
+  lea r9, [rbp - 128]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 31
+  lea r9, [rbp - 132]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 32
+  lea r9, [rbp - 136]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 33
+  lea r9, [rbp - 140]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 144]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:203:     for(int i = 0; i < 2; i++){
+  lea r8, [rbp - 148]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L0:
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 2
+  jge .L2
+#test/c/variable.c:204:         sum = sum + a0 + a1 + a2 + a3 + a4 + a5
+  lea r8, [rbp - 144]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 20]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 24]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 28]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 32]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 36]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 40]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 44]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 48]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 52]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 56]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 60]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 64]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 68]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 72]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 76]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 80]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 84]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 88]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 92]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 96]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 100]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 104]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 108]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 112]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 116]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 120]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 124]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 128]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 132]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 136]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 140]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 144]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+.L1:
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 152]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 148]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 148]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 152]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L0
+.L2:
+#test/c/variable.c:211:     return sum;
+  lea r8, [rbp - 144]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_many_live_values
+ret_many_live_values:
+  mov rsp, rbp
+  pop rbp
+  ret
+# swap_loop
+#	 stack size: 16
+#	 t( ofs: 16, size: 4) : level0
+#	 b( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+swap_loop:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 12]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:158:     while(n){
+.L3:
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  je .L4
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 16]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#test/c/variable.c:160:         a = b;
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 8]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#test/c/variable.c:161:         b = t;
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#test/c/variable.c:162:         n = n - 1;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  sub r8, 1
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  jmp .L3
+.L4:
+#test/c/variable.c:164:     return a;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_swap_loop
+ret_swap_loop:
+  pop rbp
+  ret
+# narrow_arg
+#	 stack size: 1
+#	 c( ofs: 1, size: 1) : level0
+  .text
+narrow_arg:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 1], dil
+#test/c/variable.c:152:     return c;
+  lea r8, [rbp - 1]
+  movzx r8, BYTE PTR [r8]
+  mov rax, r8
+  jmp ret_narrow_arg
+ret_narrow_arg:
+  pop rbp
+  ret
+# narrow_char
+#	 stack size: 5
+#	 c( ofs: 5, size: 1) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+narrow_char:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 5]
+  mov BYTE PTR [r9], r8b
+  mov r8, r8
+#test/c/variable.c:148:     return c;
+  lea r8, [rbp - 5]
+  movsx r8, BYTE PTR [r8]
+  mov rax, r8
+  jmp ret_narrow_char
+ret_narrow_char:
+  pop rbp
+  ret
+# sum_to
+#	 stack size: 16
+#	 i( ofs: 12, size: 4) : level0
+#	 sum( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+sum_to:
+  push rbp
+  mov rbp, rsp
+  mov [rbp - 4], edi
+  lea r8, [rbp - 8]
+  mov r9, 0
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:140:     for(int i = 1; i <= n; i++){
+  lea r8, [rbp - 12]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+.L5:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 4]
+  movsxd r9, DWORD PTR [r9]
+  cmp r8, r9
+  jg .L7
+#test/c/variable.c:141:         sum = sum + i;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 12]
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  lea r9, [rbp - 8]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+.L6:
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [rbp - 16]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 12]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 1
+  lea r9, [rbp - 12]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+  lea r8, [rbp - 16]
+  movsxd r8, DWORD PTR [r8]
+  jmp .L5
+.L7:
+#test/c/variable.c:143:     return sum;
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  mov rax, r8
+  jmp ret_sum_to
+ret_sum_to:
+  pop rbp
+  ret
+# test_global_variable
+#	 stack size: 0
+  .text
+test_global_variable:
+  push rbp
+  mov rbp, rsp
+#test/c/variable.c:134:     g_b = 14;
+  lea r8, [ rip + g_b ]
+  mov r9, 14
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:135:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_global_variable
+ret_test_global_variable:
+  pop rbp
+  ret
+# test_variable
+#	 stack size: 72
+#	 a4( ofs: 72, size: 8) : level0
+#	 a3( ofs: 62, size: 2) : level0
+#	 a2( ofs: 60, size: 4) : level0
+#	 a1( ofs: 56, size: 4) : level0
+#	 arr( ofs: 52, size: 44) : level0
+#	 abc( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_variable:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  push rbx
+#test/c/variable.c:43:     printf("test of local variable..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/variable.c:44:     int a; a = 15;
+  lea r8, [rbp - 4]
+  mov r9, 15
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 15
+  jne .L8
+  mov rbx, 0
+  jmp .L9
+.L8:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L9:
+#test/c/variable.c:47:     int abc; abc = 7;
+  lea r8, [rbp - 8]
+  mov r9, 7
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L10
+  mov rbx, 0
+  jmp .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L11:
+#test/c/variable.c:50:     a = 1;
+  lea r8, [rbp - 4]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:51:     a = a + 3;
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  add r8, 3
+  lea r9, [rbp - 4]
+  mov DWORD PTR [r9], r8d
+  mov r8, r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 4]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L12
+  mov rbx, 0
+  jmp .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L13:
+#test/c/variable.c:54:     printf("test of global variable..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/variable.c:55:     g_a = 8;
+  lea r8, [ rip + g_a ]
+  mov r9, 8
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + g_a ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 8
+  jne .L14
+  mov rbx, 0
+  jmp .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L15:
+#test/c/variable.c:58:     test_global_variable();
+  sub rsp, 8
+  call test_global_variable
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + g_b ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 14
+  jne .L16
+  mov rbx, 0
+  jmp .L17
+.L16:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L17:
+#test/c/variable.c:61:     printf("test of array..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 44
+  cmp r8, 44
+  jne .L18
+  mov rbx, 0
+  jmp .L19
+.L18:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L19:
+#test/c/variable.c:64:     *arr = 5;
+  lea r8, [rbp - 52]
+  mov r9, 5
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 52]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 5
+  jne .L20
+  mov rbx, 0
+  jmp .L21
+.L20:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L21:
+#test/c/variable.c:67:     *(arr + 2) = 7;
+  lea r8, [rbp - 52]
+  add r8, 2
+  mov r9, 7
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 52]
+  add r8, 2
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L22
+  mov rbx, 0
+  jmp .L23
+.L22:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L23:
+#test/c/variable.c:70:     arr[3]= 4;
+  lea r8, [rbp - 52]
+  mov r9, 3
+  imul r9, 4
+  add r8, r9
+  mov r9, 4
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 52]
+  mov r9, 3
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 4
+  jne .L24
+  mov rbx, 0
+  jmp .L25
+.L24:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L25:
+  lea r8, [rbp - 56]
+  mov r9, 1
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 60]
+  mov r9, 2
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+  lea r8, [rbp - 62]
+  mov r9, 3
+  mov WORD PTR [r8], r9w
+  mov r8, r9
+  lea r8, [rbp - 72]
+  mov r9, 34
+  mov QWORD PTR [r8], r9
+  mov r8, r9
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + test_extern_int ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 10
+  jne .L26
+  mov rbx, 0
+  jmp .L27
+.L26:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L27:
+#test/c/variable.c:81:     test_static = 30;
+  lea r8, [ rip + .Ltest_static ]
+  mov r9, 30
+  mov DWORD PTR [r8], r9d
+  mov r8, r9
+#test/c/variable.c:83:     printf("test of local variable in register..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  sub rsp, 8
+  call sum_to
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 55
+  jne .L28
+  mov rbx, 0
+  jmp .L29
+.L28:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 300
+  sub rsp, 8
+  call narrow_char
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 44
+  jne .L30
+  mov rbx, 0
+  jmp .L31
+.L30:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 0
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call narrow_arg
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 255
+  jne .L32
+  mov rbx, 0
+  jmp .L33
+.L32:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 6
+  sub rsp, 8
+  call swap_loop
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 8
+  jne .L34
+  mov rbx, 0
+  jmp .L35
+.L34:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call many_live_values
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 1190
+  jne .L36
+  mov rbx, 0
+  jmp .L37
+.L36:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L37:
+#test/c/variable.c:90:     printf("test of static initializer..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_int ]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 42
+  jne .L38
+  mov rbx, 0
+  jmp .L39
+.L38:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_neg ]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  sub r9, 5
+  cmp r8, r9
+  jne .L40
+  mov rbx, 0
+  jmp .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L41:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_char ]
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 65
+  jne .L42
+  mov rbx, 0
+  jmp .L43
+.L42:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L43:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_short ]
+  movsx r8, WORD PTR [r8]
+  cmp r8, 3000
+  jne .L44
+  mov rbx, 0
+  jmp .L45
+.L44:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_arr ]
+  mov r9, 0
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  lea r9, [ rip + init_arr ]
+  mov rcx, 2
+  imul rcx, 4
+  add r9, rcx
+  movsxd r9, DWORD PTR [r9]
+  add r8, r9
+  cmp r8, 4
+  jne .L46
+  mov rbx, 0
+  jmp .L47
+.L46:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L47:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_arr ]
+  mov r9, 4
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 0
+  jne .L48
+  mov rbx, 0
+  jmp .L49
+.L48:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 16
+  cmp r8, 16
+  jne .L50
+  mov rbx, 0
+  jmp .L51
+.L50:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_unsized ]
+  mov r9, 3
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 40
+  jne .L52
+  mov rbx, 0
+  jmp .L53
+.L52:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 8
+  cmp r8, 8
+  jne .L54
+  mov rbx, 0
+  jmp .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_str ]
+  mov r9, 2
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 9
+  jne .L56
+  mov rbx, 0
+  jmp .L57
+.L56:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_str ]
+  mov r9, 7
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  jne .L58
+  mov rbx, 0
+  jmp .L59
+.L58:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_exact ]
+  mov r9, 3
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 100
+  jne .L60
+  mov rbx, 0
+  jmp .L61
+.L60:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_ptr ]
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 112
+  jne .L62
+  mov rbx, 0
+  jmp .L63
+.L62:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_elem ]
+  mov r8, QWORD PTR [r8]
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L64
+  mov rbx, 0
+  jmp .L65
+.L64:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_pt ]
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 122
+  jne .L66
+  mov rbx, 0
+  jmp .L67
+.L66:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_pt ]
+  add r8, 4
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L68
+  mov rbx, 0
+  jmp .L69
+.L68:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L69:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_pt ]
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  cmp r8, 99
+  jne .L70
+  mov rbx, 0
+  jmp .L71
+.L70:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 0
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 3
+  jne .L72
+  mov rbx, 0
+  jmp .L73
+.L72:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 8
+  mov r9, 0
+  imul r9, 16
+  add r8, r9
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  cmp r8, 2
+  jne .L74
+  mov rbx, 0
+  jmp .L75
+.L74:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 8
+  mov r9, 1
+  imul r9, 16
+  add r8, r9
+  add r8, 0
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 98
+  jne .L76
+  mov rbx, 0
+  jmp .L77
+.L76:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 8
+  mov r9, 1
+  imul r9, 16
+  add r8, r9
+  add r8, 8
+  mov r8, QWORD PTR [r8]
+  cmp r8, 4
+  jne .L78
+  mov rbx, 0
+  jmp .L79
+.L78:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 40
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 113
+  jne .L80
+  mov rbx, 0
+  jmp .L81
+.L80:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L81:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_shape ]
+  add r8, 40
+  mov r9, 2
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 0
+  jne .L82
+  mov rbx, 0
+  jmp .L83
+.L82:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L83:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_table ]
+  mov r9, 2
+  imul r9, 4
+  add r8, r9
+  movsxd r8, DWORD PTR [r8]
+  cmp r8, 7
+  jne .L84
+  mov rbx, 0
+  jmp .L85
+.L84:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L85:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_names ]
+  mov r9, 1
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 111
+  jne .L86
+  mov rbx, 0
+  jmp .L87
+.L86:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_names ]
+  mov r9, 2
+  imul r9, 8
+  add r8, r9
+  mov r8, QWORD PTR [r8]
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 119
+  jne .L88
+  mov rbx, 0
+  jmp .L89
+.L88:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L89:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_member ]
+  mov r8, QWORD PTR [r8]
+  mov r8, QWORD PTR [r8]
+  cmp r8, 99
+  jne .L90
+  mov rbx, 0
+  jmp .L91
+.L90:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_u ]
+  add r8, 0
+  mov r9, 0
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 2
+  jne .L92
+  mov rbx, 0
+  jmp .L93
+.L92:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L93:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + init_u ]
+  add r8, 0
+  mov r9, 1
+  imul r9, 1
+  add r8, r9
+  movsx r8, BYTE PTR [r8]
+  cmp r8, 1
+  jne .L94
+  mov rbx, 0
+  jmp .L95
+.L94:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L95:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call init_counter
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 11
+  jne .L96
+  mov rbx, 0
+  jmp .L97
+.L96:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L97:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  sub rsp, 8
+  call init_counter
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 12
+  jne .L98
+  mov rbx, 0
+  jmp .L99
+.L98:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+  mov rbx, r8
+.L99:
+#test/c/variable.c:123:     printf("test of assignment..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/variable.c:124:     return 0;
+  mov r8, 0
+  mov rax, r8
+  jmp ret_test_variable
+ret_test_variable:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,56 @@
+.intel_syntax noprefix
+.global test_assignment
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of assignment..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_assignment
+#	 stack size: 4
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_assignment:
+  push rbp
+  mov rbp, rsp
+#test/c/assignment.c:4:     printf("test of assignment..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+#test/c/assignment.c:6:     a = 0; a += 3; ASSERT(a, 3);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L1:
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+#test/c/assignment.c:7:     a = 0; a -= 3; ASSERT(a, -3);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L3:
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+#test/c/assignment.c:8:     a = 2; a *= 3; ASSERT(a, 6);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L5:
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+#test/c/assignment.c:9:     a = 8; a /= 4; ASSERT(a, 2);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L7:
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+#test/c/assignment.c:10:     a = 13; a %= 5; ASSERT(a, 3);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L9:
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+#test/c/assignment.c:11:     a = 56; a >>= 3; ASSERT(a, 7);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L11:
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+#test/c/assignment.c:12:     a = 7; a <<= 3; ASSERT(a, 56);
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L13:
+#test/c/assignment.c:13:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_assignment:
+  pop rbp
+  ret
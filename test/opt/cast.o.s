@@ -0,0 +1,267 @@
+.intel_syntax noprefix
+.global test_cast
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of pointer cast..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of cast..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_cast
+#	 stack size: 60
+#	 pcs2( ofs: 60, size: 4) : level0
+#	 a( ofs: 56, size: 8) : level0
+#	 pcs( ofs: 48, size: 8) : level0
+#	 pi( ofs: 40, size: 8) : level0
+#	 ul( ofs: 32, size: 8) : level0
+#	 ui( ofs: 24, size: 4) : level0
+#	 us( ofs: 20, size: 2) : level0
+#	 uc( ofs: 17, size: 1) : level0
+#	 l( ofs: 16, size: 8) : level0
+#	 i( ofs: 8, size: 4) : level0
+#	 s( ofs: 4, size: 2) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_cast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+#test/c/cast.c:4:     printf("test of cast..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, 0
+  mov DWORD PTR [rbp - 8], r8d
+#test/c/cast.c:16:     c = -1;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L3:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L5:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L7:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L9:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L13:
+#test/c/cast.c:26:     s = -1;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L19:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L23:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L27:
+#test/c/cast.c:36:     i = -1;
+  mov r8, 18446744073709551615
+  mov DWORD PTR [rbp - 8], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  movsx r8, r8b
+  cmp r8, 18446744073709551615
+  je .L29
+.L28:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  movsx r8, r8w
+  cmp r8, 18446744073709551615
+  je .L31
+.L30:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  cmp r8, 18446744073709551615
+  je .L33
+.L32:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  movzx r8, r8b
+  cmp r8, 255
+  je .L35
+.L34:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  movzx r8, r8w
+  cmp r8, 65535
+  je .L37
+.L36:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L37:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  mov r8d, r8d
+  mov r9, 4294967295
+  cmp r8, r9
+  je .L39
+.L38:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 8]
+# cast st
+  cmp r8, 18446744073709551615
+  je .L41
+.L40:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L41:
+#test/c/cast.c:46:     l = -1;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L43:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L47:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L55:
+#test/c/cast.c:56:     uc = 255;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L69:
+#test/c/cast.c:66:     us = 65535;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L81:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L83:
+#test/c/cast.c:76:     ui = 4294967295;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L85:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L89:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L93:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L95:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L97:
+#test/c/cast.c:86:     ul = 18446744073709551615ul;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L101:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L105:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L107:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L109:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L111:
+#test/c/cast.c:96:     printf("test of pointer cast..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/cast.c:97:     i = 5555;
+  mov r8, 5555
+  mov DWORD PTR [rbp - 8], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 8], -77
+  je .L113
+.L112:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L113:
+  mov r8, 123456
+  mov QWORD PTR [rbp - 56], r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 56], 64
+  je .L115
+.L114:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L115:
+#test/c/cast.c:112:     pcs2.a = 1;
+  mov r8, 1
+  mov BYTE PTR [rbp - 60], r8b
+#test/c/cast.c:113:     pcs2.b = 12;
+  mov r8, 12
+  mov BYTE PTR [rbp - 59], r8b
+#test/c/cast.c:118:     (PointerCastStruct2*)&pcs2;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 59], 12
+  je .L117
+.L116:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L117:
+ret_test_cast:
+  mov rsp, rbp
+  pop rbp
+  ret
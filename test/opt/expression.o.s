@@ -0,0 +1,1333 @@
+.intel_syntax noprefix
+.global strength_mismatch
+.global uop_by
+.global op_by
+.global logic_call
+.global logic_calls
+.global test_expression
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR11:
+  .string "test of signed and unsigned arithmetic ...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR10:
+  .string "test of full of register ...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of sizeof ...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of not operator...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of unary...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of condition operator...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of comma operator...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of multiply and divide by constants...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "test of short-circuit evaluation...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of logical expression...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of expression relational..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of expression..\n"
+  .bss
+  .align 4
+logic_calls:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# strength_mismatch
+#	 stack size: 32
+#	 u( ofs: 24, size: 8) : level0
+#	 bad( ofs: 12, size: 4) : level0
+#	 n( ofs: 8, size: 8) : level0
+  .text
+strength_mismatch:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  mov r8, rdi
+#test/c/expression.c:224:     bad += n * 0 != op_by(0, n, 0);
+  mov r9, 0
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+  mov rcx, 0
+.L0:
+  cmp r9, rcx
+  setne al
+  movzb r9, al
+  mov rcx, 0
+  add rcx, r9
+# cast st
+  movsxd r9, ecx
+#test/c/expression.c:225:     bad += n * 1 != op_by(0, n, 1);
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L3:
+  mov rcx, r8
+  cmp r8, rcx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:226:     bad += n * 3 != op_by(0, n, 3);
+  mov rcx, r8
+  lea rcx, [rcx + rcx * 2]
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L6:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:227:     bad += n * 8 != op_by(0, n, 8);
+  mov rcx, r8
+  sal rcx, 3
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L9:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:228:     bad += n * 10 != op_by(0, n, 10);
+  mov rcx, r8
+  lea rcx, [rcx + rcx * 4]
+  sal rcx, 1
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L12:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:229:     bad += n * 17 != op_by(0, n, 17);
+  mov rcx, r8
+  sal rcx, 4
+  add rcx, r8
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L15:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:230:     bad += n * 31 != op_by(0, n, 31);
+  mov rcx, r8
+  sal rcx, 5
+  sub rcx, r8
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L18:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:231:     bad += n * 72 != op_by(0, n, 72);
+  mov rcx, r8
+  lea rcx, [rcx + rcx * 8]
+  sal rcx, 3
+#test/c/expression.c:211:     if(op == 0) return n * d;
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L21:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:232:     bad += n / 1 != op_by(1, n, 1);
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L25:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L24:
+  mov rcx, r8
+  cmp r8, rcx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:233:     bad += n / 2 != op_by(1, n, 2);
+  mov rcx, r8
+  sar rcx, 63
+  mov rdx, rcx
+  shr rdx, 63
+  mov rsi, r8
+  add rsi, rdx
+  mov rdx, rsi
+  sar rdx, 1
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L28:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L27:
+  mov rdi, rdx
+  cmp rdx, rdi
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:234:     bad += n / 16 != op_by(1, n, 16);
+  mov rdx, rcx
+  shr rdx, 60
+  mov rdi, r8
+  add rdi, rdx
+  sar rdi, 4
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L31:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L30:
+  mov rdx, rdi
+  cmp rdi, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:235:     bad += n / 3 != op_by(1, n, 3);
+  mov rdi, r8
+  mov rbx, 6148914691236517206
+  mov rax, rdi
+  imul rbx
+  mov rdi, rdx
+  shr rdx, 63
+  add rdi, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L34:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L33:
+  mov rdx, rdi
+  cmp rdi, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:236:     bad += n / 7 != op_by(1, n, 7);
+  mov rbx, r8
+  mov r12, 5270498306774157605
+  mov rax, rbx
+  imul r12
+  mov rbx, rdx
+  sar rbx, 1
+  mov rdx, rbx
+  shr rdx, 63
+  add rbx, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L37:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L36:
+  mov rdx, rbx
+  cmp rbx, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:237:     bad += n / 10 != op_by(1, n, 10);
+  mov r12, r8
+  mov r13, 7378697629483820647
+  mov rax, r12
+  imul r13
+  mov r12, rdx
+  sar r12, 2
+  mov rdx, r12
+  shr rdx, 63
+  add r12, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L40:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L39:
+  mov rdx, r12
+  cmp r12, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:238:     bad += n / 1000 != op_by(1, n, 1000);
+  mov r12, r8
+  mov r13, 2361183241434822607
+  mov rax, r12
+  imul r13
+  mov r12, rdx
+  sar r12, 7
+  mov rdx, r12
+  shr rdx, 63
+  add r12, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L43:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L42:
+  mov rdx, r12
+  cmp r12, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:239:     bad += n / -3 != op_by(1, n, -3);
+  mov r12, r8
+  mov r13, 6148914691236517205
+  mov rax, r12
+  imul r13
+  mov r12, rdx
+  sub r12, r8
+  sar r12, 1
+  mov rdx, r12
+  shr rdx, 63
+  add r12, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L46:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L45:
+  mov rdx, r12
+  cmp r12, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:240:     bad += n / -10 != op_by(1, n, -10);
+  mov r12, r8
+  mov r13, 11068046444225730969
+  mov rax, r12
+  imul r13
+  mov r12, rdx
+  sar r12, 2
+  mov rdx, r12
+  shr rdx, 63
+  add r12, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L49:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L48:
+  mov rdx, r12
+  cmp r12, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:241:     bad += n % 2 != op_by(2, n, 2);
+  and rsi, 18446744073709551614
+  mov rdx, r8
+  sub rdx, rsi
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L52:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L53:
+#test/c/expression.c:213:     return n % d;
+.L51:
+  mov rsi, rdx
+  cmp rdx, rsi
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:242:     bad += n % 64 != op_by(2, n, 64);
+  shr rcx, 58
+  mov rdx, r8
+  add rdx, rcx
+  and rdx, 18446744073709551552
+  mov rcx, r8
+  sub rcx, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L55:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L56:
+#test/c/expression.c:213:     return n % d;
+.L54:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:243:     bad += n % 3 != op_by(2, n, 3);
+  lea rdi, [rdi + rdi * 2]
+  mov rcx, r8
+  sub rcx, rdi
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L58:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L59:
+#test/c/expression.c:213:     return n % d;
+.L57:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:244:     bad += n % 7 != op_by(2, n, 7);
+  imul rbx, 7
+  mov rcx, r8
+  sub rcx, rbx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L61:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L62:
+#test/c/expression.c:213:     return n % d;
+.L60:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:245:     bad += n % -10 != op_by(2, n, -10);
+  imul r12, 18446744073709551606
+  mov rcx, r8
+  sub rcx, r12
+#test/c/expression.c:211:     if(op == 0) return n * d;
+.L64:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+.L65:
+#test/c/expression.c:213:     return n % d;
+.L63:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:246:     bad += u / 4 != uop_by(1, u, 4);
+  mov rcx, r8
+  shr rcx, 2
+#test/c/expression.c:217:     if(op == 1) return n / d;
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L66:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:247:     bad += u / 3 != uop_by(1, u, 3);
+  mov rcx, r8
+  mov rsi, 12297829382473034411
+  mov rax, rcx
+  mul rsi
+  mov rcx, rdx
+  shr rcx, 1
+#test/c/expression.c:217:     if(op == 1) return n / d;
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L68:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:248:     bad += u / 7 != uop_by(1, u, 7);
+  mov rcx, r8
+  mov rsi, 2635249153387078803
+  mov rax, rcx
+  mul rsi
+  mov rcx, rdx
+  mov rsi, r8
+  sub rsi, rcx
+  shr rsi, 1
+  add rsi, rcx
+  shr rsi, 2
+#test/c/expression.c:217:     if(op == 1) return n / d;
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L70:
+  mov rcx, rsi
+  cmp rsi, rcx
+  setne al
+  movzb rcx, al
+  add r9, rcx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:249:     bad += u / 10 != uop_by(1, u, 10);
+  mov rcx, r8
+  mov rdi, 14757395258967641293
+  mov rax, rcx
+  mul rdi
+  mov rcx, rdx
+  shr rcx, 3
+#test/c/expression.c:217:     if(op == 1) return n / d;
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L72:
+  mov rdx, rcx
+  cmp rcx, rdx
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:250:     bad += u % 8 != uop_by(2, u, 8);
+  mov rdx, r8
+  and rdx, 7
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L75:
+#test/c/expression.c:218:     return n % d;
+.L74:
+  mov rdi, rdx
+  cmp rdx, rdi
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:251:     bad += u % 7 != uop_by(2, u, 7);
+  imul rsi, 7
+  mov rdx, r8
+  sub rdx, rsi
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L77:
+#test/c/expression.c:218:     return n % d;
+.L76:
+  mov rsi, rdx
+  cmp rdx, rsi
+  setne al
+  movzb rdx, al
+  add r9, rdx
+# cast st
+  movsxd r9, r9d
+#test/c/expression.c:252:     bad += u % 10 != uop_by(2, u, 10);
+  imul rcx, 10
+  sub r8, rcx
+#test/c/expression.c:217:     if(op == 1) return n / d;
+.L79:
+#test/c/expression.c:218:     return n % d;
+.L78:
+  mov rcx, r8
+  cmp r8, rcx
+  setne al
+  movzb r8, al
+  add r9, r8
+# cast st
+  movsxd r8, r9d
+#test/c/expression.c:253:     return bad;
+  mov rax, r8
+ret_strength_mismatch:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# uop_by
+#	 stack size: 24
+#	 d( ofs: 24, size: 8) : level0
+#	 n( ofs: 16, size: 8) : level0
+#	 op( ofs: 4, size: 4) : level0
+  .text
+uop_by:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  mov r9, rsi
+  mov rcx, rdx
+#test/c/expression.c:217:     if(op == 1) return n / d;
+  cmp r8, 1
+  jne .L80
+#test/c/expression.c:217:     if(op == 1) return n / d;
+  mov rax, r9
+  xor edx, edx
+  div rcx
+  mov r9, rax
+  jmp ret_uop_by
+.L80:
+#test/c/expression.c:218:     return n % d;
+  mov rax, r9
+  xor edx, edx
+  div rcx
+  mov r9, rdx
+  mov rax, r9
+ret_uop_by:
+  pop rbp
+  ret
+# op_by
+#	 stack size: 24
+#	 d( ofs: 24, size: 8) : level0
+#	 n( ofs: 16, size: 8) : level0
+#	 op( ofs: 4, size: 4) : level0
+  .text
+op_by:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  mov r9, rsi
+  mov rcx, rdx
+#test/c/expression.c:211:     if(op == 0) return n * d;
+  test r8, r8
+  jne .L81
+#test/c/expression.c:211:     if(op == 0) return n * d;
+  imul r9, rcx
+  mov rax, r9
+  jmp ret_op_by
+.L81:
+#test/c/expression.c:212:     if(op == 1) return n / d;
+  cmp r8, 1
+  jne .L82
+#test/c/expression.c:212:     if(op == 1) return n / d;
+  mov rax, r9
+  cqo
+  idiv rcx
+  mov r9, rax
+  jmp ret_op_by
+.L82:
+#test/c/expression.c:213:     return n % d;
+  mov rax, r9
+  cqo
+  idiv rcx
+  mov r9, rdx
+  mov rax, r9
+ret_op_by:
+  pop rbp
+  ret
+# logic_call
+#	 stack size: 8
+#	 v( ofs: 4, size: 4) : level0
+  .text
+logic_call:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r9, DWORD PTR [rip + logic_calls]
+  add r9, 1
+  mov DWORD PTR [rip + logic_calls], r9d
+#test/c/expression.c:206:     return v;
+  mov rax, r8
+ret_logic_call:
+  pop rbp
+  ret
+# test_expression
+#	 stack size: 248
+#	 folded( ofs: 248, size: 4) : level0
+#	 ui( ofs: 244, size: 4) : level0
+#	 ul( ofs: 240, size: 8) : level0
+#	 sl( ofs: 232, size: 8) : level0
+#	 i( ofs: 204, size: 4) : level0
+#	 preg2( ofs: 200, size: 8) : level0
+#	 preg1( ofs: 192, size: 8) : level0
+#	 i( ofs: 180, size: 4) : level0
+#	 reg2( ofs: 176, size: 12) : level0
+#	 reg1( ofs: 164, size: 12) : level0
+#	 sintp( ofs: 152, size: 8) : level0
+#	 sint( ofs: 140, size: 4) : level0
+#	 incp( ofs: 120, size: 8) : level0
+#	 i( ofs: 108, size: 4) : level0
+#	 idlist( ofs: 104, size: 40) : level0
+#	 pd( ofs: 60, size: 4) : level0
+#	 pi( ofs: 52, size: 4) : level0
+#	 u( ofs: 44, size: 4) : level0
+#	 sr_uint( ofs: 40, size: 4) : level0
+#	 sr_int( ofs: 36, size: 4) : level0
+#	 sr_i( ofs: 24, size: 8) : level0
+#	 sr_bad( ofs: 16, size: 4) : level0
+#	 logic_v( ofs: 12, size: 4) : level0
+#	 logic_p( ofs: 8, size: 8) : level0
+  .text
+test_expression:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  push rbx
+  push r12
+  push r13
+  push r14
+#test/c/expression.c:10:     printf("test of expression..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L84:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L86:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L88:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L90:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L92:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L94:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L96:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L98:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L100:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L102:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L104:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L106:
+#test/c/expression.c:24:     printf("test of expression relational..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L108:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L110:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L112:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L114:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L116:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L118:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L120:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L122:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L124:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L126:
+#test/c/expression.c:36:     printf("test of logical expression...\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L128:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L130:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L132:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L134:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L137:
+.L138:
+.L136:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L144:
+.L143:
+.L141:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L149:
+.L148:
+.L146:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L154:
+.L153:
+.L151:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L157:
+.L158:
+.L156:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L161:
+.L162:
+.L160:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L165:
+.L166:
+.L164:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L170:
+.L168:
+#test/c/expression.c:50:     printf("test of short-circuit evaluation...\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/expression.c:51:     logic_calls = 0;
+  mov r8, 0
+  mov DWORD PTR [rip + logic_calls], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r8, DWORD PTR [rip + logic_calls]
+  add r8, 1
+  mov DWORD PTR [rip + logic_calls], r8d
+#test/c/expression.c:206:     return v;
+.L176:
+.L175:
+.L174:
+.L172:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + logic_calls], 1
+  je .L179
+.L178:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L179:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r8, DWORD PTR [rip + logic_calls]
+  add r8, 1
+  mov DWORD PTR [rip + logic_calls], r8d
+#test/c/expression.c:206:     return v;
+.L184:
+.L182:
+.L183:
+.L181:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + logic_calls], 2
+  je .L187
+.L186:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L187:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r8, DWORD PTR [rip + logic_calls]
+  add r8, 1
+  mov DWORD PTR [rip + logic_calls], r8d
+#test/c/expression.c:206:     return v;
+.L193:
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r8, DWORD PTR [rip + logic_calls]
+  add r8, 1
+  mov DWORD PTR [rip + logic_calls], r8d
+#test/c/expression.c:206:     return v;
+.L194:
+.L192:
+#test/c/expression.c:205:     logic_calls++;
+  movsxd r8, DWORD PTR [rip + logic_calls]
+  add r8, 1
+  mov DWORD PTR [rip + logic_calls], r8d
+#test/c/expression.c:206:     return v;
+.L195:
+.L190:
+.L191:
+.L189:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + logic_calls], 5
+  je .L197
+.L196:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L197:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L202:
+.L201:
+.L199:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L205:
+.L206:
+.L204:
+  lea r8, [rbp - 12]
+  mov r9, 7
+  mov DWORD PTR [rbp - 12], r9d
+#test/c/expression.c:62:     logic_p = &logic_v;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  test r8, r8
+  je .L211
+  cmp DWORD PTR [rbp - 12], 7
+  je .L209
+.L211:
+  mov r8, 0
+  jmp .L210
+.L209:
+  mov r8, 1
+.L210:
+  cmp r8, 1
+  je .L208
+.L207:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L208:
+#test/c/expression.c:65:     printf("test of multiply and divide by constants...\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/expression.c:67:     for(long sr_i = -6; sr_i <= 6; sr_i++){
+  mov rbx, 0
+  mov r12, 18446744073709551610
+.L213:
+  mov r13, r12
+  add r13, 1
+  cmp r13, 6
+  jg .L371
+#test/c/expression.c:68:         sr_bad += strength_mismatch(sr_i);
+  mov rdi, r12
+  call strength_mismatch
+  mov r8, rax
+  add rbx, r8
+# cast st
+  movsxd r14, ebx
+#test/c/expression.c:69:         sr_bad += strength_mismatch(sr_i * 987654321987);
+  mov r8, r12
+  mov r9, 987654321987
+  imul r8, r9
+  mov rdi, r8
+  call strength_mismatch
+  mov r8, rax
+  add r14, r8
+# cast st
+  movsxd r14, r14d
+#test/c/expression.c:70:         sr_bad += strength_mismatch(sr_i * 1234567 + 89);
+  mov r8, r12
+  imul r8, 1234567
+  add r8, 89
+  mov rdi, r8
+  call strength_mismatch
+  mov r8, rax
+  add r14, r8
+# cast st
+  movsxd r14, r14d
+.L215:
+#test/c/expression.c:68:         sr_bad += strength_mismatch(sr_i);
+  mov rdi, r13
+  call strength_mismatch
+  mov r8, rax
+  add r14, r8
+# cast st
+  movsxd r14, r14d
+#test/c/expression.c:69:         sr_bad += strength_mismatch(sr_i * 987654321987);
+  mov r8, r13
+  mov r9, 987654321987
+  imul r8, r9
+  mov rdi, r8
+  call strength_mismatch
+  mov r8, rax
+  add r14, r8
+# cast st
+  movsxd r14, r14d
+#test/c/expression.c:70:         sr_bad += strength_mismatch(sr_i * 1234567 + 89);
+  imul r13, 1234567
+  add r13, 89
+  mov rdi, r13
+  call strength_mismatch
+  mov r8, rax
+  add r14, r8
+# cast st
+  movsxd rbx, r14d
+.L216:
+  add r12, 2
+  jmp .L213
+.L371:
+.L214:
+.L217:
+  cmp r12, 6
+  jg .L212
+#test/c/expression.c:68:         sr_bad += strength_mismatch(sr_i);
+  mov rdi, r12
+  call strength_mismatch
+  mov r8, rax
+  add rbx, r8
+# cast st
+  movsxd r13, ebx
+#test/c/expression.c:69:         sr_bad += strength_mismatch(sr_i * 987654321987);
+  mov r8, r12
+  mov r9, 987654321987
+  imul r8, r9
+  mov rdi, r8
+  call strength_mismatch
+  mov r8, rax
+  add r13, r8
+# cast st
+  movsxd r13, r13d
+#test/c/expression.c:70:         sr_bad += strength_mismatch(sr_i * 1234567 + 89);
+  mov r8, r12
+  imul r8, 1234567
+  add r8, 89
+  mov rdi, r8
+  call strength_mismatch
+  mov r8, rax
+  add r13, r8
+# cast st
+  movsxd rbx, r13d
+.L218:
+  add r12, 1
+  jmp .L217
+.L212:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  test rbx, rbx
+  je .L220
+.L219:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L220:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L222:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L224:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L226:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L228:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L230:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L232:
+#test/c/expression.c:82:     printf("test of comma operator...\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L234:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L236:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L238:
+#test/c/expression.c:87:     printf("test of condition operator...\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L242:
+.L240:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L245:
+.L246:
+.L244:
+#test/c/expression.c:91:     printf("test of unary...\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L248:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L250:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L252:
+#test/c/expression.c:96:     ++u;    // u -> 1
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L254:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L256:
+#test/c/expression.c:99:     --u;    // u -> 1
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L258:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L260:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L262:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L264:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L266:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L268:
+#test/c/expression.c:112:     for(int i = 0; i < 10; ++i){
+  lea r8, [rbp - 104]
+  lea r9, [rbp - 64]
+  mov rcx, 0
+.L270:
+  mov rdx, r8
+  add rdx, 12
+  cmp rdx, r9
+  jge .L271
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [r8], ecx
+.L272:
+  mov rdx, rcx
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [r8 + 4], edx
+.L273:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [r8 + 8], edx
+.L274:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [r8 + 12], edx
+.L275:
+  add rcx, 4
+  add r8, 16
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L270
+.L271:
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [rbp + rcx * 4 - 104], ecx
+.L276:
+  add rcx, 1
+# cast st
+  movsxd r8, ecx
+#test/c/expression.c:113:         idlist[i] = i;
+  mov DWORD PTR [rbp + r8 * 4 - 104], r8d
+.L277:
+.L269:
+#test/c/expression.c:117:     incp++;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 100], 1
+  je .L279
+.L278:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L279:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 96], 2
+  je .L281
+.L280:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L281:
+#test/c/expression.c:121:     incp--;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 100], 1
+  je .L283
+.L282:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L283:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 104], 0
+  je .L285
+.L284:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L285:
+#test/c/expression.c:125:     printf("test of not operator...\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L287:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L289:
+#test/c/expression.c:129:     printf("test of sizeof ...\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L291:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L293:
+  mov r8, 0
+  mov DWORD PTR [rbp - 140], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L295:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L297:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L299:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L301:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L303:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L305:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L307:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L309:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L311:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L313:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L315:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L317:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L319:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L321:
+#test/c/expression.c:158:     printf("test of full of register ...\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/expression.c:161:     for(int i = 0; i < 3; i++){
+#test/c/expression.c:162:         reg1[i] = 3 - i;
+  lea r8, [rbp - 164]
+  mov r9, 3
+  mov DWORD PTR [rbp - 164], r9d
+.L323:
+#test/c/expression.c:162:         reg1[i] = 3 - i;
+  mov r9, 2
+  mov DWORD PTR [rbp - 160], r9d
+.L324:
+#test/c/expression.c:162:         reg1[i] = 3 - i;
+  mov r9, 1
+  mov DWORD PTR [rbp - 156], r9d
+.L325:
+.L322:
+  lea r9, [rbp - 176]
+#test/c/expression.c:166:     for(int i = 0; i < 3; i++){
+  mov rcx, 0
+.L327:
+  mov rdx, rcx
+  add rdx, 1
+  cmp rdx, 3
+  jge .L328
+#test/c/expression.c:167:         *preg2++ = *preg1++;
+  movsxd rdx, DWORD PTR [r8]
+  mov DWORD PTR [r9], edx
+.L329:
+#test/c/expression.c:167:         *preg2++ = *preg1++;
+  mov rdx, r8
+  add rdx, 8
+  movsxd rsi, DWORD PTR [r8 + 4]
+  mov rdi, r9
+  add rdi, 8
+  mov DWORD PTR [r9 + 4], esi
+.L330:
+  add rcx, 2
+# cast st
+  movsxd rsi, ecx
+  mov r8, rdx
+  mov r9, rdi
+  mov rcx, rsi
+  jmp .L327
+.L328:
+#test/c/expression.c:167:         *preg2++ = *preg1++;
+  movsxd r8, DWORD PTR [r8]
+  mov DWORD PTR [r9], r8d
+.L331:
+.L326:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 176], 3
+  je .L333
+.L332:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L333:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 172], 2
+  je .L335
+.L334:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L335:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 168], 1
+  je .L337
+.L336:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L337:
+#test/c/expression.c:173:     printf("test of signed and unsigned arithmetic ...\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L339:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L341:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L343:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L345:
+#test/c/expression.c:180:     ul = ul - 1;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L347:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L349:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L351:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L353:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L355:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L357:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L359:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L361:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L363:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L365:
+#test/c/expression.c:193:     if(0){
+.L366:
+#test/c/expression.c:196:     while(0){
+.L367:
+.L368:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L370:
+#test/c/expression.c:201:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_expression:
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
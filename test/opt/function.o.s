@@ -0,0 +1,1191 @@
+.intel_syntax noprefix
+.global fr_keep
+.global fr_leaf
+.global tc_addr
+.global tc_odd
+.global tc_even
+.global tc_gcd
+.global tc_sum
+.global inl_swap_sum
+.global inl_twice
+.global inl_add1
+.global inl_fact
+.global combine
+.global times_ten
+.global void_func
+.global get_pointer
+.global g_func_a
+.global test_function
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of tail call..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of frame layout..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of inline expansion..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "test of value live across function call..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of nested function call..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of void function call..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of function call..\n"
+  .bss
+  .align 4
+g_func_a:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# fr_keep
+#	 stack size: 32
+#	 z( ofs: 32, size: 8) : level0
+#	 y( ofs: 24, size: 8) : level0
+#	 x( ofs: 16, size: 8) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+fr_keep:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  mov rbx, rdi
+  mov r8, rbx
+  sal r8, 1
+# cast st
+  movsxd r9, ebx
+#test/c/function.c:16:     return x * 10;
+  lea r9, [r9 + r9 * 4]
+  sal r9, 1
+# cast st
+  movsxd r12, r9d
+.L0:
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:16:     return x * 10;
+  lea r8, [r8 + r8 * 4]
+  sal r8, 1
+# cast st
+  movsxd r13, r8d
+.L1:
+  mov rdi, rbx
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  add r13, r8
+#test/c/function.c:114:     return x + y + z + times_ten(y);
+  lea r8, [r12 + rbx * 2]
+  add r8, r13
+# cast st
+  movsxd r9, r12d
+#test/c/function.c:16:     return x * 10;
+  lea r9, [r9 + r9 * 4]
+  sal r9, 1
+# cast st
+  movsxd r9, r9d
+.L2:
+  add r8, r9
+  mov rax, r8
+ret_fr_keep:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# fr_leaf
+#	 stack size: 56
+#	 i( ofs: 52, size: 4) : level0
+#	 s( ofs: 48, size: 4) : level0
+#	 i( ofs: 40, size: 4) : level0
+#	 a( ofs: 36, size: 32) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+fr_leaf:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/function.c:99:     for(int i = 0; i < 8; i++){
+  lea r9, [rbp - 36]
+  lea rcx, [rbp - 4]
+  mov rdx, 0
+.L4:
+  cmp r9, rcx
+  jge .L3
+#test/c/function.c:100:         a[i] = i * n;
+  mov rsi, rdx
+  imul rsi, r8
+  mov DWORD PTR [r9], esi
+.L6:
+  mov rsi, rdx
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/function.c:100:         a[i] = i * n;
+  mov rdi, rsi
+  imul rdi, r8
+  mov DWORD PTR [r9 + 4], edi
+.L7:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/function.c:100:         a[i] = i * n;
+  mov rdi, rsi
+  imul rdi, r8
+  mov DWORD PTR [r9 + 8], edi
+.L8:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/function.c:100:         a[i] = i * n;
+  imul rsi, r8
+  mov DWORD PTR [r9 + 12], esi
+.L9:
+  add rdx, 4
+  add r9, 16
+# cast st
+  movsxd rsi, edx
+  mov rdx, rsi
+  jmp .L4
+.L5:
+.L3:
+#test/c/function.c:103:     for(int i = 0; i < 8; i++){
+  mov r8, 0
+  movd xmm0, r8d
+  pshufd xmm0, xmm0, 0
+  lea r8, [rbp - 36]
+  lea r9, [rbp - 4]
+  mov rcx, 0
+  mov rdx, 0
+.L10:
+  cmp r8, r9
+  jge .L14
+  mov rsi, r8
+  and rsi, 15
+  test rsi, rsi
+  je .L170
+#test/c/function.c:104:         s = s + a[i];
+  movsxd rsi, DWORD PTR [r8]
+  add rcx, rsi
+# cast st
+  movsxd rsi, ecx
+.L16:
+  add rdx, 1
+  add r8, 4
+# cast st
+  movsxd rdi, edx
+  mov rcx, rsi
+  mov rdx, rdi
+  jmp .L10
+.L170:
+  lea r8, [rbp + rdx * 4 - 36]
+  lea r9, [rbp - 4]
+.L11:
+.L12:
+  mov rsi, r8
+  add rsi, 12
+  cmp rsi, r9
+  jge .L13
+  movdqu xmm1, [r8]
+  paddd xmm0, xmm1
+  add rdx, 4
+  add r8, 16
+# cast st
+  movsxd rsi, edx
+  mov rdx, rsi
+  jmp .L12
+.L13:
+  pshufd xmm13, xmm0, 0x4e
+  paddd xmm0, xmm13
+  pshufd xmm13, xmm0, 0xb1
+  paddd xmm0, xmm13
+  movd eax, xmm0
+  movsxd r8, eax
+  add rcx, r8
+# cast st
+  movsxd r8, ecx
+  mov rcx, r8
+.L14:
+  lea r8, [rbp + rdx * 4 - 36]
+  lea r9, [rbp - 4]
+.L17:
+  cmp r8, r9
+  jge .L15
+#test/c/function.c:104:         s = s + a[i];
+  movsxd rdx, DWORD PTR [r8]
+  add rcx, rdx
+# cast st
+  movsxd rdx, ecx
+.L18:
+  add r8, 4
+  mov rcx, rdx
+  jmp .L17
+.L15:
+#test/c/function.c:106:     return s;
+  mov rax, rcx
+ret_fr_leaf:
+  pop rbp
+  ret
+# tc_addr
+#	 stack size: 20
+#	 x( ofs: 20, size: 4) : level0
+#	 p( ofs: 16, size: 8) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_addr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  movsxd r8, edi
+  mov r9, rsi
+  lea rcx, [rbp - 20]
+  mov DWORD PTR [rbp - 20], r8d
+#test/c/function.c:92:     if(n == 0) return *p;
+  test r8, r8
+  jne .L19
+#test/c/function.c:92:     if(n == 0) return *p;
+  movsxd r9, DWORD PTR [r9]
+  mov rax, r9
+  jmp ret_tc_addr
+.L19:
+#test/c/function.c:93:     return tc_addr(n - 1, &x);
+  sub r8, 1
+  mov rdi, r8
+  mov rsi, rcx
+  call tc_addr
+  mov r8, rax
+ret_tc_addr:
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_odd
+#	 stack size: 8
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_odd:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  movsxd r8, edi
+#test/c/function.c:81:     if(n == 0) return 0;
+  test r8, r8
+  jne .L20
+#test/c/function.c:81:     if(n == 0) return 0;
+  mov r9, 0
+  mov rax, r9
+  jmp ret_tc_odd
+.L20:
+#test/c/function.c:82:     return tc_even(n - 1);
+  sub r8, 1
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:86:     if(n == 0) return 1;
+  test r8, r8
+  jne .L22
+#test/c/function.c:86:     if(n == 0) return 1;
+  mov rbx, 1
+  jmp .L21
+.L22:
+#test/c/function.c:87:     return tc_odd(n - 1);
+  sub r8, 1
+  mov rdi, r8
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  jmp tc_odd
+.L21:
+  mov rax, rbx
+ret_tc_odd:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_even
+#	 stack size: 12
+#	 n( ofs: 4, size: 4) : level0
+  .text
+tc_even:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  movsxd r8, edi
+#test/c/function.c:86:     if(n == 0) return 1;
+  test r8, r8
+  jne .L23
+#test/c/function.c:86:     if(n == 0) return 1;
+  mov r9, 1
+  mov rax, r9
+  jmp ret_tc_even
+.L23:
+#test/c/function.c:87:     return tc_odd(n - 1);
+  sub r8, 1
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:81:     if(n == 0) return 0;
+  test r8, r8
+  jne .L25
+#test/c/function.c:81:     if(n == 0) return 0;
+  mov rbx, 0
+  jmp .L24
+.L25:
+#test/c/function.c:82:     return tc_even(n - 1);
+  sub r8, 1
+  mov rdi, r8
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  jmp tc_even
+.L24:
+  mov rax, rbx
+ret_tc_even:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# tc_gcd
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+tc_gcd:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  movsxd r9, esi
+.L26:
+#test/c/function.c:72:     if(b == 0){
+  test r9, r9
+  jne .L27
+#test/c/function.c:73:         return a;
+  mov rax, r8
+  jmp ret_tc_gcd
+.L27:
+#test/c/function.c:75:     return tc_gcd(b, a % b);
+  mov rax, r8
+  cqo
+  idiv r9
+  mov r8, rdx
+# cast st
+  movsxd rcx, r9d
+# cast st
+  movsxd r9, r8d
+  mov r8, rcx
+  jmp .L26
+ret_tc_gcd:
+  pop rbp
+  ret
+# tc_sum
+#	 stack size: 16
+#	 acc( ofs: 16, size: 8) : level0
+#	 n( ofs: 8, size: 8) : level0
+  .text
+tc_sum:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+  mov r9, rsi
+.L28:
+#test/c/function.c:67:     if(n == 0) return acc;
+  test r8, r8
+  jne .L29
+#test/c/function.c:67:     if(n == 0) return acc;
+  mov rax, r9
+  jmp ret_tc_sum
+.L29:
+#test/c/function.c:68:     return tc_sum(n - 1, acc + n);
+  mov rcx, r8
+  sub rcx, 1
+  add r9, r8
+  mov r8, rcx
+  jmp .L28
+ret_tc_sum:
+  pop rbp
+  ret
+# inl_swap_sum
+#	 stack size: 16
+#	 t( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+inl_swap_sum:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  movsxd r9, esi
+  mov DWORD PTR [rbp - 12], r8d
+#test/c/function.c:60:     a = b;
+# cast st
+  movsxd r8, r9d
+#test/c/function.c:61:     b = t;
+  movsxd r9, DWORD PTR [rbp - 12]
+# cast st
+  movsxd r9, r9d
+#test/c/function.c:62:     inl_store(&t, a * 10 + b);
+  lea r8, [r8 + r8 * 4]
+  lea r8, [r9 + r8 * 2]
+# cast st
+  movsxd r8, r8d
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:55:     *p = tmp;
+  mov DWORD PTR [rbp - 12], r8d
+.L30:
+#test/c/function.c:63:     return t;
+  movsxd r8, DWORD PTR [rbp - 12]
+  mov rax, r8
+ret_inl_swap_sum:
+  pop rbp
+  ret
+# inl_twice
+#	 stack size: 12
+#	 b( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 4) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+inl_twice:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:44:     return x + 1;
+  add r8, 1
+# cast st
+  movsxd r8, r8d
+.L31:
+# cast st
+  movsxd r8, r8d
+# cast st
+  movsxd r9, r8d
+#test/c/function.c:44:     return x + 1;
+  add r9, 1
+# cast st
+  movsxd r9, r9d
+.L32:
+# cast st
+  movsxd r9, r9d
+#test/c/function.c:50:     return a + b;
+  add r8, r9
+  mov rax, r8
+ret_inl_twice:
+  pop rbp
+  ret
+# inl_add1
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+inl_add1:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/function.c:44:     return x + 1;
+  add r8, 1
+  mov rax, r8
+ret_inl_add1:
+  pop rbp
+  ret
+# inl_fact
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inl_fact:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  movsxd rbx, edi
+#test/c/function.c:39:     if(n <= 1) return 1;
+  cmp rbx, 1
+  jg .L33
+#test/c/function.c:39:     if(n <= 1) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_inl_fact
+.L33:
+#test/c/function.c:40:     return n * inl_fact(n - 1);
+  mov r8, rbx
+  sub r8, 1
+  mov rdi, r8
+  sub rsp, 8
+  call inl_fact
+  add rsp, 8
+  mov r8, rax
+  imul rbx, r8
+  mov rax, rbx
+ret_inl_fact:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# combine
+#	 stack size: 12
+#	 c( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+combine:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  movsxd r9, esi
+  movsxd rcx, edx
+#test/c/function.c:20:     return a * 100 + b * 10 + c;
+  imul r8, 100
+  lea r9, [r9 + r9 * 4]
+  lea r8, [r8 + r9 * 2]
+  add r8, rcx
+  mov rax, r8
+ret_combine:
+  pop rbp
+  ret
+# times_ten
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+times_ten:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/function.c:16:     return x * 10;
+  lea r8, [r8 + r8 * 4]
+  sal r8, 1
+  mov rax, r8
+ret_times_ten:
+  pop rbp
+  ret
+# void_func
+#	 stack size: 0
+  .text
+void_func:
+  push rbp
+  mov rbp, rsp
+#test/c/function.c:12:     return;
+ret_void_func:
+  pop rbp
+  ret
+# get_pointer
+#	 stack size: 8
+#	 a( ofs: 8, size: 8) : level0
+  .text
+get_pointer:
+  push rbp
+  mov rbp, rsp
+  lea r8, [ rip + g_func_a ]
+#test/c/function.c:7:     *a = 30;
+  mov r9, 30
+  mov DWORD PTR [rip + g_func_a], r9d
+#test/c/function.c:8:     return a;
+  mov rax, r8
+ret_get_pointer:
+  pop rbp
+  ret
+# test_function
+#	 stack size: 56
+#	 w( ofs: 28, size: 4) : level0
+#	 z( ofs: 24, size: 4) : level0
+#	 y( ofs: 20, size: 4) : level0
+#	 x( ofs: 16, size: 4) : level0
+#	 c( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+test_function:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  push rbx
+  push r12
+  push r13
+#test/c/function.c:119:     printf("test of function call..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+#test/c/function.c:7:     *a = 30;
+  mov r8, 30
+  mov DWORD PTR [rip + g_func_a], r8d
+#test/c/function.c:8:     return a;
+.L50:
+#test/c/function.c:122:     c = *p;
+  movsxd r8, DWORD PTR [rip + g_func_a]
+#test/c/function.c:125:     ((*p) == (30) ? 0 : exit(1));
+  cmp r8, 30
+  je .L52
+.L51:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L52:
+#test/c/function.c:127:     printf("test of void function call..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/function.c:128:     void_func();
+#test/c/function.c:12:     return;
+.L53:
+#test/c/function.c:130:     printf("test of nested function call..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:16:     return x * 10;
+.L56:
+#test/c/function.c:20:     return a * 100 + b * 10 + c;
+.L57:
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:16:     return x * 10;
+.L60:
+#test/c/function.c:16:     return x * 10;
+.L61:
+#test/c/function.c:20:     return a * 100 + b * 10 + c;
+.L62:
+.L59:
+#test/c/function.c:134:     printf("test of value live across function call..\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#test/c/function.c:16:     return x * 10;
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L65:
+#test/c/function.c:140:     printf("test of inline expansion..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:24:     if(v < lo) return lo;
+#test/c/function.c:24:     if(v < lo) return lo;
+.L68:
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:24:     if(v < lo) return lo;
+.L74:
+#test/c/function.c:25:     if(v > hi) return hi;
+.L75:
+#test/c/function.c:26:     return v;
+.L73:
+.L72:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:24:     if(v < lo) return lo;
+.L79:
+#test/c/function.c:25:     if(v > hi) return hi;
+#test/c/function.c:25:     if(v > hi) return hi;
+.L78:
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:31:     for(int i = 0; i < n; i++){
+  mov r8, 0
+  mov r9, 0
+.L85:
+  mov rcx, r9
+  add rcx, 3
+  cmp rcx, 10
+  jge .L171
+#test/c/function.c:32:         if(i == 5) break;
+  cmp r9, 5
+  je .L84
+#test/c/function.c:32:         if(i == 5) break;
+.L88:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L87:
+  mov rdx, r9
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/function.c:32:         if(i == 5) break;
+  cmp rdx, 5
+  jne .L90
+#test/c/function.c:32:         if(i == 5) break;
+  mov r8, rcx
+  jmp .L84
+.L90:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  add rcx, rdx
+# cast st
+  movsxd r8, ecx
+.L89:
+  add rdx, 1
+# cast st
+  movsxd rcx, edx
+#test/c/function.c:32:         if(i == 5) break;
+  cmp rcx, 5
+  je .L84
+#test/c/function.c:32:         if(i == 5) break;
+.L92:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  add r8, rcx
+# cast st
+  movsxd rdx, r8d
+.L91:
+  add rcx, 1
+# cast st
+  movsxd rcx, ecx
+#test/c/function.c:32:         if(i == 5) break;
+  cmp rcx, 5
+  jne .L94
+#test/c/function.c:32:         if(i == 5) break;
+  mov r8, rdx
+  jmp .L84
+.L94:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  add rdx, rcx
+# cast st
+  movsxd r8, edx
+.L93:
+  add r9, 4
+# cast st
+  movsxd rcx, r9d
+  mov r9, rcx
+  jmp .L85
+.L171:
+.L86:
+.L95:
+  cmp r9, 10
+  jge .L84
+#test/c/function.c:32:         if(i == 5) break;
+  cmp r9, 5
+  je .L84
+#test/c/function.c:32:         if(i == 5) break;
+.L97:
+#test/c/function.c:32:         if(i == 5) break;
+#test/c/function.c:33:         s += i;
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L96:
+  add r9, 1
+# cast st
+  movsxd rdx, r9d
+  mov r8, rcx
+  mov r9, rdx
+  jmp .L95
+.L84:
+#test/c/function.c:35:     return s;
+# cast st
+  movsxd r8, r8d
+.L83:
+  cmp r8, 10
+  je .L82
+.L81:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L82:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:39:     if(n <= 1) return 1;
+.L101:
+#test/c/function.c:40:     return n * inl_fact(n - 1);
+  mov rdi, 4
+  sub rsp, 8
+  call inl_fact
+  add rsp, 8
+  mov r8, rax
+  lea r8, [r8 + r8 * 4]
+# cast st
+  movsxd r8, r8d
+.L100:
+  cmp r8, 120
+  je .L99
+.L98:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:44:     return x + 1;
+.L105:
+#test/c/function.c:44:     return x + 1;
+.L106:
+#test/c/function.c:50:     return a + b;
+.L104:
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:44:     return x + 1;
+.L110:
+#test/c/function.c:44:     return x + 1;
+.L111:
+#test/c/function.c:50:     return a + b;
+.L109:
+#test/c/function.c:44:     return x + 1;
+.L113:
+#test/c/function.c:44:     return x + 1;
+.L114:
+#test/c/function.c:50:     return a + b;
+.L112:
+.L108:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, 1
+  mov DWORD PTR [rbp - 12], r8d
+#test/c/function.c:60:     a = b;
+#test/c/function.c:61:     b = t;
+  movsxd r8, DWORD PTR [rbp - 12]
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:62:     inl_store(&t, a * 10 + b);
+  mov r9, 20
+  add r9, r8
+# cast st
+  movsxd r8, r9d
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:55:     *p = tmp;
+  mov DWORD PTR [rbp - 12], r8d
+.L118:
+#test/c/function.c:63:     return t;
+  movsxd r8, DWORD PTR [rbp - 12]
+# cast st
+  movsxd r8, r8d
+.L117:
+  cmp r8, 21
+  je .L116
+.L115:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L116:
+  mov r8, 0
+  mov DWORD PTR [rbp - 28], r8d
+#test/c/function.c:150:     inl_store(&w, 7);
+#test/c/function.c:55:     *p = tmp;
+  mov r8, 7
+  mov DWORD PTR [rbp - 28], r8d
+.L119:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 28], 7
+  je .L121
+.L120:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L121:
+#test/c/function.c:153:     printf("test of frame layout..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 84
+  je .L123
+.L122:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L123:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:16:     return x * 10;
+.L127:
+#test/c/function.c:16:     return x * 10;
+.L128:
+  mov rdi, 1
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+#test/c/function.c:114:     return x + y + z + times_ten(y);
+  lea r8, [r8 + 32]
+#test/c/function.c:16:     return x * 10;
+.L129:
+  add r8, 100
+.L126:
+  cmp r8, 160
+  je .L125
+.L124:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L125:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov rbx, rax
+  mov r8, rbx
+  sal r8, 1
+# cast st
+  movsxd r9, ebx
+#test/c/function.c:16:     return x * 10;
+  lea r9, [r9 + r9 * 4]
+  sal r9, 1
+# cast st
+  movsxd r12, r9d
+.L133:
+# cast st
+  movsxd r8, r8d
+#test/c/function.c:16:     return x * 10;
+  lea r8, [r8 + r8 * 4]
+  sal r8, 1
+# cast st
+  movsxd r13, r8d
+.L134:
+  mov rdi, rbx
+  sub rsp, 8
+  call fr_leaf
+  add rsp, 8
+  mov r8, rax
+  add r13, r8
+#test/c/function.c:114:     return x + y + z + times_ten(y);
+  lea r8, [r12 + rbx * 2]
+  add r8, r13
+# cast st
+  movsxd r9, r12d
+#test/c/function.c:16:     return x * 10;
+  lea r9, [r9 + r9 * 4]
+  sal r9, 1
+# cast st
+  movsxd r9, r9d
+.L135:
+  add r8, r9
+.L132:
+  cmp r8, 4480
+  je .L131
+.L130:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L131:
+#test/c/function.c:158:     printf("test of tail call..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:67:     if(n == 0) return acc;
+.L139:
+#test/c/function.c:68:     return tc_sum(n - 1, acc + n);
+  mov rdi, 999
+  mov rsi, 1000
+  sub rsp, 8
+  call tc_sum
+  add rsp, 8
+  mov r8, rax
+.L138:
+  cmp r8, 500500
+  je .L137
+.L136:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L137:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:72:     if(b == 0){
+.L143:
+#test/c/function.c:75:     return tc_gcd(b, a % b);
+  mov rdi, 462
+  mov rsi, 147
+  sub rsp, 8
+  call tc_gcd
+  add rsp, 8
+  mov r8, rax
+# cast st
+  movsxd r8, r8d
+.L142:
+  cmp r8, 21
+  je .L141
+.L140:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L141:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:86:     if(n == 0) return 1;
+.L147:
+#test/c/function.c:87:     return tc_odd(n - 1);
+#test/c/function.c:81:     if(n == 0) return 0;
+.L149:
+#test/c/function.c:82:     return tc_even(n - 1);
+  mov rdi, 999
+  sub rsp, 8
+  call tc_even
+  add rsp, 8
+  mov r8, rax
+# cast st
+  movsxd r8, r8d
+.L148:
+# cast st
+  movsxd r8, r8d
+.L146:
+  test r8, r8
+  je .L145
+.L144:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L145:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:81:     if(n == 0) return 0;
+.L153:
+#test/c/function.c:82:     return tc_even(n - 1);
+#test/c/function.c:86:     if(n == 0) return 1;
+.L155:
+#test/c/function.c:87:     return tc_odd(n - 1);
+  mov rdi, 999
+  sub rsp, 8
+  call tc_odd
+  add rsp, 8
+  mov r8, rax
+# cast st
+  movsxd r8, r8d
+.L154:
+# cast st
+  movsxd r8, r8d
+.L152:
+  cmp r8, 1
+  je .L151
+.L150:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L151:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 20]
+  mov r9, 5
+  mov DWORD PTR [rbp - 20], r9d
+#test/c/function.c:92:     if(n == 0) return *p;
+.L159:
+#test/c/function.c:93:     return tc_addr(n - 1, &x);
+  mov rdi, 4
+  mov rsi, r8
+  sub rsp, 8
+  call tc_addr
+  add rsp, 8
+  mov r8, rax
+# cast st
+  movsxd r8, r8d
+.L158:
+  cmp r8, 1
+  je .L157
+.L156:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L157:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:67:     if(n == 0) return acc;
+.L163:
+#test/c/function.c:68:     return tc_sum(n - 1, acc + n);
+  mov rdi, 9999999
+  mov rsi, 10000000
+  sub rsp, 8
+  call tc_sum
+  add rsp, 8
+  mov r8, rax
+.L162:
+  mov r9, 50000005000000
+  cmp r8, r9
+  je .L161
+.L160:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L161:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/function.c:86:     if(n == 0) return 1;
+.L167:
+#test/c/function.c:87:     return tc_odd(n - 1);
+#test/c/function.c:81:     if(n == 0) return 0;
+.L169:
+#test/c/function.c:82:     return tc_even(n - 1);
+  mov rdi, 9999998
+  sub rsp, 8
+  call tc_even
+  add rsp, 8
+  mov r8, rax
+# cast st
+  movsxd r8, r8d
+.L168:
+# cast st
+  movsxd r8, r8d
+.L166:
+  cmp r8, 1
+  je .L165
+.L164:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L165:
+#test/c/function.c:170:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_function:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,724 @@
+.intel_syntax noprefix
+.global am_global
+.global am_len
+.global am_max
+.global am_sum_tag
+.global am_sum_side
+.global am_table
+.global set_through
+.global test_pointer
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "address"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of addressing mode..\n"
+  .bss
+  .align 8
+am_table:
+  .zero 64
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# am_global
+#	 stack size: 4
+#	 i( ofs: 4, size: 4) : level0
+  .text
+am_global:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/pointer.c:123:     am_table[i] = i * 3;
+  mov r9, r8
+  lea r9, [r9 + r9 * 2]
+  lea rcx, [ rip + am_table ]
+  mov QWORD PTR [rcx + r8 * 8], r9
+#test/c/pointer.c:124:     return am_table[i] + am_table[0];
+  mov r9, QWORD PTR [rip + am_table]
+  add r9, QWORD PTR [rcx + r8 * 8]
+  mov rax, r9
+ret_am_global:
+  pop rbp
+  ret
+# am_len
+#	 stack size: 24
+#	 n( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 8) : level0
+  .text
+am_len:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+#test/c/pointer.c:115:     while(*s){
+  mov r9, 0
+.L0:
+  cmp BYTE PTR [r8], 0
+  je .L1
+#test/c/pointer.c:116:         n++;
+  add r9, 1
+# cast st
+  movsxd rcx, r9d
+#test/c/pointer.c:117:         s++;
+  add r8, 1
+  mov r9, rcx
+  jmp .L0
+.L1:
+#test/c/pointer.c:119:     return n;
+  mov rax, r9
+ret_am_len:
+  pop rbp
+  ret
+# am_max
+#	 stack size: 32
+#	 i( ofs: 28, size: 4) : level0
+#	 m( ofs: 24, size: 8) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+am_max:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+  mov rcx, QWORD PTR [r8]
+#test/c/pointer.c:105:     for(int i = 1; i < n; i++){
+  mov rdx, r8
+  add rdx, 8
+  lea rsi, [r8 + r9 * 8]
+  mov rdi, 1
+.L2:
+  cmp rdx, rsi
+  jge .L6
+  mov rbx, rdx
+  and rbx, 15
+  test rbx, rbx
+  je .L3
+#test/c/pointer.c:106:         if(m < a[i]){
+  mov rbx, QWORD PTR [rdx]
+  cmp rcx, rbx
+  jge .L9
+#test/c/pointer.c:107:             m = a[i];
+  mov rcx, rbx
+.L9:
+.L8:
+  add rdi, 1
+  add rdx, 8
+# cast st
+  movsxd rbx, edi
+  mov rdi, rbx
+  jmp .L2
+.L3:
+  mov rsi, rdi
+  add rsi, 1
+  cmp rsi, r9
+  jge .L6
+  movdqu xmm0, [rdx]
+  add rdi, 2
+# cast st
+  movsxd rdx, edi
+  lea rsi, [r8 + rdx * 8]
+  lea rbx, [r8 + r9 * 8]
+.L4:
+  mov r12, rsi
+  add r12, 8
+  cmp r12, rbx
+  jge .L5
+  movdqu xmm1, [rsi]
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm1
+  movdqa xmm14, xmm15
+  pand xmm14, xmm0
+  pandn xmm15, xmm1
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  add rdx, 2
+  add rsi, 16
+# cast st
+  movsxd r12, edx
+  mov rdx, r12
+  jmp .L4
+.L5:
+  pshufd xmm13, xmm0, 0x4e
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm0
+  pandn xmm15, xmm13
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movq rsi, xmm0
+  mov rdi, rdx
+  cmp rsi, rcx
+  jle .L10
+  mov rcx, rsi
+  mov rdi, rdx
+.L10:
+.L6:
+  lea rdx, [r8 + rdi * 8]
+  lea r8, [r8 + r9 * 8]
+.L11:
+  cmp rdx, r8
+  jge .L7
+#test/c/pointer.c:106:         if(m < a[i]){
+  mov r9, QWORD PTR [rdx]
+  cmp rcx, r9
+  jge .L13
+#test/c/pointer.c:107:             m = a[i];
+  mov rcx, r9
+.L13:
+.L12:
+  add rdx, 8
+  jmp .L11
+.L7:
+#test/c/pointer.c:110:     return m;
+  mov rax, rcx
+ret_am_max:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# am_sum_tag
+#	 stack size: 24
+#	 sum( ofs: 24, size: 8) : level0
+#	 tag( ofs: 9, size: 1) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+am_sum_tag:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+  movsx r9, sil
+#test/c/pointer.c:94:     while(p){
+  mov rcx, 0
+.L14:
+  test r8, r8
+  je .L15
+#test/c/pointer.c:95:         if(p->tag == tag){
+  movsx rdx, BYTE PTR [r8]
+  cmp rdx, r9
+  jne .L16
+#test/c/pointer.c:96:             sum += p->val;
+  add rcx, QWORD PTR [r8 + 8]
+.L16:
+#test/c/pointer.c:98:         p = p->next;
+  mov rdx, QWORD PTR [r8 + 16]
+  mov r8, rdx
+  jmp .L14
+.L15:
+#test/c/pointer.c:100:     return sum;
+  mov rax, rcx
+ret_am_sum_tag:
+  pop rbp
+  ret
+# am_sum_side
+#	 stack size: 12
+#	 i( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+am_sum_side:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/pointer.c:89:     return a[i + 1] + a[i - 1];
+  mov rcx, r9
+  sub rcx, 1
+  mov rcx, QWORD PTR [r8 + rcx * 8]
+  add rcx, QWORD PTR [r8 + r9 * 8 + 8]
+  mov rax, rcx
+ret_am_sum_side:
+  pop rbp
+  ret
+# set_through
+#	 stack size: 12
+#	 v( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+set_through:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/pointer.c:85:     *p = v;
+  mov DWORD PTR [r8], r9d
+ret_set_through:
+  pop rbp
+  ret
+# test_pointer
+#	 stack size: 224
+#	 n1( ofs: 224, size: 24) : level0
+#	 n2( ofs: 200, size: 24) : level0
+#	 n3( ofs: 176, size: 24) : level0
+#	 i( ofs: 148, size: 4) : level0
+#	 la( ofs: 144, size: 40) : level0
+#	 twice( ofs: 100, size: 4) : level0
+#	 ap( ofs: 96, size: 8) : level0
+#	 ai( ofs: 84, size: 4) : level0
+#	 arr( ofs: 80, size: 16) : level0
+#	 lp( ofs: 64, size: 8) : level0
+#	 ld( ofs: 56, size: 8) : level0
+#	 sp( ofs: 48, size: 8) : level0
+#	 sd( ofs: 34, size: 2) : level0
+#	 cp( ofs: 32, size: 8) : level0
+#	 cd( ofs: 17, size: 1) : level0
+#	 a( ofs: 16, size: 8) : level0
+#	 data( ofs: 4, size: 4) : level0
+  .text
+test_pointer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  push rbx
+#test/c/pointer.c:18:     int data; data = 10;
+  lea rbx, [rbp - 4]
+  mov r8, 10
+  mov DWORD PTR [rbp - 4], r8d
+#test/c/pointer.c:19:     int* a; a = &data;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 4], 10
+  je .L18
+.L17:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L18:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, rbx
+  je .L20
+.L19:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L20:
+#test/c/pointer.c:22:     *a = 15;
+  mov r8, 15
+  mov DWORD PTR [rbp - 4], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 4], 15
+  je .L22
+.L21:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L22:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L24:
+  lea rbx, [rbp - 17]
+  mov r8, 10
+  mov BYTE PTR [rbp - 17], r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 17], 10
+  je .L26
+.L25:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L26:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, rbx
+  je .L28
+.L27:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L28:
+#test/c/pointer.c:30:     *cp = 15;
+  mov r8, 15
+  mov BYTE PTR [rbp - 17], r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 17], 15
+  je .L30
+.L29:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L30:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L32:
+  lea rbx, [rbp - 34]
+  mov r8, 10
+  mov WORD PTR [rbp - 34], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 34], 10
+  je .L34
+.L33:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L34:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, rbx
+  je .L36
+.L35:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L36:
+#test/c/pointer.c:38:     *sp = 15;
+  mov r8, 15
+  mov WORD PTR [rbp - 34], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 34], 15
+  je .L38
+.L37:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L38:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L40:
+  lea rbx, [rbp - 56]
+  mov r8, 10
+  mov QWORD PTR [rbp - 56], r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 56], 10
+  je .L42
+.L41:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L42:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, rbx
+  je .L44
+.L43:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L44:
+#test/c/pointer.c:46:     *lp = 15;
+  mov r8, 15
+  mov QWORD PTR [rbp - 56], r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 56], 15
+  je .L46
+.L45:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L46:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L48:
+#test/c/pointer.c:51:     arr[1] = 3;
+  mov r8, 3
+  mov DWORD PTR [rbp - 76], r8d
+  movsxd r8, DWORD PTR [rbp - 76]
+  mov r9, r8
+  add r9, r8
+# cast st
+  movsxd r8, r9d
+#test/c/pointer.c:55:     *ap = 10;
+  mov r9, 10
+  mov DWORD PTR [rbp - 76], r9d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 6
+  je .L50
+.L49:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L50:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 76]
+  mov r9, r8
+  add r9, r8
+  cmp r9, 20
+  je .L52
+.L51:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L52:
+#test/c/pointer.c:58:     set_through(ap, 7);
+#test/c/pointer.c:85:     *p = v;
+  mov r8, 7
+  mov DWORD PTR [rbp - 76], r8d
+.L53:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 76]
+  mov r9, r8
+  imul r9, r8
+  cmp r9, 49
+  je .L55
+.L54:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L55:
+#test/c/pointer.c:61:     printf("test of addressing mode..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+#test/c/pointer.c:63:     for(int i = 0; i < 5; i++){
+  lea r8, [rbp - 144]
+  lea r9, [rbp - 104]
+  mov rcx, 0
+.L57:
+  mov rdx, r8
+  add rdx, 24
+  cmp rdx, r9
+  jge .L58
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  mov rdx, rcx
+  imul rdx, rcx
+  add rdx, 1
+  mov QWORD PTR [r8], rdx
+.L59:
+  mov rdx, rcx
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov QWORD PTR [r8 + 8], rsi
+.L60:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov QWORD PTR [r8 + 16], rsi
+.L61:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov QWORD PTR [r8 + 24], rsi
+.L62:
+  add rcx, 4
+  add r8, 32
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L57
+.L58:
+#test/c/pointer.c:64:         la[i] = i * i + 1;
+  mov r8, rcx
+  imul r8, rcx
+  add r8, 1
+  lea rbx, [rbp - 144]
+  mov QWORD PTR [rbp + rcx * 8 - 144], r8
+.L63:
+.L56:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/pointer.c:89:     return a[i + 1] + a[i - 1];
+  mov r8, QWORD PTR [rbp - 136]
+  add r8, QWORD PTR [rbp - 120]
+.L66:
+  cmp r8, 12
+  je .L65
+.L64:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 5
+  sub rsp, 8
+  call am_max
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 17
+  je .L68
+.L67:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L68:
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  lea rbx, [rbp - 224]
+  mov r8, 2
+  mov BYTE PTR [rbp - 224], r8b
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  mov QWORD PTR [rbp - 216], 10
+#test/c/pointer.c:71:     n1.tag = 2; n1.val = 10; n1.next = &n2;
+  lea r8, [rbp - 200]
+  mov QWORD PTR [rbp - 208], r8
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  mov r8, 1
+  mov BYTE PTR [rbp - 200], r8b
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  mov QWORD PTR [rbp - 192], 20
+#test/c/pointer.c:72:     n2.tag = 1; n2.val = 20; n2.next = &n3;
+  lea r8, [rbp - 176]
+  mov QWORD PTR [rbp - 184], r8
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  mov r8, 2
+  mov BYTE PTR [rbp - 176], r8b
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  mov QWORD PTR [rbp - 168], 30
+#test/c/pointer.c:73:     n3.tag = 2; n3.val = 30; n3.next = 0;
+  mov QWORD PTR [rbp - 160], 0
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/pointer.c:94:     while(p){
+  mov r8, rbx
+  mov r9, 0
+.L72:
+  test r8, r8
+  je .L73
+#test/c/pointer.c:95:         if(p->tag == tag){
+  cmp BYTE PTR [r8], 2
+  jne .L74
+#test/c/pointer.c:96:             sum += p->val;
+  add r9, QWORD PTR [r8 + 8]
+.L74:
+#test/c/pointer.c:98:         p = p->next;
+  mov rcx, QWORD PTR [r8 + 16]
+  mov r8, rcx
+  jmp .L72
+.L73:
+#test/c/pointer.c:100:     return sum;
+.L71:
+  cmp r9, 40
+  je .L70
+.L69:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L70:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/pointer.c:94:     while(p){
+  mov r8, 0
+.L78:
+  test rbx, rbx
+  je .L79
+#test/c/pointer.c:95:         if(p->tag == tag){
+  cmp BYTE PTR [rbx], 1
+  jne .L80
+#test/c/pointer.c:96:             sum += p->val;
+  add r8, QWORD PTR [rbx + 8]
+.L80:
+#test/c/pointer.c:98:         p = p->next;
+  mov r9, QWORD PTR [rbx + 16]
+  mov rbx, r9
+  jmp .L78
+.L79:
+#test/c/pointer.c:100:     return sum;
+.L77:
+  cmp r8, 20
+  je .L76
+.L75:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L76:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  sub rsp, 8
+  call am_len
+  add rsp, 8
+  mov r8, rax
+  cmp r8, 7
+  je .L82
+.L81:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L82:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/pointer.c:123:     am_table[i] = i * 3;
+  mov QWORD PTR [rip + am_table + 40], 15
+#test/c/pointer.c:124:     return am_table[i] + am_table[0];
+  mov r8, QWORD PTR [rip + am_table]
+  add r8, QWORD PTR [rip + am_table + 40]
+.L85:
+  cmp r8, 15
+  je .L84
+.L83:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L84:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/pointer.c:123:     am_table[i] = i * 3;
+  mov QWORD PTR [rip + am_table], 0
+#test/c/pointer.c:124:     return am_table[i] + am_table[0];
+  mov r8, QWORD PTR [rip + am_table]
+  mov r9, r8
+  add r9, r8
+.L88:
+  test r9, r9
+  je .L87
+.L86:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rip + am_table + 40], 15
+  je .L90
+.L89:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L90:
+#test/c/pointer.c:81:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_pointer:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,80 @@
+.intel_syntax noprefix
+.global test_preprocess
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of preprocess if directive..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of preprocess if-group..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of preprocess..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_preprocess
+#	 stack size: 16
+#	 func_arg_owner( ofs: 16, size: 4) : level0
+#	 TEST_CIRC_A( ofs: 12, size: 4) : level0
+#	 pp_ans( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_preprocess:
+  push rbp
+  mov rbp, rsp
+#test/c/preprocessor.c:8:     printf("test of preprocess..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/preprocessor.c:10:     a = TEST_MACRO;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L3:
+#test/c/preprocessor.c:14:     printf("test of preprocess if-group..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/preprocessor.c:26:     a = 20;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L5:
+#test/c/preprocessor.c:32:     printf("test of preprocess if directive..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/preprocessor.c:41:     pp_ans = 10;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L7:
+#test/c/preprocessor.c:52:     pp_ans = 20;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L9:
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L11:
+#test/c/preprocessor.c:140: #define TEST_CIRC_C TEST_CIRC_A
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L13:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L15:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L19:
+#test/c/preprocessor.c:163:     OBJLIKE_VACANCY_MACRO;
+#test/c/preprocessor.c:164:     FUNC_ARG_OWNER(OBJLIKE_VACANCY_MACRO);
+#test/c/preprocessor.c:167:     FUNC_MACRO_VACANCY(3);
+#test/c/preprocessor.c:168:     FUNC_MACRO_VACANCY(XXXXXXX_NODEFINED);
+#test/c/preprocessor.c:170:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_preprocess:
+  pop rbp
+  ret
@@ -0,0 +1,270 @@
+.intel_syntax noprefix
+.global add
+.global test_primary
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of initialize..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of character riteral..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of function call..\n"
+  .section .rodata
+.LSTR5:
+  .string "a\0b"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "pool"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "pooled"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "abd"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "abc"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of string literal..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# add
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+add:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  movsxd r9, esi
+#test/c/primary.c:55:     return a + b;
+  add r8, r9
+  mov rax, r8
+ret_add:
+  pop rbp
+  ret
+# test_primary
+#	 stack size: 56
+#	 st2( ofs: 56, size: 8) : level0
+#	 st1( ofs: 48, size: 8) : level0
+#	 val( ofs: 40, size: 8) : level0
+#	 defini( ofs: 28, size: 4) : level0
+#	 s2( ofs: 24, size: 8) : level0
+#	 s1( ofs: 16, size: 8) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_primary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  push rbx
+#test/c/primary.c:6:     printf("test of string literal..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+#test/c/primary.c:8:     c = "abc"[0]; ASSERT(c, 'a');
+  movsx r8, BYTE PTR [rip + .LSTR1]
+# cast st
+  movsx r8, r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 97
+  je .L1
+.L0:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L1:
+#test/c/primary.c:9:     c = "abc"[1]; ASSERT(c, 'b');
+  movsx r8, BYTE PTR [rip + .LSTR1 + 1]
+# cast st
+  movsx r8, r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 98
+  je .L3
+.L2:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L3:
+#test/c/primary.c:10:     c = "abc"[2]; ASSERT(c, 'c');
+  movsx r8, BYTE PTR [rip + .LSTR1 + 2]
+# cast st
+  movsx r8, r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 99
+  je .L5
+.L4:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L5:
+#test/c/primary.c:11:     c = "abc"[3]; ASSERT(c, 0);
+  movsx r8, BYTE PTR [rip + .LSTR1 + 3]
+# cast st
+  movsx r8, r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  test r8, r8
+  je .L7
+.L6:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L7:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L9:
+  lea rbx, [ rip + .LSTR3 ]
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, rbx
+  sete al
+  movzb r8, al
+  cmp r8, 1
+  je .L11
+.L10:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .LSTR4 ]
+  cmp rbx, r8
+  sete al
+  movzb r8, al
+  jne .L13
+.L12:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L13:
+#test/c/primary.c:17:     c = "a\0b"[2]; ASSERT(c, 'b');
+  movsx r8, BYTE PTR [rip + .LSTR5 + 2]
+# cast st
+  movsx r8, r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 98
+  je .L15
+.L14:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L15:
+#test/c/primary.c:19:     printf("test of function call..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/primary.c:55:     return a + b;
+.L18:
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/primary.c:55:     return a + b;
+.L21:
+.L20:
+#test/c/primary.c:23:     printf("test of character riteral..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L23:
+#test/c/primary.c:26:     printf("test of initialize..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L27:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L31:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L37:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L39:
+#test/c/primary.c:39:     printf("test of struct..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  sub rsp, 8
+  call printf
+  add rsp, 8
+#test/c/primary.c:45:     st1.a = 1;
+  lea r9, [rbp - 48]
+  mov r8, 1
+  mov DWORD PTR [rbp - 48], r8d
+#test/c/primary.c:46:     st1.b = 2;
+  mov r8, 2
+  mov DWORD PTR [rbp - 44], r8d
+#test/c/primary.c:47:     st2 = st1;
+  lea rcx, [rbp - 56]
+  mov r8, QWORD PTR [r9 + 0]
+  mov QWORD PTR [rcx + 0], r8
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 56], 1
+  je .L41
+.L40:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L41:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 52], 2
+  je .L43
+.L42:
+  mov rdi, 1
+  sub rsp, 8
+  call exit
+  add rsp, 8
+  mov r8, rax
+.L43:
+#test/c/primary.c:51:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_primary:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,5019 @@
+.intel_syntax noprefix
+.global inv_set_limit
+.global inv_scale
+.global up_count
+.global vec_overlap
+.global vec_ucmax
+.global vec_cmin
+.global vec_max
+.global vec_min
+.global vec_ucsum
+.global vec_csum
+.global vec_sum
+.global vec_map
+.global unroll_heuristic
+.global unroll_full
+.global unroll_down
+.global unroll_jump
+.global unroll_known
+.global unroll_sum
+.global iv_weighted
+.global iv_after
+.global iv_reverse
+.global iv_stride
+.global iv_sum
+.global inv_guard
+.global inv_call
+.global inv_through_ptr
+.global inv_shrink
+.global inv_sum
+.global inv_limit
+.global switch_unsigned
+.global switch_mixed
+.global switch_sparse
+.global switch_dense
+.global in_range
+.global unsigned_less
+.global branch_code
+.global count_up
+.global test_return
+.global test_statement
+  .bss
+  .align 4
+inv_scale:
+  .zero 4
+  .bss
+  .align 4
+up_count:
+  .zero 4
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR17:
+  .string "test of expression statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR16:
+  .string "test of label and goto..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR15:
+  .string "test of loop vectorization..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR14:
+  .string "test of loop unrolling..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR13:
+  .string "abcde"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR12:
+  .string "test of induction variable..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR11:
+  .string "test of loop invariant..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR10:
+  .string "test of switch statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of continue statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of break statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of void statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of compound-statement..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of return-statement...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of condition branch..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "test of if-statement...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of for-statement...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of do-while-statement...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of while-statement...\n"
+  .bss
+  .align 4
+inv_limit:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# inv_set_limit
+#	 stack size: 4
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inv_set_limit:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:502:     inv_limit = n;
+  mov DWORD PTR [rip + inv_limit], r8d
+#test/c/statement.c:503:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_inv_set_limit:
+  pop rbp
+  ret
+# vec_overlap
+#	 stack size: 28
+#	 i( ofs: 24, size: 4) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 8) : level0
+#	 d( ofs: 8, size: 8) : level0
+  .text
+vec_overlap:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  mov r9, rsi
+  movsxd rcx, edx
+#test/c/statement.c:691:     for(int i = 0; i < n; i++){
+  mov rdx, r8
+  sub rdx, r9
+  sub rdx, 1
+  mov rsi, 0
+  cmp rdx, 15
+  jb .L4
+  mov rdx, 1
+  movd xmm0, edx
+  pshufd xmm0, xmm0, 0
+  lea rdx, [r9 + rcx * 4]
+  mov rsi, 0
+  mov rdi, r9
+  mov rbx, r8
+.L0:
+  cmp rdi, rdx
+  jge .L4
+  mov r12, rbx
+  and r12, 15
+  test r12, r12
+  je .L712
+#test/c/statement.c:692:         d[i] = s[i] + 1;
+  movsxd r12, DWORD PTR [rdi]
+  add r12, 1
+  mov DWORD PTR [rbx], r12d
+.L6:
+  add rsi, 1
+  add rbx, 4
+  add rdi, 4
+# cast st
+  movsxd r12, esi
+  mov rsi, r12
+  jmp .L0
+.L712:
+  lea rdx, [r9 + rsi * 4]
+  lea rdi, [r8 + rsi * 4]
+  lea rbx, [r9 + rcx * 4]
+.L1:
+.L2:
+  mov r12, rdx
+  add r12, 12
+  cmp r12, rbx
+  jge .L3
+  movdqu xmm2, [rdx]
+  movdqa xmm1, xmm2
+  paddd xmm1, xmm0
+  movdqu [rdi], xmm1
+  add rsi, 4
+  add rdi, 16
+  add rdx, 16
+# cast st
+  movsxd r12, esi
+  mov rsi, r12
+  jmp .L2
+.L3:
+.L4:
+  lea rdx, [r9 + rsi * 4]
+  lea rsi, [r8 + rsi * 4]
+  lea r9, [r9 + rcx * 4]
+.L7:
+  cmp rdx, r9
+  jge .L5
+#test/c/statement.c:692:         d[i] = s[i] + 1;
+  movsxd rdi, DWORD PTR [rdx]
+  add rdi, 1
+  mov DWORD PTR [rsi], edi
+.L8:
+  add rsi, 4
+  add rdx, 4
+  jmp .L7
+.L5:
+#test/c/statement.c:694:     return d[n - 1];
+  sub rcx, 1
+  movsxd r8, DWORD PTR [r8 + rcx * 4]
+  mov rax, r8
+ret_vec_overlap:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_ucmax
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 13, size: 1) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_ucmax:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:684:     for(int i = 0; i < n; i++){
+  mov rcx, r8
+  add rcx, r9
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L9:
+  cmp rdi, rcx
+  jge .L13
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L10
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+  movzx rbx, BYTE PTR [rdi]
+  cmp rdx, rbx
+  jge .L16
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+# cast st
+  movzx rdx, bl
+.L16:
+.L15:
+  add rsi, 1
+  add rdi, 1
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L9
+.L10:
+  mov rcx, rsi
+  add rcx, 15
+  cmp rcx, r9
+  jge .L13
+  movdqu xmm0, [rdi]
+  add rsi, 16
+# cast st
+  movsxd rcx, esi
+  mov rdi, r8
+  add rdi, rcx
+  mov rbx, r8
+  add rbx, r9
+.L11:
+  mov r12, rdi
+  add r12, 15
+  cmp r12, rbx
+  jge .L12
+  movdqu xmm1, [rdi]
+  pmaxub xmm0, xmm1
+  add rcx, 16
+  add rdi, 16
+# cast st
+  movsxd r12, ecx
+  mov rcx, r12
+  jmp .L11
+.L12:
+  pshufd xmm13, xmm0, 0x4e
+  pmaxub xmm0, xmm13
+  pshufd xmm13, xmm0, 0xb1
+  pmaxub xmm0, xmm13
+  movdqa xmm13, xmm0
+  psrld xmm13, 16
+  pmaxub xmm0, xmm13
+  movdqa xmm13, xmm0
+  psrlw xmm13, 8
+  pmaxub xmm0, xmm13
+  movd eax, xmm0
+  movzx rdi, al
+  mov rsi, rcx
+  cmp rdi, rdx
+  jle .L17
+# cast st
+  movzx rdx, dil
+  mov rsi, rcx
+.L17:
+.L13:
+  mov rcx, r8
+  add rcx, rsi
+  add r8, r9
+.L18:
+  cmp rcx, r8
+  jge .L14
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+  movzx r9, BYTE PTR [rcx]
+  cmp rdx, r9
+  jge .L20
+#test/c/statement.c:685:         if(m < a[i]) m = a[i];
+# cast st
+  movzx rdx, r9b
+.L20:
+.L19:
+  add rcx, 1
+  jmp .L18
+.L14:
+#test/c/statement.c:687:     return m;
+  mov rax, rdx
+ret_vec_ucmax:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_cmin
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_cmin:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:676:     for(int i = 0; i < n; i++){
+  mov rcx, r8
+  add rcx, r9
+  mov rdx, 1000
+  mov rsi, 0
+  mov rdi, r8
+.L21:
+  cmp rdi, rcx
+  jge .L25
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L22
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+  movsx rbx, BYTE PTR [rdi]
+  cmp rbx, rdx
+  jge .L28
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+# cast st
+  movsxd rdx, ebx
+.L28:
+.L27:
+  add rsi, 1
+  add rdi, 1
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L21
+.L22:
+  mov rcx, rsi
+  add rcx, 15
+  cmp rcx, r9
+  jge .L25
+  movdqu xmm0, [rdi]
+  add rsi, 16
+# cast st
+  movsxd rcx, esi
+  mov rdi, r8
+  add rdi, rcx
+  mov rbx, r8
+  add rbx, r9
+.L23:
+  mov r12, rdi
+  add r12, 15
+  cmp r12, rbx
+  jge .L24
+  movdqu xmm1, [rdi]
+  movdqa xmm15, xmm0
+  pcmpgtb xmm15, xmm1
+  movdqa xmm14, xmm15
+  pand xmm14, xmm1
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  add rcx, 16
+  add rdi, 16
+# cast st
+  movsxd r12, ecx
+  mov rcx, r12
+  jmp .L23
+.L24:
+  pshufd xmm13, xmm0, 0x4e
+  movdqa xmm15, xmm0
+  pcmpgtb xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  pshufd xmm13, xmm0, 0xb1
+  movdqa xmm15, xmm0
+  pcmpgtb xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movdqa xmm13, xmm0
+  psrld xmm13, 16
+  movdqa xmm15, xmm0
+  pcmpgtb xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movdqa xmm13, xmm0
+  psrlw xmm13, 8
+  movdqa xmm15, xmm0
+  pcmpgtb xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movd eax, xmm0
+  movsx rdi, al
+  mov rsi, rcx
+  cmp rdi, rdx
+  jge .L29
+# cast st
+  movsxd rdx, edi
+  mov rsi, rcx
+.L29:
+.L25:
+  mov rcx, r8
+  add rcx, rsi
+  add r8, r9
+.L30:
+  cmp rcx, r8
+  jge .L26
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+  movsx r9, BYTE PTR [rcx]
+  cmp r9, rdx
+  jge .L32
+#test/c/statement.c:677:         if(a[i] < m) m = a[i];
+# cast st
+  movsxd rdx, r9d
+.L32:
+.L31:
+  add rcx, 1
+  jmp .L30
+.L26:
+#test/c/statement.c:679:     return m;
+  mov rax, rdx
+ret_vec_cmin:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_max
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_max:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:668:     for(int i = 0; i < n; i++){
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 18446744073709541616
+  mov rsi, 0
+  mov rdi, r8
+.L33:
+  cmp rdi, rcx
+  jge .L37
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L34
+#test/c/statement.c:669:         m = m < a[i] ? a[i] : m;
+  movsxd rbx, DWORD PTR [rdi]
+  cmp rdx, rbx
+  jl .L41
+.L40:
+  mov rbx, rdx
+.L41:
+# cast st
+  movsxd rdx, ebx
+.L39:
+  add rsi, 1
+  add rdi, 4
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L33
+.L34:
+  mov rcx, rsi
+  add rcx, 3
+  cmp rcx, r9
+  jge .L37
+  movdqu xmm0, [rdi]
+  add rsi, 4
+# cast st
+  movsxd rcx, esi
+  lea rdi, [r8 + rcx * 4]
+  lea rbx, [r8 + r9 * 4]
+.L35:
+  mov r12, rdi
+  add r12, 12
+  cmp r12, rbx
+  jge .L36
+  movdqu xmm1, [rdi]
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm1
+  movdqa xmm14, xmm15
+  pand xmm14, xmm0
+  pandn xmm15, xmm1
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  add rcx, 4
+  add rdi, 16
+# cast st
+  movsxd r12, ecx
+  mov rcx, r12
+  jmp .L35
+.L36:
+  pshufd xmm13, xmm0, 0x4e
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm0
+  pandn xmm15, xmm13
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  pshufd xmm13, xmm0, 0xb1
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm0
+  pandn xmm15, xmm13
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movd eax, xmm0
+  movsxd rdi, eax
+  mov rsi, rcx
+  cmp rdi, rdx
+  jle .L42
+# cast st
+  movsxd rdx, edi
+  mov rsi, rcx
+.L42:
+.L37:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L43:
+  cmp rcx, r8
+  jge .L38
+#test/c/statement.c:669:         m = m < a[i] ? a[i] : m;
+  movsxd r9, DWORD PTR [rcx]
+  cmp rdx, r9
+  jl .L46
+.L45:
+  mov r9, rdx
+.L46:
+# cast st
+  movsxd rdx, r9d
+.L44:
+  add rcx, 4
+  jmp .L43
+.L38:
+#test/c/statement.c:671:     return m;
+  mov rax, rdx
+ret_vec_max:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_min
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 m( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_min:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:658:     for(int i = 0; i < n; i++){
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 10000
+  mov rsi, 0
+  mov rdi, r8
+.L47:
+  cmp rdi, rcx
+  jge .L51
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L48
+#test/c/statement.c:659:         if(a[i] < m){
+  movsxd rbx, DWORD PTR [rdi]
+  cmp rbx, rdx
+  jge .L54
+#test/c/statement.c:660:             m = a[i];
+# cast st
+  movsxd rdx, ebx
+.L54:
+.L53:
+  add rsi, 1
+  add rdi, 4
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L47
+.L48:
+  mov rcx, rsi
+  add rcx, 3
+  cmp rcx, r9
+  jge .L51
+  movdqu xmm0, [rdi]
+  add rsi, 4
+# cast st
+  movsxd rcx, esi
+  lea rdi, [r8 + rcx * 4]
+  lea rbx, [r8 + r9 * 4]
+.L49:
+  mov r12, rdi
+  add r12, 12
+  cmp r12, rbx
+  jge .L50
+  movdqu xmm1, [rdi]
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm1
+  movdqa xmm14, xmm15
+  pand xmm14, xmm1
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  add rcx, 4
+  add rdi, 16
+# cast st
+  movsxd r12, ecx
+  mov rcx, r12
+  jmp .L49
+.L50:
+  pshufd xmm13, xmm0, 0x4e
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  pshufd xmm13, xmm0, 0xb1
+  movdqa xmm15, xmm0
+  pcmpgtd xmm15, xmm13
+  movdqa xmm14, xmm15
+  pand xmm14, xmm13
+  pandn xmm15, xmm0
+  por xmm15, xmm14
+  movdqa xmm0, xmm15
+  movd eax, xmm0
+  movsxd rdi, eax
+  mov rsi, rcx
+  cmp rdi, rdx
+  jge .L55
+# cast st
+  movsxd rdx, edi
+  mov rsi, rcx
+.L55:
+.L51:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L56:
+  cmp rcx, r8
+  jge .L52
+#test/c/statement.c:659:         if(a[i] < m){
+  movsxd r9, DWORD PTR [rcx]
+  cmp r9, rdx
+  jge .L58
+#test/c/statement.c:660:             m = a[i];
+# cast st
+  movsxd rdx, r9d
+.L58:
+.L57:
+  add rcx, 4
+  jmp .L56
+.L52:
+#test/c/statement.c:663:     return m;
+  mov rax, rdx
+ret_vec_min:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_ucsum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_ucsum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:650:     for(int i = 0; i < n; i++){
+  mov rcx, 0
+  movq xmm0, rcx
+  punpcklqdq xmm0, xmm0
+  mov rcx, 0
+  movq xmm1, rcx
+  punpcklqdq xmm1, xmm1
+  mov rcx, r8
+  add rcx, r9
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L59:
+  cmp rdi, rcx
+  jge .L63
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L713
+#test/c/statement.c:651:         s = s + a[i];
+  movzx rbx, BYTE PTR [rdi]
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L65:
+  add rsi, 1
+  add rdi, 1
+# cast st
+  movsxd r12, esi
+  mov rdx, rbx
+  mov rsi, r12
+  jmp .L59
+.L713:
+  mov rcx, r8
+  add rcx, rsi
+  mov rdi, r8
+  add rdi, r9
+.L60:
+.L61:
+  mov rbx, rcx
+  add rbx, 15
+  cmp rbx, rdi
+  jge .L62
+  movdqu xmm2, [rcx]
+  movdqa xmm3, xmm2
+  psadbw xmm3, xmm1
+  paddq xmm0, xmm3
+  add rsi, 16
+  add rcx, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L61
+.L62:
+  pshufd xmm13, xmm0, 0x4e
+  paddq xmm0, xmm13
+  movq rcx, xmm0
+  add rdx, rcx
+# cast st
+  movsxd rcx, edx
+  mov rdx, rcx
+.L63:
+  mov rcx, r8
+  add rcx, rsi
+  add r8, r9
+.L66:
+  cmp rcx, r8
+  jge .L64
+#test/c/statement.c:651:         s = s + a[i];
+  movzx r9, BYTE PTR [rcx]
+  add rdx, r9
+# cast st
+  movsxd r9, edx
+.L67:
+  add rcx, 1
+  mov rdx, r9
+  jmp .L66
+.L64:
+#test/c/statement.c:653:     return s;
+  mov rax, rdx
+ret_vec_ucsum:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_csum
+#	 stack size: 32
+#	 i( ofs: 28, size: 4) : level0
+#	 s( ofs: 24, size: 8) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_csum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:642:     for(int i = 0; i < n; i++){
+  mov rcx, 0
+  movq xmm0, rcx
+  punpcklqdq xmm0, xmm0
+  mov rcx, 0
+  movq xmm1, rcx
+  punpcklqdq xmm1, xmm1
+  mov rcx, 128
+  movd xmm2, ecx
+  punpcklbw xmm2, xmm2
+  punpcklwd xmm2, xmm2
+  pshufd xmm2, xmm2, 0
+  mov rcx, 1024
+  movq xmm3, rcx
+  punpcklqdq xmm3, xmm3
+  mov rcx, r8
+  add rcx, r9
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L68:
+  cmp rdi, rcx
+  jge .L72
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L714
+#test/c/statement.c:643:         s += a[i];
+  movsx rbx, BYTE PTR [rdi]
+  add rdx, rbx
+.L74:
+  add rsi, 1
+  add rdi, 1
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L68
+.L714:
+  mov rcx, r8
+  add rcx, rsi
+  mov rdi, r8
+  add rdi, r9
+.L69:
+.L70:
+  mov rbx, rcx
+  add rbx, 15
+  cmp rbx, rdi
+  jge .L71
+  movdqu xmm4, [rcx]
+  pxor xmm4, xmm2
+  movdqa xmm5, xmm4
+  psadbw xmm5, xmm1
+  psubq xmm5, xmm3
+  paddq xmm0, xmm5
+  add rsi, 16
+  add rcx, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L70
+.L71:
+  pshufd xmm13, xmm0, 0x4e
+  paddq xmm0, xmm13
+  movq rcx, xmm0
+  add rdx, rcx
+.L72:
+  mov rcx, r8
+  add rcx, rsi
+  add r8, r9
+.L75:
+  cmp rcx, r8
+  jge .L73
+#test/c/statement.c:643:         s += a[i];
+  movsx r9, BYTE PTR [rcx]
+  add rdx, r9
+.L76:
+  add rcx, 1
+  jmp .L75
+.L73:
+#test/c/statement.c:645:     return s;
+  mov rax, rdx
+ret_vec_csum:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+vec_sum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:634:     for(int i = 0; i < n; i++){
+  mov rcx, 0
+  movd xmm0, ecx
+  pshufd xmm0, xmm0, 0
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L77:
+  cmp rdi, rcx
+  jge .L81
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L715
+#test/c/statement.c:635:         s += a[i];
+  movsxd rbx, DWORD PTR [rdi]
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L83:
+  add rsi, 1
+  add rdi, 4
+# cast st
+  movsxd r12, esi
+  mov rdx, rbx
+  mov rsi, r12
+  jmp .L77
+.L715:
+  lea rcx, [r8 + rsi * 4]
+  lea rdi, [r8 + r9 * 4]
+.L78:
+.L79:
+  mov rbx, rcx
+  add rbx, 12
+  cmp rbx, rdi
+  jge .L80
+  movdqu xmm1, [rcx]
+  paddd xmm0, xmm1
+  add rsi, 4
+  add rcx, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L79
+.L80:
+  pshufd xmm13, xmm0, 0x4e
+  paddd xmm0, xmm13
+  pshufd xmm13, xmm0, 0xb1
+  paddd xmm0, xmm13
+  movd eax, xmm0
+  movsxd rcx, eax
+  add rdx, rcx
+# cast st
+  movsxd rcx, edx
+  mov rdx, rcx
+.L81:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L84:
+  cmp rcx, r8
+  jge .L82
+#test/c/statement.c:635:         s += a[i];
+  movsxd r9, DWORD PTR [rcx]
+  add rdx, r9
+# cast st
+  movsxd r9, edx
+.L85:
+  add rcx, 4
+  mov rdx, r9
+  jmp .L84
+.L82:
+#test/c/statement.c:637:     return s;
+  mov rax, rdx
+ret_vec_sum:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# vec_map
+#	 stack size: 44
+#	 i( ofs: 40, size: 4) : level0
+#	 h( ofs: 36, size: 4) : level0
+#	 i( ofs: 28, size: 4) : level0
+#	 k( ofs: 24, size: 4) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 8) : level0
+#	 d( ofs: 8, size: 8) : level0
+  .text
+vec_map:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  push r14
+  mov r8, rdi
+  mov r9, rsi
+  movsxd rdx, edx
+  movsxd rcx, ecx
+#test/c/statement.c:622:     for(int i = 0; i < n; i++){
+  mov rsi, r8
+  sub rsi, r9
+  sub rsi, 1
+  mov rdi, 0
+  cmp rsi, 15
+  jb .L90
+  mov rdi, 0
+  cmp rsi, 15
+  jb .L90
+  movd xmm0, ecx
+  pshufd xmm0, xmm0, 0
+  lea rsi, [r9 + rdx * 4]
+  mov rdi, 0
+  mov rbx, r9
+  mov r12, r8
+.L86:
+  cmp rbx, rsi
+  jge .L90
+  mov r13, r12
+  and r13, 15
+  test r13, r13
+  je .L716
+#test/c/statement.c:623:         d[i] = (s[i] << 2) - s[i] + k;
+  movsxd r13, DWORD PTR [rbx]
+  mov r14, r13
+  sal r14, 2
+  sub r14, r13
+  add r14, rcx
+  mov DWORD PTR [r12], r14d
+.L92:
+  add rdi, 1
+  add r12, 4
+  add rbx, 4
+# cast st
+  movsxd r13, edi
+  mov rdi, r13
+  jmp .L86
+.L716:
+  lea rsi, [r9 + rdi * 4]
+  lea rbx, [r8 + rdi * 4]
+  lea r12, [r9 + rdx * 4]
+.L87:
+.L88:
+  mov r13, rsi
+  add r13, 12
+  cmp r13, r12
+  jge .L89
+  movdqu xmm4, [rsi]
+  movdqa xmm3, xmm4
+  pslld xmm3, 2
+  movdqu xmm5, [rsi]
+  movdqa xmm2, xmm3
+  psubd xmm2, xmm5
+  movdqa xmm1, xmm2
+  paddd xmm1, xmm0
+  movdqu [rbx], xmm1
+  add rdi, 4
+  add rbx, 16
+  add rsi, 16
+# cast st
+  movsxd r13, edi
+  mov rdi, r13
+  jmp .L88
+.L89:
+.L90:
+  lea rsi, [r9 + rdi * 4]
+  lea rdi, [r8 + rdi * 4]
+  lea r9, [r9 + rdx * 4]
+.L93:
+  cmp rsi, r9
+  jge .L91
+#test/c/statement.c:623:         d[i] = (s[i] << 2) - s[i] + k;
+  movsxd rbx, DWORD PTR [rsi]
+  mov r12, rbx
+  sal r12, 2
+  sub r12, rbx
+  add r12, rcx
+  mov DWORD PTR [rdi], r12d
+.L94:
+  add rdi, 4
+  add rsi, 4
+  jmp .L93
+.L91:
+#test/c/statement.c:626:     for(int i = 0; i < n; i++){
+  lea r9, [r8 + rdx * 4]
+  mov rcx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L96:
+  mov rbx, rdi
+  add rbx, 12
+  cmp rbx, r9
+  jge .L717
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea rcx, [rcx + rcx * 2]
+  movsxd rbx, DWORD PTR [rdi]
+  add rcx, rbx
+# cast st
+  movsxd rbx, ecx
+.L98:
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea rbx, [rbx + rbx * 2]
+  movsxd r12, DWORD PTR [rdi + 4]
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L99:
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea rbx, [rbx + rbx * 2]
+  movsxd r12, DWORD PTR [rdi + 8]
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L100:
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea rbx, [rbx + rbx * 2]
+  movsxd r12, DWORD PTR [rdi + 12]
+  add rbx, r12
+# cast st
+  movsxd rcx, ebx
+.L101:
+  add rsi, 4
+  add rdi, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L96
+.L717:
+  lea r9, [r8 + rsi * 4]
+  lea r8, [r8 + rdx * 4]
+.L97:
+.L102:
+  cmp r9, r8
+  jge .L95
+#test/c/statement.c:627:         h = h * 3 + d[i];
+  lea rcx, [rcx + rcx * 2]
+  movsxd rdx, DWORD PTR [r9]
+  add rcx, rdx
+# cast st
+  movsxd rdx, ecx
+.L103:
+  add r9, 4
+  mov rcx, rdx
+  jmp .L102
+.L95:
+#test/c/statement.c:629:     return h;
+  mov rax, rcx
+ret_vec_map:
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_heuristic
+#	 stack size: 28
+#	 i( ofs: 24, size: 4) : level0
+#	 s( ofs: 20, size: 4) : level0
+#	 k( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+unroll_heuristic:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  mov r8, rdi
+  movsxd r9, esi
+  movsxd rcx, edx
+#test/c/statement.c:615:     for(int i = 1; i < n - k; i++){
+  sub r9, rcx
+  mov rcx, r8
+  add rcx, 4
+  lea rdx, [r8 + r9 * 4]
+  mov rsi, 0
+  mov rdi, 1
+.L105:
+  mov rbx, rcx
+  add rbx, 12
+  cmp rbx, rdx
+  jge .L718
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  movsxd rbx, DWORD PTR [rcx]
+  movsxd r12, DWORD PTR [rcx - 4]
+  sub rbx, r12
+  add rsi, rbx
+# cast st
+  movsxd rbx, esi
+.L107:
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  movsxd r12, DWORD PTR [rcx + 4]
+  movsxd r13, DWORD PTR [rcx]
+  sub r12, r13
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L108:
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  movsxd r12, DWORD PTR [rcx + 8]
+  movsxd r13, DWORD PTR [rcx + 4]
+  sub r12, r13
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L109:
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  movsxd r12, DWORD PTR [rcx + 12]
+  movsxd r13, DWORD PTR [rcx + 8]
+  sub r12, r13
+  add rbx, r12
+# cast st
+  movsxd rsi, ebx
+.L110:
+  add rdi, 4
+  add rcx, 16
+# cast st
+  movsxd rbx, edi
+  mov rdi, rbx
+  jmp .L105
+.L718:
+  lea rcx, [r8 + rdi * 4]
+  lea r8, [r8 + r9 * 4]
+.L106:
+.L111:
+  cmp rcx, r8
+  jge .L104
+#test/c/statement.c:616:         s += a[i] - a[i - 1];
+  movsxd r9, DWORD PTR [rcx]
+  movsxd rdx, DWORD PTR [rcx - 4]
+  sub r9, rdx
+  add rsi, r9
+# cast st
+  movsxd r9, esi
+.L112:
+  add rcx, 4
+  mov rsi, r9
+  jmp .L111
+.L104:
+#test/c/statement.c:618:     return s;
+  mov rax, rsi
+ret_unroll_heuristic:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_full
+#	 stack size: 16
+#	 i( ofs: 16, size: 8) : level0
+#	 s( ofs: 4, size: 4) : level0
+  .text
+unroll_full:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:607:     for(long i = 1; i <= 3; ++i){
+#test/c/statement.c:608:         s = s * 10 + i;
+.L114:
+#test/c/statement.c:608:         s = s * 10 + i;
+.L115:
+#test/c/statement.c:608:         s = s * 10 + i;
+.L116:
+.L113:
+#test/c/statement.c:610:     return s;
+  mov r8, 123
+  mov rax, r8
+ret_unroll_full:
+  pop rbp
+  ret
+# unroll_down
+#	 stack size: 12
+#	 i( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+unroll_down:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:598:     for(i = n; i >= 0; i -= 3){
+# cast st
+  movsxd r8, r8d
+  mov r9, 0
+.L118:
+  mov rcx, r8
+  add rcx, 18446744073709551613
+  mov rdx, 0
+  cmp rdx, rcx
+  jg .L719
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r9, [r9 + r9 * 2]
+  add r9, r8
+# cast st
+  movsxd rcx, r9d
+.L120:
+  mov rdx, r8
+  sub rdx, 3
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea rcx, [rcx + rcx * 2]
+  add rcx, rdx
+# cast st
+  movsxd r9, ecx
+.L121:
+  add r8, 18446744073709551610
+# cast st
+  movsxd rcx, r8d
+  mov r8, rcx
+  jmp .L118
+.L719:
+.L119:
+.L122:
+  mov rcx, 0
+  cmp rcx, r8
+  jg .L117
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r9, [r9 + r9 * 2]
+  add r9, r8
+# cast st
+  movsxd rcx, r9d
+.L123:
+  sub r8, 3
+# cast st
+  movsxd rdx, r8d
+  mov r9, rcx
+  mov r8, rdx
+  jmp .L122
+.L117:
+#test/c/statement.c:601:     return s + i;
+  add r9, r8
+  mov rax, r9
+ret_unroll_down:
+  pop rbp
+  ret
+# unroll_jump
+#	 stack size: 16
+#	 i( ofs: 12, size: 4) : level0
+#	 s( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+unroll_jump:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  movsxd r8, edi
+#test/c/statement.c:586:     for(int i = 0; i < n; i++){
+  mov r9, 0
+  mov rcx, 0
+.L125:
+  mov rdx, rcx
+  add rdx, 3
+  cmp rdx, r8
+  jge .L720
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  mov rsi, rcx
+  mov rdi, 6148914691236517206
+  mov rax, rsi
+  imul rdi
+  mov rsi, rdx
+  shr rdx, 63
+  add rsi, rdx
+  lea rsi, [rsi + rsi * 2]
+  mov rdx, rcx
+  sub rdx, rsi
+  test rdx, rdx
+  je .L127
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+.L128:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  cmp rcx, 11
+  je .L124
+#test/c/statement.c:588:         if(i == 11) break;
+.L129:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+  mov r9, rdx
+.L127:
+  mov rdx, rcx
+  add rdx, 1
+# cast st
+  movsxd rsi, edx
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  mov rdi, rsi
+  mov rbx, 6148914691236517206
+  mov rax, rdi
+  imul rbx
+  mov rdi, rdx
+  shr rdx, 63
+  add rdi, rdx
+  lea rdi, [rdi + rdi * 2]
+  mov rdx, rsi
+  sub rdx, rdi
+  test rdx, rdx
+  je .L130
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+.L131:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  cmp rsi, 11
+  je .L124
+#test/c/statement.c:588:         if(i == 11) break;
+.L132:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  add r9, rsi
+# cast st
+  movsxd rdx, r9d
+  mov r9, rdx
+.L130:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  mov rdi, rsi
+  mov rbx, 6148914691236517206
+  mov rax, rdi
+  imul rbx
+  mov rdi, rdx
+  shr rdx, 63
+  add rdi, rdx
+  lea rdi, [rdi + rdi * 2]
+  mov rdx, rsi
+  sub rdx, rdi
+  test rdx, rdx
+  je .L133
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+.L134:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  cmp rsi, 11
+  je .L124
+#test/c/statement.c:588:         if(i == 11) break;
+.L135:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  add r9, rsi
+# cast st
+  movsxd rdx, r9d
+  mov r9, rdx
+.L133:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  mov rdi, rsi
+  mov rbx, 6148914691236517206
+  mov rax, rdi
+  imul rbx
+  mov rdi, rdx
+  shr rdx, 63
+  add rdi, rdx
+  lea rdi, [rdi + rdi * 2]
+  mov rdx, rsi
+  sub rdx, rdi
+  test rdx, rdx
+  je .L136
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+.L137:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  cmp rsi, 11
+  je .L124
+#test/c/statement.c:588:         if(i == 11) break;
+.L138:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  add r9, rsi
+# cast st
+  movsxd rdx, r9d
+  mov r9, rdx
+.L136:
+  add rcx, 4
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L125
+.L720:
+.L126:
+.L139:
+  cmp rcx, r8
+  jge .L124
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+  mov rsi, rcx
+  mov rdi, 6148914691236517206
+  mov rax, rsi
+  imul rdi
+  mov rsi, rdx
+  shr rdx, 63
+  add rsi, rdx
+  lea rsi, [rsi + rsi * 2]
+  mov rdx, rcx
+  sub rdx, rsi
+  test rdx, rdx
+  je .L140
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+.L141:
+#test/c/statement.c:587:         if(i % 3 == 0) continue;
+#test/c/statement.c:588:         if(i == 11) break;
+  cmp rcx, 11
+  je .L124
+#test/c/statement.c:588:         if(i == 11) break;
+.L142:
+#test/c/statement.c:588:         if(i == 11) break;
+#test/c/statement.c:589:         s += i;
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+  mov r9, rdx
+.L140:
+  add rcx, 1
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L139
+.L124:
+#test/c/statement.c:591:     return s;
+  mov rax, r9
+ret_unroll_jump:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# unroll_known
+#	 stack size: 12
+#	 i( ofs: 8, size: 4) : level0
+#	 s( ofs: 4, size: 4) : level0
+  .text
+unroll_known:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:577:     for(int i = 0; i < 10; i++){
+  mov r8, 0
+  mov r9, 0
+.L144:
+  mov rcx, r9
+  add rcx, 2
+  cmp rcx, 10
+  jge .L145
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea rcx, [r9 + r8 * 2]
+# cast st
+  movsxd rcx, ecx
+.L146:
+  mov rdx, r9
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea rcx, [rdx + rcx * 2]
+# cast st
+  movsxd rcx, ecx
+.L147:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea rcx, [rdx + rcx * 2]
+# cast st
+  movsxd r8, ecx
+.L148:
+  add r9, 3
+# cast st
+  movsxd rcx, r9d
+  mov r9, rcx
+  jmp .L144
+.L145:
+#test/c/statement.c:578:         s = s * 2 + i;
+  lea r8, [r9 + r8 * 2]
+# cast st
+  movsxd r8, r8d
+.L149:
+.L143:
+#test/c/statement.c:580:     return s;
+  mov rax, r8
+ret_unroll_known:
+  pop rbp
+  ret
+# unroll_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+unroll_sum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:568:     for(int i = 0; i < n; i++){
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L151:
+  mov rbx, rdi
+  add rbx, 12
+  cmp rbx, rcx
+  jge .L721
+#test/c/statement.c:569:         s += a[i];
+  movsxd rbx, DWORD PTR [rdi]
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L153:
+#test/c/statement.c:569:         s += a[i];
+  movsxd r12, DWORD PTR [rdi + 4]
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L154:
+#test/c/statement.c:569:         s += a[i];
+  movsxd r12, DWORD PTR [rdi + 8]
+  add rbx, r12
+# cast st
+  movsxd rbx, ebx
+.L155:
+#test/c/statement.c:569:         s += a[i];
+  movsxd r12, DWORD PTR [rdi + 12]
+  add rbx, r12
+# cast st
+  movsxd rdx, ebx
+.L156:
+  add rsi, 4
+  add rdi, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L151
+.L721:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L152:
+.L157:
+  cmp rcx, r8
+  jge .L150
+#test/c/statement.c:569:         s += a[i];
+  movsxd r9, DWORD PTR [rcx]
+  add rdx, r9
+# cast st
+  movsxd r9, edx
+.L158:
+  add rcx, 4
+  mov rdx, r9
+  jmp .L157
+.L150:
+#test/c/statement.c:571:     return s;
+  mov rax, rdx
+ret_unroll_sum:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_weighted
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_weighted:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:559:     for(int i = 0; i < n; i++){
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L160:
+  mov rbx, rdi
+  add rbx, 12
+  cmp rbx, rcx
+  jge .L722
+#test/c/statement.c:560:         s += a[i] * i;
+  movsxd rbx, DWORD PTR [rdi]
+  imul rbx, rsi
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L162:
+  mov r12, rsi
+  add r12, 1
+# cast st
+  movsxd r12, r12d
+#test/c/statement.c:560:         s += a[i] * i;
+  movsxd r13, DWORD PTR [rdi + 4]
+  imul r13, r12
+  add rbx, r13
+# cast st
+  movsxd rbx, ebx
+.L163:
+  add r12, 1
+# cast st
+  movsxd r12, r12d
+#test/c/statement.c:560:         s += a[i] * i;
+  movsxd r13, DWORD PTR [rdi + 8]
+  imul r13, r12
+  add rbx, r13
+# cast st
+  movsxd rbx, ebx
+.L164:
+  add r12, 1
+# cast st
+  movsxd r12, r12d
+#test/c/statement.c:560:         s += a[i] * i;
+  movsxd r13, DWORD PTR [rdi + 12]
+  imul r13, r12
+  add rbx, r13
+# cast st
+  movsxd rdx, ebx
+.L165:
+  add rsi, 4
+  add rdi, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L160
+.L722:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L161:
+.L166:
+  cmp rcx, r8
+  jge .L159
+#test/c/statement.c:560:         s += a[i] * i;
+  movsxd rdi, DWORD PTR [rcx]
+  imul rdi, rsi
+  add rdx, rdi
+# cast st
+  movsxd rdi, edx
+.L167:
+  add rsi, 1
+  add rcx, 4
+# cast st
+  movsxd rbx, esi
+  mov rdx, rdi
+  mov rsi, rbx
+  jmp .L166
+.L159:
+#test/c/statement.c:562:     return s + n;
+  add rdx, r9
+  mov rax, rdx
+ret_iv_weighted:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_after
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 str( ofs: 8, size: 8) : level0
+  .text
+iv_after:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:551:     for(i = 0; i < n; i++){
+  mov rcx, 0
+  movq xmm0, rcx
+  punpcklqdq xmm0, xmm0
+  mov rcx, 0
+  movq xmm1, rcx
+  punpcklqdq xmm1, xmm1
+  mov rcx, 128
+  movd xmm2, ecx
+  punpcklbw xmm2, xmm2
+  punpcklwd xmm2, xmm2
+  pshufd xmm2, xmm2, 0
+  mov rcx, 1024
+  movq xmm3, rcx
+  punpcklqdq xmm3, xmm3
+  mov rcx, r8
+  add rcx, r9
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L168:
+  cmp rdi, rcx
+  jge .L172
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L723
+#test/c/statement.c:552:         s += str[i];
+  movsx rbx, BYTE PTR [rdi]
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L174:
+  add rsi, 1
+  add rdi, 1
+# cast st
+  movsxd r12, esi
+  mov rdx, rbx
+  mov rsi, r12
+  jmp .L168
+.L723:
+  mov rcx, r8
+  add rcx, rsi
+  mov rdi, r8
+  add rdi, r9
+.L169:
+.L170:
+  mov rbx, rcx
+  add rbx, 15
+  cmp rbx, rdi
+  jge .L171
+  movdqu xmm4, [rcx]
+  pxor xmm4, xmm2
+  movdqa xmm5, xmm4
+  psadbw xmm5, xmm1
+  psubq xmm5, xmm3
+  paddq xmm0, xmm5
+  add rsi, 16
+  add rcx, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L170
+.L171:
+  pshufd xmm13, xmm0, 0x4e
+  paddq xmm0, xmm13
+  movq rcx, xmm0
+  add rdx, rcx
+# cast st
+  movsxd rcx, edx
+  mov rdx, rcx
+.L172:
+  mov rcx, r8
+  add rcx, rsi
+  add r8, r9
+.L175:
+  cmp rcx, r8
+  jge .L173
+#test/c/statement.c:552:         s += str[i];
+  movsx r9, BYTE PTR [rcx]
+  add rdx, r9
+# cast st
+  movsxd r9, edx
+.L176:
+  add rsi, 1
+  add rcx, 1
+# cast st
+  movsxd rdi, esi
+  mov rdx, r9
+  mov rsi, rdi
+  jmp .L175
+.L173:
+#test/c/statement.c:554:     return s + i;
+  add rdx, rsi
+  mov rax, rdx
+ret_iv_after:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_reverse
+#	 stack size: 60
+#	 i( ofs: 56, size: 4) : level0
+#	 t( ofs: 52, size: 4) : level0
+#	 i( ofs: 44, size: 4) : level0
+#	 arr( ofs: 40, size: 40) : level0
+  .text
+iv_reverse:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  lea r8, [rbp - 40]
+  lea r9, [rbp]
+  mov rcx, 0
+.L178:
+  mov rdx, r8
+  add rdx, 12
+  cmp rdx, r9
+  jge .L179
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov rdx, rcx
+  imul rdx, rcx
+  mov DWORD PTR [r8], edx
+.L180:
+  mov rdx, rcx
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov rsi, rdx
+  imul rsi, rdx
+  mov DWORD PTR [r8 + 4], esi
+.L181:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov rsi, rdx
+  imul rsi, rdx
+  mov DWORD PTR [r8 + 8], esi
+.L182:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov rsi, rdx
+  imul rsi, rdx
+  mov DWORD PTR [r8 + 12], esi
+.L183:
+  add rcx, 4
+  add r8, 16
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L178
+.L179:
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov r8, rcx
+  imul r8, rcx
+  lea r9, [rbp - 40]
+  mov DWORD PTR [rbp + rcx * 4 - 40], r8d
+.L184:
+  add rcx, 1
+# cast st
+  movsxd r8, ecx
+#test/c/statement.c:542:     for(int i = 0; i < 10; i++) arr[i] = i * i;
+  mov rcx, r8
+  imul rcx, r8
+  mov DWORD PTR [rbp + r8 * 4 - 40], ecx
+.L185:
+.L177:
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea r8, [rbp - 4]
+  mov rcx, 0
+  mov rdx, 9
+.L187:
+  mov rsi, r8
+  add rsi, 18446744073709551604
+  cmp r9, rsi
+  jg .L188
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea rcx, [rcx + rcx * 2]
+  movsxd rsi, DWORD PTR [r8]
+  add rcx, rsi
+# cast st
+  movsxd rsi, ecx
+.L189:
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea rsi, [rsi + rsi * 2]
+  movsxd rdi, DWORD PTR [r8 - 4]
+  add rsi, rdi
+# cast st
+  movsxd rsi, esi
+.L190:
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea rsi, [rsi + rsi * 2]
+  movsxd rdi, DWORD PTR [r8 - 8]
+  add rsi, rdi
+# cast st
+  movsxd rsi, esi
+.L191:
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea rsi, [rsi + rsi * 2]
+  movsxd rdi, DWORD PTR [r8 - 12]
+  add rsi, rdi
+# cast st
+  movsxd rcx, esi
+.L192:
+  add rdx, 18446744073709551612
+  add r8, 18446744073709551600
+# cast st
+  movsxd rsi, edx
+  mov rdx, rsi
+  jmp .L187
+.L188:
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea rcx, [rcx + rcx * 2]
+  movsxd r8, DWORD PTR [rbp + rdx * 4 - 40]
+  add rcx, r8
+# cast st
+  movsxd r8, ecx
+.L193:
+  sub rdx, 1
+# cast st
+  movsxd r9, edx
+#test/c/statement.c:544:     for(int i = 9; i >= 0; i--) t = t * 3 + arr[i];
+  lea r8, [r8 + r8 * 2]
+  movsxd r9, DWORD PTR [rbp + r9 * 4 - 40]
+  add r8, r9
+# cast st
+  movsxd r8, r8d
+.L194:
+.L186:
+#test/c/statement.c:545:     return t;
+  mov rax, r8
+ret_iv_reverse:
+  pop rbp
+  ret
+# iv_stride
+#	 stack size: 36
+#	 i( ofs: 36, size: 4) : level0
+#	 s( ofs: 32, size: 8) : level0
+#	 n( ofs: 20, size: 4) : level0
+#	 b( ofs: 16, size: 8) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_stride:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  push r13
+  mov r8, rdi
+  mov r9, rsi
+  movsxd rcx, edx
+#test/c/statement.c:534:     for(int i = 2; i < n; i += 2){
+  mov rdx, r8
+  add rdx, 16
+  mov rsi, r9
+  add rsi, 16
+  lea rdi, [r8 + rcx * 8]
+  mov rbx, 0
+  mov r12, 2
+.L196:
+  mov r13, rdx
+  add r13, 48
+  cmp r13, rdi
+  jge .L724
+#test/c/statement.c:535:         s += a[i] * b[i];
+  mov r13, QWORD PTR [rsi]
+  imul r13, QWORD PTR [rdx]
+  add rbx, r13
+.L198:
+#test/c/statement.c:535:         s += a[i] * b[i];
+  mov r13, QWORD PTR [rsi + 16]
+  imul r13, QWORD PTR [rdx + 16]
+  add rbx, r13
+.L199:
+#test/c/statement.c:535:         s += a[i] * b[i];
+  mov r13, QWORD PTR [rsi + 32]
+  imul r13, QWORD PTR [rdx + 32]
+  add rbx, r13
+.L200:
+#test/c/statement.c:535:         s += a[i] * b[i];
+  mov r13, QWORD PTR [rsi + 48]
+  imul r13, QWORD PTR [rdx + 48]
+  add rbx, r13
+.L201:
+  add r12, 8
+  add rsi, 64
+  add rdx, 64
+# cast st
+  movsxd r13, r12d
+  mov r12, r13
+  jmp .L196
+.L724:
+  lea rdx, [r8 + r12 * 8]
+  lea r9, [r9 + r12 * 8]
+  lea r8, [r8 + rcx * 8]
+.L197:
+.L202:
+  cmp rdx, r8
+  jge .L195
+#test/c/statement.c:535:         s += a[i] * b[i];
+  mov rcx, QWORD PTR [r9]
+  imul rcx, QWORD PTR [rdx]
+  add rbx, rcx
+.L203:
+  add r9, 16
+  add rdx, 16
+  jmp .L202
+.L195:
+#test/c/statement.c:537:     return s;
+  mov rax, rbx
+ret_iv_stride:
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# iv_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 8) : level0
+  .text
+iv_sum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:526:     for(int i = 0; i < n; i++){
+  mov rcx, 0
+  movd xmm0, ecx
+  pshufd xmm0, xmm0, 0
+  lea rcx, [r8 + r9 * 4]
+  mov rdx, 0
+  mov rsi, 0
+  mov rdi, r8
+.L204:
+  cmp rdi, rcx
+  jge .L208
+  mov rbx, rdi
+  and rbx, 15
+  test rbx, rbx
+  je .L725
+#test/c/statement.c:527:         s += a[i];
+  movsxd rbx, DWORD PTR [rdi]
+  add rdx, rbx
+# cast st
+  movsxd rbx, edx
+.L210:
+  add rsi, 1
+  add rdi, 4
+# cast st
+  movsxd r12, esi
+  mov rdx, rbx
+  mov rsi, r12
+  jmp .L204
+.L725:
+  lea rcx, [r8 + rsi * 4]
+  lea rdi, [r8 + r9 * 4]
+.L205:
+.L206:
+  mov rbx, rcx
+  add rbx, 12
+  cmp rbx, rdi
+  jge .L207
+  movdqu xmm1, [rcx]
+  paddd xmm0, xmm1
+  add rsi, 4
+  add rcx, 16
+# cast st
+  movsxd rbx, esi
+  mov rsi, rbx
+  jmp .L206
+.L207:
+  pshufd xmm13, xmm0, 0x4e
+  paddd xmm0, xmm13
+  pshufd xmm13, xmm0, 0xb1
+  paddd xmm0, xmm13
+  movd eax, xmm0
+  movsxd rcx, eax
+  add rdx, rcx
+# cast st
+  movsxd rcx, edx
+  mov rdx, rcx
+.L208:
+  lea rcx, [r8 + rsi * 4]
+  lea r8, [r8 + r9 * 4]
+.L211:
+  cmp rcx, r8
+  jge .L209
+#test/c/statement.c:527:         s += a[i];
+  movsxd r9, DWORD PTR [rcx]
+  add rdx, r9
+# cast st
+  movsxd r9, edx
+.L212:
+  add rcx, 4
+  mov rdx, r9
+  jmp .L211
+.L209:
+#test/c/statement.c:529:     return s;
+  mov rax, rdx
+ret_iv_sum:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# inv_guard
+#	 stack size: 20
+#	 i( ofs: 16, size: 4) : level0
+#	 s( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_guard:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+#test/c/statement.c:518:     for(int i = 0; v && i < v->len; i++){
+  mov r9, 0
+  mov rcx, 0
+.L213:
+  test r8, r8
+  je .L215
+  movsxd rdx, DWORD PTR [r8]
+  cmp rcx, rdx
+  jge .L215
+#test/c/statement.c:519:         s += v->data[i];
+  mov rdx, QWORD PTR [r8 + 8]
+  movsxd rdx, DWORD PTR [rdx + rcx * 4]
+  add r9, rdx
+# cast st
+  movsxd rdx, r9d
+.L214:
+  add rcx, 1
+# cast st
+  movsxd rsi, ecx
+  mov r9, rdx
+  mov rcx, rsi
+  jmp .L213
+.L215:
+#test/c/statement.c:521:     return s;
+  mov rax, r9
+ret_inv_guard:
+  pop rbp
+  ret
+# inv_call
+#	 stack size: 16
+#	 i( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+inv_call:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:508:     inv_limit = 3;
+  mov r8, 3
+  mov DWORD PTR [rip + inv_limit], r8d
+#test/c/statement.c:509:     for(int i = 0; i < inv_limit; i++){
+  mov r8, 0
+  mov r9, 0
+.L216:
+  movsxd rcx, DWORD PTR [rip + inv_limit]
+  cmp r9, rcx
+  jge .L218
+#test/c/statement.c:510:         if(i == 0) inv_set_limit(6);
+  test r9, r9
+  jne .L219
+#test/c/statement.c:510:         if(i == 0) inv_set_limit(6);
+#test/c/statement.c:502:     inv_limit = n;
+  mov rcx, 6
+  mov DWORD PTR [rip + inv_limit], ecx
+#test/c/statement.c:503:     return 0;
+.L220:
+.L219:
+#test/c/statement.c:511:         n++;
+  add r8, 1
+# cast st
+  movsxd rcx, r8d
+.L217:
+  add r9, 1
+# cast st
+  movsxd rdx, r9d
+  mov r8, rcx
+  mov r9, rdx
+  jmp .L216
+.L218:
+#test/c/statement.c:513:     return n;
+  mov rax, r8
+ret_inv_call:
+  pop rbp
+  ret
+# inv_through_ptr
+#	 stack size: 24
+#	 i( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 p( ofs: 8, size: 8) : level0
+  .text
+inv_through_ptr:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+#test/c/statement.c:493:     inv_limit = 10;
+  mov r9, 10
+  mov DWORD PTR [rip + inv_limit], r9d
+#test/c/statement.c:494:     for(int i = 0; i < inv_limit; i++){
+  mov r9, 0
+  mov rcx, 0
+.L221:
+  movsxd rdx, DWORD PTR [rip + inv_limit]
+  cmp rcx, rdx
+  jge .L223
+#test/c/statement.c:495:         *p = 4;
+  mov rdx, 4
+  mov DWORD PTR [r8], edx
+#test/c/statement.c:496:         n++;
+  add r9, 1
+# cast st
+  movsxd rdx, r9d
+.L222:
+  add rcx, 1
+# cast st
+  movsxd rsi, ecx
+  mov r9, rdx
+  mov rcx, rsi
+  jmp .L221
+.L223:
+#test/c/statement.c:498:     return n;
+  mov rax, r9
+ret_inv_through_ptr:
+  pop rbp
+  ret
+# inv_shrink
+#	 stack size: 24
+#	 i( ofs: 16, size: 4) : level0
+#	 n( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_shrink:
+  push rbp
+  mov rbp, rsp
+  mov r8, rdi
+#test/c/statement.c:484:     for(int i = 0; i < v->len; i++){
+  mov r9, 0
+  mov rcx, 0
+.L224:
+  movsxd rdx, DWORD PTR [r8]
+  cmp rcx, rdx
+  jge .L226
+#test/c/statement.c:485:         if(i == 2) v->len = 3;
+  cmp rcx, 2
+  jne .L227
+#test/c/statement.c:485:         if(i == 2) v->len = 3;
+  mov rdx, 3
+  mov DWORD PTR [r8], edx
+.L227:
+#test/c/statement.c:486:         n++;
+  add r9, 1
+# cast st
+  movsxd rdx, r9d
+.L225:
+  add rcx, 1
+# cast st
+  movsxd rsi, ecx
+  mov r9, rdx
+  mov rcx, rsi
+  jmp .L224
+.L226:
+#test/c/statement.c:488:     return n;
+  mov rax, r9
+ret_inv_shrink:
+  pop rbp
+  ret
+# inv_sum
+#	 stack size: 24
+#	 i( ofs: 20, size: 4) : level0
+#	 s( ofs: 16, size: 4) : level0
+#	 k( ofs: 12, size: 4) : level0
+#	 v( ofs: 8, size: 8) : level0
+  .text
+inv_sum:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  mov r8, rdi
+  movsxd r9, esi
+#test/c/statement.c:474:     inv_scale = 2;
+  mov rcx, 2
+  mov DWORD PTR [rip + inv_scale], ecx
+#test/c/statement.c:476:     for(int i = 0; i < v->len; i++){
+  movsxd rcx, DWORD PTR [r8]
+  lea r9, [r9 + r9 * 2]
+  add r9, 1
+  mov rdx, 0
+  mov rsi, 0
+.L228:
+  cmp rsi, rcx
+  jge .L230
+#test/c/statement.c:477:         s = s + v->data[i] * (k * 3 + 1) + inv_scale;
+  mov rdi, QWORD PTR [r8 + 8]
+  movsxd rdi, DWORD PTR [rdi + rsi * 4]
+  imul rdi, r9
+  add rdx, rdi
+  movsxd rdi, DWORD PTR [rip + inv_scale]
+  add rdx, rdi
+# cast st
+  movsxd rdi, edx
+.L229:
+  add rsi, 1
+# cast st
+  movsxd rbx, esi
+  mov rdx, rdi
+  mov rsi, rbx
+  jmp .L228
+.L230:
+#test/c/statement.c:479:     return s;
+  mov rax, rdx
+ret_inv_sum:
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# switch_unsigned
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_unsigned:
+  push rbp
+  mov rbp, rsp
+  mov r8d, edi
+#test/c/statement.c:461:     switch(x){
+  cmp r8, 3
+  ja .L237
+  lea rax, [rip + .L238]
+  movsxd r11, DWORD PTR [rax + r8 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L238:
+  .long .L236 - .L238
+  .long .L235 - .L238
+  .long .L234 - .L238
+  .long .L233 - .L238
+  .text
+.L237:
+  mov r9, 4294967295
+  cmp r8, r9
+  je .L232
+  jmp .L231
+.L236:
+#test/c/statement.c:462:         case 0: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L235:
+#test/c/statement.c:463:         case 1: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L234:
+#test/c/statement.c:464:         case 2: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L233:
+#test/c/statement.c:465:         case 3: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L232:
+#test/c/statement.c:466:         case 4294967295: return 9;
+  mov r8, 9
+  mov rax, r8
+  jmp ret_switch_unsigned
+.L231:
+#test/c/statement.c:468:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_switch_unsigned:
+  pop rbp
+  ret
+# switch_mixed
+#	 stack size: 8
+#	 r( ofs: 8, size: 4) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_mixed:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:446:     switch(x){
+  cmp r8, 1000
+  jge .L249
+  cmp r8, 3
+  je .L248
+  sub r8, 10
+  cmp r8, 5
+  ja .L250
+  lea rax, [rip + .L251]
+  movsxd r11, DWORD PTR [rax + r8 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L251:
+  .long .L247 - .L251
+  .long .L246 - .L251
+  .long .L245 - .L251
+  .long .L244 - .L251
+  .long .L243 - .L251
+  .long .L242 - .L251
+  .text
+.L250:
+  mov r9, 0
+  jmp .L239
+.L249:
+  cmp r8, 1000
+  je .L241
+  cmp r8, 2000
+  je .L240
+  mov r9, 0
+  jmp .L239
+.L248:
+#test/c/statement.c:447:         case 3: r = 100; break;
+#test/c/statement.c:447:         case 3: r = 100; break;
+  mov r9, 100
+  jmp .L239
+.L247:
+#test/c/statement.c:448:         case 10: r = 10; break;
+#test/c/statement.c:448:         case 10: r = 10; break;
+  mov r9, 10
+  jmp .L239
+.L246:
+#test/c/statement.c:449:         case 11: r = 11; break;
+#test/c/statement.c:449:         case 11: r = 11; break;
+  mov r9, 11
+  jmp .L239
+.L245:
+#test/c/statement.c:450:         case 12: r = 12; break;
+#test/c/statement.c:450:         case 12: r = 12; break;
+  mov r9, 12
+  jmp .L239
+.L244:
+#test/c/statement.c:451:         case 13: r = 13; break;
+#test/c/statement.c:451:         case 13: r = 13; break;
+  mov r9, 13
+  jmp .L239
+.L243:
+#test/c/statement.c:452:         case 14: r = 14; break;
+#test/c/statement.c:452:         case 14: r = 14; break;
+  mov r9, 14
+  jmp .L239
+.L242:
+#test/c/statement.c:453:         case 15: r = 15; break;
+#test/c/statement.c:453:         case 15: r = 15; break;
+  mov r9, 15
+  jmp .L239
+.L241:
+#test/c/statement.c:454:         case 1000: r = 200; break;
+#test/c/statement.c:454:         case 1000: r = 200; break;
+  mov r9, 200
+  jmp .L239
+.L240:
+#test/c/statement.c:455:         case 2000: r = 300; break;
+#test/c/statement.c:455:         case 2000: r = 300; break;
+  mov r9, 300
+.L239:
+#test/c/statement.c:457:     return r;
+  mov rax, r9
+ret_switch_mixed:
+  pop rbp
+  ret
+# switch_sparse
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_sparse:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:433:     switch(x){
+  cmp r8, 100
+  jge .L259
+  cmp r8, 1
+  je .L257
+  cmp r8, 3
+  je .L256
+  cmp r8, 77
+  je .L254
+  jmp .L252
+.L259:
+  cmp r8, 100
+  je .L253
+  cmp r8, 1000
+  je .L258
+  cmp r8, 5000
+  je .L255
+  jmp .L252
+.L258:
+#test/c/statement.c:434:         case 1000: return 5;
+  mov r8, 5
+  mov rax, r8
+  jmp ret_switch_sparse
+.L257:
+#test/c/statement.c:435:         case 1: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_sparse
+.L256:
+#test/c/statement.c:436:         case 3: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_sparse
+.L255:
+#test/c/statement.c:437:         case 5000: return 6;
+  mov r8, 6
+  mov rax, r8
+  jmp ret_switch_sparse
+.L254:
+#test/c/statement.c:438:         case 77: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_sparse
+.L253:
+#test/c/statement.c:439:         case 100: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_sparse
+.L252:
+#test/c/statement.c:441:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_switch_sparse:
+  pop rbp
+  ret
+# switch_dense
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+switch_dense:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:418:     switch(x){
+  cmp r8, 9
+  ja .L271
+  lea rax, [rip + .L272]
+  movsxd r11, DWORD PTR [rax + r8 * 4]
+  add rax, r11
+  jmp rax
+  .section .rodata
+  .align 4
+.L272:
+  .long .L269 - .L272
+  .long .L268 - .L272
+  .long .L267 - .L272
+  .long .L266 - .L272
+  .long .L265 - .L272
+  .long .L270 - .L272
+  .long .L264 - .L272
+  .long .L263 - .L272
+  .long .L262 - .L272
+  .long .L261 - .L272
+  .text
+.L271:
+  jmp .L270
+.L269:
+#test/c/statement.c:419:         case 0: return 3;
+  mov r8, 3
+  mov rax, r8
+  jmp ret_switch_dense
+.L268:
+#test/c/statement.c:420:         case 1: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_dense
+.L267:
+#test/c/statement.c:421:         case 2: return 4;
+  mov r8, 4
+  mov rax, r8
+  jmp ret_switch_dense
+.L266:
+#test/c/statement.c:422:         case 3: return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_switch_dense
+.L265:
+#test/c/statement.c:423:         case 4: return 5;
+  mov r8, 5
+  mov rax, r8
+  jmp ret_switch_dense
+.L264:
+#test/c/statement.c:424:         case 6: return 9;
+  mov r8, 9
+  mov rax, r8
+  jmp ret_switch_dense
+.L263:
+#test/c/statement.c:425:         case 7: return 2;
+  mov r8, 2
+  mov rax, r8
+  jmp ret_switch_dense
+.L262:
+#test/c/statement.c:427:         case 9: return 6;
+.L261:
+#test/c/statement.c:427:         case 9: return 6;
+  mov r8, 6
+  mov rax, r8
+  jmp ret_switch_dense
+.L270:
+#test/c/statement.c:428:         default: return 7;
+  mov r8, 7
+  mov rax, r8
+ret_switch_dense:
+  pop rbp
+  ret
+# in_range
+#	 stack size: 4
+#	 x( ofs: 4, size: 4) : level0
+  .text
+in_range:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+  mov r9, 0
+  cmp r9, r8
+  jg .L275
+  cmp r8, 10
+  jl .L274
+.L275:
+  cmp r8, 100
+  jne .L273
+.L274:
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_in_range
+.L273:
+#test/c/statement.c:414:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_in_range:
+  pop rbp
+  ret
+# unsigned_less
+#	 stack size: 8
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+unsigned_less:
+  push rbp
+  mov rbp, rsp
+  mov r8d, edi
+  mov r9d, esi
+#test/c/statement.c:408:     if(a < b) return 1;
+  cmp r8, r9
+  jae .L276
+#test/c/statement.c:408:     if(a < b) return 1;
+  mov r8, 1
+  mov rax, r8
+  jmp ret_unsigned_less
+.L276:
+#test/c/statement.c:409:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_unsigned_less:
+  pop rbp
+  ret
+# branch_code
+#	 stack size: 12
+#	 code( ofs: 12, size: 4) : level0
+#	 b( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+branch_code:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+  movsxd r9, esi
+#test/c/statement.c:397:     if(a < b) code += 1;
+  mov rcx, 0
+  cmp r8, r9
+  jge .L277
+#test/c/statement.c:397:     if(a < b) code += 1;
+  mov rcx, 1
+.L277:
+#test/c/statement.c:398:     if(a <= b) code += 2;
+  cmp r8, r9
+  jg .L278
+#test/c/statement.c:398:     if(a <= b) code += 2;
+  add rcx, 2
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+.L278:
+#test/c/statement.c:399:     if(a > b) code += 4;
+  cmp r9, r8
+  jge .L279
+#test/c/statement.c:399:     if(a > b) code += 4;
+  add rcx, 4
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+.L279:
+#test/c/statement.c:400:     if(a >= b) code += 8;
+  cmp r9, r8
+  jg .L280
+#test/c/statement.c:400:     if(a >= b) code += 8;
+  add rcx, 8
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+.L280:
+#test/c/statement.c:401:     if(a == b) code += 16;
+  cmp r8, r9
+  jne .L281
+#test/c/statement.c:401:     if(a == b) code += 16;
+  add rcx, 16
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+.L281:
+#test/c/statement.c:402:     if(a != b) code += 32;
+  cmp r8, r9
+  je .L282
+#test/c/statement.c:402:     if(a != b) code += 32;
+  add rcx, 32
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+.L282:
+#test/c/statement.c:403:     if(!(a < b)) code += 64;
+  cmp r8, r9
+  jl .L283
+#test/c/statement.c:403:     if(!(a < b)) code += 64;
+  add rcx, 64
+# cast st
+  movsxd r8, ecx
+  mov rcx, r8
+.L283:
+#test/c/statement.c:404:     return code;
+  mov rax, rcx
+ret_branch_code:
+  pop rbp
+  ret
+# count_up
+#	 stack size: 4
+  .text
+count_up:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:386:     up_count++;
+  movsxd r8, DWORD PTR [rip + up_count]
+  add r8, 1
+  mov DWORD PTR [rip + up_count], r8d
+#test/c/statement.c:387:     return up_count;
+  movsxd r8, DWORD PTR [rip + up_count]
+  mov rax, r8
+ret_count_up:
+  pop rbp
+  ret
+# test_return
+#	 stack size: 0
+  .text
+test_return:
+  push rbp
+  mov rbp, rsp
+#test/c/statement.c:391:     return 5;
+  mov r8, 5
+  mov rax, r8
+ret_test_return:
+  pop rbp
+  ret
+# test_statement
+#	 stack size: 1392
+#	 esp( ofs: 1392, size: 8) : level0
+#	 es( ofs: 1376, size: 4) : level0
+#	 li( ofs: 1372, size: 4) : level0
+#	 vec_i( ofs: 1364, size: 4) : level0
+#	 vec_u( ofs: 1360, size: 100) : level0
+#	 vec_c( ofs: 1260, size: 100) : level0
+#	 vec_d( ofs: 1160, size: 400) : level0
+#	 vec_a( ofs: 760, size: 400) : level0
+#	 ur_i( ofs: 356, size: 4) : level0
+#	 ur_a( ofs: 352, size: 80) : level0
+#	 iv_i( ofs: 268, size: 4) : level0
+#	 iv_b( ofs: 264, size: 48) : level0
+#	 iv_a( ofs: 216, size: 48) : level0
+#	 inv_other( ofs: 164, size: 4) : level0
+#	 inv_v( ofs: 160, size: 16) : level0
+#	 inv_i( ofs: 140, size: 4) : level0
+#	 inv_data( ofs: 136, size: 20) : level0
+#	 sw_i( ofs: 112, size: 4) : level0
+#	 sw_sum( ofs: 108, size: 4) : level0
+#	 s5( ofs: 104, size: 4) : level0
+#	 s4( ofs: 100, size: 4) : level0
+#	 s3( ofs: 96, size: 4) : level0
+#	 s2( ofs: 92, size: 4) : level0
+#	 s1( ofs: 88, size: 4) : level0
+#	 cont_2_1( ofs: 84, size: 4) : level0
+#	 cont_2( ofs: 80, size: 4) : level0
+#	 cont_1_1( ofs: 76, size: 4) : level0
+#	 cont_1( ofs: 72, size: 4) : level0
+#	 break_3_2( ofs: 68, size: 4) : level0
+#	 break_3_1( ofs: 64, size: 4) : level0
+#	 break_2( ofs: 60, size: 4) : level0
+#	 break_1( ofs: 56, size: 4) : level0
+#	 i( ofs: 52, size: 4) : level0
+#	 cp2( ofs: 48, size: 4) : level0
+#	 cp( ofs: 44, size: 4) : level0
+#	 cond_n( ofs: 40, size: 4) : level0
+#	 cond_sc( ofs: 36, size: 4) : level0
+#	 if_a( ofs: 32, size: 4) : level0
+#	 for_null( ofs: 28, size: 4) : level0
+#	 for_d( ofs: 24, size: 4) : level0
+#	 for_c( ofs: 20, size: 4) : level0
+#	 for_b( ofs: 16, size: 4) : level0
+#	 for_a( ofs: 12, size: 4) : level0
+#	 do_while_a( ofs: 8, size: 4) : level0
+#	 while_a( ofs: 4, size: 4) : level0
+  .text
+test_statement:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 1392
+  push rbx
+  push r12
+  push r13
+  push r14
+#test/c/statement.c:41:     printf("test of while-statement...\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:42:     int while_a; while_a = 0;
+#test/c/statement.c:43:     while(while_a < 3) while_a = while_a + 1;
+  mov r8, 0
+.L286:
+  cmp r8, 3
+  jge .L287
+#test/c/statement.c:43:     while(while_a < 3) while_a = while_a + 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+  mov r8, r9
+  jmp .L286
+.L287:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 3
+  je .L289
+.L288:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L289:
+#test/c/statement.c:46:     printf("test of do-while-statement...\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:47:     int do_while_a; do_while_a = 0;
+#test/c/statement.c:48:     do {
+  mov r8, 0
+.L290:
+#test/c/statement.c:49:         do_while_a = do_while_a + 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+  mov r8, r9
+  cmp r9, 3
+  jl .L290
+.L291:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r9, 3
+  je .L293
+.L292:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L293:
+#test/c/statement.c:53:     do_while_a = 0;
+#test/c/statement.c:54:     do {
+.L294:
+#test/c/statement.c:55:         do_while_a = do_while_a + 1;
+.L295:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L297:
+#test/c/statement.c:59:     printf("test of for-statement...\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:60:     int for_a; for_a = 0;
+#test/c/statement.c:61:     int for_b; for_b = 0;
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+  mov r8, 0
+  mov r9, 0
+.L299:
+  mov rcx, r8
+  add rcx, 3
+  cmp rcx, 5
+  jge .L300
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+.L301:
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+.L302:
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+.L303:
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+  add r9, 8
+# cast st
+  movsxd rcx, r9d
+.L304:
+  add r8, 4
+# cast st
+  movsxd rdx, r8d
+  mov r8, rdx
+  mov r9, rcx
+  jmp .L299
+.L300:
+#test/c/statement.c:62:     for(for_a = 0; for_a < 5; for_a = for_a + 1) for_b = for_b + 2;
+  add r9, 2
+# cast st
+  movsxd rbx, r9d
+.L305:
+  add r8, 1
+# cast st
+  movsxd r8, r8d
+.L298:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 5
+  je .L307
+.L306:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L307:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, 10
+  je .L309
+.L308:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L309:
+#test/c/statement.c:67:     for(; for_c < 5;){ for_c += 1; }
+  mov r8, 0
+.L310:
+  cmp r8, 5
+  jge .L312
+#test/c/statement.c:67:     for(; for_c < 5;){ for_c += 1; }
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+.L311:
+  mov r8, r9
+  jmp .L310
+.L312:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 5
+  je .L314
+.L313:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L314:
+#test/c/statement.c:70:     for(int for_d = 0; for_d < 5; ){ for_d += 1; }
+  mov r8, 0
+.L315:
+  cmp r8, 5
+  jge .L317
+#test/c/statement.c:70:     for(int for_d = 0; for_d < 5; ){ for_d += 1; }
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+.L316:
+  mov r8, r9
+  jmp .L315
+.L317:
+#test/c/statement.c:73:     for(;;){
+  mov r8, 0
+.L318:
+#test/c/statement.c:74:         for_null += 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+#test/c/statement.c:75:         if(for_null == 5) break;
+  cmp r9, 5
+  je .L320
+#test/c/statement.c:75:         if(for_null == 5) break;
+.L321:
+#test/c/statement.c:75:         if(for_null == 5) break;
+.L319:
+  mov r8, r9
+  jmp .L318
+.L320:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r9, 5
+  je .L323
+.L322:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L323:
+#test/c/statement.c:79:     printf("test of if-statement...\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/statement.c:81:     if_a = 0;
+#test/c/statement.c:82:     if(1){
+#test/c/statement.c:83:         if_a = 1;
+.L324:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L326:
+#test/c/statement.c:87:     if(0){
+.L327:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L329:
+#test/c/statement.c:92:     if(1){
+#test/c/statement.c:93:         if_a = 2;
+.L331:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L333:
+#test/c/statement.c:99:     if(0){
+.L334:
+#test/c/statement.c:102:         if_a = 20;
+.L335:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L337:
+#test/c/statement.c:106:     if(0){
+.L338:
+#test/c/statement.c:108:     } else if(1){
+#test/c/statement.c:109:         if_a = 12;
+.L341:
+.L339:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L343:
+#test/c/statement.c:115:     printf("test of condition branch..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  mov rsi, 2
+  call branch_code
+  mov r8, rax
+  cmp r8, 35
+  je .L345
+.L344:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L345:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  mov rsi, 2
+  call branch_code
+  mov r8, rax
+  cmp r8, 90
+  je .L347
+.L346:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L347:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 2
+  call branch_code
+  mov r8, rax
+  cmp r8, 108
+  je .L349
+.L348:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L349:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 18446744073709551615
+  mov rsi, 1
+  call branch_code
+  mov r8, rax
+  cmp r8, 35
+  je .L351
+.L350:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L351:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:408:     if(a < b) return 1;
+.L355:
+#test/c/statement.c:409:     return 0;
+.L354:
+.L353:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:408:     if(a < b) return 1;
+#test/c/statement.c:408:     if(a < b) return 1;
+.L358:
+.L357:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L365:
+.L363:
+#test/c/statement.c:414:     return 0;
+.L362:
+.L361:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L370:
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L368:
+.L367:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L376:
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L374:
+.L373:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L383:
+.L381:
+#test/c/statement.c:414:     return 0;
+.L380:
+.L379:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L389:
+.L388:
+#test/c/statement.c:413:     if(x >= 0 && x < 10 || x == 100) return 1;
+.L386:
+.L385:
+#test/c/statement.c:128:     if(0 && (cond_sc = 1)) cond_sc = 2;
+.L390:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L392:
+#test/c/statement.c:130:     if(1 || (cond_sc = 1)) cond_sc += 3;
+.L394:
+#test/c/statement.c:130:     if(1 || (cond_sc = 1)) cond_sc += 3;
+.L393:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L396:
+#test/c/statement.c:133:     while(!(cond_n >= 4)) cond_n += 1;
+  mov r8, 0
+.L397:
+  mov r9, 4
+  cmp r9, r8
+  jle .L398
+#test/c/statement.c:133:     while(!(cond_n >= 4)) cond_n += 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+  mov r8, r9
+  jmp .L397
+.L398:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 4
+  je .L400
+.L399:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L400:
+#test/c/statement.c:136:     printf("test of return-statement...\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:391:     return 5;
+.L403:
+.L402:
+#test/c/statement.c:139:     printf("test of compound-statement..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:140:     int cp; cp = 0;
+#test/c/statement.c:141:     int cp2; cp2 = 0;
+#test/c/statement.c:142:     int i; i = 0;
+#test/c/statement.c:143:     for(i = 0; i < 5; i += 1){
+  mov r8, 0
+  mov r9, 0
+  mov rcx, 0
+.L405:
+  mov rdx, rcx
+  add rdx, 3
+  cmp rdx, 5
+  jge .L406
+#test/c/statement.c:144:         cp = cp + 1;
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+.L407:
+#test/c/statement.c:144:         cp = cp + 1;
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+.L408:
+#test/c/statement.c:144:         cp = cp + 1;
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+.L409:
+#test/c/statement.c:144:         cp = cp + 1;
+  add r8, 4
+# cast st
+  movsxd rdx, r8d
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+  add r9, 8
+# cast st
+  movsxd rsi, r9d
+.L410:
+  add rcx, 4
+# cast st
+  movsxd rdi, ecx
+  mov r8, rdx
+  mov r9, rsi
+  mov rcx, rdi
+  jmp .L405
+.L406:
+#test/c/statement.c:144:         cp = cp + 1;
+  add r8, 1
+# cast st
+  movsxd r8, r8d
+#test/c/statement.c:145:         cp2 = cp2 + 2;
+  add r9, 2
+# cast st
+  movsxd rbx, r9d
+.L411:
+.L404:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 5
+  je .L413
+.L412:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L413:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, 10
+  je .L415
+.L414:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L415:
+#test/c/statement.c:150:     printf("test of void statement..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:151:     ;;;
+#test/c/statement.c:153:         ;
+#test/c/statement.c:155:     if(1) ;
+#test/c/statement.c:155:     if(1) ;
+.L416:
+#test/c/statement.c:156:     if(0) ; else ;
+.L417:
+#test/c/statement.c:156:     if(0) ; else ;
+.L418:
+#test/c/statement.c:158:     printf("test of break statement..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/statement.c:160:     for(; break_1 < 5; break_1 += 1){
+.L420:
+#test/c/statement.c:161:         if(break_1 == 3){
+.L423:
+.L422:
+#test/c/statement.c:161:         if(break_1 == 3){
+.L425:
+.L424:
+#test/c/statement.c:161:         if(break_1 == 3){
+.L427:
+.L426:
+#test/c/statement.c:161:         if(break_1 == 3){
+#test/c/statement.c:162:             break;
+.L419:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L434:
+#test/c/statement.c:168:     while(1){
+  mov r8, 0
+.L435:
+#test/c/statement.c:169:         if(break_2 == 4) break;
+  cmp r8, 4
+  je .L436
+#test/c/statement.c:169:         if(break_2 == 4) break;
+.L437:
+#test/c/statement.c:169:         if(break_2 == 4) break;
+#test/c/statement.c:170:         break_2 += 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+  mov r8, r9
+  jmp .L435
+.L436:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 4
+  je .L439
+.L438:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L439:
+#test/c/statement.c:176:     for(; break_3_1 < 5; break_3_1 += 1){
+  mov r8, 0
+.L440:
+  cmp r8, 5
+  jge .L442
+#test/c/statement.c:177:         for(break_3_2 = 0; break_3_2 < 5; break_3_2 += 1){
+.L444:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L447:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L446:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L449:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L448:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L451:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L450:
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+#test/c/statement.c:178:             if(break_3_2 == 3) break;
+.L443:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L457:
+.L441:
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+  mov r8, r9
+  jmp .L440
+.L442:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r8, 5
+  je .L459
+.L458:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L459:
+#test/c/statement.c:184:     printf("test of continue statement..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/statement.c:187:     for(;cont_1 < 5; cont_1 += 1){
+  mov rbx, 0
+.L461:
+  mov r8, rbx
+  add r8, 3
+  cmp r8, 5
+  jge .L726
+#test/c/statement.c:188:         continue;
+.L463:
+#test/c/statement.c:188:         continue;
+.L464:
+#test/c/statement.c:188:         continue;
+.L465:
+#test/c/statement.c:188:         continue;
+.L466:
+  add rbx, 4
+# cast st
+  movsxd r8, ebx
+  mov rbx, r8
+  jmp .L461
+.L726:
+.L462:
+.L467:
+  cmp rbx, 5
+  jge .L460
+#test/c/statement.c:188:         continue;
+.L468:
+  add rbx, 1
+# cast st
+  movsxd r8, ebx
+  mov rbx, r8
+  jmp .L467
+.L460:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, 5
+  je .L470
+.L469:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L470:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L472:
+#test/c/statement.c:196:     while(cont_2 < 5){
+  mov r8, 0
+.L473:
+  cmp r8, 5
+  jge .L474
+#test/c/statement.c:197:         cont_2 += 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+#test/c/statement.c:198:         continue;
+  mov r8, r9
+  jmp .L473
+.L474:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, 5
+  je .L476
+.L475:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L476:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L478:
+#test/c/statement.c:204:     printf("test of switch statement..\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/statement.c:208:     switch(s1){
+.L481:
+#test/c/statement.c:210:             s2 = 5;
+#test/c/statement.c:211:             break;
+.L479:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L483:
+#test/c/statement.c:219:     switch(s2){
+.L487:
+#test/c/statement.c:227:             s3 = 123;
+#test/c/statement.c:228:             break;
+.L484:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L489:
+#test/c/statement.c:233:     switch(s2){
+.L492:
+#test/c/statement.c:235:             s3 = 10;
+#test/c/statement.c:236:         case 10:
+.L491:
+#test/c/statement.c:237:             s4 = 12;
+#test/c/statement.c:238:             break;
+.L490:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L494:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L496:
+#test/c/statement.c:244:     switch(s2){
+.L497:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L500:
+#test/c/statement.c:252:     for(int sw_i = -3; sw_i < 12; sw_i++){
+  mov rbx, 0
+  mov r12, 18446744073709551613
+.L502:
+  mov r8, r12
+  add r8, 3
+  cmp r8, 12
+  jge .L727
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea rbx, [rbx + rbx * 2]
+  mov rdi, r12
+  call switch_dense
+  mov r8, rax
+  add rbx, r8
+# cast st
+  movsxd r8, ebx
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  mov r9, r8
+  mov rcx, 9671377542784405045
+  mov rax, r9
+  imul rcx
+  mov r9, rdx
+  add r9, r8
+  sar r9, 19
+  mov rcx, r9
+  shr rcx, 63
+  add r9, rcx
+  imul r9, 1000003
+  sub r8, r9
+# cast st
+  movsxd r13, r8d
+.L504:
+  mov r8, r12
+  add r8, 1
+# cast st
+  movsxd r14, r8d
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea r13, [r13 + r13 * 2]
+  mov rdi, r14
+  call switch_dense
+  mov r8, rax
+  add r13, r8
+# cast st
+  movsxd r8, r13d
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  mov r9, r8
+  mov rcx, 9671377542784405045
+  mov rax, r9
+  imul rcx
+  mov r9, rdx
+  add r9, r8
+  sar r9, 19
+  mov rcx, r9
+  shr rcx, 63
+  add r9, rcx
+  imul r9, 1000003
+  sub r8, r9
+# cast st
+  movsxd r13, r8d
+.L505:
+  add r14, 1
+# cast st
+  movsxd r14, r14d
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea r13, [r13 + r13 * 2]
+  mov rdi, r14
+  call switch_dense
+  mov r8, rax
+  add r13, r8
+# cast st
+  movsxd r8, r13d
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  mov r9, r8
+  mov rcx, 9671377542784405045
+  mov rax, r9
+  imul rcx
+  mov r9, rdx
+  add r9, r8
+  sar r9, 19
+  mov rcx, r9
+  shr rcx, 63
+  add r9, rcx
+  imul r9, 1000003
+  sub r8, r9
+# cast st
+  movsxd r13, r8d
+.L506:
+  add r14, 1
+# cast st
+  movsxd r8, r14d
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea r13, [r13 + r13 * 2]
+  mov rdi, r8
+  call switch_dense
+  mov r8, rax
+  add r13, r8
+# cast st
+  movsxd r8, r13d
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  mov r9, r8
+  mov rcx, 9671377542784405045
+  mov rax, r9
+  imul rcx
+  mov r9, rdx
+  add r9, r8
+  sar r9, 19
+  mov rcx, r9
+  shr rcx, 63
+  add r9, rcx
+  imul r9, 1000003
+  sub r8, r9
+# cast st
+  movsxd rbx, r8d
+.L507:
+  add r12, 4
+# cast st
+  movsxd r8, r12d
+  mov r12, r8
+  jmp .L502
+.L727:
+.L503:
+.L508:
+  cmp r12, 12
+  jge .L501
+#test/c/statement.c:253:         sw_sum = sw_sum * 3 + switch_dense(sw_i);
+  lea rbx, [rbx + rbx * 2]
+  mov rdi, r12
+  call switch_dense
+  mov r8, rax
+  add rbx, r8
+# cast st
+  movsxd r8, ebx
+#test/c/statement.c:254:         sw_sum = sw_sum % 1000003;
+  mov r9, r8
+  mov rcx, 9671377542784405045
+  mov rax, r9
+  imul rcx
+  mov r9, rdx
+  add r9, r8
+  sar r9, 19
+  mov rcx, r9
+  shr rcx, 63
+  add r9, rcx
+  imul r9, 1000003
+  sub r8, r9
+# cast st
+  movsxd rbx, r8d
+.L509:
+  add r12, 1
+# cast st
+  movsxd r8, r12d
+  mov r12, r8
+  jmp .L508
+.L501:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp rbx, 55398
+  je .L511
+.L510:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L511:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 1
+  je .L513
+.L512:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L513:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 2
+  je .L515
+.L514:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L515:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 77
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 3
+  je .L517
+.L516:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L517:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 100
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 4
+  je .L519
+.L518:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L519:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1000
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 5
+  je .L521
+.L520:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L521:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5000
+  call switch_sparse
+  mov r8, rax
+  cmp r8, 6
+  je .L523
+.L522:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L523:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2
+  call switch_sparse
+  mov r8, rax
+  test r8, r8
+  je .L525
+.L524:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L525:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 4999
+  call switch_sparse
+  mov r8, rax
+  test r8, r8
+  je .L527
+.L526:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L527:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 18446744073709551613
+  call switch_sparse
+  mov r8, rax
+  test r8, r8
+  je .L529
+.L528:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L529:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 100
+  je .L531
+.L530:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L531:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 9
+  call switch_mixed
+  mov r8, rax
+  test r8, r8
+  je .L533
+.L532:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L533:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 10
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 10
+  je .L535
+.L534:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L535:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 13
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 13
+  je .L537
+.L536:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L537:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 15
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 15
+  je .L539
+.L538:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L539:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 16
+  call switch_mixed
+  mov r8, rax
+  test r8, r8
+  je .L541
+.L540:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L541:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1000
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 200
+  je .L543
+.L542:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L543:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 2000
+  call switch_mixed
+  mov r8, rax
+  cmp r8, 300
+  je .L545
+.L544:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L545:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1999
+  call switch_mixed
+  mov r8, rax
+  test r8, r8
+  je .L547
+.L546:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L547:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  call switch_unsigned
+  mov r8, rax
+  cmp r8, 1
+  je .L549
+.L548:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L549:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  call switch_unsigned
+  mov r8, rax
+  cmp r8, 4
+  je .L551
+.L550:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L551:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 18446744073709551615
+  call switch_unsigned
+  mov r8, rax
+  cmp r8, 9
+  je .L553
+.L552:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L553:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 18446744073709551614
+  call switch_unsigned
+  mov r8, rax
+  test r8, r8
+  je .L555
+.L554:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L555:
+#test/c/statement.c:280:     printf("test of loop invariant..\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  lea r8, [rbp - 136]
+  lea r9, [rbp - 116]
+  mov rcx, 0
+.L557:
+  mov rdx, r8
+  add rdx, 12
+  cmp rdx, r9
+  jge .L558
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  mov rdx, rcx
+  add rdx, 1
+  mov DWORD PTR [r8], edx
+.L559:
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  add rdx, 1
+  mov DWORD PTR [r8 + 4], edx
+.L560:
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  add rdx, 1
+  mov DWORD PTR [r8 + 8], edx
+.L561:
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  add rdx, 1
+  mov DWORD PTR [r8 + 12], edx
+.L562:
+  add rcx, 4
+  add r8, 16
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L557
+.L558:
+#test/c/statement.c:282:     for(int inv_i = 0; inv_i < 5; inv_i++) inv_data[inv_i] = inv_i + 1;
+  mov r8, rcx
+  add r8, 1
+  lea rbx, [rbp - 136]
+  mov DWORD PTR [rbp + rcx * 4 - 136], r8d
+.L563:
+.L556:
+#test/c/statement.c:284:     inv_v.len = 5;
+  lea r12, [rbp - 160]
+  mov r8, 5
+  mov DWORD PTR [rbp - 160], r8d
+#test/c/statement.c:285:     inv_v.data = inv_data;
+  mov QWORD PTR [rbp - 152], rbx
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, 2
+  call inv_sum
+  mov r8, rax
+  cmp r8, 115
+  je .L565
+.L564:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L565:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, 0
+  call inv_sum
+  mov r8, rax
+  cmp r8, 25
+  je .L567
+.L566:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L567:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  call inv_guard
+  mov r8, rax
+  cmp r8, 15
+  je .L569
+.L568:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L569:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  call inv_guard
+  mov r8, rax
+  test r8, r8
+  je .L571
+.L570:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L571:
+#test/c/statement.c:290:     inv_v.len = 10;
+  mov r8, 10
+  mov DWORD PTR [rbp - 160], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  call inv_shrink
+  mov r8, rax
+  cmp r8, 3
+  je .L573
+.L572:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L573:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 160], 3
+  je .L575
+.L574:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L575:
+  lea r8, [rbp - 164]
+  mov r9, 0
+  mov DWORD PTR [rbp - 164], r9d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r8
+  call inv_through_ptr
+  mov r8, rax
+  cmp r8, 10
+  je .L577
+.L576:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L577:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + inv_limit ]
+  mov rdi, r8
+  call inv_through_ptr
+  mov r8, rax
+  cmp r8, 4
+  je .L579
+.L578:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L579:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  call inv_call
+  mov r8, rax
+  cmp r8, 6
+  je .L581
+.L580:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L581:
+#test/c/statement.c:298:     printf("test of induction variable..\n");
+  lea r8, [ rip + .LSTR12 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 5
+  call iv_sum
+  mov r8, rax
+  cmp r8, 15
+  je .L583
+.L582:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L583:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 0
+  call iv_sum
+  mov r8, rax
+  test r8, r8
+  je .L585
+.L584:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L585:
+#test/c/statement.c:303:     for(int iv_i = 0; iv_i < 6; iv_i++){
+  lea r8, [rbp - 216]
+  lea r9, [rbp - 264]
+  lea rcx, [rbp - 168]
+  mov rdx, 0
+.L587:
+  mov rsi, r8
+  add rsi, 24
+  cmp rsi, rcx
+  jge .L588
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  mov QWORD PTR [r8], rdx
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov rsi, 10
+  sub rsi, rdx
+  mov QWORD PTR [r9], rsi
+.L589:
+  mov rsi, rdx
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  mov QWORD PTR [r8 + 8], rsi
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov rdi, 10
+  sub rdi, rsi
+  mov QWORD PTR [r9 + 8], rdi
+.L590:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  mov QWORD PTR [r8 + 16], rsi
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov rdi, 10
+  sub rdi, rsi
+  mov QWORD PTR [r9 + 16], rdi
+.L591:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  mov QWORD PTR [r8 + 24], rsi
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov rdi, 10
+  sub rdi, rsi
+  mov QWORD PTR [r9 + 24], rdi
+.L592:
+  add rdx, 4
+  add r9, 32
+  add r8, 32
+# cast st
+  movsxd rsi, edx
+  mov rdx, rsi
+  jmp .L587
+.L588:
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  lea r12, [rbp - 216]
+  mov QWORD PTR [rbp + rdx * 8 - 216], rdx
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov r8, 10
+  sub r8, rdx
+  lea r13, [rbp - 264]
+  mov QWORD PTR [rbp + rdx * 8 - 264], r8
+.L593:
+  add rdx, 1
+# cast st
+  movsxd r8, edx
+#test/c/statement.c:304:         iv_a[iv_i] = iv_i;
+  mov QWORD PTR [rbp + r8 * 8 - 216], r8
+#test/c/statement.c:305:         iv_b[iv_i] = 10 - iv_i;
+  mov r9, 10
+  sub r9, r8
+  mov QWORD PTR [rbp + r8 * 8 - 264], r9
+.L594:
+.L586:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, r13
+  mov rdx, 6
+  call iv_stride
+  mov r8, rax
+  cmp r8, 40
+  je .L596
+.L595:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L596:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, r13
+  mov rdx, 1
+  call iv_stride
+  mov r8, rax
+  test r8, r8
+  je .L598
+.L597:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L598:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  call iv_reverse
+  mov r8, rax
+  cmp r8, 2155287
+  je .L600
+.L599:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L600:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [ rip + .LSTR13 ]
+  mov rdi, r8
+  mov rsi, 5
+  call iv_after
+  mov r8, rax
+  cmp r8, 500
+  je .L602
+.L601:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L602:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 5
+  call iv_weighted
+  mov r8, rax
+  cmp r8, 45
+  je .L604
+.L603:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L604:
+#test/c/statement.c:313:     printf("test of loop unrolling..\n");
+  lea r8, [ rip + .LSTR14 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:315:     for(int ur_i = 0; ur_i < 20; ur_i++){
+  lea r8, [rbp - 352]
+  lea r9, [rbp - 272]
+  mov rcx, 0
+.L606:
+  cmp r8, r9
+  jge .L605
+#test/c/statement.c:316:         ur_a[ur_i] = ur_i * ur_i + 1;
+  mov rdx, rcx
+  imul rdx, rcx
+  add rdx, 1
+  mov DWORD PTR [r8], edx
+.L608:
+  mov rdx, rcx
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:316:         ur_a[ur_i] = ur_i * ur_i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov DWORD PTR [r8 + 4], esi
+.L609:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:316:         ur_a[ur_i] = ur_i * ur_i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov DWORD PTR [r8 + 8], esi
+.L610:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:316:         ur_a[ur_i] = ur_i * ur_i + 1;
+  mov rsi, rdx
+  imul rsi, rdx
+  add rsi, 1
+  mov DWORD PTR [r8 + 12], esi
+.L611:
+  add rcx, 4
+  add r8, 16
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L606
+.L607:
+.L605:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea rbx, [rbp - 352]
+  mov rdi, rbx
+  mov rsi, 7
+  call unroll_sum
+  mov r8, rax
+  cmp r8, 98
+  je .L613
+.L612:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L613:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 0
+  call unroll_sum
+  mov r8, rax
+  test r8, r8
+  je .L615
+.L614:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L615:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 20
+  call unroll_sum
+  mov r8, rax
+  cmp r8, 2490
+  je .L617
+.L616:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L617:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 3
+  call unroll_sum
+  mov r8, rax
+  cmp r8, 8
+  je .L619
+.L618:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L619:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  call unroll_known
+  mov r8, rax
+  cmp r8, 1013
+  je .L621
+.L620:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L621:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 20
+  call unroll_jump
+  mov r8, rax
+  cmp r8, 37
+  je .L623
+.L622:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L623:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 5
+  call unroll_jump
+  mov r8, rax
+  cmp r8, 7
+  je .L625
+.L624:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L625:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 0
+  call unroll_jump
+  mov r8, rax
+  test r8, r8
+  je .L627
+.L626:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L627:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:598:     for(i = n; i >= 0; i -= 3){
+  mov r8, 0
+  mov r9, 10
+.L632:
+  mov rcx, r9
+  add rcx, 18446744073709551613
+  mov rdx, 0
+  cmp rdx, rcx
+  jg .L728
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [r8 + r8 * 2]
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L634:
+  mov rdx, r9
+  sub rdx, 3
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea rcx, [rcx + rcx * 2]
+  add rcx, rdx
+# cast st
+  movsxd r8, ecx
+.L635:
+  add r9, 18446744073709551610
+# cast st
+  movsxd rcx, r9d
+  mov r9, rcx
+  jmp .L632
+.L728:
+.L633:
+.L636:
+  mov rcx, 0
+  cmp rcx, r9
+  jg .L631
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [r8 + r8 * 2]
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L637:
+  sub r9, 3
+# cast st
+  movsxd rdx, r9d
+  mov r8, rcx
+  mov r9, rdx
+  jmp .L636
+.L631:
+#test/c/statement.c:601:     return s + i;
+  add r8, r9
+# cast st
+  movsxd r8, r8d
+.L630:
+  cmp r8, 344
+  je .L629
+.L628:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L629:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:598:     for(i = n; i >= 0; i -= 3){
+  mov r8, 0
+  mov r9, 9
+.L642:
+  mov rcx, r9
+  add rcx, 18446744073709551613
+  mov rdx, 0
+  cmp rdx, rcx
+  jg .L729
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [r8 + r8 * 2]
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L644:
+  mov rdx, r9
+  sub rdx, 3
+# cast st
+  movsxd rdx, edx
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea rcx, [rcx + rcx * 2]
+  add rcx, rdx
+# cast st
+  movsxd r8, ecx
+.L645:
+  add r9, 18446744073709551610
+# cast st
+  movsxd rcx, r9d
+  mov r9, rcx
+  jmp .L642
+.L729:
+.L643:
+.L646:
+  mov rcx, 0
+  cmp rcx, r9
+  jg .L641
+#test/c/statement.c:599:         s = s * 3 + i;
+  lea r8, [r8 + r8 * 2]
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L647:
+  sub r9, 3
+# cast st
+  movsxd rdx, r9d
+  mov r8, rcx
+  mov r9, rdx
+  jmp .L646
+.L641:
+#test/c/statement.c:601:     return s + i;
+  add r8, r9
+# cast st
+  movsxd r8, r8d
+.L640:
+  cmp r8, 303
+  je .L639
+.L638:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L639:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:598:     for(i = n; i >= 0; i -= 3){
+.L652:
+.L653:
+.L656:
+.L651:
+#test/c/statement.c:601:     return s + i;
+.L650:
+.L649:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:607:     for(long i = 1; i <= 3; ++i){
+#test/c/statement.c:608:         s = s * 10 + i;
+.L662:
+#test/c/statement.c:608:         s = s * 10 + i;
+.L663:
+#test/c/statement.c:608:         s = s * 10 + i;
+.L664:
+.L661:
+#test/c/statement.c:610:     return s;
+.L660:
+.L659:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 20
+  mov rdx, 0
+  call unroll_heuristic
+  mov r8, rax
+  cmp r8, 361
+  je .L666
+.L665:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L666:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 20
+  mov rdx, 5
+  call unroll_heuristic
+  mov r8, rax
+  cmp r8, 196
+  je .L668
+.L667:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L668:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 1
+  mov rdx, 0
+  call unroll_heuristic
+  mov r8, rax
+  test r8, r8
+  je .L670
+.L669:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L670:
+#test/c/statement.c:334:     printf("test of loop vectorization..\n");
+  lea r8, [ rip + .LSTR15 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:339:     for(int vec_i = 0; vec_i < 100; vec_i++){
+  lea r8, [rbp - 760]
+  lea r9, [rbp - 1260]
+  lea rcx, [rbp - 1360]
+  lea rsi, [rbp - 360]
+  mov rdi, 0
+.L672:
+  cmp r8, rsi
+  jge .L671
+#test/c/statement.c:340:         vec_a[vec_i] = vec_i * 7919 % 2001 - 1000;
+  mov rbx, rdi
+  imul rbx, 7919
+  mov r12, rbx
+  mov r13, 4720006479629830299
+  mov rax, r12
+  imul r13
+  mov r12, rdx
+  sar r12, 9
+  mov rdx, r12
+  shr rdx, 63
+  add r12, rdx
+  imul r12, 2001
+  sub rbx, r12
+  sub rbx, 1000
+  mov DWORD PTR [r8], ebx
+#test/c/statement.c:341:         vec_c[vec_i] = vec_i * 53 % 256 - 128;
+  mov rdx, rdi
+  imul rdx, 53
+  mov rbx, rdx
+  sar rbx, 63
+  shr rbx, 56
+  mov r12, rdx
+  add r12, rbx
+  and r12, 18446744073709551360
+  sub rdx, r12
+  sub rdx, 128
+  mov BYTE PTR [r9], dl
+#test/c/statement.c:342:         vec_u[vec_i] = vec_i * 71 % 256;
+  mov rdx, rdi
+  imul rdx, 71
+  mov rbx, rdx
+  sar rbx, 63
+  shr rbx, 56
+  mov r12, rdx
+  add r12, rbx
+  and r12, 18446744073709551360
+  sub rdx, r12
+  mov BYTE PTR [rcx], dl
+.L674:
+  mov rdx, rdi
+  add rdx, 1
+# cast st
+  movsxd rbx, edx
+#test/c/statement.c:340:         vec_a[vec_i] = vec_i * 7919 % 2001 - 1000;
+  mov r12, rbx
+  imul r12, 7919
+  mov r13, r12
+  mov r14, 4720006479629830299
+  mov rax, r13
+  imul r14
+  mov r13, rdx
+  sar r13, 9
+  mov rdx, r13
+  shr rdx, 63
+  add r13, rdx
+  imul r13, 2001
+  sub r12, r13
+  sub r12, 1000
+  mov DWORD PTR [r8 + 4], r12d
+#test/c/statement.c:341:         vec_c[vec_i] = vec_i * 53 % 256 - 128;
+  mov rdx, rbx
+  imul rdx, 53
+  mov r12, rdx
+  sar r12, 63
+  shr r12, 56
+  mov r13, rdx
+  add r13, r12
+  and r13, 18446744073709551360
+  sub rdx, r13
+  sub rdx, 128
+  mov BYTE PTR [r9 + 1], dl
+#test/c/statement.c:342:         vec_u[vec_i] = vec_i * 71 % 256;
+  imul rbx, 71
+  mov rdx, rbx
+  sar rdx, 63
+  shr rdx, 56
+  mov r12, rbx
+  add r12, rdx
+  and r12, 18446744073709551360
+  sub rbx, r12
+  mov BYTE PTR [rcx + 1], bl
+.L675:
+  add rdi, 2
+  add rcx, 2
+  add r9, 2
+  add r8, 8
+# cast st
+  movsxd rdx, edi
+  mov rdi, rdx
+  jmp .L672
+.L673:
+.L671:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea rbx, [rbp - 1160]
+  lea r12, [rbp - 760]
+  lea r13, [rbp - 756]
+  mov rdi, rbx
+  mov rsi, r13
+  mov rdx, 37
+  mov rcx, 5
+  call vec_map
+  mov r8, rax
+  cmp r8, 18446744073492052343
+  je .L677
+.L676:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L677:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, r12
+  mov rdx, 0
+  mov rcx, 5
+  call vec_map
+  mov r8, rax
+  test r8, r8
+  je .L679
+.L678:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L679:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 748]
+  mov rdi, r8
+  mov rsi, 50
+  call vec_sum
+  mov r8, rax
+  cmp r8, 1209
+  je .L681
+.L680:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L681:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, 3
+  call vec_sum
+  mov r8, rax
+  cmp r8, 747
+  je .L683
+.L682:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L683:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea rbx, [rbp - 1260]
+  lea r8, [rbp - 1259]
+  mov rdi, r8
+  mov rsi, 70
+  call vec_csum
+  mov r8, rax
+  cmp r8, 18446744073709551225
+  je .L685
+.L684:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L685:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1360]
+  mov rdi, r8
+  mov rsi, 70
+  call vec_ucsum
+  mov r8, rax
+  cmp r8, 8905
+  je .L687
+.L686:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L687:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 752]
+  mov rdi, r8
+  mov rsi, 60
+  call vec_min
+  mov r8, rax
+  cmp r8, 18446744073709550623
+  je .L689
+.L688:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L689:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, 0
+  call vec_min
+  mov r8, rax
+  cmp r8, 10000
+  je .L691
+.L690:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L691:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r12
+  mov rsi, 60
+  call vec_max
+  mov r8, rax
+  cmp r8, 962
+  je .L693
+.L692:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L693:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, rbx
+  mov rsi, 70
+  call vec_cmin
+  mov r8, rax
+  cmp r8, 18446744073709551488
+  je .L695
+.L694:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L695:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1355]
+  mov rdi, r8
+  mov rsi, 64
+  call vec_ucmax
+  mov r8, rax
+  cmp r8, 254
+  je .L697
+.L696:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L697:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, r13
+  mov rsi, r12
+  mov rdx, 40
+  call vec_overlap
+  mov r8, rax
+  cmp r8, 18446744073709550656
+  je .L699
+.L698:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L699:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 680], -980
+  je .L701
+.L700:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L701:
+#test/c/statement.c:358:     printf("test of label and goto..\n");
+  lea r8, [ rip + .LSTR16 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/statement.c:361:     LABEL_TEST_HEAD:
+  mov r8, 0
+.L285:
+#test/c/statement.c:362:     li += 1;
+  add r8, 1
+# cast st
+  movsxd r9, r8d
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+  cmp r9, 10
+  je .L284
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+.L702:
+#test/c/statement.c:363:     if(li == 10) goto LABEL_TEST_END;
+#test/c/statement.c:364:     goto LABEL_TEST_HEAD;
+  mov r8, r9
+  jmp .L285
+.L284:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp r9, 10
+  je .L704
+.L703:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L704:
+#test/c/statement.c:368:     printf("test of expression statement..\n");
+  lea r8, [ rip + .LSTR17 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, 3
+  mov DWORD PTR [rbp - 1376], r8d
+#test/c/statement.c:370:     es * 2 + 1;
+  movsxd r8, DWORD PTR [rbp - 1376]
+#test/c/statement.c:371:     es == 4;
+#test/c/statement.c:372:     (long)es;
+#test/c/statement.c:373:     es++;
+  add r8, 1
+  mov DWORD PTR [rbp - 1376], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 1376], 4
+  je .L706
+.L705:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L706:
+#test/c/statement.c:376:     *esp + 1;
+#test/c/statement.c:377:     count_up() * 2;
+#test/c/statement.c:386:     up_count++;
+  movsxd r8, DWORD PTR [rip + up_count]
+  add r8, 1
+  mov DWORD PTR [rip + up_count], r8d
+#test/c/statement.c:387:     return up_count;
+  movsxd r8, DWORD PTR [rip + up_count]
+.L707:
+#test/c/statement.c:378:     count_up() + es;
+#test/c/statement.c:386:     up_count++;
+  add r8, 1
+  mov DWORD PTR [rip + up_count], r8d
+#test/c/statement.c:387:     return up_count;
+  movsxd r8, DWORD PTR [rip + up_count]
+.L708:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/statement.c:386:     up_count++;
+  add r8, 1
+  mov DWORD PTR [rip + up_count], r8d
+#test/c/statement.c:387:     return up_count;
+  movsxd r8, DWORD PTR [rip + up_count]
+# cast st
+  movsxd r8, r8d
+.L711:
+  cmp r8, 3
+  je .L710
+.L709:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L710:
+#test/c/statement.c:381:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_statement:
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
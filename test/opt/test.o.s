@@ -0,0 +1,86 @@
+.intel_syntax noprefix
+.global main
+.global test_extern_int
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test is complete!!!\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "mcc2 test...\n\n"
+  .bss
+  .align 4
+test_extern_int:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# main
+#	 stack size: 0
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+#test/c/test.c:6:     printf("mcc2 test...\n\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/test.c:8:     test_extern_int = 10;
+  mov r8, 10
+  mov DWORD PTR [rip + test_extern_int], r8d
+#test/c/test.c:9:     test_static = 20;
+  mov r8, 20
+  mov DWORD PTR [rip + .Ltest_static], r8d
+#test/c/test.c:11:     test_expression();
+  call test_expression
+  mov r8, rax
+#test/c/test.c:12:     test_statement();
+  call test_statement
+  mov r8, rax
+#test/c/test.c:13:     test_variable();
+  call test_variable
+  mov r8, rax
+#test/c/test.c:14:     test_type();
+  call test_type
+  mov r8, rax
+#test/c/test.c:15:     test_primary();
+  call test_primary
+  mov r8, rax
+#test/c/test.c:16:     test_pointer();
+  call test_pointer
+  mov r8, rax
+#test/c/test.c:17:     test_assignment();
+  call test_assignment
+  mov r8, rax
+#test/c/test.c:18:     test_preprocess();
+  call test_preprocess
+  mov r8, rax
+#test/c/test.c:19:     test_cast();
+  call test_cast
+  mov r8, rax
+#test/c/test.c:20:     test_function();
+  call test_function
+  mov r8, rax
+#test/c/test.c:21:     test_varg();
+  call test_varg
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + .Ltest_static], 20
+  je .L1
+.L0:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L1:
+#test/c/test.c:25:     printf("test is complete!!!\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/test.c:26:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_main:
+  pop rbp
+  ret
@@ -0,0 +1,921 @@
+.intel_syntax noprefix
+.global test_type
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR15:
+  .string "test of _Alignof..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR14:
+  .string "test of struct alignment..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR13:
+  .string "test of struct copy..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR12:
+  .string "test of _Bool...\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR11:
+  .string "test of imcomplete enum..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR10:
+  .string "test of imcomplete struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of type qualifier..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of enum..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of union..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of struct pointer..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of struct of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of struct..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "test of long type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "test of int type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of short type..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of char type..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# test_type
+#	 stack size: 1288
+#	 along( ofs: 1288, size: 8) : level0
+#	 apad( ofs: 1273, size: 1) : level0
+#	 au( ofs: 1272, size: 8) : level0
+#	 al1s( ofs: 1264, size: 24) : level0
+#	 al4( ofs: 1240, size: 24) : level0
+#	 al3( ofs: 1212, size: 20) : level0
+#	 al2( ofs: 1192, size: 24) : level0
+#	 al1( ofs: 1168, size: 8) : level0
+#	 s384( ofs: 1160, size: 384) : level0
+#	 s36( ofs: 776, size: 40) : level0
+#	 s15( ofs: 730, size: 15) : level0
+#	 s3( ofs: 715, size: 3) : level0
+#	 w384( ofs: 712, size: 400) : level0
+#	 w36( ofs: 312, size: 56) : level0
+#	 w15( ofs: 250, size: 17) : level0
+#	 w3( ofs: 233, size: 5) : level0
+#	 okng( ofs: 228, size: 4) : level0
+#	 b( ofs: 221, size: 1) : level0
+#	 ime( ofs: 220, size: 4) : level0
+#	 ims( ofs: 216, size: 8) : level0
+#	 volatile_b( ofs: 208, size: 4) : level0
+#	 const_a( ofs: 204, size: 4) : level0
+#	 ts( ofs: 200, size: 8) : level0
+#	 ddd2( ofs: 192, size: 4) : level0
+#	 ddd( ofs: 188, size: 4) : level0
+#	 test_union( ofs: 184, size: 4) : level0
+#	 s( ofs: 180, size: 4) : level0
+#	 sptr( ofs: 176, size: 8) : level0
+#	 abc_struct_2( ofs: 168, size: 8) : level0
+#	 abc_struct_1( ofs: 160, size: 8) : level0
+#	 struct_array( ofs: 152, size: 40) : level0
+#	 test_struct_struct( ofs: 112, size: 8) : level0
+#	 test_strcut( ofs: 104, size: 8) : level0
+#	 lp( ofs: 96, size: 8) : level0
+#	 larr( ofs: 88, size: 24) : level0
+#	 l( ofs: 64, size: 8) : level0
+#	 ip( ofs: 56, size: 8) : level0
+#	 iarr( ofs: 48, size: 12) : level0
+#	 i( ofs: 36, size: 4) : level0
+#	 sp( ofs: 32, size: 8) : level0
+#	 sarr( ofs: 24, size: 6) : level0
+#	 s( ofs: 18, size: 2) : level0
+#	 cp( ofs: 16, size: 8) : level0
+#	 carr( ofs: 4, size: 3) : level0
+#	 c( ofs: 1, size: 1) : level0
+  .text
+test_type:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 1296
+  push rbx
+  push r12
+#test/c/type.c:4:     printf("test of char type..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/type.c:5:     char c; c = 5;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L1:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L3:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L5:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L7:
+#test/c/type.c:13:     printf("test of short type..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/type.c:14:     short s; s = 7;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L9:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L11:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L13:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L15:
+#test/c/type.c:22:     printf("test of int type..\n");
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/type.c:23:     int i; i = 17;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L17:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L19:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L21:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L23:
+#test/c/type.c:31:     printf("test of long type..\n");
+  lea r8, [ rip + .LSTR3 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/type.c:32:     long l; l = 17;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L25:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L27:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L29:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L31:
+#test/c/type.c:40:     printf("test of struct..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:46:     test_strcut.c = 1;
+  mov r8, 1
+  mov BYTE PTR [rbp - 104], r8b
+#test/c/type.c:47:     test_strcut.s = 2;
+  mov r8, 2
+  mov WORD PTR [rbp - 102], r8w
+#test/c/type.c:48:     test_strcut.i = 3;
+  mov r8, 3
+  mov DWORD PTR [rbp - 100], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 104], 1
+  je .L33
+.L32:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L33:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 102], 2
+  je .L35
+.L34:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L35:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 100], 3
+  je .L37
+.L36:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L37:
+#test/c/type.c:53:     printf("test of struct of struct..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:61:     test_struct_struct.ss.c = 8;
+  mov r8, 8
+  mov BYTE PTR [rbp - 112], r8b
+#test/c/type.c:62:     test_struct_struct.ss.s = 9;
+  mov r8, 9
+  mov WORD PTR [rbp - 110], r8w
+#test/c/type.c:63:     test_struct_struct.ss.i = 10;
+  mov r8, 10
+  mov DWORD PTR [rbp - 108], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 112], 8
+  je .L39
+.L38:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L39:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 110], 9
+  je .L41
+.L40:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L41:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 108], 10
+  je .L43
+.L42:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L43:
+#test/c/type.c:72:     struct_array[5].c = 10;
+  mov r8, 10
+  mov BYTE PTR [rbp - 132], r8b
+#test/c/type.c:73:     struct_array[5].s = 235;
+  mov r8, 235
+  mov WORD PTR [rbp - 130], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 132], 10
+  je .L45
+.L44:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L45:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 130], 235
+  je .L47
+.L46:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L47:
+#test/c/type.c:82:     abc_struct_2.a = 10;
+  mov r8, 10
+  mov DWORD PTR [rbp - 168], r8d
+#test/c/type.c:83:     abc_struct_2.s = 34;
+  mov r8, 34
+  mov WORD PTR [rbp - 164], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 168], 10
+  je .L49
+.L48:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L49:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 164], 34
+  je .L51
+.L50:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L51:
+#test/c/type.c:91:     printf("test of struct pointer..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:94:     sptr = &s;
+#test/c/type.c:95:     sptr->sss = 100;
+  mov r8, 100
+  mov DWORD PTR [rbp - 180], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 180], 100
+  je .L53
+.L52:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L53:
+#test/c/type.c:98:     printf("test of union..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:104:     test_union.c = 1;
+  mov r8, 1
+  mov BYTE PTR [rbp - 184], r8b
+#test/c/type.c:105:     test_union.s = 2;
+  mov r8, 2
+  mov WORD PTR [rbp - 184], r8w
+#test/c/type.c:106:     test_union.i = 3;
+  mov r8, 3
+  mov DWORD PTR [rbp - 184], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 184], 3
+  je .L55
+.L54:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L55:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 184], 3
+  je .L57
+.L56:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L57:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 184], 3
+  je .L59
+.L58:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L59:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L61:
+#test/c/type.c:112:     printf("test of enum..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L69:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L81:
+#test/c/type.c:145:     ts.a = 10;
+  mov r8, 10
+  mov DWORD PTR [rbp - 200], r8d
+#test/c/type.c:146:     ts.s = 20;
+  mov r8, 20
+  mov WORD PTR [rbp - 196], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 200], 10
+  je .L83
+.L82:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L83:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rbp - 196], 20
+  je .L85
+.L84:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L85:
+#test/c/type.c:150:     printf("test of type qualifier..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:156:     printf("test of imcomplete struct..\n");
+  lea r8, [ rip + .LSTR10 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:164:     ims.a = 10;
+  mov r8, 10
+  mov DWORD PTR [rbp - 216], r8d
+#test/c/type.c:165:     ims.s = 20;
+  mov r8, 20
+  mov WORD PTR [rbp - 212], r8w
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 216], 10
+  je .L87
+.L86:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L87:
+#test/c/type.c:168:     printf("test of imcomplete enum..\n");
+  lea r8, [ rip + .LSTR11 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/type.c:177:     ime = B;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L89:
+#test/c/type.c:180:     printf("test of _Bool...\n");
+  lea r8, [ rip + .LSTR12 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L93:
+#test/c/type.c:186:     if(b)
+#test/c/type.c:187:         okng = 1;
+.L94:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L96:
+#test/c/type.c:190:     b = 5;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L98:
+#test/c/type.c:192:     b = 0;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L100:
+#test/c/type.c:194:     b = -1;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L102:
+#test/c/type.c:197:     printf("test of struct copy..\n");
+  lea r8, [ rip + .LSTR13 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/type.c:213:     w3.pre = 1; w3.post = 2;
+  mov r8, 1
+  mov BYTE PTR [rbp - 233], r8b
+#test/c/type.c:213:     w3.pre = 1; w3.post = 2;
+  mov r8, 2
+  mov BYTE PTR [rbp - 229], r8b
+#test/c/type.c:214:     w15.pre = 3; w15.post = 4;
+  mov r8, 3
+  mov BYTE PTR [rbp - 250], r8b
+#test/c/type.c:214:     w15.pre = 3; w15.post = 4;
+  mov r8, 4
+  mov BYTE PTR [rbp - 234], r8b
+#test/c/type.c:215:     w36.pre = 5; w36.post = 6;
+  mov r8, 5
+  mov BYTE PTR [rbp - 312], r8b
+#test/c/type.c:215:     w36.pre = 5; w36.post = 6;
+  mov r8, 6
+  mov BYTE PTR [rbp - 264], r8b
+#test/c/type.c:216:     w384.pre = 7; w384.post = 8;
+  mov r8, 7
+  mov BYTE PTR [rbp - 712], r8b
+#test/c/type.c:216:     w384.pre = 7; w384.post = 8;
+  mov r8, 8
+  mov BYTE PTR [rbp - 320], r8b
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  lea r9, [rbp - 715]
+  mov r8, 30
+  mov BYTE PTR [rbp - 715], r8b
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  mov r8, 3
+  mov BYTE PTR [rbp - 714], r8b
+#test/c/type.c:217:     s3.a = 30; s3.b = 3; s3.c = 33;
+  mov r8, 33
+  mov BYTE PTR [rbp - 713], r8b
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  lea rcx, [rbp - 730]
+  mov r8, 15
+  mov BYTE PTR [rbp - 730], r8b
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  mov r8, 50
+  mov BYTE PTR [rbp - 729], r8b
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  mov r8, 12
+  mov BYTE PTR [rbp - 717], r8b
+#test/c/type.c:218:     s15.a = 15; s15.b[0] = 50; s15.b[12] = 12; s15.d = 5;
+  mov r8, 5
+  mov BYTE PTR [rbp - 716], r8b
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  lea rdx, [rbp - 776]
+  mov QWORD PTR [rbp - 776], 3600
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  mov QWORD PTR [rbp - 752], 360
+#test/c/type.c:219:     s36.x.a = 3600; s36.x.d = 360; s36.y = 36;
+  mov r8, 36
+  mov DWORD PTR [rbp - 744], r8d
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  lea rbx, [rbp - 1160]
+  mov QWORD PTR [rbp - 1160], 384
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  mov QWORD PTR [rbp - 960], 38
+#test/c/type.c:220:     s384.a.a.a = 384; s384.b.c.b = 38; s384.c.d.d = 4;
+  mov r8, 4
+  mov QWORD PTR [rbp - 784], r8
+#test/c/type.c:221:     w3.v = s3;
+  lea rsi, [rbp - 232]
+  mov r8w, WORD PTR [r9 + 0]
+  mov WORD PTR [rsi + 0], r8w
+  mov r8b, BYTE PTR [r9 + 2]
+  mov BYTE PTR [rsi + 2], r8b
+#test/c/type.c:222:     w15.v = s15;
+  lea r9, [rbp - 249]
+  mov r8, QWORD PTR [rcx + 0]
+  mov QWORD PTR [r9 + 0], r8
+  mov r8d, DWORD PTR [rcx + 8]
+  mov DWORD PTR [r9 + 8], r8d
+  mov r8w, WORD PTR [rcx + 12]
+  mov WORD PTR [r9 + 12], r8w
+  mov r8b, BYTE PTR [rcx + 14]
+  mov BYTE PTR [r9 + 14], r8b
+#test/c/type.c:223:     w36.v = s36;
+  lea r9, [rbp - 304]
+  movdqu xmm15, XMMWORD PTR [rdx + 0]
+  movdqu XMMWORD PTR [r9 + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [rdx + 16]
+  movdqu XMMWORD PTR [r9 + 16], xmm15
+  movdqu xmm15, XMMWORD PTR [rdx + 24]
+  movdqu XMMWORD PTR [r9 + 24], xmm15
+#test/c/type.c:224:     w384.v = s384;
+  lea r9, [rbp - 704]
+  mov rdi, r9
+  mov rsi, rbx
+  mov ecx, 384
+  rep movsb
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L104:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L106:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 232], 30
+  je .L108
+.L107:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L108:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 231], 3
+  je .L110
+.L109:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L110:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 230], 33
+  je .L112
+.L111:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L112:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 249], 15
+  je .L114
+.L113:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L114:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 248], 50
+  je .L116
+.L115:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L116:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 236], 12
+  je .L118
+.L117:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L118:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rbp - 235], 5
+  je .L120
+.L119:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L120:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 304], 3600
+  je .L122
+.L121:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L122:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 280], 360
+  je .L124
+.L123:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L124:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 272], 36
+  je .L126
+.L125:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L126:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 704], 384
+  je .L128
+.L127:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L128:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 504], 38
+  je .L130
+.L129:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L130:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rbp - 328], 4
+  je .L132
+.L131:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L132:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsx r8, BYTE PTR [rbp - 233]
+  movsx r9, BYTE PTR [rbp - 229]
+  lea r9, [r9 + r9 * 4]
+  lea r8, [r8 + r9 * 2]
+  cmp r8, 21
+  je .L134
+.L133:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L134:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsx r8, BYTE PTR [rbp - 250]
+  movsx r9, BYTE PTR [rbp - 234]
+  lea r9, [r9 + r9 * 4]
+  lea r8, [r8 + r9 * 2]
+  cmp r8, 43
+  je .L136
+.L135:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L136:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsx r8, BYTE PTR [rbp - 312]
+  movsx r9, BYTE PTR [rbp - 264]
+  lea r9, [r9 + r9 * 4]
+  lea r8, [r8 + r9 * 2]
+  cmp r8, 65
+  je .L138
+.L137:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L138:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsx r8, BYTE PTR [rbp - 712]
+  movsx r9, BYTE PTR [rbp - 320]
+  lea r9, [r9 + r9 * 4]
+  lea r8, [r8 + r9 * 2]
+  cmp r8, 87
+  je .L140
+.L139:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L140:
+#test/c/type.c:245:     printf("test of struct alignment..\n");
+  lea r8, [ rip + .LSTR14 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L142:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1168]
+  lea r9, [rbp - 1164]
+# cast st
+# cast st
+  sub r9, r8
+  cmp r9, 4
+  je .L144
+.L143:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L144:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L146:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1192]
+  lea r9, [rbp - 1184]
+# cast st
+# cast st
+  mov rbx, r8
+  sub r9, rbx
+  cmp r9, 8
+  je .L148
+.L147:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L148:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1176]
+# cast st
+  sub r8, rbx
+  cmp r8, 16
+  je .L150
+.L149:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L150:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L152:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1212]
+  lea r9, [rbp - 1208]
+  add r9, 0
+# cast st
+# cast st
+  mov r12, r8
+  sub r9, r12
+  cmp r9, 4
+  je .L154
+.L153:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L154:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1196]
+# cast st
+  sub r8, r12
+  cmp r8, 16
+  je .L156
+.L155:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L156:
+#test/c/type.c:257:     al3.a[2] = 32; al3.d = 3;
+  mov r8, 32
+  mov DWORD PTR [rbp - 1200], r8d
+#test/c/type.c:257:     al3.a[2] = 32; al3.d = 3;
+  mov r8, 3
+  mov BYTE PTR [rbp - 1196], r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 1200]
+  lea r8, [r8 + r8 * 4]
+  movsx r9, BYTE PTR [rbp - 1196]
+  lea r8, [r9 + r8 * 2]
+  cmp r8, 323
+  je .L158
+.L157:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L158:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L160:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1240]
+  lea r9, [rbp - 1232]
+  add r9, 8
+# cast st
+# cast st
+  sub r9, r8
+  cmp r9, 16
+  je .L162
+.L161:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L162:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L164:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1248]
+# cast st
+  lea r9, [rbp - 1264]
+# cast st
+  sub r8, r9
+  cmp r8, 16
+  je .L166
+.L165:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L166:
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  mov r8, 1
+  mov BYTE PTR [rbp - 1256], r8b
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  mov r8, 11
+  mov DWORD PTR [rbp - 1252], r8d
+#test/c/type.c:265:     al1s[1].c = 1; al1s[1].i = 11; al1s[2].c = 2;
+  mov r8, 2
+  mov BYTE PTR [rbp - 1248], r8b
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rbp - 1252]
+  lea r8, [r8 + r8 * 4]
+  movsx r9, BYTE PTR [rbp - 1256]
+  lea r8, [r9 + r8 * 2]
+  movsx r9, BYTE PTR [rbp - 1248]
+  add r8, r9
+  cmp r8, 113
+  je .L168
+.L167:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L168:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L170:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  lea r8, [rbp - 1288]
+# cast st
+  mov r9, r8
+  sar r9, 63
+  shr r9, 61
+  mov rcx, r8
+  add rcx, r9
+  and rcx, 18446744073709551608
+  sub r8, rcx
+  test r8, r8
+  je .L172
+.L171:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L172:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, rbx
+  sar r8, 63
+  shr r8, 61
+  mov r9, rbx
+  add r9, r8
+  and r9, 18446744073709551608
+  sub rbx, r9
+  test rbx, rbx
+  je .L174
+.L173:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L174:
+#test/c/type.c:274:     printf("test of _Alignof..\n");
+  lea r8, [ rip + .LSTR15 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L176:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L178:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L180:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L182:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L184:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L186:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L188:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L190:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L192:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L194:
+#test/c/type.c:286:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_type:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,250 @@
+.intel_syntax noprefix
+.global vafuncstr
+.global vafunc
+.global test_varg
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "d"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "c"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "b"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "a"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "%s %s %s %s\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "%d %d %d %d\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "test of varg with string..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "test of varg..\n"
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# vafuncstr
+#	 stack size: 168
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 144, size: 136) : level0
+#	 fmt( ofs: 8, size: 8) : level0
+  .text
+vafuncstr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov DWORD PTR [rbp - 144], 8
+  mov DWORD PTR [rbp - 144 + 4], 48
+  lea rax, [rbp - 144 + 16]
+  mov QWORD PTR [rbp - 144 + 8], rax
+  lea rax, [rbp - 144 + 24]
+  mov QWORD PTR [rbp - 144 + 16], rax
+  mov QWORD PTR [rbp - 144 + 24], rdi
+  mov QWORD PTR [rbp - 144 + 32], rsi
+  mov QWORD PTR [rbp - 144 + 40], rdx
+  mov QWORD PTR [rbp - 144 + 48], rcx
+  mov QWORD PTR [rbp - 144 + 56], r8
+  mov QWORD PTR [rbp - 144 + 64], r9
+  movsd QWORD PTR [rbp - 144 + 72], xmm0
+  movsd QWORD PTR [rbp - 144 + 80], xmm1
+  movsd QWORD PTR [rbp - 144 + 88], xmm2
+  movsd QWORD PTR [rbp - 144 + 96], xmm3
+  movsd QWORD PTR [rbp - 144 + 104], xmm4
+  movsd QWORD PTR [rbp - 144 + 112], xmm5
+  movsd QWORD PTR [rbp - 144 + 120], xmm6
+  movsd QWORD PTR [rbp - 144 + 128], xmm7
+  mov r9, rdi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea rcx, [rbp - 144]
+  lea rdx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [rcx + 0]
+  movdqu XMMWORD PTR [rdx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [rcx + 8]
+  movdqu XMMWORD PTR [rdx + 8], xmm15
+#test/c/varg.c:18:     vprintf(fmt, ap);
+  mov rdi, r9
+  mov rsi, rdx
+  call vprintf
+  mov r8, rax
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+ret_vafuncstr:
+  mov rsp, rbp
+  pop rbp
+  ret
+# vafunc
+#	 stack size: 180
+#	 i( ofs: 176, size: 4) : level0
+#	 sum( ofs: 172, size: 4) : level0
+#	 ap( ofs: 168, size: 24) : level0
+#	 __va_area__( ofs: 140, size: 136) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+vafunc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov DWORD PTR [rbp - 140], 8
+  mov DWORD PTR [rbp - 140 + 4], 48
+  lea rax, [rbp - 140 + 16]
+  mov QWORD PTR [rbp - 140 + 8], rax
+  lea rax, [rbp - 140 + 24]
+  mov QWORD PTR [rbp - 140 + 16], rax
+  mov QWORD PTR [rbp - 140 + 24], rdi
+  mov QWORD PTR [rbp - 140 + 32], rsi
+  mov QWORD PTR [rbp - 140 + 40], rdx
+  mov QWORD PTR [rbp - 140 + 48], rcx
+  mov QWORD PTR [rbp - 140 + 56], r8
+  mov QWORD PTR [rbp - 140 + 64], r9
+  movsd QWORD PTR [rbp - 140 + 72], xmm0
+  movsd QWORD PTR [rbp - 140 + 80], xmm1
+  movsd QWORD PTR [rbp - 140 + 88], xmm2
+  movsd QWORD PTR [rbp - 140 + 96], xmm3
+  movsd QWORD PTR [rbp - 140 + 104], xmm4
+  movsd QWORD PTR [rbp - 140 + 112], xmm5
+  movsd QWORD PTR [rbp - 140 + 120], xmm6
+  movsd QWORD PTR [rbp - 140 + 128], xmm7
+  movsxd r9, edi
+#test/c/../../src/mcc2_lib.h:54: #define va_start(ap, param) __builtin_va_start(ap, param)
+  lea rcx, [rbp - 140]
+  lea rdx, [rbp - 168]
+  movdqu xmm15, XMMWORD PTR [rcx + 0]
+  movdqu XMMWORD PTR [rdx + 0], xmm15
+  movdqu xmm15, XMMWORD PTR [rcx + 8]
+  movdqu XMMWORD PTR [rdx + 8], xmm15
+#test/c/varg.c:8:     for (int i = 0; i < a; i++){
+  mov r8, 0
+  mov rcx, 0
+.L1:
+  mov rdx, rcx
+  add rdx, 1
+  cmp rdx, r9
+  jge .L9
+#test/c/varg.c:9:         sum += va_arg(ap, int);
+  mov edx, DWORD PTR [rbp - 168]
+  add rdx, 8
+  mov DWORD PTR [rbp - 168], edx
+  mov rdx, QWORD PTR [rbp - 152]
+  mov esi, DWORD PTR [rbp - 168]
+  mov rdi, rsi
+  sub rdi, 8
+  add r8, QWORD PTR [rdx + rdi * 1]
+# cast st
+  movsxd rdx, r8d
+.L3:
+#test/c/varg.c:9:         sum += va_arg(ap, int);
+  add rsi, 8
+  mov DWORD PTR [rbp - 168], esi
+  mov rsi, QWORD PTR [rbp - 152]
+  mov edi, DWORD PTR [rbp - 168]
+  sub rdi, 8
+  add rdx, QWORD PTR [rsi + rdi * 1]
+# cast st
+  movsxd r8, edx
+.L4:
+  add rcx, 2
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L1
+.L9:
+.L2:
+.L5:
+  cmp rcx, r9
+  jge .L0
+#test/c/varg.c:9:         sum += va_arg(ap, int);
+  mov edx, DWORD PTR [rbp - 168]
+  add rdx, 8
+  mov DWORD PTR [rbp - 168], edx
+  mov rdx, QWORD PTR [rbp - 152]
+  mov esi, DWORD PTR [rbp - 168]
+  sub rsi, 8
+  add r8, QWORD PTR [rdx + rsi * 1]
+# cast st
+  movsxd rdx, r8d
+.L6:
+  add rcx, 1
+# cast st
+  movsxd rsi, ecx
+  mov r8, rdx
+  mov rcx, rsi
+  jmp .L5
+.L0:
+#test/c/../../src/mcc2_lib.h:55: #define va_end(ap)          __builtin_va_end(ap)
+#test/c/varg.c:12:     return sum;
+  mov rax, r8
+ret_vafunc:
+  mov rsp, rbp
+  pop rbp
+  ret
+# test_varg
+#	 stack size: 0
+  .text
+test_varg:
+  push rbp
+  mov rbp, rsp
+  push rbx
+  push r12
+#test/c/varg.c:23:     printf("test of varg..\n");
+  lea r8, [ rip + .LSTR0 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 3
+  mov rsi, 1
+  mov rdx, 2
+  mov rcx, 3
+  mov eax, 0
+  call vafunc
+  mov r8, rax
+  cmp r8, 6
+  je .L8
+.L7:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L8:
+#test/c/varg.c:26:     printf("test of varg with string..\n");
+  lea r8, [ rip + .LSTR1 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/varg.c:27:     vafuncstr("%d %d %d %d\n", 1, 2, 3, 4);
+  lea r8, [ rip + .LSTR2 ]
+  mov rdi, r8
+  mov rsi, 1
+  mov rdx, 2
+  mov rcx, 3
+  mov r8, 4
+  mov eax, 0
+  call vafuncstr
+#test/c/varg.c:28:     vafuncstr("%s %s %s %s\n", "a", "b", "c", "d");
+  lea r8, [ rip + .LSTR3 ]
+  lea r9, [ rip + .LSTR4 ]
+  lea rcx, [ rip + .LSTR5 ]
+  lea rbx, [ rip + .LSTR6 ]
+  lea r12, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov rsi, r9
+  mov rdx, rcx
+  mov rcx, rbx
+  mov r8, r12
+  mov eax, 0
+  call vafuncstr
+#test/c/varg.c:29:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_varg:
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
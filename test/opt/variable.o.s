@@ -0,0 +1,1216 @@
+.intel_syntax noprefix
+.global init_counter
+.global init_u
+.global init_member
+.global init_names
+.global init_table
+.global init_shape
+.global init_pt
+.global init_elem
+.global init_ptr
+.global init_exact
+.global init_str
+.global init_unsized
+.global init_arr
+.global init_short
+.global init_char
+.global init_neg
+.global init_int
+.global many_live_values
+.global swap_loop
+.global narrow_arg
+.global narrow_char
+.global sum_to
+.global test_global_variable
+.global g_b
+.global g_a
+.global test_variable
+  .data
+  .align 4
+.Lcount.0:
+  .long 10
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR9:
+  .string "test of assignment..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR8:
+  .string "test of static initializer..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR7:
+  .string "test of local variable in register..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR6:
+  .string "test of array..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR5:
+  .string "test of global variable..\n"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR4:
+  .string "test of local variable..\n"
+  .data
+  .align 8
+init_u:
+  .quad 258
+  .data
+  .align 8
+init_member:
+  .quad init_pt+8
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR3:
+  .string "two"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR2:
+  .string "one"
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR1:
+  .string "zero"
+  .data
+  .align 8
+init_names:
+  .quad .LSTR1
+  .quad .LSTR2
+  .quad .LSTR3
+  .section .rodata
+  .align 4
+init_table:
+  .quad 25769803781
+  .long 7
+  .data
+  .align 8
+init_shape:
+  .quad 3
+  .quad 4294967393
+  .quad 2
+  .quad 12884901986
+  .quad 4
+  .quad 29043
+  .data
+  .align 8
+init_pt:
+  .quad 30064771194
+  .quad 99
+  .data
+  .align 8
+init_elem:
+  .quad init_arr+8
+  .section .rodata.str1.1,"aMS",@progbits,1
+.LSTR0:
+  .string "pooled"
+  .data
+  .align 8
+init_ptr:
+  .quad .LSTR0
+  .data
+  .align 1
+init_exact:
+  .long 1684234849
+  .data
+  .align 1
+init_str:
+  .quad 2933962507381096
+  .data
+  .align 4
+init_unsized:
+  .quad 85899345930
+  .quad 171798691870
+  .data
+  .align 4
+init_arr:
+  .quad 8589934593
+  .quad 3
+  .long 0
+  .data
+  .align 2
+init_short:
+  .short 3000
+  .data
+  .align 1
+init_char:
+  .byte 65
+  .data
+  .align 8
+init_neg:
+  .quad 18446744073709551611
+  .data
+  .align 4
+init_int:
+  .long 42
+  .bss
+  .align 4
+g_b:
+  .zero 4
+  .bss
+  .align 4
+g_a:
+  .zero 4
+  .bss
+  .align 4
+.Ltest_static:
+  .zero 4
+# init_counter
+#	 stack size: 4
+  .text
+init_counter:
+  push rbp
+  mov rbp, rsp
+#test/c/variable.c:129:     count++;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+  add r8, 1
+  mov DWORD PTR [rip + .Lcount.0], r8d
+#test/c/variable.c:130:     return count;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+  mov rax, r8
+ret_init_counter:
+  pop rbp
+  ret
+# many_live_values
+#	 stack size: 152
+#	 i( ofs: 148, size: 4) : level0
+#	 sum( ofs: 144, size: 4) : level0
+#	 a33( ofs: 140, size: 4) : level0
+#	 a32( ofs: 136, size: 4) : level0
+#	 a31( ofs: 132, size: 4) : level0
+#	 a30( ofs: 128, size: 4) : level0
+#	 a29( ofs: 124, size: 4) : level0
+#	 a28( ofs: 120, size: 4) : level0
+#	 a27( ofs: 116, size: 4) : level0
+#	 a26( ofs: 112, size: 4) : level0
+#	 a25( ofs: 108, size: 4) : level0
+#	 a24( ofs: 104, size: 4) : level0
+#	 a23( ofs: 100, size: 4) : level0
+#	 a22( ofs: 96, size: 4) : level0
+#	 a21( ofs: 92, size: 4) : level0
+#	 a20( ofs: 88, size: 4) : level0
+#	 a19( ofs: 84, size: 4) : level0
+#	 a18( ofs: 80, size: 4) : level0
+#	 a17( ofs: 76, size: 4) : level0
+#	 a16( ofs: 72, size: 4) : level0
+#	 a15( ofs: 68, size: 4) : level0
+#	 a14( ofs: 64, size: 4) : level0
+#	 a13( ofs: 60, size: 4) : level0
+#	 a12( ofs: 56, size: 4) : level0
+#	 a11( ofs: 52, size: 4) : level0
+#	 a10( ofs: 48, size: 4) : level0
+#	 a9( ofs: 44, size: 4) : level0
+#	 a8( ofs: 40, size: 4) : level0
+#	 a7( ofs: 36, size: 4) : level0
+#	 a6( ofs: 32, size: 4) : level0
+#	 a5( ofs: 28, size: 4) : level0
+#	 a4( ofs: 24, size: 4) : level0
+#	 a3( ofs: 20, size: 4) : level0
+#	 a2( ofs: 16, size: 4) : level0
+#	 a1( ofs: 12, size: 4) : level0
+#	 a0( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+many_live_values:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 368
+  push rbx
+  push r12
+  push r13
+  push r14
+  push r15
+  movsxd r8, edi
+  mov r9, r8
+  add r9, 0
+# cast st
+  movsxd r9, r9d
+  mov rcx, r8
+  add rcx, 1
+# cast st
+  movsxd rcx, ecx
+  mov rdx, r8
+  add rdx, 2
+# cast st
+  movsxd rdx, edx
+  mov rsi, r8
+  add rsi, 3
+# cast st
+  movsxd rsi, esi
+  mov rdi, r8
+  add rdi, 4
+# cast st
+  movsxd rdi, edi
+  mov rbx, r8
+  add rbx, 5
+# cast st
+  movsxd rbx, ebx
+  mov r12, r8
+  add r12, 6
+# cast st
+  movsxd r10, r12d
+  mov QWORD PTR [rbp - 368], r10
+  mov r13, r8
+  add r13, 7
+# cast st
+  movsxd r13, r13d
+  mov r14, r8
+  add r14, 8
+# cast st
+  movsxd r14, r14d
+  mov r15, r8
+  add r15, 9
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 160], r10
+  mov r15, r8
+  add r15, 10
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 168], r10
+  mov r15, r8
+  add r15, 11
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 176], r10
+  mov r15, r8
+  add r15, 12
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 184], r10
+  mov r15, r8
+  add r15, 13
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 192], r10
+  mov r15, r8
+  add r15, 14
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 200], r10
+  mov r15, r8
+  add r15, 15
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 208], r10
+  mov r15, r8
+  add r15, 16
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 216], r10
+  mov r15, r8
+  add r15, 17
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 224], r10
+  mov r15, r8
+  add r15, 18
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 232], r10
+  mov r15, r8
+  add r15, 19
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 240], r10
+  mov r15, r8
+  add r15, 20
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 248], r10
+  mov r15, r8
+  add r15, 21
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 256], r10
+  mov r15, r8
+  add r15, 22
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 264], r10
+  mov r15, r8
+  add r15, 23
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 272], r10
+  mov r15, r8
+  add r15, 24
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 280], r10
+  mov r15, r8
+  add r15, 25
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 288], r10
+  mov r15, r8
+  add r15, 26
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 296], r10
+  mov r15, r8
+  add r15, 27
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 304], r10
+  mov r15, r8
+  add r15, 28
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 312], r10
+  mov r15, r8
+  add r15, 29
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 320], r10
+  mov r15, r8
+  add r15, 30
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 328], r10
+  mov r15, r8
+  add r15, 31
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 336], r10
+  mov r15, r8
+  add r15, 32
+# cast st
+  movsxd r10, r15d
+  mov QWORD PTR [rbp - 352], r10
+  add r8, 33
+# cast st
+  movsxd r10, r8d
+  mov QWORD PTR [rbp - 344], r10
+#test/c/variable.c:203:     for(int i = 0; i < 2; i++){
+  mov r10, 0
+  mov QWORD PTR [rbp - 360], r10
+  mov r15, 0
+.L0:
+  cmp r15, 2
+  jge .L2
+#test/c/variable.c:204:         sum = sum + a0 + a1 + a2 + a3 + a4 + a5
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, r9
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, rcx
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, rdx
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, rsi
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, rdi
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, rbx
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 368]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, r13
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  add r10, r14
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 160]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 168]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 176]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 184]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 192]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 200]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 208]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 216]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 224]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 232]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 240]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 248]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 256]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 264]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 272]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 280]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 288]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 296]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 304]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 312]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 320]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 328]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 336]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 352]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+  mov r11, QWORD PTR [rbp - 344]
+  add r10, r11
+  mov QWORD PTR [rbp - 360], r10
+  mov r10, QWORD PTR [rbp - 360]
+# cast st
+  movsxd r8, r10d
+.L1:
+  add r15, 1
+# cast st
+  movsxd r12, r15d
+  mov r10, r8
+  mov QWORD PTR [rbp - 360], r10
+  mov r15, r12
+  jmp .L0
+.L2:
+#test/c/variable.c:211:     return sum;
+  mov r10, QWORD PTR [rbp - 360]
+  mov rax, r10
+ret_many_live_values:
+  pop r15
+  pop r14
+  pop r13
+  pop r12
+  pop rbx
+  mov rsp, rbp
+  pop rbp
+  ret
+# swap_loop
+#	 stack size: 16
+#	 t( ofs: 16, size: 4) : level0
+#	 b( ofs: 12, size: 4) : level0
+#	 a( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+swap_loop:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/variable.c:158:     while(n){
+  mov r9, 0
+  mov rcx, 1
+.L3:
+  test r8, r8
+  je .L4
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+#test/c/variable.c:160:         a = b;
+# cast st
+  movsxd r9, ecx
+#test/c/variable.c:161:         b = t;
+# cast st
+  movsxd rcx, edx
+#test/c/variable.c:162:         n = n - 1;
+  sub r8, 1
+# cast st
+  movsxd rdx, r8d
+  mov r8, rdx
+  jmp .L3
+.L4:
+#test/c/variable.c:164:     return a;
+  mov rax, r9
+ret_swap_loop:
+  pop rbp
+  ret
+# narrow_arg
+#	 stack size: 1
+#	 c( ofs: 1, size: 1) : level0
+  .text
+narrow_arg:
+  push rbp
+  mov rbp, rsp
+  movzx r8, dil
+#test/c/variable.c:152:     return c;
+  mov rax, r8
+ret_narrow_arg:
+  pop rbp
+  ret
+# narrow_char
+#	 stack size: 5
+#	 c( ofs: 5, size: 1) : level0
+#	 x( ofs: 4, size: 4) : level0
+  .text
+narrow_char:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+# cast st
+  movsx r8, r8b
+#test/c/variable.c:148:     return c;
+  mov rax, r8
+ret_narrow_char:
+  pop rbp
+  ret
+# sum_to
+#	 stack size: 16
+#	 i( ofs: 12, size: 4) : level0
+#	 sum( ofs: 8, size: 4) : level0
+#	 n( ofs: 4, size: 4) : level0
+  .text
+sum_to:
+  push rbp
+  mov rbp, rsp
+  movsxd r8, edi
+#test/c/variable.c:140:     for(int i = 1; i <= n; i++){
+  mov r9, 0
+  mov rcx, 1
+.L6:
+  mov rdx, rcx
+  add rdx, 3
+  cmp rdx, r8
+  jg .L124
+#test/c/variable.c:141:         sum = sum + i;
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+.L8:
+  mov rsi, rcx
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/variable.c:141:         sum = sum + i;
+  add rdx, rsi
+# cast st
+  movsxd rdx, edx
+.L9:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/variable.c:141:         sum = sum + i;
+  add rdx, rsi
+# cast st
+  movsxd rdx, edx
+.L10:
+  add rsi, 1
+# cast st
+  movsxd rsi, esi
+#test/c/variable.c:141:         sum = sum + i;
+  add rdx, rsi
+# cast st
+  movsxd r9, edx
+.L11:
+  add rcx, 4
+# cast st
+  movsxd rdx, ecx
+  mov rcx, rdx
+  jmp .L6
+.L124:
+.L7:
+.L12:
+  cmp rcx, r8
+  jg .L5
+#test/c/variable.c:141:         sum = sum + i;
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+.L13:
+  add rcx, 1
+# cast st
+  movsxd rsi, ecx
+  mov r9, rdx
+  mov rcx, rsi
+  jmp .L12
+.L5:
+#test/c/variable.c:143:     return sum;
+  mov rax, r9
+ret_sum_to:
+  pop rbp
+  ret
+# test_global_variable
+#	 stack size: 0
+  .text
+test_global_variable:
+  push rbp
+  mov rbp, rsp
+#test/c/variable.c:134:     g_b = 14;
+  mov r8, 14
+  mov DWORD PTR [rip + g_b], r8d
+#test/c/variable.c:135:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_global_variable:
+  pop rbp
+  ret
+# test_variable
+#	 stack size: 72
+#	 a4( ofs: 72, size: 8) : level0
+#	 a3( ofs: 62, size: 2) : level0
+#	 a2( ofs: 60, size: 4) : level0
+#	 a1( ofs: 56, size: 4) : level0
+#	 arr( ofs: 52, size: 44) : level0
+#	 abc( ofs: 8, size: 4) : level0
+#	 a( ofs: 4, size: 4) : level0
+  .text
+test_variable:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+#test/c/variable.c:43:     printf("test of local variable..\n");
+  lea r8, [ rip + .LSTR4 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#test/c/variable.c:44:     int a; a = 15;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L15:
+#test/c/variable.c:47:     int abc; abc = 7;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L17:
+#test/c/variable.c:50:     a = 1;
+#test/c/variable.c:51:     a = a + 3;
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L19:
+#test/c/variable.c:54:     printf("test of global variable..\n");
+  lea r8, [ rip + .LSTR5 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/variable.c:55:     g_a = 8;
+  mov r8, 8
+  mov DWORD PTR [rip + g_a], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + g_a], 8
+  je .L21
+.L20:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L21:
+#test/c/variable.c:58:     test_global_variable();
+#test/c/variable.c:134:     g_b = 14;
+  mov r8, 14
+  mov DWORD PTR [rip + g_b], r8d
+#test/c/variable.c:135:     return 0;
+.L22:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + g_b], 14
+  je .L24
+.L23:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L24:
+#test/c/variable.c:61:     printf("test of array..\n");
+  lea r8, [ rip + .LSTR6 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L26:
+#test/c/variable.c:64:     *arr = 5;
+  mov r8, 5
+  mov DWORD PTR [rbp - 52], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 52], 5
+  je .L28
+.L27:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L28:
+#test/c/variable.c:67:     *(arr + 2) = 7;
+  mov r8, 7
+  mov DWORD PTR [rbp - 50], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 50], 7
+  je .L30
+.L29:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L30:
+#test/c/variable.c:70:     arr[3]= 4;
+  mov r8, 4
+  mov DWORD PTR [rbp - 40], r8d
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rbp - 40], 4
+  je .L32
+.L31:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L32:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + test_extern_int], 10
+  je .L34
+.L33:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L34:
+#test/c/variable.c:81:     test_static = 30;
+  mov r8, 30
+  mov DWORD PTR [rip + .Ltest_static], r8d
+#test/c/variable.c:83:     printf("test of local variable in register..\n");
+  lea r8, [ rip + .LSTR7 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:140:     for(int i = 1; i <= n; i++){
+  mov r8, 0
+  mov r9, 1
+.L39:
+  mov rcx, r9
+  add rcx, 3
+  cmp rcx, 10
+  jg .L125
+#test/c/variable.c:141:         sum = sum + i;
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L41:
+  mov rdx, r9
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/variable.c:141:         sum = sum + i;
+  add rcx, rdx
+# cast st
+  movsxd rcx, ecx
+.L42:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/variable.c:141:         sum = sum + i;
+  add rcx, rdx
+# cast st
+  movsxd rcx, ecx
+.L43:
+  add rdx, 1
+# cast st
+  movsxd rdx, edx
+#test/c/variable.c:141:         sum = sum + i;
+  add rcx, rdx
+# cast st
+  movsxd r8, ecx
+.L44:
+  add r9, 4
+# cast st
+  movsxd rcx, r9d
+  mov r9, rcx
+  jmp .L39
+.L125:
+.L40:
+.L45:
+  cmp r9, 10
+  jg .L38
+#test/c/variable.c:141:         sum = sum + i;
+  add r8, r9
+# cast st
+  movsxd rcx, r8d
+.L46:
+  add r9, 1
+# cast st
+  movsxd rdx, r9d
+  mov r8, rcx
+  mov r9, rdx
+  jmp .L45
+.L38:
+#test/c/variable.c:143:     return sum;
+# cast st
+  movsxd r8, r8d
+.L37:
+  cmp r8, 55
+  je .L36
+.L35:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L36:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:148:     return c;
+.L49:
+.L48:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:152:     return c;
+.L52:
+.L51:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:158:     while(n){
+  mov r8, 6
+  mov r9, 0
+  mov rcx, 1
+.L56:
+  test r8, r8
+  je .L57
+  add r9, rcx
+# cast st
+  movsxd rdx, r9d
+#test/c/variable.c:160:         a = b;
+# cast st
+  movsxd r9, ecx
+#test/c/variable.c:161:         b = t;
+# cast st
+  movsxd rcx, edx
+#test/c/variable.c:162:         n = n - 1;
+  sub r8, 1
+# cast st
+  movsxd rdx, r8d
+  mov r8, rdx
+  jmp .L56
+.L57:
+#test/c/variable.c:164:     return a;
+# cast st
+  movsxd r8, r9d
+.L55:
+  cmp r8, 8
+  je .L54
+.L53:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L54:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov rdi, 1
+  call many_live_values
+  mov r8, rax
+  cmp r8, 1190
+  je .L59
+.L58:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L59:
+#test/c/variable.c:90:     printf("test of static initializer..\n");
+  lea r8, [ rip + .LSTR8 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+  mov r8, rax
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_int], 42
+  je .L61
+.L60:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L61:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rip + init_neg], -5
+  je .L63
+.L62:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L63:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_char], 65
+  je .L65
+.L64:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L65:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp WORD PTR [rip + init_short], 3000
+  je .L67
+.L66:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L67:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  movsxd r8, DWORD PTR [rip + init_arr]
+  movsxd r9, DWORD PTR [rip + init_arr + 8]
+  add r8, r9
+  cmp r8, 4
+  je .L69
+.L68:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L69:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_arr + 16], 0
+  je .L71
+.L70:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L71:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L73:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_unsized + 12], 40
+  je .L75
+.L74:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L75:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+.L77:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_str + 2], 9
+  je .L79
+.L78:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L79:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_str + 7], 0
+  je .L81
+.L80:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L81:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_exact + 3], 100
+  je .L83
+.L82:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L83:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, QWORD PTR [rip + init_ptr]
+  cmp BYTE PTR [r8], 112
+  je .L85
+.L84:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L85:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, QWORD PTR [rip + init_elem]
+  cmp DWORD PTR [r8], 3
+  je .L87
+.L86:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L87:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_pt], 122
+  je .L89
+.L88:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L89:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_pt + 4], 7
+  je .L91
+.L90:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L91:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rip + init_pt + 8], 99
+  je .L93
+.L92:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L93:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_shape], 3
+  je .L95
+.L94:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L95:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rip + init_shape + 16], 2
+  je .L97
+.L96:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L97:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_shape + 24], 98
+  je .L99
+.L98:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L99:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp QWORD PTR [rip + init_shape + 32], 4
+  je .L101
+.L100:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L101:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_shape + 41], 113
+  je .L103
+.L102:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L103:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_shape + 42], 0
+  je .L105
+.L104:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L105:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp DWORD PTR [rip + init_table + 8], 7
+  je .L107
+.L106:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L107:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, QWORD PTR [rip + init_names + 8]
+  cmp BYTE PTR [r8], 111
+  je .L109
+.L108:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L109:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, QWORD PTR [rip + init_names + 16]
+  cmp BYTE PTR [r8 + 1], 119
+  je .L111
+.L110:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L111:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  mov r8, QWORD PTR [rip + init_member]
+  cmp QWORD PTR [r8], 99
+  je .L113
+.L112:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L113:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_u], 2
+  je .L115
+.L114:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L115:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+  cmp BYTE PTR [rip + init_u + 1], 1
+  je .L117
+.L116:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L117:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:129:     count++;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+  add r8, 1
+  mov DWORD PTR [rip + .Lcount.0], r8d
+#test/c/variable.c:130:     return count;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+# cast st
+  movsxd r8, r8d
+.L120:
+  cmp r8, 11
+  je .L119
+.L118:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L119:
+#./test/testinc/testinc.h:13: #define ASSERT(X, Y)    ((X) == (Y) ? 0 : exit(1))
+#test/c/variable.c:129:     count++;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+  add r8, 1
+  mov DWORD PTR [rip + .Lcount.0], r8d
+#test/c/variable.c:130:     return count;
+  movsxd r8, DWORD PTR [rip + .Lcount.0]
+# cast st
+  movsxd r8, r8d
+.L123:
+  cmp r8, 12
+  je .L122
+.L121:
+  mov rdi, 1
+  call exit
+  mov r8, rax
+.L122:
+#test/c/variable.c:123:     printf("test of assignment..\n");
+  lea r8, [ rip + .LSTR9 ]
+  mov rdi, r8
+  mov eax, 0
+  call printf
+#test/c/variable.c:124:     return 0;
+  mov r8, 0
+  mov rax, r8
+ret_test_variable:
+  mov rsp, rbp
+  pop rbp
+  ret